@@ -43,6 +43,16 @@ if (NOT MSVC)
     endif (SUPPORT_COVERAGE)
 endif (NOT MSVC)
 
+# ----- AVX2 CONFIG ----- #
+option(SUPPORT_AVX2 "Build vectorized code paths using AVX2" OFF)
+if (SUPPORT_AVX2)
+    if (MSVC)
+        SET(CMAKE_CXX_FLAGS  "${CMAKE_CXX_FLAGS} /arch:AVX2")
+    else (MSVC)
+        SET(CMAKE_CXX_FLAGS  "${CMAKE_CXX_FLAGS} -mavx2")
+    endif (MSVC)
+endif (SUPPORT_AVX2)
+
 # ----- LINUX CONFIG ----- #
 if (UNIX AND NOT APPLE)
     set(PTHREADLIB -pthread)
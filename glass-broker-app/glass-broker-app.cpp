@@ -325,6 +325,10 @@ int main(int argc, char* argv[]) {
 	// information
 	OutputThread.setAssociator(&AssocThread);
 
+	// input needs to know about the associator thread to wake it when new
+	// data is available
+	InputThread.setInputDataConsumer(&AssocThread);
+
 	// configure glass
 	// first send in initialize
 	AssocThread.setup(InitializeConfig.getJSON());
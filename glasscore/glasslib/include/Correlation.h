@@ -8,6 +8,7 @@
 #define CORRELATION_H
 
 #include <json.h>
+#include <internedid.h>
 #include <memory>
 #include <string>
 #include <vector>
@@ -261,6 +262,13 @@ class CCorrelation {
 	 */
 	const std::string& getID() const;
 
+	/**
+	 * \brief Get the interned handle of the ID of this correlation
+	 * \return Return an unsigned integer containing the handle of the correlation ID,
+	 * unique among the ids in use
+	 */
+	unsigned int getIDHandle() const;
+
 	/**
 	 * \brief Get the arrival time for this correlation
 	 * \return Return a double containing the correlation arrival time
@@ -273,6 +281,14 @@ class CCorrelation {
 	 */
 	double getTCreate() const;
 
+	/**
+	 * \brief Get the version of this correlation
+	 * \return Returns an integer containing the number of times this
+	 * correlation has been initialized, so that anything generated from the
+	 * correlation can tell when it has been updated
+	 */
+	int getVersion() const;
+
  private:
 	/**
 	 * \brief A std::weak_ptr to a CSite object
@@ -295,9 +311,9 @@ class CCorrelation {
 	std::string m_sPhaseName;
 
 	/**
-	 * \brief A std::string containing the unique string id of this correlation
+	 * \brief A glass3::util::InternedID containing the unique id of this correlation
 	 */
-	std::string m_sID;
+	glass3::util::InternedID m_ID;
 
 	/**
 	 * \brief A double value containing the arrival time of the correlation
@@ -337,6 +353,12 @@ class CCorrelation {
 	 */
 	std::atomic<double> m_tCreate;
 
+	/**
+	 * \brief An integer containing the number of times this correlation has
+	 * been initialized, incremented by initialize()
+	 */
+	std::atomic<int> m_iVersion;
+
 	/**
 	 * \brief A std::shared_ptr to a json object representing the original
 	 * correlation input message, used in accessing information not relevant to
@@ -14,6 +14,12 @@
 #include <memory>
 #include <atomic>
 #include <vector>
+namespace glass3 {
+namespace util {
+class ThreadPool;
+}  // namespace util
+}  // namespace glass3
+
 namespace glasscore {
 
 // forward declarations
@@ -25,6 +31,20 @@ class CDetection;
 class CCorrelationList;
 struct IGlassSend;
 
+/**
+ * \brief glasscore hypo processing queue order enumeration
+ *
+ * This enumeration defines the orders CHypoList can process its queued
+ * hypos in.
+ */
+enum HypoQueueOrder {
+	FirstInFirstOut = 0, /**< Hypos are processed in the order queued */
+	LeastProcessedFirst = 1, /**< Hypos with the fewest processing cycles
+	 since their last new data go first */
+	HighestBayesFirst = 2 /**< Hypos with the highest bayesian stack value
+	 go first */
+};
+
 /**
  * \brief glasscore interface class
  *
@@ -428,6 +448,61 @@ class CGlass {
 	 */
 	static bool getAllowPickUpdates();
 
+	/**
+	 * \brief Gets a boolean flag indicating whether sites publish read only
+	 * snapshots of their picks, letting nucleation read them without locking
+	 * out pick insertion
+	 */
+	static bool getSitePickSnapshots();
+
+	/**
+	 * \brief Sets a boolean flag indicating whether sites publish read only
+	 * snapshots of their picks
+	 * \param use - A boolean flag indicating whether sites publish pick
+	 * snapshots
+	 */
+	static void setSitePickSnapshots(bool use);
+
+	/**
+	 * \brief Gets the number of independent annealing chains the locator
+	 * runs for each location, 1 runs the single serial chain
+	 */
+	static int getNumLocatorChains();
+
+	/**
+	 * \brief Sets the number of independent annealing chains the locator
+	 * runs for each location
+	 * \param numChains - An integer containing the number of chains, values
+	 * less than 1 are treated as 1
+	 */
+	static void setNumLocatorChains(int numChains);
+
+	/**
+	 * \brief Gets the seed each new hypo's locator random number generator
+	 * is seeded with, -1 if they are seeded randomly
+	 */
+	static int getLocatorRandomSeed();
+
+	/**
+	 * \brief Sets the seed each new hypo's locator random number generator
+	 * is seeded with
+	 * \param seed - An integer containing the seed, -1 to seed the hypos
+	 * randomly
+	 */
+	static void setLocatorRandomSeed(int seed);
+
+	/**
+	 * \brief Gets the order CHypoList processes its queued hypos in
+	 * \return Returns a HypoQueueOrder containing the processing order
+	 */
+	static HypoQueueOrder getHypoQueueOrder();
+
+	/**
+	 * \brief Sets the order CHypoList processes its queued hypos in
+	 * \param order - A HypoQueueOrder containing the processing order
+	 */
+	static void setHypoQueueOrder(HypoQueueOrder order);
+
 	/**
 	 * \brief Gets the optional threshold used for accepting the classification
 	 * of a pick as noise by an external algorithm. -1 indicates this feature is 
@@ -497,6 +572,22 @@ class CGlass {
 	 */
 	static CPickList* getPickList();
 
+	/**
+	 * \brief Gets a pointer to the pool of threads used to spread node
+	 * nucleation for a pick across threads
+	 * \return Returns a pointer to the nucleation work pool, or NULL if
+	 * nucleation work threads are disabled
+	 */
+	static glass3::util::ThreadPool* getNucleationWorkPool();
+
+	/**
+	 * \brief Gets a pointer to the pool of threads used to run the locator
+	 * chains in parallel
+	 * \return Returns a pointer to the locator work pool, or NULL if locator
+	 * work threads are disabled
+	 */
+	static glass3::util::ThreadPool* getLocatorWorkPool();
+
 	/**
 	 * \brief Gets a pointer to the Site list
 	 * \return Returns a pointer to the site list
@@ -764,6 +855,29 @@ class CGlass {
 	 */
 	static std::atomic<bool> m_bAllowPickUpdates;
 
+	/**
+	 * \brief The boolean flag indicating whether sites publish read only
+	 * snapshots of their picks for nucleation
+	 */
+	static std::atomic<bool> m_bSitePickSnapshots;
+
+	/**
+	 * \brief The number of independent annealing chains the locator runs for
+	 * each location
+	 */
+	static std::atomic<int> m_iNumLocatorChains;
+
+	/**
+	 * \brief The seed each new hypo's locator random number generator is
+	 * seeded with, -1 to seed them randomly
+	 */
+	static std::atomic<int> m_iLocatorRandomSeed;
+
+	/**
+	 * \brief The order CHypoList processes its queued hypos in
+	 */
+	static std::atomic<int> m_iHypoQueueOrder;
+
 	/**
 	 * \brief The probability threshold for accepting the pick noise 
 	 * classification, phases that meet this threshold will be rejected
@@ -844,6 +958,20 @@ class CGlass {
 	 */
 	static CHypoList * m_pHypoList;
 
+	/**
+	 * \brief A pointer to a glass3::util::ThreadPool used by CSite to spread
+	 * the nucleation of a pick at the nodes linked to its site across
+	 * threads, and by the webs to run their updates, NULL if nucleation work
+	 * threads are disabled
+	 */
+	static glass3::util::ThreadPool * m_pNucleationWorkPool;
+
+	/**
+	 * \brief A pointer to a glass3::util::ThreadPool used by CHypo to run
+	 * locator chains in parallel, NULL if locator work threads are disabled
+	 */
+	static glass3::util::ThreadPool * m_pLocatorWorkPool;
+
 	/**
 	 * \brief A pointer to a CCorrelationList object containing the last n
 	 * correlations sent into glasscore
@@ -929,6 +1057,28 @@ class CGlass {
 	 */
 	static const unsigned int k_DefaultNumWebThreads = 0;
 
+	/**
+	 * \brief Default number of nucleation work threads, 0 nucleates every
+	 * node on the pick list thread
+	 */
+	static const unsigned int k_DefaultNumNucleationWorkThreads = 0;
+
+	/**
+	 * \brief The sleep time in milliseconds of idle nucleation work threads
+	 */
+	static const int k_iNucleationWorkSleepTime = 1;
+
+	/**
+	 * \brief Default number of locator work threads, 0 runs every locator
+	 * chain on the hypo list thread
+	 */
+	static const unsigned int k_DefaultNumLocatorWorkThreads = 0;
+
+	/**
+	 * \brief The sleep time in milliseconds of idle locator work threads
+	 */
+	static const int k_iLocatorWorkSleepTime = 1;
+
 	/**
 	 * \brief Default value used to indicate a param is disabled
 	 */
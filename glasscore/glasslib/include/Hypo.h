@@ -8,10 +8,14 @@
 #define HYPO_H
 
 #include <json.h>
+#include <internedid.h>
 #include <geo.h>
+#include <randomengine.h>
 #include <memory>
 #include <string>
 #include <vector>
+#include <unordered_map>
+#include <unordered_set>
 #include <mutex>
 #include <atomic>
 #include "TTT.h"
@@ -50,6 +54,109 @@ typedef struct _HypoAuditingPerformanceStruct {
 	double dDepthPrev;
 } HypoAuditingPerformanceStruct;
 
+/**
+ * \brief glasscore hypo locator pick cache structure
+ *
+ * The HypoLocatorCache struct holds the pick data used by the locator in
+ * contiguous arrays, gathered once per locate call, along with scratch arrays
+ * for the per trial location values, so that evaluating a trial location only
+ * needs to do the math. It also holds the travel times and tapers the stack
+ * is calculated with, so a copy can be evaluated without the hypo.
+ */
+typedef struct _HypoLocatorCache {
+	bool bValid;
+	int iNumPicks;
+	std::shared_ptr<traveltime::CTravelTime> pNucleationTravelTime1;
+	std::shared_ptr<traveltime::CTravelTime> pNucleationTravelTime2;
+	std::shared_ptr<traveltime::CTTT> pTravelTimeTables;
+	glass3::util::Taper taperGap;
+	glass3::util::Taper taperDepth;
+	int iNucleationPhaseID1;
+	int iNucleationPhaseID2;
+	std::vector<double> vdSiteUnitVectorX;
+	std::vector<double> vdSiteUnitVectorY;
+	std::vector<double> vdSiteUnitVectorZ;
+	std::vector<double> vdPickTimes;
+	std::vector<double> vdDeltas;
+	std::vector<double> vdTravelTimes1;
+	std::vector<double> vdTravelTimes2;
+	std::vector<double> vdAzimuths;
+	std::vector<double> vdGapBinMinimums;
+	std::vector<double> vdGapBinMaximums;
+} HypoLocatorCache;
+
+/**
+ * \brief glasscore hypo locator chain structure
+ *
+ * The HypoLocatorChain struct holds one independent annealing chain run by
+ * the multiple chain locator: its own copy of the locator pick cache, its
+ * own random number generator, the search parameters, and the best location
+ * and bayesian stack value the chain has found
+ */
+typedef struct _HypoLocatorChain {
+	HypoLocatorCache Cache;
+	glass3::util::RandomEngine Generator;
+	int iNumIterations;
+	double dStartDistance;
+	double dStopDistance;
+	double dStartTime;
+	double dStopTime;
+	bool bNucleate;
+	double dLatitude;
+	double dLongitude;
+	double dDepth;
+	double dTOrigin;
+	double dBayes;
+} HypoLocatorChain;
+
+/**
+ * \brief glasscore hypo message data structure
+ *
+ * The HypoMessageData struct holds the hypo message data block generated for
+ * one pick or correlation, along with the data version and time, site
+ * location, and hypocenter it was generated for, so that the next hypo
+ * message can reuse the block, or only update its association info if the
+ * hypocenter moved
+ */
+typedef struct _HypoMessageData {
+	json::Object jData;
+	bool bValid;
+	bool bHasJSON;
+	bool bAssociated;
+	bool bPublishable;
+	int iDataVersion;
+	double dTData;
+	double dSiteLatitude;
+	double dSiteLongitude;
+	double dSiteElevation;
+	double dLatitude;
+	double dLongitude;
+	double dDepth;
+	double dTOrigin;
+} HypoMessageData;
+
+/**
+ * \brief glasscore hypo message state structure
+ *
+ * The HypoMessageState struct holds the hypocenter values and the supporting
+ * data a message was last generated from, so that a hypo that has not
+ * changed since can be detected without generating the message again
+ */
+typedef struct _HypoMessageState {
+	bool bValid;
+	double dLatitude;
+	double dLongitude;
+	double dDepth;
+	double dTOrigin;
+	double dBayes;
+	double dMinDistance;
+	double dGap;
+	std::vector<std::shared_ptr<CPick>> vPickData;
+	std::vector<int> vPickVersions;
+	std::vector<std::shared_ptr<CCorrelation>> vCorrelationData;
+	std::vector<int> vCorrelationVersions;
+} HypoMessageState;
+
 /**
  * \brief glasscore hypocenter class
  *
@@ -357,6 +464,12 @@ class CHypo {
 	 *
 	 * Generate a json object representing this hypocenter in the "Hypo" format
 	 *
+	 * If the hypocenter and its supporting data have not changed since the
+	 * last hypo message, a copy of that message is returned. Otherwise the
+	 * data blocks of picks and correlations that were in the last message
+	 * are reused, only recalculating their association info if the
+	 * hypocenter moved.
+	 *
 	 * \return Returns the generated json object in the "Hypo" format.
 	 */
 	std::shared_ptr<json::Object> generateHypoMessage();
@@ -367,6 +480,10 @@ class CHypo {
 	 * Generate a json object representing a summary of this hypocenter in the
 	 * "Event" format
 	 *
+	 * The event version (report count) is only incremented if the hypocenter
+	 * or its supporting data have changed since the last event message, so
+	 * that output can skip requesting and publishing an unchanged hypo.
+	 *
 	 * \return Returns the generated json object in the "Event" format.
 	 */
 	std::shared_ptr<json::Object> generateEventMessage();
@@ -691,13 +808,14 @@ class CHypo {
 	 * location given the phase, observed travel time, and calculated travel
 	 * time
 	 *
-	 * \param sPhase - A string with the phase type
+	 * \param phaseID - An integer containing the process-wide phase id of the
+	 * phase type, see traveltime::CTravelTime::getPhaseID()
 	 * \param tObs - The observed travel time in gregorian seconds
 	 * \param tCal - The calculated travel time in gregorian seconds
 	 * \return Returns a double value containing the weighted residual
 	 */
-	double calculateWeightedResidual(std::string sPhase, double tObs,
-										double tCal);
+	static double calculateWeightedResidual(int phaseID, double tObs,
+											double tCal);
 
 	/**
 	 * \brief Write files for plotting output
@@ -957,11 +1075,35 @@ class CHypo {
 	double getMinDistance() const;
 
 	/**
-	 * \brief Gets the mutex used to ensure that the hypo can be processed by
-	 * only one thread at a time
-	 * \return Returns a std::mutex
+	 * \brief Claim the hypo for processing
+	 *
+	 * Claims the hypo so that only one thread processes it at a time. This
+	 * never blocks; a thread that can't claim the hypo should call
+	 * deferProcessing() and move on rather than wait.
+	 *
+	 * \return Returns true if the calling thread now owns the claim, false
+	 * if another thread does
+	 */
+	bool claimForProcessing();
+
+	/**
+	 * \brief Ask the owner of the processing claim to requeue the hypo
+	 *
+	 * Records that the hypo needs processing again once the thread that
+	 * currently owns the claim releases it. If the claim was released in the
+	 * meantime, it is claimed for the calling thread instead.
+	 *
+	 * \return Returns true if the calling thread now owns the claim, false
+	 * if the request was recorded for the owner
 	 */
-	std::mutex & getProcessingMutex();
+	bool deferProcessing();
+
+	/**
+	 * \brief Release the processing claim
+	 * \return Returns true if deferProcessing() was called while the claim
+	 * was held, meaning the hypo should be requeued
+	 */
+	bool releaseProcessingClaim();
 
 	/**
 	 * \brief Gets the node resolution of the web that nucleated this hypo
@@ -1009,6 +1151,13 @@ class CHypo {
 	 */
 	const std::string& getID() const;
 
+	/**
+	 * \brief Get the interned handle of the ID of this hypo
+	 * \return Returns an unsigned integer containing the handle of the hypo ID,
+	 * unique among the ids in use
+	 */
+	unsigned int getIDHandle() const;
+
 	/**
 	 * \brief Gets the name of the web that nucleated this hypo
 	 * \return Returns a std::string containing the name of the web that
@@ -1074,14 +1223,15 @@ class CHypo {
 	std::shared_ptr<traveltime::CTTT> getTravelTimeTables() const;
 
 	/**
-	 * \brief Gets the number of times that this hypo has been reported
+	 * \brief Gets the number of times that this hypo has been reported with
+	 * changes, used as the event version
 	 * \return Returns an integer value containing the report count
 	 */
 	int getReportCount() const;
 
 	/**
-	 * \brief Gets whether the mutex accessed via getProcessingMutex() is locked
-	 * \return Returns a boolean flag indicating whether the mutex is locked,
+	 * \brief Gets whether the hypo is claimed for processing
+	 * \return Returns a boolean flag indicating whether the hypo is claimed,
 	 * true if it is, false otherwise
 	 */
 	bool isLockedForProcessing();
@@ -1415,9 +1565,9 @@ class CHypo {
 	std::atomic<double> m_dAssociationDistanceCutoff;
 
 	/**
-	 * \brief A std::string containing this hypo's unique identifier
+	 * \brief A glass3::util::InternedID containing the unique id of this hypo
 	 */
-	std::string m_sID;
+	glass3::util::InternedID m_ID;
 
 	/**
 	 * \brief A boolean indicating if this hypo is fixed (not allowed to change)
@@ -1436,6 +1586,13 @@ class CHypo {
 	 */
 	std::atomic<int> m_iTotalProcessCount;
 
+	/**
+	 * \brief An integer incremented whenever picks or correlations are added
+	 * to or removed from this hypo, so work done on a copy of the data
+	 * without the hypo locked can tell whether it is still current
+	 */
+	std::atomic<int> m_iDataVersion;
+
 	/**
 	 * \brief An integer containing the number of times this hypo has been
 	 * reported.
@@ -1469,6 +1626,14 @@ class CHypo {
 	 */
 	std::vector<std::shared_ptr<CPick>> m_vPickData;
 
+	/**
+	 * \brief A std::unordered_set of pointers to the picks in m_vPickData,
+	 * kept alongside the vector so that membership checks do not have to scan
+	 * it. Keyed on the pick itself rather than its id, since an updated pick
+	 * gets a new id but is still the same pick.
+	 */
+	std::unordered_set<const CPick *> m_PickDataSet;
+
 	/**
 	 * \brief A vector of shared pointers to correlation data that support
 	 * this hypo.
@@ -1479,6 +1644,14 @@ class CHypo {
 	 */
 	std::vector<std::shared_ptr<CCorrelation>> m_vCorrelationData;
 
+	/**
+	 * \brief A std::unordered_set of pointers to the correlations in
+	 * m_vCorrelationData, kept alongside the vector so that membership checks
+	 * do not have to scan it. Keyed on the correlation itself rather than its
+	 * id, since an updated correlation gets a new id.
+	 */
+	std::unordered_set<const CCorrelation *> m_CorrelationDataSet;
+
 	/**
 	 * \brief A pointer to a CTravelTime object containing
 	 * travel times for the first phase used to nucleate this hypo. This
@@ -1509,6 +1682,212 @@ class CHypo {
 	 */
 	std::shared_ptr<traveltime::CZoneStats> m_pZoneStats;
 
+	/**
+	 * \brief Gather the locator pick cache
+	 *
+	 * Copies the site unit vectors and arrival times of the supporting picks
+	 * into m_LocatorCache, and sizes its scratch arrays, reusing the cache
+	 * storage from previous calls
+	 */
+	void gatherLocatorCache();
+
+	/**
+	 * \brief Calculate the gap using a locator pick cache
+	 *
+	 * Calculates the azimuthal gap for a given location from the site unit
+	 * vectors in a locator pick cache, without allocating or sorting. The
+	 * azimuths are bucketed into one more bin than there are picks, so at
+	 * least one bin is empty and the largest gap is always between bins,
+	 * leaving only the lowest and highest azimuth in each bin to compare. The
+	 * result is the same as sorting the azimuths.
+	 *
+	 * \param cache - A pointer to the HypoLocatorCache to use
+	 * \param geo - A reference to the glass3::util::Geo of the test location
+	 * \return Returns a double value containing the calculated gap
+	 */
+	static double calculateCachedGap(HypoLocatorCache *cache,
+										const glass3::util::Geo &geo);
+
+	/**
+	 * \brief Calculate the bayesian stack value using a locator pick cache
+	 *
+	 * Calculates the bayesian stack value for a given location from the pick
+	 * data, travel times, and tapers gathered into the given cache, using its
+	 * scratch arrays. This function does not use the hypo, so the multiple
+	 * chain locator can call it from several threads at once, each with its
+	 * own cache, without the hypo locked.
+	 *
+	 * \param cache - A pointer to the HypoLocatorCache to use
+	 * \param xlat - The latitude of the test location
+	 * \param xlon - The longitude of the test location
+	 * \param xZ - The depth of the test location
+	 * \param oT - The origin time of the test location
+	 * \param nucleate - A boolean flag indicating whether to use only the
+	 * nucleation phases
+	 * \return Returns a double value containing the bayesian stack value
+	 */
+	static double calculateCachedBayes(HypoLocatorCache *cache, double xlat,
+										double xlon, double xZ, double oT,
+										bool nucleate);
+
+	/**
+	 * \brief Update the location auditing information and move the hypo
+	 *
+	 * Records a large move in the auditing information if the new location
+	 * is far enough from the previous one, then sets the hypo location,
+	 * depth, and origin time
+	 *
+	 * \param xlat - The new latitude
+	 * \param xlon - The new longitude
+	 * \param xz - The new depth
+	 * \param oT - The new origin time
+	 * \param valBest - The bayesian stack value at the new location
+	 */
+	void commitLocatorMove(double xlat, double xlon, double xz, double oT,
+							double valBest);
+
+	/**
+	 * \brief Run the multiple chain locator
+	 *
+	 * Runs numChains independent annealing chains, splitting nIter iterations
+	 * between them, each starting from the current location or a random step
+	 * away from it with its own random number generator. The chains run in
+	 * the locator work pool when there is one. Each chain works on its own
+	 * copy of the locator cache, so hypoLock is released while they run and
+	 * other threads can use the hypo. The hypo is then moved to the best
+	 * location found if it is better than the starting value, unless its data
+	 * or location changed while the chains ran, in which case the result is
+	 * discarded. Chains are seeded from the hypo's m_RandomGenerator, so the
+	 * result is repeatable when CGlass::getLocatorRandomSeed() is set.
+	 *
+	 * \param hypoLock - A pointer to the std::unique_lock holding the hypo,
+	 * unlocked while the chains run and locked again on return. The hypo is
+	 * only released if the caller holds no other lock on it.
+	 * \param numChains - The number of chains to run
+	 * \param nIter - The total number of iterations
+	 * \param dStart - The starting search radius in km
+	 * \param dStop - The ending search radius in km
+	 * \param tStart - The starting search time in seconds
+	 * \param tStop - The ending search time in seconds
+	 * \param nucleate - A boolean flag indicating whether to use only the
+	 * nucleation phases
+	 * \param valStart - The bayesian stack value at the current location
+	 * \return Returns a double value containing the best bayesian stack value,
+	 * or the value at the current location if the result was discarded
+	 */
+	double runLocatorChains(std::unique_lock<std::recursive_mutex> *hypoLock,
+							int numChains, int nIter, double dStart,
+							double dStop, double tStart, double tStop,
+							bool nucleate, double valStart);
+
+	/**
+	 * \brief Run one locator chain
+	 *
+	 * Runs the annealing search described by the chain from its starting
+	 * location, keeping the best location found in the chain. This function
+	 * does not modify the hypo.
+	 *
+	 * \param chain - A pointer to the HypoLocatorChain to run
+	 */
+	void runLocatorChain(HypoLocatorChain *chain);
+
+	/**
+	 * \brief Record the message state
+	 *
+	 * Copies the current hypocenter values and supporting data into the
+	 * given message state
+	 *
+	 * \param state - A pointer to the HypoMessageState to record into
+	 */
+	void recordMessageState(HypoMessageState *state);
+
+	/**
+	 * \brief Check whether a message state is current
+	 *
+	 * Compares the given message state against the current hypocenter values
+	 * and supporting data. Site location updates are not compared, they are
+	 * picked up the next time the hypo changes.
+	 *
+	 * \param state - A reference to the HypoMessageState to check
+	 * \return Returns true if the hypo has not changed since the state was
+	 * recorded, false otherwise
+	 */
+	bool isMessageStateCurrent(const HypoMessageState &state) const;
+
+	/**
+	 * \brief Update a pick's hypo message data block
+	 *
+	 * Rebuilds the data block if it is new or the pick time or site location
+	 * changed, and recalculates the association info if the hypocenter moved
+	 * since it was last calculated
+	 *
+	 * \param pick - A shared_ptr to the CPick the block is for
+	 * \param geo - A reference to the glass3::util::Geo of the hypocenter
+	 * \param data - A pointer to the HypoMessageData to update
+	 */
+	void updatePickMessageData(std::shared_ptr<CPick> pick,
+								const glass3::util::Geo &geo,
+								HypoMessageData *data);
+
+	/**
+	 * \brief Update a correlation's hypo message data block
+	 *
+	 * Rebuilds the data block if it is new or the correlation time or site
+	 * location changed, and recalculates the association info if the
+	 * hypocenter moved since it was last calculated
+	 *
+	 * \param correlation - A shared_ptr to the CCorrelation the block is for
+	 * \param geo - A reference to the glass3::util::Geo of the hypocenter
+	 * \param data - A pointer to the HypoMessageData to update
+	 */
+	void updateCorrelationMessageData(std::shared_ptr<CCorrelation> correlation,
+										const glass3::util::Geo &geo,
+										HypoMessageData *data);
+
+	/**
+	 * \brief The locator pick cache, valid only while a locate call (or a
+	 * single calculateBayes() or calculateAbsResidualSum() call made outside
+	 * of one) is running
+	 */
+	HypoLocatorCache m_LocatorCache;
+
+	/**
+	 * \brief The random number generator for the locator's search steps,
+	 * owned by this hypo so locations don't depend on other hypos or threads,
+	 * and seeded from CGlass::getLocatorRandomSeed() when it is not -1
+	 */
+	glass3::util::RandomEngine m_RandomGenerator;
+
+	/**
+	 * \brief The last generated hypo message, kept to return copies of while
+	 * the hypo is unchanged
+	 */
+	std::shared_ptr<json::Object> m_pLastHypoMessage;
+
+	/**
+	 * \brief The state the last hypo message was generated from
+	 */
+	HypoMessageState m_HypoMessageState;
+
+	/**
+	 * \brief The state the last event message was generated from
+	 */
+	HypoMessageState m_EventMessageState;
+
+	/**
+	 * \brief The hypo message data blocks of the picks in the last hypo
+	 * message
+	 */
+	std::unordered_map<std::shared_ptr<CPick>, HypoMessageData>
+		m_mPickMessageData;
+
+	/**
+	 * \brief The hypo message data blocks of the correlations in the last hypo
+	 * message
+	 */
+	std::unordered_map<std::shared_ptr<CCorrelation>, HypoMessageData>
+		m_mCorrelationMessageData;
+
 	/**
 	 * \brief Taper for event depth being larger than zonestats
 	 */
@@ -1530,9 +1909,17 @@ class CHypo {
 	mutable std::recursive_mutex m_HypoMutex;
 
 	/**
-	 * \brief A mutex to control processing access to CHypo.
+	 * \brief A boolean flag indicating whether a thread has claimed this
+	 * hypo for processing, not reset by clear() since a hypo can be cleared
+	 * while claimed
+	 */
+	std::atomic<bool> m_bProcessingClaimed;
+
+	/**
+	 * \brief A boolean flag indicating whether another thread asked for this
+	 * hypo to be requeued while it was claimed
 	 */
-	std::mutex m_ProcessingMutex;
+	std::atomic<bool> m_bProcessingDeferred;
 
 	/**
 	 * \brief The auditing structure for this hypo
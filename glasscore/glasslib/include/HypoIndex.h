@@ -0,0 +1,182 @@
+/*****************************************
+ * This file is documented for Doxygen.
+ * If you modify this file please update
+ * the comments so that Doxygen will still
+ * be able to work.
+ ****************************************/
+#ifndef HYPOINDEX_H
+#define HYPOINDEX_H
+
+#include <geo.h>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace glasscore {
+
+// forward declarations
+class CHypo;
+
+/**
+ * \brief glasscore hypo spatial and temporal index class
+ * The CHypoIndex class is an index of hypos by both location and time, used
+ * by CHypoList to find the hypos within a time window that could be near
+ * enough to a site or another hypo to matter, without checking every hypo
+ * in the window. Hypos are bucketed into the same grid of cubic cells over
+ * the geocentric unit vector of their location as CSiteIndex, and each cell
+ * keeps its hypos sorted by their sort time.
+ * Each entry is a snapshot of the hypo's location and association distance
+ * cutoff as of when it was added, which CHypoList refreshes whenever it
+ * repositions the hypo by time. Since a hypo may relocate before it is
+ * refreshed, searches allow every entry k_dMovementAllowance degrees beyond
+ * its snapshot, so a hypo that could be within the distance is never left
+ * out.
+ * CHypoIndex is not thread safe, the owner is expected to lock around its
+ * use.
+ */
+class CHypoIndex {
+ public:
+	/**
+	 * \brief CHypoIndex constructor
+	 */
+	CHypoIndex();
+
+	/**
+	 * \brief CHypoIndex destructor
+	 */
+	~CHypoIndex();
+
+	/**
+	 * \brief CHypoIndex clear function, removes all hypos
+	 */
+	void clear();
+
+	/**
+	 * \brief Add a hypo
+	 * Adds the given hypo to the index at its current location, sort time,
+	 * and association distance cutoff, replacing any existing entry for the
+	 * hypo.
+	 * \param hypo - A shared_ptr to the CHypo to add
+	 * \return Returns true if successful, false otherwise
+	 */
+	bool addHypo(std::shared_ptr<CHypo> hypo);
+
+	/**
+	 * \brief Remove a hypo
+	 * \param hypo - A shared_ptr to the CHypo to remove
+	 * \return Returns true if the hypo was removed, false if it was not in
+	 * the index
+	 */
+	bool removeHypo(std::shared_ptr<CHypo> hypo);
+
+	/**
+	 * \brief Get the hypos near a location within a time window
+	 * Gets the hypos with sort times from t1 to t2, inclusive, that could be
+	 * within maxDistance of the given location, sorted by sort time. Hypos
+	 * farther than maxDistance may be included, but no hypo within
+	 * maxDistance is left out.
+	 * \param geo - A glass3::util::Geo containing the location to search from
+	 * \param maxDistance - A double containing the maximum distance from the
+	 * location to a hypo in radians
+	 * \param t1 - A double value containing the beginning of the time window
+	 * in Gregorian seconds
+	 * \param t2 - A double value containing the end of the time window in
+	 * Gregorian seconds
+	 * \return Returns a std::vector of std::weak_ptrs to the hypos found
+	 */
+	std::vector<std::weak_ptr<CHypo>> getHypos(const glass3::util::Geo &geo,
+												double maxDistance, double t1,
+												double t2) const;
+
+	/**
+	 * \brief Get the hypos that data at a location could associate with
+	 * Gets the hypos with sort times from t1 to t2, inclusive, that could be
+	 * within their own association distance cutoff of the given location,
+	 * sorted by sort time. Hypos that can't associate may be included, but no
+	 * hypo within its cutoff is left out.
+	 * \param geo - A glass3::util::Geo containing the location of the data,
+	 * such as a pick's site
+	 * \param t1 - A double value containing the beginning of the time window
+	 * in Gregorian seconds
+	 * \param t2 - A double value containing the end of the time window in
+	 * Gregorian seconds
+	 * \return Returns a std::vector of std::weak_ptrs to the hypos found
+	 */
+	std::vector<std::weak_ptr<CHypo>> getAssociableHypos(
+			const glass3::util::Geo &geo, double t1, double t2) const;
+
+	/**
+	 * \brief Get the number of hypos in the index
+	 * \return Returns an integer containing the number of hypos
+	 */
+	int size() const;
+
+	/**
+	 * \brief The distance in degrees a hypo is allowed to have moved since
+	 * its entry was added
+	 */
+	static constexpr double k_dMovementAllowance = 10.0;
+
+ private:
+	/**
+	 * \brief the snapshot of a hypo held by an entry, the association
+	 * distance cutoff is in radians
+	 */
+	typedef struct _HypoIndexEntry {
+		std::shared_ptr<CHypo> Hypo;
+		double dUnitVector[3];
+		double dCutoff;
+	} HypoIndexEntry;
+
+	/**
+	 * \brief the hypos in a cell, sorted by sort time
+	 */
+	typedef std::multimap<double, HypoIndexEntry> CellHypos;
+
+	/**
+	 * \brief a cell, its hypos and the largest association distance cutoff
+	 * among them in radians
+	 */
+	typedef struct _HypoIndexCell {
+		CellHypos Hypos;
+		double dMaxCutoff;
+	} HypoIndexCell;
+
+	/**
+	 * \brief Search the index
+	 * \param geo - A glass3::util::Geo containing the location to search from
+	 * \param maxDistance - A double containing the maximum distance in
+	 * radians, or a negative value to use each hypo's association distance
+	 * cutoff instead
+	 * \param t1 - A double value containing the beginning of the time window
+	 * \param t2 - A double value containing the end of the time window
+	 * \return Returns a std::vector of std::weak_ptrs to the hypos found
+	 */
+	std::vector<std::weak_ptr<CHypo>> search(const glass3::util::Geo &geo,
+												double maxDistance, double t1,
+												double t2) const;
+
+	/**
+	 * \brief Get the chord length padded to cover a distance plus the
+	 * movement allowance
+	 * \param distance - A double containing the distance in radians
+	 * \return Returns a double containing the chord length on a unit sphere
+	 */
+	static double getSearchChord(double distance);
+
+	/**
+	 * \brief A std::map of cell index to the hypos within the cell, only
+	 * cells holding hypos are present
+	 */
+	std::map<int, HypoIndexCell> m_mCells;
+
+	/**
+	 * \brief A std::unordered_map of each indexed hypo to the cell index and
+	 * iterator of its entry
+	 */
+	std::unordered_map<const CHypo *, std::pair<int, CellHypos::iterator>> m_mHypoEntries;  // NOLINT
+};
+}  // namespace glasscore
+#endif  // HYPOINDEX_H
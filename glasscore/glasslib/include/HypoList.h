@@ -13,6 +13,7 @@
 #include <list>
 #include <queue>
 #include <map>
+#include <unordered_map>
 #include <set>
 #include <memory>
 #include <utility>
@@ -20,8 +21,10 @@
 #include <mutex>
 #include <thread>
 #include <random>
+#include <cstdint>
 #include "Glass.h"
 #include "Hypo.h"
+#include "HypoIndex.h"
 
 namespace glasscore {
 
@@ -200,6 +203,45 @@ class CHypoList : public glass3::util::ThreadBaseClass {
 	 */
 	std::vector<std::weak_ptr<CHypo>> getHypos(double t1, double t2);
 
+	/**
+	 * \brief Get list of CHypos in given time range and distance
+	 *
+	 * Get a list of hypocenters with sort times within the given range that
+	 * could be within maxDistance of the provided location, using the hypo
+	 * index rather than checking every hypo in the time range. Hypos farther
+	 * than maxDistance may be included.
+	 *
+	 * \param t1 - Starting time of selection range
+	 * \param t2 - Ending time of selection range
+	 * \param geo - A glass3::util::Geo containing the location to search from
+	 * \param maxDistance - A double value containing the maximum distance
+	 * from the location to a hypo in degrees
+	 * \return A vector of std::weak_ptr to CHypos within the range and
+	 * distance, in time order
+	 */
+	std::vector<std::weak_ptr<CHypo>> getHypos(double t1, double t2,
+												const glass3::util::Geo &geo,
+												double maxDistance);
+
+	/**
+	 * \brief Get list of CHypos in given time range that data at a location
+	 * could associate with
+	 *
+	 * Get a list of hypocenters with sort times within the given range that
+	 * could be within their association distance cutoff of the provided
+	 * location, using the hypo index rather than checking every hypo in the
+	 * time range. Hypos that can't associate may be included.
+	 *
+	 * \param t1 - Starting time of selection range
+	 * \param t2 - Ending time of selection range
+	 * \param geo - A glass3::util::Geo containing the location of the data,
+	 * such as a pick's site
+	 * \return A vector of std::weak_ptr to CHypos within the range that
+	 * could associate, in time order
+	 */
+	std::vector<std::weak_ptr<CHypo>> getAssociableHypos(
+			double t1, double t2, const glass3::util::Geo &geo);
+
 	/**
 	 * \brief Gets the maximum number of hypocenters this list will hold
 	 * \return Returns an integer containing the maximum number of hypocenters
@@ -240,7 +282,10 @@ class CHypoList : public glass3::util::ThreadBaseClass {
 	 * \brief Append hypo to processing queue
 	 *
 	 * Append the given hypocenter to the processing queue if it is not already
-	 * in the queue.
+	 * in the queue, ordered by CGlass::getHypoQueueOrder(). Whether the hypo
+	 * is already queued is a single hash lookup. When the queue is not
+	 * first in first out, appending an already queued hypo updates its
+	 * priority, keeping its place among hypos of equal priority.
 	 *
 	 * \param hyp - A std::shared_ptr to the hypocenter to add
 	 * \return Returns the current size of the processing queue
@@ -250,13 +295,20 @@ class CHypoList : public glass3::util::ThreadBaseClass {
 	/**
 	 * \brief Get first hypo from processing queue
 	 *
-	 * Get the first valid hypocenter from the processing queue.
+	 * Get the highest priority valid hypocenter from the processing queue.
 	 *
 	 * \return Returns a std::shared_ptr to the hypocenter retrieved
 	 * from the queue.
 	 */
 	std::shared_ptr<CHypo> getNextHypoFromProcessingQueue();
 
+	/**
+	 * \brief Check if a hypo is on the processing queue
+	 * \param hyp - A std::shared_ptr to the hypocenter to check
+	 * \return Returns true if the hypo is waiting to be processed
+	 */
+	bool isOnHypoProcessingQueue(std::shared_ptr<CHypo> hyp);
+
 	/**
 	 * \brief Remove hypo from list
 	 *
@@ -358,14 +410,46 @@ class CHypoList : public glass3::util::ThreadBaseClass {
 	std::atomic<int> m_iCountOfTotalHyposProcessed;
 
 	/**
-	 * \brief A std::list of weak_ptrs to the hypocenters that need to be
-	 * processed. This list is managed in a way to make it act as a FIFO
-	 * queue
+	 * \brief Remove a hypo from the processing queue, if it is on it
+	 * \param hyp - A std::shared_ptr to the hypocenter to remove
+	 */
+	void removeFromHypoProcessingQueue(std::shared_ptr<CHypo> hyp);
+
+	/**
+	 * \brief Get the processing queue priority of a hypo
+	 * \param hyp - A std::shared_ptr to the hypocenter
+	 * \return Returns a double containing the priority of the hypo for the
+	 * current CGlass::getHypoQueueOrder(), lower values are processed first
+	 */
+	static double getHypoQueuePriority(std::shared_ptr<CHypo> hyp);
+
+	/**
+	 * \brief the processing queue, a std::map of priority and the order
+	 * queued to the id handle and weak_ptr of each hypocenter waiting to be
+	 * processed
+	 */
+	typedef std::map<std::pair<double, uint64_t>, std::pair<unsigned int, std::weak_ptr<CHypo>>> HypoQueue;  // NOLINT
+
+	/**
+	 * \brief The processing queue, processed from the lowest priority value,
+	 * first queued first among equal priorities
+	 */
+	HypoQueue m_mHypoProcessingQueue;
+
+	/**
+	 * \brief A std::unordered_map of the id handle of each queued hypo to
+	 * its processing queue entry
+	 */
+	std::unordered_map<unsigned int, HypoQueue::iterator> m_mQueuedHypos;
+
+	/**
+	 * \brief The sequence number given to the next hypo queued
 	 */
-	std::list<std::weak_ptr<CHypo>> m_lHypoProcessingQueue;
+	uint64_t m_iHypoQueueSequence;
 
 	/**
-	 * \brief the std::mutex for accessing m_vHyposToProcess
+	 * \brief the std::mutex for accessing m_mHypoProcessingQueue and
+	 * m_mQueuedHypos
 	 */
 	std::mutex m_HypoProcessingQueueMutex;
 
@@ -376,10 +460,17 @@ class CHypoList : public glass3::util::ThreadBaseClass {
 	std::multiset<std::shared_ptr<CHypo>, HypoCompare> m_msHypoList;
 
 	/**
-	 * \brief A std::map containing a std::shared_ptr to each hypocenter
-	 * in CHypoList indexed by the std::string hypo id.
+	 * \brief A CHypoIndex containing each hypo in m_msHypoList indexed by
+	 * location and sort time, used to find the hypos data could associate
+	 * with and the hypos to try merging with
 	 */
-	std::map<std::string, std::shared_ptr<CHypo>> m_mHypo;
+	CHypoIndex m_HypoIndex;
+
+	/**
+	 * \brief A std::unordered_map containing a std::shared_ptr to each
+	 * hypocenter in CHypoList indexed by the interned handle of the hypo id.
+	 */
+	std::unordered_map<unsigned int, std::shared_ptr<CHypo>> m_mHypo;
 
 	/**
 	 * \brief A recursive_mutex to control threading access to CHypoList.
@@ -427,5 +518,64 @@ class CHypoList : public glass3::util::ThreadBaseClass {
 	 */
 	static constexpr double k_dExistingDistanceTolerance = 0.5;
 };
+
+/**
+ * \brief glasscore hypo processing claim class
+ *
+ * The CHypoProcessingClaim class claims a hypo for processing when it is
+ * constructed and releases the claim when it is destroyed, in the manner of
+ * a std::unique_lock that only ever try-locks. Claiming never blocks or
+ * sleeps. If the hypo is already claimed by another thread, the claim is
+ * deferred (see CHypo::deferProcessing()), and the hypo is requeued on the
+ * given CHypoList by whichever claim releases it.
+ */
+class CHypoProcessingClaim {
+ public:
+	/**
+	 * \brief CHypoProcessingClaim constructor
+	 *
+	 * Tries to claim the hypo for processing, deferring it if another thread
+	 * owns the claim
+	 *
+	 * \param hypo - A std::shared_ptr to the hypo to claim
+	 * \param hypoList - A pointer to the CHypoList to requeue the hypo on
+	 * when it was deferred while claimed
+	 */
+	CHypoProcessingClaim(std::shared_ptr<CHypo> hypo, CHypoList *hypoList);
+
+	/**
+	 * \brief CHypoProcessingClaim destructor
+	 *
+	 * Releases the claim if it is owned, requeueing the hypo if another
+	 * thread deferred it in the meantime
+	 */
+	~CHypoProcessingClaim();
+
+	/**
+	 * \brief Gets whether this claim owns the hypo
+	 * \return Returns true if the hypo was claimed, false if it was deferred
+	 */
+	bool ownsClaim() const;
+
+ private:
+	/**
+	 * \brief The hypo claimed
+	 */
+	std::shared_ptr<CHypo> m_pHypo;
+
+	/**
+	 * \brief The CHypoList to requeue the hypo on
+	 */
+	CHypoList * m_pHypoList;
+
+	/**
+	 * \brief A boolean flag indicating whether this claim owns the hypo
+	 */
+	bool m_bOwnsClaim;
+
+	// claims can't be copied
+	CHypoProcessingClaim(const CHypoProcessingClaim &) = delete;
+	CHypoProcessingClaim & operator=(const CHypoProcessingClaim &) = delete;
+};
 }  // namespace glasscore
 #endif  // HYPOLIST_H
@@ -32,13 +32,5 @@ class CSite;
  * prevent a cyclical reference
  */
 typedef std::tuple<std::weak_ptr<CNode>, double, std::string, double, std::string, double> NodeLink; // NOLINT
-
-/**
- * \brief Typedef to simplify use of a node-site link.  Contains a CSite
- * pointer to the Site that it's linked to, and then 3 doubles:
- * Nucleation Traveltime 1 (sec), Nucleation Traveltime 2 (sec),
- * and Distance (between Node and Site) in Deg
- */
-typedef std::tuple<std::shared_ptr<CSite>, double, std::string, double, std::string, double> SiteLink; // NOLINT
 }  // namespace glasscore
 #endif  // LINK_H
@@ -41,6 +41,11 @@ class CTrigger;
  * existing centered on the node based on all picks each site linked
  * to the node
  *
+ * In a web with a coarse nucleation grid, a coarse CNode screens a cluster of
+ * fine child nodes. A coarse node nucleates against relaxed thresholds, and
+ * its children are only nucleated when it passes. Coarse nodes never produce
+ * triggers of their own.
+ *
  * CNode uses smart pointers (std::shared_ptr).
  */
 class CNode {
@@ -288,6 +293,37 @@ class CNode {
 	 */
 	bool getAseismic() const;
 
+	/**
+	 * \brief Gets a flag indicating that the node is a coarse node, which
+	 * nucleates against relaxed thresholds to screen its child nodes
+	 * \return Returns a boolean flag, true if the node is coarse, false
+	 * otherwise
+	 */
+	bool getCoarse() const;
+
+	/**
+	 * \brief Sets a flag indicating that the node is a coarse node, this
+	 * must be set before the node is linked to sites
+	 * \param coarse - a boolean flag, true if the node is coarse, false
+	 * otherwise
+	 */
+	void setCoarse(bool coarse);
+
+	/**
+	 * \brief Gets the coarse node screening this node
+	 * \return Returns a pointer to the parent coarse node, or NULL if this
+	 * node is not screened by a coarse node. The parent is owned by the
+	 * same web as this node.
+	 */
+	CNode * getParentNode() const;
+
+	/**
+	 * \brief Sets the coarse node screening this node
+	 * \param parent - a pointer to the parent coarse node, or NULL to
+	 * always nucleate this node
+	 */
+	void setParentNode(CNode * parent);
+
 	/**
 	 * \brief Get the combined node location (latitude, longitude, depth) as
 	 * a CGeo object
@@ -383,6 +419,17 @@ class CNode {
 	 */
 	std::atomic<bool> m_bAseismic;
 
+	/**
+	 * \brief A boolean flag indicating whether this node is a coarse node
+	 */
+	std::atomic<bool> m_bCoarse;
+
+	/**
+	 * \brief A pointer to the coarse node screening this node, NULL if this
+	 * node is not screened. The parent is owned by the same web as this node.
+	 */
+	std::atomic<CNode *> m_pParentNode;
+
 	/**
 	 * \brief A double value containing this node's maximum site distance in
 	 * degrees.
@@ -408,13 +455,66 @@ class CNode {
 	std::set<std::string> m_SourceSet;
 
 	/**
-	 * \brief A std::vector of tuples linking node to site
-	 * {shared site pointer, travel time 1, travel time 2}
+	 * \brief Sort the site links using the given order
+	 *
+	 * Reorders each of the parallel site link arrays so that the link at
+	 * order[i] becomes link i. Callers must hold m_SiteLinkListMutex.
+	 *
+	 * \param order - A std::vector of integers containing the new order of
+	 * the site link indexes
+	 */
+	void reorderSiteLinks(const std::vector<int> &order);
+
+	/**
+	 * \brief Remove a site link
+	 *
+	 * Removes the site link at the given index from each of the parallel site
+	 * link arrays and recomputes the maximum site distance. Callers must hold
+	 * m_SiteLinkListMutex.
+	 *
+	 * \param index - An integer containing the index of the link to remove
+	 */
+	void eraseSiteLink(int index);
+
+	/**
+	 * \brief A std::vector of the sites linked to this node. The node-site
+	 * links are stored as parallel arrays indexed the same way, so that
+	 * nucleate() streams through contiguous travel times and distances
+	 */
+	std::vector<std::shared_ptr<CSite>> m_vSiteLinkSites;
+
+	/**
+	 * \brief A std::vector of the first travel time in seconds for each site
+	 * link, -1 if there is no first travel time
+	 */
+	std::vector<double> m_vSiteLinkTravelTime1;
+
+	/**
+	 * \brief A std::vector of the second travel time in seconds for each site
+	 * link, -1 if there is no second travel time
+	 */
+	std::vector<double> m_vSiteLinkTravelTime2;
+
+	/**
+	 * \brief A std::vector of the process-wide phase id of the first travel
+	 * time phase for each site link, see traveltime::CTravelTime::getPhaseID()
+	 */
+	std::vector<int> m_vSiteLinkPhaseID1;
+
+	/**
+	 * \brief A std::vector of the process-wide phase id of the second travel
+	 * time phase for each site link
+	 */
+	std::vector<int> m_vSiteLinkPhaseID2;
+
+	/**
+	 * \brief A std::vector of the distance in degrees between the node and
+	 * the site for each site link
 	 */
-	std::vector<SiteLink> m_vSiteLinkList;
+	std::vector<double> m_vSiteLinkDistances;
 
 	/**
-	 * \brief A mutex to control threading access to vSite.
+	 * \brief A mutex to control threading access to the site links.
 	 */
 	mutable std::mutex m_SiteLinkListMutex;
 
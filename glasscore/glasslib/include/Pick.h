@@ -8,6 +8,7 @@
 #define PICK_H
 
 #include <json.h>
+#include <internedid.h>
 #include <memory>
 #include <string>
 #include <vector>
@@ -291,6 +292,13 @@ class CPick {
 	 */
 	const std::string& getID() const;
 
+	/**
+	 * \brief Get the interned handle of the ID of this pick
+	 * \return Return an unsigned integer containing the handle of the pick ID,
+	 * unique among the ids in use
+	 */
+	unsigned int getIDHandle() const;
+
 	/**
 	 * \brief Get the arrival time for this pick
 	 * \return Return a double containing the pick arrival time
@@ -338,6 +346,14 @@ class CPick {
 	 */
 	double getTNucleation() const;
 
+	/**
+	 * \brief Get the version of this pick
+	 * \return Returns an integer containing the number of times this pick
+	 * has been initialized, so that anything generated from the pick can
+	 * tell when it has been updated
+	 */
+	int getVersion() const;
+
 	/**
 	 * \brief Get the classified phase for this pick
 	 * \return Return a std::string containing the pick phase
@@ -454,9 +470,9 @@ class CPick {
 	std::string m_sPhaseName;
 
 	/**
-	 * \brief A std::string containing the string unique id of this pick
+	 * \brief A glass3::util::InternedID containing the unique id of this pick
 	 */
-	std::string m_sID;
+	glass3::util::InternedID m_ID;
 
 	/**
 	 * \brief A std::string containing the source id for this pick
@@ -569,6 +585,12 @@ class CPick {
 	 */
 	std::atomic<double> m_tNucleation;
 
+	/**
+	 * \brief An integer containing the number of times this pick has been
+	 * initialized, incremented by initialize()
+	 */
+	std::atomic<int> m_iVersion;
+
 	/**
 	 * \brief A recursive_mutex to control threading access to CPick.
 	 * NOTE: recursive mutexes are frowned upon, so maybe redesign around it
@@ -0,0 +1,113 @@
+/*****************************************
+ * This file is documented for Doxygen.
+ * If you modify this file please update
+ * the comments so that Doxygen will still
+ * be able to work.
+ ****************************************/
+#ifndef PICKINDEX_H
+#define PICKINDEX_H
+
+#include <geo.h>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace glasscore {
+
+// forward declarations
+class CPick;
+
+/**
+ * \brief glasscore pick spatial and temporal index class
+ * The CPickIndex class is an index of picks by both site location and time,
+ * used by CPickList to find the picks within a time window whose sites are
+ * within a distance of a location without checking every pick in the
+ * window. Picks are bucketed into the same grid of cubic cells over the
+ * geocentric unit vector of their site as CSiteIndex, and each cell keeps
+ * its picks sorted by their sort time. A search only looks at the cells
+ * that could hold a site within the distance, and only at the picks in
+ * the time window within those cells.
+ * CPickIndex is not thread safe, the owner is expected to lock around its
+ * use.
+ */
+class CPickIndex {
+ public:
+	/**
+	 * \brief CPickIndex constructor
+	 */
+	CPickIndex();
+
+	/**
+	 * \brief CPickIndex destructor
+	 */
+	~CPickIndex();
+
+	/**
+	 * \brief CPickIndex clear function, removes all picks
+	 */
+	void clear();
+
+	/**
+	 * \brief Add a pick
+	 * Adds the given pick to the index at its site's current location and
+	 * its current sort time, replacing any existing entry for the pick.
+	 * \param pick - A shared_ptr to the CPick to add
+	 * \return Returns true if successful, false otherwise
+	 */
+	bool addPick(std::shared_ptr<CPick> pick);
+
+	/**
+	 * \brief Remove a pick
+	 * \param pick - A shared_ptr to the CPick to remove
+	 * \return Returns true if the pick was removed, false if it was not in
+	 * the index
+	 */
+	bool removePick(std::shared_ptr<CPick> pick);
+
+	/**
+	 * \brief Get the picks near a location within a time window
+	 * Gets the picks with sort times from t1 to t2, inclusive, that are
+	 * within maxDistance of the given location, sorted by sort time. Picks
+	 * slightly farther than maxDistance may be included, but no pick within
+	 * maxDistance is left out.
+	 * \param geo - A glass3::util::Geo containing the location to search from
+	 * \param maxDistance - A double containing the maximum distance from the
+	 * location to a pick's site in radians
+	 * \param t1 - A double value containing the beginning of the time window
+	 * in Gregorian seconds
+	 * \param t2 - A double value containing the end of the time window in
+	 * Gregorian seconds
+	 * \return Returns a std::vector of std::weak_ptrs to the picks found
+	 */
+	std::vector<std::weak_ptr<CPick>> getPicks(const glass3::util::Geo &geo,
+												double maxDistance, double t1,
+												double t2) const;
+
+	/**
+	 * \brief Get the number of picks in the index
+	 * \return Returns an integer containing the number of picks
+	 */
+	int size() const;
+
+ private:
+	/**
+	 * \brief the picks in a cell, sorted by sort time
+	 */
+	typedef std::multimap<double, std::shared_ptr<CPick>> CellPicks;
+
+	/**
+	 * \brief A std::map of cell index to the picks within the cell, only
+	 * cells holding picks are present
+	 */
+	std::map<int, CellPicks> m_mCells;
+
+	/**
+	 * \brief A std::unordered_map of each indexed pick to the cell index and
+	 * iterator of its entry
+	 */
+	std::unordered_map<const CPick *, std::pair<int, CellPicks::iterator>> m_mPickEntries;  // NOLINT
+};
+}  // namespace glasscore
+#endif  // PICKINDEX_H
@@ -23,6 +23,7 @@
 
 #include "Glass.h"
 #include "Pick.h"
+#include "PickIndex.h"
 #include "HypoList.h"
 
 namespace glasscore {
@@ -215,6 +216,29 @@ class CPickList : public glass3::util::ThreadBaseClass {
 	 */
 	std::vector<std::weak_ptr<CPick>> getPicks(double t1, double t2);
 
+	/**
+	 * \brief Get a vector of picks that fall within a time window and
+	 * distance
+	 *
+	 * Get a vector of picks that fall within the provided time window from t1
+	 * to t2 and whose sites are within maxDistance of the provided location,
+	 * using the pick index rather than checking every pick in the window.
+	 * Picks slightly farther than maxDistance may be included.
+	 *
+	 * \param t1 - A double value containing the beginning of the time window in
+	 * Gregorian seconds
+	 * \param t2 - A double value containing the end of the time window in
+	 * Gregorian seconds
+	 * \param geo - A glass3::util::Geo containing the location to search from
+	 * \param maxDistance - A double value containing the maximum distance
+	 * from the location to a pick's site in degrees
+	 * \return Return a std::vector of std::weak_ptrs to the picks within the
+	 * time window and distance, in time order
+	 */
+	std::vector<std::weak_ptr<CPick>> getPicks(double t1, double t2,
+												const glass3::util::Geo &geo,
+												double maxDistance);
+
 	/**
 	 * \brief PickList work function
 	 *
@@ -264,6 +288,12 @@ class CPickList : public glass3::util::ThreadBaseClass {
 	 */
 	std::multiset<std::shared_ptr<CPick>, PickCompare> m_msPickList;
 
+	/**
+	 * \brief A CPickIndex containing each pick in m_msPickList indexed by
+	 * site location and sort time, used by scavenge()
+	 */
+	CPickIndex m_PickIndex;
+
 	/**
 	 * \brief A std::queue containing a std::shared_ptr to each json::Object
 	 * containing a pick that needs to be processed
@@ -8,12 +8,13 @@
 #define SITE_H
 
 #include <json.h>
+#include <internedid.h>
 #include <geo.h>
-#include <set>
 #include <string>
 #include <vector>
 #include <memory>
 #include <utility>
+#include <unordered_map>
 #include <tuple>
 #include <mutex>
 #include <atomic>
@@ -29,20 +30,51 @@ class CHypo;
 class CPickList;
 
 /**
- * \brief CSite comparison function
+ * \brief glasscore site pick block
  *
- * PickCompare contains the comparison function used by std::multiset when
- * SitePickCompare, sorting, and retrieving picks.
+ * The SitePickBlock struct contains fixed size storage for the picks made at
+ * a site, in sequential time order from oldest to youngest, along with the
+ * sort time of each pick so that time windows can be found by binary search.
+ * A block is shared between pick snapshots, picks are only ever appended to
+ * it past the end of every published snapshot, so the entries a snapshot
+ * covers never change.
  */
-struct SitePickCompare {
-	bool operator()(const std::shared_ptr<CPick> &lhs,
-					const std::shared_ptr<CPick> &rhs) const {
-		if (lhs->getTSort() < rhs->getTSort()) {
-			return (true);
-		}
-		return (false);
-	}
-};
+typedef struct _SitePickBlock {
+	/**
+	 * \brief A std::vector containing the sort time of each pick in
+	 * vPicks, in Gregorian seconds
+	 */
+	std::vector<double> vdPickTimes;
+
+	/**
+	 * \brief A std::vector of shared_ptrs to the picks
+	 */
+	std::vector<std::shared_ptr<CPick>> vPicks;
+} SitePickBlock;
+
+/**
+ * \brief glasscore site pick snapshot
+ *
+ * The SitePickSnapshot struct contains a read only view of the picks made at
+ * a site, the entries of a SitePickBlock from iStart up to iEnd.
+ */
+typedef struct _SitePickSnapshot {
+	/**
+	 * \brief A shared_ptr to the block holding the picks
+	 */
+	std::shared_ptr<const SitePickBlock> pBlock;
+
+	/**
+	 * \brief An integer containing the index of the oldest pick in pBlock
+	 */
+	int iStart;
+
+	/**
+	 * \brief An integer containing the index one past the youngest pick in
+	 * pBlock
+	 */
+	int iEnd;
+} SitePickSnapshot;
 
 /**
  * \brief glasscore site (station) class
@@ -55,7 +87,11 @@ struct SitePickCompare {
  * CSite maintains graph database links between it and one or more detection
  * nodes
  *
- * CSite maintains a list of picks made at the site
+ * CSite maintains a list of picks made at the site, stored in a contiguous
+ * buffer sorted by time. Since picks arrive nearly in time order and expire
+ * oldest first, inserts are almost always at the end and removals at the
+ * start of the buffer, which is compacted once enough of its start has been
+ * vacated.
  *
  * CSite contains function to support nucleation of a new event based
  * on a potential origin time and each of the detection nodes linked to the site.
@@ -260,6 +296,16 @@ class CSite {
 	 *
 	 * The function uses addTrigger to keep track of triggering nodes
 	 *
+	 * If CGlass::getNucleationWorkPool() is available and this site is linked
+	 * to more than k_iNodesPerNucleationJob nodes, the nodes are split into
+	 * groups that are nucleated by the pool threads and the calling thread
+	 * together, and the triggers from each group are merged in node order
+	 * so that the result is the same as nucleating the nodes serially.
+	 *
+	 * Coarse nodes linked to this site are nucleated first, against their
+	 * relaxed thresholds. A node whose parent coarse node is linked to this
+	 * site and did not pass is skipped. Coarse nodes never produce triggers.
+	 *
 	 * \param tpick - A double value containing the pick time to nucleate with
 	 * in Gregorian seconds
 	 * \param parentThread - A pointer to the parent CPickList thread to allow 
@@ -282,6 +328,12 @@ class CSite {
 	void addTriggerToList(std::vector<std::shared_ptr<CTrigger>> *vTrigger,
 							std::shared_ptr<CTrigger> trigger);
 
+	/**
+	 * \brief The number of linked nodes nucleated together as one job when
+	 * nucleation is spread across the nucleation work pool
+	 */
+	static const int k_iNodesPerNucleationJob = 32;
+
 	/**
 	 * \brief Gets the number of nodes linked to this site
 	 * \return Returns an integer containing the number of nodes linked to this
@@ -393,6 +445,13 @@ class CSite {
 	 */
 	const std::string& getSCNL() const;
 
+	/**
+	 * \brief Get the interned handle of the SCNL identifier for this site
+	 * \return Returns an unsigned integer containing the handle of the SCNL
+	 * identifier, unique among the ids in use
+	 */
+	unsigned int getSCNLHandle() const;
+
 	/**
 	 * \brief Get the Site (station) name for this site
 	 * \return Returns a std::string containing the station name for this site
@@ -453,67 +512,176 @@ class CSite {
 	int getPickCount() const;
 
 	/**
-	 * \brief Gets the lower bound of the pick multiset at the provided time
-	 * \param min - a double value containing the desired time to generate
-	 * the lower value at in Gregorian seconds
-	 * \return Returns an interator pointing to the first pick in the multiset
-	 * greater than the provided time
+	 * \brief Gets the picks made at this site within a time window
+	 *
+	 * If CGlass::getSitePickSnapshots() is enabled, this copies the window
+	 * out of the read only snapshot published the last time the picks at
+	 * this site changed, without waiting on pick insertion. Otherwise it
+	 * copies the window while holding the pick lock.
+	 *
+	 * \param min - a double value containing the earliest pick sort time to
+	 * get in Gregorian seconds
+	 * \param max - a double value containing the latest pick sort time to
+	 * get in Gregorian seconds
+	 * \param picks - a pointer to a std::vector to fill with shared_ptrs to
+	 * the picks in time order, cleared first so the caller can reuse it
 	 */
-	std::multiset<std::shared_ptr<CPick>, SitePickCompare>::iterator getLower(
-			double min);
+	void getPickWindow(double min, double max,
+						std::vector<std::shared_ptr<CPick>> *picks);
 
 	/**
-	 * \brief Gets the upper bound of the pick multiset at the provided time
-	 * \param max - a double value containing the desired time to generate
-	 * the upper value at in Gregorian seconds
-	 * \return Returns an interator pointing to the first pick in the multiset
-	 * less than the provided time
+	 * \brief Gets the most recently published pick snapshot
+	 * \return Returns a shared_ptr to the SitePickSnapshot published the last
+	 * time the picks at this site changed, or NULL if
+	 * CGlass::getSitePickSnapshots() was not enabled then
 	 */
-	std::multiset<std::shared_ptr<CPick>, SitePickCompare>::iterator getUpper(
-			double max);
+	std::shared_ptr<const SitePickSnapshot> getPickSnapshot() const;
 
 	/**
-	 * \brief Gets the end iterator of the pick multiset
-	 * \return Returns an interator pointing to end of the multiset i.e. end()
+	 * \brief A PickList function that updates the position of the given pick
+	 * in the pick buffer
+	 * \param pick - A shared_ptr to the pick that needs a position update
 	 */
-	std::multiset<std::shared_ptr<CPick>, SitePickCompare>::iterator getEnd();
+	void updatePosition(std::shared_ptr<CPick> pick);
 
+ private:
 	/**
-	 * \brief Gets pick multiset mutex
-	 * \return Returns the std::mutex protecting the pick multiset
+	 * \brief Try to nucleate a new event at a range of the nodes linked to
+	 * this site, the caller is expected to hold m_vNodeMutex
+	 *
+	 * \param first - An integer containing the index of the first node link
+	 * in m_vNode to nucleate at
+	 * \param last - An integer containing the index one past the last node
+	 * link in m_vNode to nucleate at
+	 * \param tPick - A double value containing the pick time to nucleate with
+	 * in Gregorian seconds
+	 * \param parentThread - A pointer to the parent CPickList thread
+	 * \param coarseResults - A pointer to a std::unordered_map of each coarse
+	 * node linked to this site to whether it passed, nodes whose parent
+	 * failed are skipped
+	 * \param vTrigger - a pointer to a vector of shared_ptr's to add the
+	 * generated triggers to
 	 */
-	std::mutex & getPickMutex();
+	void nucleateNodes(int first, int last, double tPick,
+						CPickList* parentThread,
+						const std::unordered_map<const CNode *, bool> *coarseResults,  // NOLINT
+						std::vector<std::shared_ptr<CTrigger>> *vTrigger);
 
 	/**
-	 * \brief A PickList function that updates the position of the given pick
-	 * in the multiset
-	 * \param pick - A shared_ptr to the pick that needs a position update
+	 * \brief Try to nucleate a new event at a node linked to this site
+	 *
+	 * \param link - The NodeLink to the node to nucleate at
+	 * \param tPick - A double value containing the pick time to nucleate with
+	 * in Gregorian seconds
+	 * \param parentThread - A pointer to the parent CPickList thread
+	 * \return Returns a shared_ptr to the CTrigger generated by the node, or
+	 * NULL if the node did not nucleate
 	 */
-	void updatePosition(std::shared_ptr<CPick> pick);
+	std::shared_ptr<CTrigger> nucleateNode(const NodeLink &link, double tPick,
+											CPickList* parentThread);
 
- private:
 	/**
-	 * \brief A PickList function that removes the given pick from the multiset
+	 * \brief A PickList function that removes the given pick from the pick
+	 * buffer, the caller is expected to hold vPickMutex
 	 * \param pick - A shared_ptr to the pick to be removed
 	 */
-	void eraseFromMultiset(std::shared_ptr<CPick> pick);
+	void eraseFromPickBuffer(std::shared_ptr<CPick> pick);
+
+	/**
+	 * \brief Inserts the given pick into the pick buffer in time order, the
+	 * caller is expected to hold vPickMutex
+	 * \param pick - A shared_ptr to the pick to be inserted
+	 */
+	void insertIntoPickBuffer(std::shared_ptr<CPick> pick);
 
 	/**
-	 * \brief A mutex to control threading access to vPick.
+	 * \brief Publishes a new pick snapshot if CGlass::getSitePickSnapshots()
+	 * is enabled, the caller is expected to hold vPickMutex
+	 *
+	 * Picks appended to or removed from the front of the pick buffer since
+	 * the last snapshot are published in the current pick block, any other
+	 * change copies the picks into a new block.
+	 */
+	void publishPickSnapshot();
+
+	/**
+	 * \brief A mutex to control threading access to the pick buffer.
 	 */
 	mutable std::mutex vPickMutex;
 
 	/**
-	 * \brief A std::multiset containing each pick made at this site in sequential
-	 * time order from oldest to youngest.
+	 * \brief A std::vector containing the sort time of each pick in
+	 * m_vPickBuffer, in Gregorian seconds
+	 */
+	std::vector<double> m_vPickBufferTimes;
+
+	/**
+	 * \brief A std::vector containing each pick made at this site in
+	 * sequential time order from oldest to youngest, starting at
+	 * m_iPickBufferStart. Entries before m_iPickBufferStart have been removed
+	 * and are waiting for the buffer to be compacted.
+	 */
+	std::vector<std::shared_ptr<CPick>> m_vPickBuffer;
+
+	/**
+	 * \brief An integer containing the index of the oldest pick in
+	 * m_vPickBuffer
+	 */
+	int m_iPickBufferStart;
+
+	/**
+	 * \brief A shared_ptr to the most recently published pick snapshot, only
+	 * accessed with std::atomic_load and std::atomic_store
+	 */
+	std::shared_ptr<const SitePickSnapshot> m_pPickSnapshot;
+
+	/**
+	 * \brief A shared_ptr to the pick block used by the most recently
+	 * published pick snapshot
+	 */
+	std::shared_ptr<SitePickBlock> m_pPickBlock;
+
+	/**
+	 * \brief An integer containing the index of the oldest pick in
+	 * m_pPickBlock for the most recently published pick snapshot
+	 */
+	int m_iPickSnapshotStart;
+
+	/**
+	 * \brief An integer containing the index one past the youngest pick in
+	 * m_pPickBlock for the most recently published pick snapshot, nothing
+	 * past it has been written
 	 */
-	std::multiset<std::shared_ptr<CPick>, SitePickCompare> m_msPickList;
+	int m_iPickSnapshotEnd;
 
 	/**
-	 * \brief A std::string containing the SCNL (Site, Component, Network,
-	 * Location) identifier for this site.
+	 * \brief An integer containing the number of picks removed from the
+	 * front of the pick buffer since the last pick snapshot
 	 */
-	std::string m_sSCNL;
+	int m_iPickSnapshotRemoved;
+
+	/**
+	 * \brief An integer containing the number of picks appended to the end
+	 * of the pick buffer since the last pick snapshot
+	 */
+	int m_iPickSnapshotAppended;
+
+	/**
+	 * \brief A boolean flag indicating whether the pick buffer changed since
+	 * the last pick snapshot in a way that needs a new pick block
+	 */
+	bool m_bPickSnapshotRebuild;
+
+	/**
+	 * \brief The minimum number of picks a new pick block holds
+	 */
+	static const int k_iMinimumPickBlockSize = 64;
+
+	/**
+	 * \brief A glass3::util::InternedID containing the SCNL (Site, Component,
+	 * Network, Location) identifier for this site.
+	 */
+	glass3::util::InternedID m_SCNL;
 
 	/**
 	 * \brief A std::string containing the Site (station) name for this site.
@@ -604,6 +772,12 @@ class CSite {
 	 */
 	std::vector<NodeLink> m_vNode;
 
+	/**
+	 * \brief A std::vector of tuples linking site to coarse nodes, which
+	 * screen the nodes in m_vNode during nucleation
+	 */
+	std::vector<NodeLink> m_vCoarseNode;
+
 	/**
 	 * \brief A recursive_mutex to control threading access to CSite.
 	 * NOTE: recursive mutexes are frowned upon, so maybe redesign around it
@@ -619,18 +793,6 @@ class CSite {
 	 */
 	std::atomic<double> m_tLastPickAdded;
 
-	/**
-	 * \brief A shared_ptr to a pick used to represent the lower value in
-	 * getPicks() calls
-	 */
-	std::shared_ptr<CPick> m_LowerValue;
-
-	/**
-	 * \brief A shared_ptr to a pick used to represent the upper value in
-	 * getPicks() calls
-	 */
-	std::shared_ptr<CPick> m_UpperValue;
-
 	// constants
 	/**
 	 * \brief The index of the X coordinate in the unit vector array
@@ -0,0 +1,158 @@
+/*****************************************
+ * This file is documented for Doxygen.
+ * If you modify this file please update
+ * the comments so that Doxygen will still
+ * be able to work.
+ ****************************************/
+#ifndef SITEINDEX_H
+#define SITEINDEX_H
+
+#include <geo.h>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace glasscore {
+
+// forward declarations
+class CSite;
+
+/**
+ * \brief glasscore site spatial index class
+ *
+ * The CSiteIndex class is a spatial index of sites, used by CWeb to find the
+ * sites nearest to a node location without sorting every site in the web.
+ *
+ * Sites are bucketed into a uniform grid of cubic cells over their
+ * geocentric unit vectors. Since the chord between two unit vectors grows
+ * with the angular distance between them, the nearest sites to a location
+ * can be found by searching outward from the cell containing the location
+ * one shell of cells at a time, stopping once no unsearched cell can hold a
+ * closer site. Adding, updating, or removing a site only touches the cell
+ * holding it.
+ *
+ * CSiteIndex is not thread safe, the owner is expected to lock around its
+ * use.
+ */
+class CSiteIndex {
+ public:
+	/**
+	 * \brief CSiteIndex constructor
+	 */
+	CSiteIndex();
+
+	/**
+	 * \brief CSiteIndex destructor
+	 */
+	~CSiteIndex();
+
+	/**
+	 * \brief CSiteIndex clear function, removes all sites
+	 */
+	void clear();
+
+	/**
+	 * \brief Add or update a site
+	 *
+	 * Adds the given site to the index at its current location, replacing
+	 * any existing entry for a site with the same SCNL.
+	 *
+	 * \param site - A shared_ptr to the CSite to add
+	 * \return Returns true if successful, false otherwise
+	 */
+	bool addSite(std::shared_ptr<CSite> site);
+
+	/**
+	 * \brief Remove a site
+	 *
+	 * \param scnl - A std::string containing the SCNL of the site to remove
+	 * \return Returns true if the site was removed, false if it was not in
+	 * the index
+	 */
+	bool removeSite(const std::string &scnl);
+
+	/**
+	 * \brief Check if a site is in the index
+	 *
+	 * \param scnl - A std::string containing the SCNL of the site to check
+	 * \return Returns true if the site is in the index, false otherwise
+	 */
+	bool hasSite(const std::string &scnl) const;
+
+	/**
+	 * \brief Get the nearest sites
+	 *
+	 * Gets the given number of sites nearest to the given location, along
+	 * with their distance in radians, sorted by increasing distance. The
+	 * result is the same as computing the distance to every site with
+	 * glass3::util::Geo::delta() and sorting.
+	 *
+	 * \param geo - A glass3::util::Geo containing the location to search from
+	 * \param numSites - An integer containing the number of sites to get
+	 * \return Returns a std::vector of std::pairs of the distance in radians
+	 * and a shared_ptr to each site, containing the lesser of numSites and
+	 * size() sites
+	 */
+	std::vector<std::pair<double, std::shared_ptr<CSite>>> getNearestSites(
+			const glass3::util::Geo &geo, int numSites) const;
+
+	/**
+	 * \brief Get the number of sites in the index
+	 *
+	 * \return Returns an integer containing the number of sites
+	 */
+	int size() const;
+
+	/**
+	 * \brief The number of cells along each axis of the unit vector grid
+	 */
+	static const int k_iNumCellsPerAxis = 16;
+
+	/**
+	 * \brief Get the grid cell index along one axis for a unit vector
+	 * component
+	 *
+	 * \param unitVector - A double containing the unit vector component
+	 * \return Returns an integer containing the cell index along the axis
+	 */
+	static int getAxisIndex(double unitVector);
+
+	/**
+	 * \brief Get the grid cell index for a set of axis indexes
+	 *
+	 * \param xIndex - An integer containing the cell index along the x axis
+	 * \param yIndex - An integer containing the cell index along the y axis
+	 * \param zIndex - An integer containing the cell index along the z axis
+	 * \return Returns an integer containing the index into m_vCells
+	 */
+	static int getCellIndex(int xIndex, int yIndex, int zIndex);
+
+	/**
+	 * \brief Get the shortest chord between a unit vector and any point in a
+	 * grid cell
+	 *
+	 * \param geo - A glass3::util::Geo containing the unit vector
+	 * \param cellIndex - An integer containing the cell index
+	 * \return Returns a double containing the chord length
+	 */
+	static double getCellChord(const glass3::util::Geo &geo, int cellIndex);
+
+ private:
+
+	/**
+	 * \brief The grid cells, each holding a std::vector of the sites within
+	 * it along with a copy of their location
+	 */
+	std::vector<std::vector<std::pair<glass3::util::Geo, std::shared_ptr<CSite>>>> m_vCells;  // NOLINT
+
+	/**
+	 * \brief A std::unordered_map of site SCNL handle to the index of the cell
+	 * holding it
+	 */
+	std::unordered_map<unsigned int, int> m_mSiteCells;
+};
+}  // namespace glasscore
+#endif  // SITEINDEX_H
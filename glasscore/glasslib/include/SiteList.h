@@ -14,6 +14,7 @@
 #include <vector>
 #include <memory>
 #include <map>
+#include <unordered_map>
 #include <mutex>
 #include <thread>
 #include <atomic>
@@ -244,10 +245,10 @@ class CSiteList : public glass3::util::ThreadBaseClass {
 	std::vector<std::shared_ptr<CSite>> m_vSite;
 
 	/**
-	 * \brief A std::map containing a std::shared_ptr to each site
-	 * in CSiteList indexed by the std::string scnl id.
+	 * \brief A std::unordered_map containing a std::shared_ptr to each site
+	 * in CSiteList indexed by the interned handle of the scnl id.
 	 */
-	std::map<std::string, std::shared_ptr<CSite>> m_mSite;
+	std::unordered_map<unsigned int, std::shared_ptr<CSite>> m_mSite;
 
 	/**
 	 * \brief A std::map the last time in epoch seconds each site in CSiteList
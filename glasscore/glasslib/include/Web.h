@@ -16,6 +16,7 @@
 #include <memory>
 #include <vector>
 #include <mutex>
+#include <condition_variable>
 #include <thread>
 #include <queue>
 #include <map>
@@ -23,6 +24,13 @@
 
 #include "TravelTime.h"
 #include "ZoneStats.h"
+#include "SiteIndex.h"
+
+namespace glass3 {
+namespace util {
+class ThreadPool;
+}  // namespace util
+}  // namespace glass3
 
 namespace glasscore {
 
@@ -266,10 +274,11 @@ class CWeb : public glass3::util::ThreadBaseClass {
 	/**
 	 * \brief Sort site list
 	 *
-	 * This function sorts a list of sites stored in vSite in increasing
-	 * distance from the given location at 0 depth.  The function also populates
-	 * the distance between the given location and the site as part of the
-	 * std::pair in vSite.
+	 * This function fills m_vSitesSortedForCurrentNode with the
+	 * m_iNumStationsPerNode sites nearest to the given location at 0 depth in
+	 * increasing distance, using the m_SiteIndex spatial index.  The function
+	 * also populates the distance between the given location and the site as
+	 * part of the std::pair in m_vSitesSortedForCurrentNode.
 	 *
 	 * \param lat - A double variable containing the latitude to use in degrees
 	 * \param lon - A double variable containing the longitude to use in degrees
@@ -306,10 +315,28 @@ class CWeb : public glass3::util::ThreadBaseClass {
 	 * \param lon - A double variable containing the longitude to use
 	 * \param z - A double variable containing the depth to use
 	 * \param resol - A double variable containing the spatial resolution to use
+	 * \param coarse - A boolean flag indicating whether to create a coarse
+	 * node, defaults to false
 	 * \return Returns a std::shared_ptr to the newly created node.
 	 */
 	std::shared_ptr<CNode> generateNode(double lat, double lon, double z,
-										double resol);
+										double resol, bool coarse = false);
+
+	/**
+	 * \brief Create the coarse nucleation nodes for this web
+	 *
+	 * If a coarse resolution larger than the node resolution is configured,
+	 * this function clusters the (fine) nodes of this web by location within
+	 * each depth layer, using cells of about the coarse resolution, and
+	 * creates one coarse node at the center of each cluster of two or more
+	 * nodes. Each coarse node is given a resolution large enough to cover its
+	 * children, and becomes the parent node of each of its children, so that
+	 * the children are only nucleated when the coarse node passes the relaxed
+	 * coarse thresholds.
+	 *
+	 * \return Returns an integer containing the number of coarse nodes created
+	 */
+	int generateCoarseNodes();
 
 	/**
 	 * \brief Add node to list
@@ -378,12 +405,24 @@ class CWeb : public glass3::util::ThreadBaseClass {
 	 * \brief add a job
 	 *
 	 * Adds a job to the queue of jobs to be run by the background
-	 * thread
+	 * thread, or by the job pool if one is set
 	 * \param newjob - A std::function<void()> bound to the function
 	 * containing the job to run
 	 */
 	void addJob(std::function<void()> newjob);
 
+	/**
+	 * \brief Set the job pool
+	 *
+	 * Sets a glass3::util::ThreadPool shared with other webs and glass work
+	 * that runs this web's jobs instead of its own background threads. The
+	 * jobs of one web are still run one at a time, in the order they were
+	 * added.
+	 * \param jobPool - A pointer to the glass3::util::ThreadPool to run jobs
+	 * in, NULL to use the background threads
+	 */
+	void setJobPool(glass3::util::ThreadPool * jobPool);
+
 	/**
 	 * \brief Get the azimuth taper used for this web
 	 * \return Returns a double value containing the taper to use
@@ -438,6 +477,21 @@ class CWeb : public glass3::util::ThreadBaseClass {
 	 */
 	double getNodeResolution() const;
 
+	/**
+	 * \brief Gets the coarse nucleation node resolution of this web
+	 * \return Returns a double value containing the coarse node resolution
+	 * of this web in kilometers, or k_dCoarseResolutionUndefined if this web
+	 * does not use coarse nodes
+	 */
+	double getCoarseResolution() const;
+
+	/**
+	 * \brief Gets the factor applied to the nucleation thresholds of coarse
+	 * nodes in this web
+	 * \return Returns a double value containing the coarse threshold factor
+	 */
+	double getCoarseThresholdFactor() const;
+
 	/**
 	 * \brief Gets the nucleation minimum stack threshold used for this web
 	 * \return Returns a double value containing the nucleation minimum stack
@@ -606,14 +660,20 @@ class CWeb : public glass3::util::ThreadBaseClass {
 	std::atomic<bool> m_bUseOnlyTeleseismicStations;
 
 	/**
-	 * \brief A std::vector containing a std::pair for each the sites to use
-	 * in node generation and the distance to the current node location.
-	 * vSite is populated by genSiteList(), and sorted by sortSiteList() (which
-	 * also fills in the distance), and used by genNode() during a Single(),
-	 * Shell(), Grid(), or Global() call
+	 * \brief A std::vector containing a std::pair for each of the sites
+	 * nearest to the current node location and their distance to it, sorted
+	 * by distance. Filled from m_SiteIndex by sortSiteListForNode(), and used
+	 * by generateNodeSites() and removeSite()
 	 */
 	std::vector<std::pair<double, std::shared_ptr<CSite>>>m_vSitesSortedForCurrentNode;  // NOLINT
 
+	/**
+	 * \brief A CSiteIndex containing the sites to use in node generation,
+	 * populated by loadWebSiteList() and kept up to date by
+	 * addSiteToSiteList() and removeSiteFromSiteList()
+	 */
+	CSiteIndex m_SiteIndex;
+
 	/**
 	 * \brief A std::vector containing a std::shared_ptr to each node in this
 	 * web
@@ -707,6 +767,18 @@ class CWeb : public glass3::util::ThreadBaseClass {
 	 **/
 	std::atomic<double> m_dDepthResolution;
 
+	/**
+	 * \brief A double which describes the resolution in kilometers used to
+	 * cluster the nodes of this web under coarse nucleation nodes
+	 **/
+	std::atomic<double> m_dCoarseResolution;
+
+	/**
+	 * \brief A double containing the factor applied to the nucleation
+	 * thresholds of the coarse nodes in this web
+	 **/
+	std::atomic<double> m_dCoarseThresholdFactor;
+
 	/**
 	 * \brief A boolean flag that stores whether to update this web when a
 	 * station has changed.
@@ -764,6 +836,32 @@ class CWeb : public glass3::util::ThreadBaseClass {
 	 */
 	std::mutex m_QueueMutex;
 
+	/**
+	 * \brief A pointer to the glass3::util::ThreadPool that runs the jobs in
+	 * m_JobQueue, NULL if they are run by the background threads
+	 */
+	glass3::util::ThreadPool * m_pJobPool;
+
+	/**
+	 * \brief A boolean flag indicating that a runQueuedJobs() call is added
+	 * to or running in m_pJobPool, protected by m_QueueMutex
+	 */
+	bool m_bJobsScheduled;
+
+	/**
+	 * \brief A std::condition_variable signaled when m_bJobsScheduled is
+	 * cleared, so the destructor can wait for the job pool to let go of us
+	 */
+	std::condition_variable m_JobsScheduledCondition;
+
+	/**
+	 * \brief run the queued jobs
+	 *
+	 * Runs the jobs in m_JobQueue in order until it is empty, added to
+	 * m_pJobPool by addJob()
+	 */
+	void runQueuedJobs();
+
 	/**
 	 * \brief string containing the filename of ZoneStats file.  Empty = no
 	 * zonestats
@@ -799,6 +897,18 @@ class CWeb : public glass3::util::ThreadBaseClass {
 	 */
 	static constexpr double k_dDepthResolutionUndefined = -1.0;
 
+	/**
+	 * \brief the value for an undefined coarse resolution, which disables
+	 * coarse nodes
+	 */
+	static constexpr double k_dCoarseResolutionUndefined = -1.0;
+
+	/**
+	 * \brief the default factor applied to the nucleation thresholds of
+	 * coarse nodes
+	 */
+	static constexpr double k_dCoarseThresholdFactorDefault = 0.5;
+
 	/**
 	 * \brief the ratio used when generating the global grids
 	 * NOTE: = (1 + std::sqrt(5.0)) / 2.0
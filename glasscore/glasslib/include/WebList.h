@@ -12,6 +12,12 @@
 #include <memory>
 #include <mutex>
 
+namespace glass3 {
+namespace util {
+class ThreadPool;
+}  // namespace util
+}  // namespace glass3
+
 namespace glasscore {
 
 // forward declarations
@@ -140,6 +146,16 @@ class CWebList {
 	 */
 	void setSiteList(CSiteList* siteList);
 
+	/**
+	 * \brief Set the job pool used by webs added after this call
+	 *
+	 * Webs added with a job pool run their update jobs in it, rather than
+	 * in their own background threads
+	 * \param jobPool - a pointer to the glass3::util::ThreadPool to run web
+	 * jobs in, NULL for each web to use its own background threads
+	 */
+	void setJobPool(glass3::util::ThreadPool* jobPool);
+
 	/**
 	 * \brief Get controlling web for coordinates 
 	 *
@@ -174,6 +190,12 @@ class CWebList {
 	 */
 	int m_iNumThreads;
 
+	/**
+	 * \brief A pointer to the glass3::util::ThreadPool that runs the web
+	 * jobs, NULL if each web runs its own jobs
+	 */
+	glass3::util::ThreadPool* m_pJobPool;
+
 	/**
 	 * \brief A recursive_mutex to control threading access to CCorrelationList.
 	 * NOTE: recursive mutexes are frowned upon, so maybe redesign around it
@@ -17,7 +17,8 @@
 namespace glasscore {
 
 // ---------------------------------------------------------CCorrelation
-CCorrelation::CCorrelation() {
+CCorrelation::CCorrelation()
+		: m_iVersion(0) {
 	clear();
 }
 
@@ -26,7 +27,8 @@ CCorrelation::CCorrelation(std::shared_ptr<CSite> correlationSite,
 							double correlationTime,
 							std::string correlationIdString, std::string phase,
 							double orgTime, double orgLat, double orgLon,
-							double orgZ, double corrVal) {
+							double orgZ, double corrVal)
+		: m_iVersion(0) {
 	clear();
 
 	initialize(correlationSite, correlationTime,
@@ -36,13 +38,13 @@ CCorrelation::CCorrelation(std::shared_ptr<CSite> correlationSite,
 
 // ---------------------------------------------------------CCorrelation
 CCorrelation::CCorrelation(std::shared_ptr<json::Object> correlation,
-							CSiteList *pSiteList) {
+							CSiteList *pSiteList)
+		: m_iVersion(0) {
 	clear();
 
 	// null check json
 	if (correlation == NULL) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CCorrelation::CCorrelation: NULL json correlation message.");
 		return;
 	}
@@ -53,15 +55,13 @@ CCorrelation::CCorrelation(std::shared_ptr<json::Object> correlation,
 		std::string type = (*correlation)["Type"].ToString();
 
 		if (type != "Correlation") {
-			glass3::util::Logger::log(
-					"warning",
+			GLASS3_LOG_WARNING(
 					"CCorrelation::CCorrelation: Non-Correlation type message"
 					" passed in.");
 			return;
 		}
 	} else {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CCorrelation::CCorrelation: Missing required Type Key.");
 		return;
 	}
@@ -94,8 +94,7 @@ CCorrelation::CCorrelation(std::shared_ptr<json::Object> correlation,
 				&& (siteobj["Station"].GetType() == json::ValueType::StringVal)) {
 			sta = siteobj["Station"].ToString();
 		} else {
-			glass3::util::Logger::log(
-					"error",
+			GLASS3_LOG_ERROR(
 					"CCorrelation::CCorrelation: Missing required Station Key.");
 
 			return;
@@ -114,8 +113,7 @@ CCorrelation::CCorrelation(std::shared_ptr<json::Object> correlation,
 				&& (siteobj["Network"].GetType() == json::ValueType::StringVal)) {
 			net = siteobj["Network"].ToString();
 		} else {
-			glass3::util::Logger::log(
-					"error",
+			GLASS3_LOG_ERROR(
 					"CCorrelation::CCorrelation: Missing required Network Key.");
 
 			return;
@@ -130,8 +128,7 @@ CCorrelation::CCorrelation(std::shared_ptr<json::Object> correlation,
 		}
 	} else {
 		// no site key
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CCorrelation::CCorrelation: Missing required Site Key.");
 
 		return;
@@ -144,8 +141,7 @@ CCorrelation::CCorrelation(std::shared_ptr<json::Object> correlation,
 
 	// check to see if we got a site
 	if (site == NULL) {
-		glass3::util::Logger::log("warning",
-								"CCorrelation::CCorrelation: site is null.");
+		GLASS3_LOG_WARNING("CCorrelation::CCorrelation: site is null.");
 
 		return;
 	}
@@ -163,8 +159,7 @@ CCorrelation::CCorrelation(std::shared_ptr<json::Object> correlation,
 		glass3::util::Date dt = glass3::util::Date();
 		tcorr = dt.decodeISO8601Time(ttt);
 	} else {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CCorrelation::CCorrelation: Missing required Time Key.");
 
 		return;
@@ -176,8 +171,7 @@ CCorrelation::CCorrelation(std::shared_ptr<json::Object> correlation,
 			&& ((*correlation)["ID"].GetType() == json::ValueType::StringVal)) {
 		pid = (*correlation)["ID"].ToString();
 	} else {
-		glass3::util::Logger::log(
-				"warning",
+		GLASS3_LOG_WARNING(
 				"CCorrelation::CCorrelation: Missing required ID Key.");
 
 		return;
@@ -188,8 +182,7 @@ CCorrelation::CCorrelation(std::shared_ptr<json::Object> correlation,
 			&& ((*correlation)["Phase"].GetType() == json::ValueType::StringVal)) {
 		phs = (*correlation)["Phase"].ToString();
 	} else {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CCorrelation::CCorrelation: Missing required Phase Key.");
 
 		return;
@@ -208,8 +201,7 @@ CCorrelation::CCorrelation(std::shared_ptr<json::Object> correlation,
 				&& (hypoobj["Latitude"].GetType() == json::ValueType::DoubleVal)) {
 			lat = hypoobj["Latitude"].ToDouble();
 		} else {
-			glass3::util::Logger::log(
-					"error",
+			GLASS3_LOG_ERROR(
 					"CCorrelation::CCorrelation: Missing required Hypocenter"
 					" Latitude Key.");
 
@@ -221,8 +213,7 @@ CCorrelation::CCorrelation(std::shared_ptr<json::Object> correlation,
 				&& (hypoobj["Longitude"].GetType() == json::ValueType::DoubleVal)) {
 			lon = hypoobj["Longitude"].ToDouble();
 		} else {
-			glass3::util::Logger::log(
-					"error",
+			GLASS3_LOG_ERROR(
 					"CCorrelation::CCorrelation: Missing required Hypocenter"
 					" Longitude Key.");
 
@@ -234,8 +225,7 @@ CCorrelation::CCorrelation(std::shared_ptr<json::Object> correlation,
 				&& (hypoobj["Depth"].GetType() == json::ValueType::DoubleVal)) {
 			z = hypoobj["Depth"].ToDouble();
 		} else {
-			glass3::util::Logger::log(
-					"error",
+			GLASS3_LOG_ERROR(
 					"CCorrelation::CCorrelation: Missing required Hypocenter"
 					" Depth Key.");
 
@@ -251,8 +241,7 @@ CCorrelation::CCorrelation(std::shared_ptr<json::Object> correlation,
 			glass3::util::Date dt = glass3::util::Date();
 			tori = dt.decodeISO8601Time(ttt);
 		} else {
-			glass3::util::Logger::log(
-					"error",
+			GLASS3_LOG_ERROR(
 					"CCorrelation::CCorrelation: Missing required Hypocenter"
 					" Time Key.");
 
@@ -261,8 +250,7 @@ CCorrelation::CCorrelation(std::shared_ptr<json::Object> correlation,
 
 	} else {
 		// no hypocenter key
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CCorrelation::CCorrelation: Missing required Hypocenter Key.");
 
 		return;
@@ -274,8 +262,7 @@ CCorrelation::CCorrelation(std::shared_ptr<json::Object> correlation,
 					== json::ValueType::DoubleVal)) {
 		corr = (*correlation)["Correlation"].ToDouble();
 	} else {
-		glass3::util::Logger::log(
-				"warning",
+		GLASS3_LOG_WARNING(
 				"CCorrelation::CCorrelation: Missing required Correlation Key.");
 
 		return;
@@ -284,8 +271,7 @@ CCorrelation::CCorrelation(std::shared_ptr<json::Object> correlation,
 	// pass to initialization function
 	if (!initialize(site, tcorr, pid, phs, tori, lat, lon, z,
 					corr)) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CCorrelation::CCorrelation: Failed to initialize correlation.");
 
 		return;
@@ -311,7 +297,7 @@ void CCorrelation::clear() {
 	m_JSONCorrelation.reset();
 
 	m_sPhaseName = "";
-	m_sID = "";
+	m_ID = glass3::util::InternedID();
 	m_tCorrelation = 0;
 	m_tOrigin = 0;
 	m_dLatitude = 0;
@@ -335,7 +321,7 @@ bool CCorrelation::initialize(std::shared_ptr<CSite> correlationSite,
 
 	m_wpSite = correlationSite;
 	m_sPhaseName = phase;
-	m_sID = correlationIdString;
+	m_ID = glass3::util::InternedID(correlationIdString);
 	m_tCorrelation = correlationTime;
 	m_tOrigin = orgTime;
 
@@ -345,6 +331,7 @@ bool CCorrelation::initialize(std::shared_ptr<CSite> correlationSite,
 	m_dDepth = orgZ;
 
 	m_dCorrelation = corrVal;
+	m_iVersion++;
 
 	// nullcheck
 	if (correlationSite == NULL) {
@@ -360,9 +347,7 @@ void CCorrelation::addHypoReference(std::shared_ptr<CHypo> hyp, bool force) {
 
 	// nullcheck
 	if (hyp == NULL) {
-		glass3::util::Logger::log(
-				"error",
-				"CCorrelation::addHypo: NULL hypo " "provided.");
+		GLASS3_LOG_ERROR("CCorrelation::addHypo: NULL hypo " "provided.");
 		return;
 	}
 
@@ -378,8 +363,7 @@ void CCorrelation::addHypoReference(std::shared_ptr<CHypo> hyp, bool force) {
 void CCorrelation::removeHypoReference(std::shared_ptr<CHypo> hyp) {
 	// nullcheck
 	if (hyp == NULL) {
-		glass3::util::Logger::log("error",
-								"CCorrelation::remHypo: NULL hypo provided.");
+		GLASS3_LOG_ERROR("CCorrelation::remHypo: NULL hypo provided.");
 		return;
 	}
 
@@ -451,7 +435,12 @@ const std::string& CCorrelation::getPhaseName() const {
 
 // ---------------------------------------------------------getID
 const std::string& CCorrelation::getID() const {
-	return (m_sID);
+	return (m_ID.getString());
+}
+
+// ---------------------------------------------------------getIDHandle
+unsigned int CCorrelation::getIDHandle() const {
+	return (m_ID.getHandle());
 }
 
 // ---------------------------------------------------------getTCorrelation
@@ -464,6 +453,11 @@ double CCorrelation::getTCreate() const {
 	return (m_tCreate);
 }
 
+// ---------------------------------------------------------getVersion
+int CCorrelation::getVersion() const {
+	return (m_iVersion);
+}
+
 // ---------------------------------------------------------getTOrigin
 double CCorrelation::getTOrigin() const {
 	return (m_tOrigin);
@@ -51,8 +51,7 @@ bool CCorrelationList::receiveExternalMessage(
 		std::shared_ptr<json::Object> com) {
 	// null check json
 	if (com == NULL) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CCorrelationList::receiveExternalMessage: NULL json communication.");
 		return (false);
 	}
@@ -80,16 +79,14 @@ bool CCorrelationList::addCorrelationFromJSON(
 
 	// null check json
 	if (correlation == NULL) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CCorrelationList::addCorrelationFromJSON: NULL json correlation.");
 		return (false);
 	}
 
 	// null check pSiteList
 	if (m_pSiteList == NULL) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CCorrelationList::addCorrelationFromJSON: NULL m_pSiteList.");
 		return (false);
 	}
@@ -100,16 +97,14 @@ bool CCorrelationList::addCorrelationFromJSON(
 		std::string type = (*correlation)["Type"].ToString();
 
 		if (type != "Correlation") {
-			glass3::util::Logger::log(
-					"warning",
+			GLASS3_LOG_WARNING(
 					"CCorrelationList::addCorrelationFromJSON: Non-Correlation "
 					"message passed in.");
 			return (false);
 		}
 	} else {
 		// no command or type
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CCorrelationList::addCorrelationFromJSON: Missing required Type "
 				"Key.");
 		return (false);
@@ -135,8 +130,7 @@ bool CCorrelationList::addCorrelationFromJSON(
 
 	// it is a duplicate, log and don't add correlation
 	if (duplicate) {
-		glass3::util::Logger::log(
-				"warning",
+		GLASS3_LOG_WARNING(
 				"CCorrelationList::addCorrelationFromJSON: Duplicate correlation "
 				"not passed in.");
 		delete (newCorrelation);
@@ -348,8 +342,7 @@ bool CCorrelationList::checkDuplicate(CCorrelation * newCorrelation,
 					// check if distance difference is within window
 					if (delta < xWindow) {
 						// if match is found, log, and return
-						glass3::util::Logger::log(
-								"warning",
+						GLASS3_LOG_WARNING(
 								"CCorrelationList::checkDuplicate: Duplicate "
 										"(tWindow = " + std::to_string(tWindow)
 										+ ", xWindow = "
@@ -382,13 +375,11 @@ bool CCorrelationList::scavenge(std::shared_ptr<CHypo> hyp, double tWindow) {
 	// Returns true if any associated.
 	// null check
 	if (hyp == NULL) {
-		glass3::util::Logger::log(
-				"error", "CCorrelationList::scavenge: NULL CHypo provided.");
+		GLASS3_LOG_ERROR("CCorrelationList::scavenge: NULL CHypo provided.");
 		return (false);
 	}
 
-	glass3::util::Logger::log("debug",
-								"CCorrelationList::scavenge. " + hyp->getID());
+	GLASS3_LOG_DEBUG("CCorrelationList::scavenge. " + hyp->getID());
 
 	bool associated = false;
 
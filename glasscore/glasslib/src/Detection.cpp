@@ -30,8 +30,7 @@ CDetection::~CDetection() {
 bool CDetection::receiveExternalMessage(std::shared_ptr<json::Object> com) {
 	// null check json
 	if (com == NULL) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CDetection::receiveExternalMessage: NULL json communication.");
 		return (false);
 	}
@@ -56,8 +55,7 @@ bool CDetection::receiveExternalMessage(std::shared_ptr<json::Object> com) {
 bool CDetection::processDetectionMessage(std::shared_ptr<json::Object> com) {
 	// null check json
 	if (com == NULL) {
-		glass3::util::Logger::log(
-				"error", "CDetection::process: NULL json communication.");
+		GLASS3_LOG_ERROR("CDetection::process: NULL json communication.");
 		return (false);
 	}
 
@@ -84,8 +82,7 @@ bool CDetection::processDetectionMessage(std::shared_ptr<json::Object> com) {
 			glass3::util::Date dt = glass3::util::Date();
 			torg = dt.decodeISO8601Time(tiso);
 		} else {
-			glass3::util::Logger::log(
-					"error",
+			GLASS3_LOG_ERROR(
 					"CDetection::process: Missing required Hypocenter Time Key.");
 
 			return (false);
@@ -98,8 +95,7 @@ bool CDetection::processDetectionMessage(std::shared_ptr<json::Object> com) {
 			lat = hypocenter["Latitude"].ToDouble();
 
 		} else {
-			glass3::util::Logger::log(
-					"error",
+			GLASS3_LOG_ERROR(
 					"CDetection::process: Missing required Hypocenter Latitude"
 					" Key.");
 
@@ -112,8 +108,7 @@ bool CDetection::processDetectionMessage(std::shared_ptr<json::Object> com) {
 						== json::ValueType::DoubleVal)) {
 			lon = hypocenter["Longitude"].ToDouble();
 		} else {
-			glass3::util::Logger::log(
-					"error",
+			GLASS3_LOG_ERROR(
 					"CDetection::process: Missing required Hypocenter Longitude"
 					" Key.");
 
@@ -125,16 +120,14 @@ bool CDetection::processDetectionMessage(std::shared_ptr<json::Object> com) {
 				&& (hypocenter["Depth"].GetType() == json::ValueType::DoubleVal)) {
 			z = hypocenter["Depth"].ToDouble();
 		} else {
-			glass3::util::Logger::log(
-					"error",
+			GLASS3_LOG_ERROR(
 					"CDetection::process: Missing required Hypocenter Depth"
 					" Key.");
 
 			return (false);
 		}
 	} else {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CDetection::process: Missing required Hypocenter Key.");
 
 		return (false);
@@ -5,6 +5,8 @@
 #include <logger.h>
 #include <TTT.h>
 #include <TravelTime.h>
+#include <functional>
+#include <threadpool.h>
 #include <cmath>
 #include <string>
 #include <atomic>
@@ -26,6 +28,8 @@ CWebList * CGlass::m_pWebList = NULL;
 CSiteList * CGlass::m_pSiteList = NULL;
 CPickList * CGlass::m_pPickList = NULL;
 CHypoList * CGlass::m_pHypoList = NULL;
+glass3::util::ThreadPool * CGlass::m_pNucleationWorkPool = NULL;
+glass3::util::ThreadPool * CGlass::m_pLocatorWorkPool = NULL;
 CCorrelationList * CGlass::m_pCorrelationList = NULL;
 CDetection * CGlass::m_pDetectionProcessor = NULL;
 std::shared_ptr<traveltime::CTravelTime> CGlass::m_pDefaultNucleationTravelTime =  // NOLINT
@@ -69,6 +73,10 @@ std::atomic<double> CGlass::m_dHypoMergingDistanceWindow;
 std::atomic<double> CGlass::m_dEventFragmentDepthThreshold;
 std::atomic<double> CGlass::m_dEventFragmentAzimuthThreshold;
 std::atomic<bool> CGlass::m_bAllowPickUpdates;
+std::atomic<bool> CGlass::m_bSitePickSnapshots;
+std::atomic<int> CGlass::m_iNumLocatorChains;
+std::atomic<int> CGlass::m_iLocatorRandomSeed;
+std::atomic<int> CGlass::m_iHypoQueueOrder;
 std::atomic<double> CGlass::m_dPickNoiseClassificationThreshold;
 std::atomic<double> CGlass::m_dPickPhaseClassificationThreshold;
 std::atomic<double> CGlass::m_dPickAzimuthClassificationThreshold;
@@ -96,11 +104,13 @@ const unsigned int CGlass::k_iAssocRangeEnd;
 const unsigned int CGlass::k_DefaultNumNucleationThreads;
 const unsigned int CGlass::k_DefaultNumHypoThreads;
 const unsigned int CGlass::k_DefaultNumWebThreads;
+const unsigned int CGlass::k_DefaultNumNucleationWorkThreads;
 // Other default values
 const int CGlass::k_nParamDisabled;  // used to indicate a param is disabled
 const int CGlass::k_DefaultHoursWithoutPicking;
 const int CGlass::k_DefaultHoursBeforeLookingUp;
 const int CGlass::k_DefaultMaxPicksPerHour;
+const int CGlass::k_iNucleationWorkSleepTime;
 constexpr double CGlass::k_dAssociationSecondsPerSigma;
 constexpr double CGlass::k_dNucleationSecondsPerSigma;
 constexpr double CGlass::k_dMaximumDepth;
@@ -112,6 +122,8 @@ CGlass::CGlass() {
 	m_pSiteList = NULL;
 	m_pPickList = NULL;
 	m_pHypoList = NULL;
+	m_pNucleationWorkPool = NULL;
+	m_pLocatorWorkPool = NULL;
 	m_pCorrelationList = NULL;
 	m_pDetectionProcessor = NULL;
 	m_pDefaultNucleationTravelTime = NULL;
@@ -122,6 +134,16 @@ CGlass::CGlass() {
 
 // ---------------------------------------------------------~CGlass
 CGlass::~CGlass() {
+	// let the shared pools finish the jobs they already have before
+	// anything they use goes away, queued web jobs hold references to their
+	// webs
+	if (m_pNucleationWorkPool) {
+		m_pNucleationWorkPool->drain();
+	}
+	if (m_pLocatorWorkPool) {
+		m_pLocatorWorkPool->drain();
+	}
+
 	if (m_pWebList) {
 		delete (m_pWebList);
 	}
@@ -134,6 +156,14 @@ CGlass::~CGlass() {
 	if (m_pHypoList) {
 		delete (m_pHypoList);
 	}
+	if (m_pNucleationWorkPool) {
+		m_pNucleationWorkPool->stop();
+		delete (m_pNucleationWorkPool);
+	}
+	if (m_pLocatorWorkPool) {
+		m_pLocatorWorkPool->stop();
+		delete (m_pLocatorWorkPool);
+	}
 	if (m_pCorrelationList) {
 		delete (m_pCorrelationList);
 	}
@@ -146,8 +176,7 @@ CGlass::~CGlass() {
 bool CGlass::receiveExternalMessage(std::shared_ptr<json::Object> com) {
 	// null check json
 	if (com == NULL) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CGlass::receiveExternalMessage: NULL json communication.");
 		return (false);
 	}
@@ -256,6 +285,10 @@ void CGlass::clear() {
 	m_dEventFragmentDepthThreshold = 550.0;
 	m_dEventFragmentAzimuthThreshold = 270.0;
 	m_bAllowPickUpdates = false;
+	m_bSitePickSnapshots = false;
+	m_iNumLocatorChains = 1;
+	m_iLocatorRandomSeed = -1;
+	m_iHypoQueueOrder = HypoQueueOrder::FirstInFirstOut;
 	m_dPickNoiseClassificationThreshold = -1;
 	m_dPickPhaseClassificationThreshold = -1;
 	m_dPickDistanceClassificationThreshold = -1;
@@ -270,7 +303,7 @@ void CGlass::clear() {
 bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 	// null check json
 	if (com == NULL) {
-		glass3::util::Logger::log("error", "CGlass::initialize: NULL json.");
+		GLASS3_LOG_ERROR("CGlass::initialize: NULL json.");
 		return (false);
 	}
 
@@ -280,15 +313,13 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 		std::string cmd = (*com)["Cmd"].ToString();
 
 		if (cmd != "Initialize") {
-			glass3::util::Logger::log(
-					"warning",
+			GLASS3_LOG_WARNING(
 					"CGlass::initialize: Non-Initialize Cmd passed in.");
 			return (false);
 		}
 	} else {
 		// no command or type
-		glass3::util::Logger::log(
-				"error", "CGlass::initialize: Missing required Cmd Key.");
+		GLASS3_LOG_ERROR("CGlass::initialize: Missing required Cmd Key.");
 		return (false);
 	}
 
@@ -323,13 +354,11 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 		if (phsObj.HasKey("TravFile")) {
 			file = phsObj["TravFile"].ToString();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using file location: " + file
 							+ " for default nucleation phase: " + phs);
 		} else {
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default file location for "
 							" default nucleation phase: " + phs);
 		}
@@ -361,8 +390,7 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 		// set up the first phase travel time
 		m_pDefaultNucleationTravelTime->setup("P");
 
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"CGlass::initialize: Using  default nucleation first phase P");
 	}
 
@@ -400,8 +428,7 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 
 			// get the phase name
 			std::string phs = obj["PhaseName"].ToString();
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using association phase: " + phs);
 
 			// Look for an Assoc
@@ -420,8 +447,7 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 					assoc[i] = arr[i].ToDouble();
 				}
 
-				glass3::util::Logger::log(
-						"info",
+				GLASS3_LOG_INFO(
 						"CGlass::initialize: Using association Assoc = ["
 							+ std::to_string(assoc[k_iAssocRangeStart])
 							+ "," + std::to_string(assoc[k_iAssocRangeEnd])
@@ -434,8 +460,7 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 				minPublishPhase = assoc[0];
 				maxPublishPhase = assoc[1];
 			} else {
-				glass3::util::Logger::log(
-						"error",
+				GLASS3_LOG_ERROR(
 						"CGlass::initialize: Missing required Assoc key.");
 				continue;
 			}
@@ -445,13 +470,11 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 					&& (obj["TravFile"].GetType() == json::ValueType::StringVal)) {
 				file = obj["TravFile"].ToString();
 
-				glass3::util::Logger::log(
-						"info",
+				GLASS3_LOG_INFO(
 						"CGlass::initialize: Using association tt file: "
 								+ file);
 			} else {
-				glass3::util::Logger::log(
-						"info",
+				GLASS3_LOG_INFO(
 						"CGlass::initialize: Using default file location for "
 								"association phase: " + phs);
 			}
@@ -461,14 +484,12 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 					&& (obj["UseForLocation"].GetType() == json::ValueType::BoolVal)) {
 				useForLocation = obj["UseForLocation"].ToBool();
 
-				glass3::util::Logger::log(
-						"info",
+				GLASS3_LOG_INFO(
 						"CGlass::initialize: Using useForLocation: "
 								+ std::to_string(useForLocation) + " for phase: "+ phs);
 			} else {
 				useForLocation = true;
-				glass3::util::Logger::log(
-						"info",
+				GLASS3_LOG_INFO(
 						"CGlass::initialize: Using default useForLocation: "
 								+ std::to_string(useForLocation) + " for phase: "+ phs);
 			}
@@ -479,13 +500,11 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 				if(obj["PublishPhase"].ToBool() == false) {
 					minPublishPhase = -1.0;
 					maxPublishPhase = -1.0;
-					glass3::util::Logger::log(
-							"info",
+					GLASS3_LOG_INFO(
 							"CGlass::initialize: Publishing phase: " + phs
 							+ " is disabled.");
 				} else {
-					glass3::util::Logger::log(
-							"info",
+					GLASS3_LOG_INFO(
 							"CGlass::initialize: Using default publishPhase range: "
 									+ std::to_string(minPublishPhase) + " to "
 									+ std::to_string(maxPublishPhase)
@@ -502,16 +521,14 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 					minPublishPhase = arr[0].ToDouble();
 					maxPublishPhase = arr[1].ToDouble();
 
-					glass3::util::Logger::log(
-							"info",
+					GLASS3_LOG_INFO(
 							"CGlass::initialize: Using specified publishPhase range: "
 									+ std::to_string(minPublishPhase) + " to "
 									+ std::to_string(maxPublishPhase)
 									+ " for phase: " + phs);
 				}
 			} else {
-				glass3::util::Logger::log(
-							"info",
+				GLASS3_LOG_INFO(
 							"CGlass::initialize: Using default publishPhase range: "
 									+ std::to_string(minPublishPhase) + " to "
 									+ std::to_string(maxPublishPhase)
@@ -524,8 +541,7 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 		}
 
 	} else {
-		glass3::util::Logger::log("error",
-									"No association Phase array provided");
+		GLASS3_LOG_ERROR("No association Phase array provided");
 		return (false);
 	}
 
@@ -566,13 +582,11 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 						== json::ValueType::BoolVal)) {
 			m_bGraphicsOut = paramsPlot["graphicsOut"].ToBool();
 			if (m_bGraphicsOut == true) {
-				glass3::util::Logger::log(
-						"info", "CGlass::initialize: Plotting output is on!!!");
+				GLASS3_LOG_INFO("CGlass::initialize: Plotting output is on!!!");
 			}
 
 			if (m_bGraphicsOut == false) {
-				glass3::util::Logger::log(
-						"info", "CGlass::initialize: Plotting output is off.");
+				GLASS3_LOG_INFO("CGlass::initialize: Plotting output is off.");
 			}
 		}
 
@@ -580,8 +594,7 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 				&& (paramsPlot["graphicsStepKM"].GetType()
 						== json::ValueType::DoubleVal)) {
 			m_dGraphicsStepKM = paramsPlot["graphicsStepKM"].ToDouble();
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Plotting Step Increment: "
 							+ std::to_string(m_dGraphicsStepKM));
 		}
@@ -590,8 +603,7 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 				&& (paramsPlot["graphicsSteps"].GetType()
 						== json::ValueType::IntVal)) {
 			m_iGraphicsSteps = paramsPlot["graphicsSteps"].ToInt();
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Plotting Steps: "
 							+ std::to_string(m_iGraphicsSteps));
 		}
@@ -601,8 +613,7 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 						== json::ValueType::StringVal)) {
 			std::lock_guard < std::mutex > ttGuard(m_TTTMutex);
 			m_sGraphicsOutFolder = paramsPlot["graphicsOutFolder"].ToString();
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Plotting Output Location: "
 							+ m_sGraphicsOutFolder);
 		}
@@ -621,13 +632,11 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 			m_dNucleationStackThreshold = params["NucleationStackThreshold"]
 					.ToDouble();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using NucleationStackThreshold: "
 							+ std::to_string(m_dNucleationStackThreshold));
 		} else {
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default NucleationStackThreshold: "
 							+ std::to_string(m_dNucleationStackThreshold));
 		}
@@ -639,13 +648,11 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 			m_iNucleationDataCountThreshold =
 					params["NucleationDataCountThreshold"].ToInt();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using NucleationDataCountThreshold: "
 							+ std::to_string(m_iNucleationDataCountThreshold));
 		} else {
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default NucleationDataCountThreshold: "
 							+ std::to_string(m_iNucleationDataCountThreshold));
 		}
@@ -657,13 +664,11 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 			m_dAssociationSDCutoff =
 					params["AssociationStandardDeviationCutoff"].ToDouble();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using AssociationStandardDeviationCutoff: "
 							+ std::to_string(m_dAssociationSDCutoff));
 		} else {
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default AssociationStandardDeviationCutoff: "
 							+ std::to_string(m_dAssociationSDCutoff));
 		}
@@ -675,13 +680,11 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 			m_dPruningSDCutoff = params["PruningStandardDeviationCutoff"]
 					.ToDouble();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using PruningStandardDeviationCutoff: "
 							+ std::to_string(m_dPruningSDCutoff));
 		} else {
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default PruningStandardDeviationCutoff: "
 							+ std::to_string(m_dPruningSDCutoff));
 		}
@@ -693,13 +696,11 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 			m_dNonLocatingPhaseCutoffFactor = params["NonLocatingPhaseCutoffFactor"]
 					.ToDouble();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using NonLocatingPhaseCutoffFactor: "
 						+ std::to_string(m_dNonLocatingPhaseCutoffFactor));
 		} else {
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default NonLocatingPhaseCutoffFactor: "
 						+ std::to_string(m_dNonLocatingPhaseCutoffFactor));
 		}
@@ -711,13 +712,11 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 			m_dTeleseismicDistanceLimit = params["TeleseismicDistanceLimit"]
 					.ToDouble();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using TeleseismicDistanceLimit: "
 						+ std::to_string(m_dTeleseismicDistanceLimit));
 		} else {
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default TeleseismicDistanceLimit: "
 						+ std::to_string(m_dTeleseismicDistanceLimit));
 		}
@@ -729,13 +728,11 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 			m_iTeleseismicPhaseCountThreshold = params["TeleseismicPhaseCountThreshold"]
 					.ToInt();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using TeleseismicPhaseCountThreshold: "
 						+ std::to_string(m_iTeleseismicPhaseCountThreshold));
 		} else {
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default TeleseismicPhaseCountThreshold: "
 						+ std::to_string(m_iTeleseismicPhaseCountThreshold));
 		}
@@ -746,13 +743,11 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 						== json::ValueType::DoubleVal)) {
 			m_dPickAffinityExpFactor = params["PickAffinityExponentialFactor"]
 					.ToDouble();
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using PickAffinityExponentialFactor: "
 							+ std::to_string(m_dPickAffinityExpFactor));
 		} else {
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default PickAffinityExponentialFactor: "
 							+ std::to_string(m_dPickAffinityExpFactor));
 		}
@@ -763,13 +758,11 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 						== json::ValueType::DoubleVal)) {
 			m_dDistanceCutoffFactor = params["DistanceCutoffFactor"].ToDouble();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using DistanceCutoffFactor: "
 							+ std::to_string(m_dDistanceCutoffFactor));
 		} else {
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default DistanceCutoffFactor: "
 							+ std::to_string(m_dDistanceCutoffFactor));
 		}
@@ -780,13 +773,11 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 						== json::ValueType::DoubleVal)) {
 			m_dDistanceCutoffRatio = params["DistanceCutoffRatio"].ToDouble();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using DistanceCutoffRatio: "
 							+ std::to_string(m_dDistanceCutoffRatio));
 		} else {
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default DistanceCutoffRatio: "
 							+ std::to_string(m_dDistanceCutoffRatio));
 		}
@@ -797,13 +788,11 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 						== json::ValueType::DoubleVal)) {
 			m_dMinDistanceCutoff = params["DistanceCutoffMinimum"].ToDouble();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using DistanceCutoffMinimum: "
 							+ std::to_string(m_dMinDistanceCutoff));
 		} else {
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default DistanceCutoffMinimum: "
 							+ std::to_string(m_dMinDistanceCutoff));
 		}
@@ -814,13 +803,11 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 						== json::ValueType::IntVal)) {
 			m_iProcessLimit = params["HypoProcessCountLimit"].ToInt();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using HypoProcessCountLimit: "
 							+ std::to_string(m_iProcessLimit));
 		} else {
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default HypoProcessCountLimit: "
 							+ std::to_string(m_iProcessLimit));
 		}
@@ -832,13 +819,11 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 			m_dCorrelationMatchingTimeWindow = params["CorrelationTimeWindow"]
 					.ToDouble();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using CorrelationTimeWindow: "
 							+ std::to_string(m_dCorrelationMatchingTimeWindow));
 		} else {
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default "
 							"CorrelationTimeWindow: "
 							+ std::to_string(m_dCorrelationMatchingTimeWindow));
@@ -851,14 +836,12 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 			m_dCorrelationMatchingDistanceWindow =
 					params["CorrelationDistanceWindow"].ToDouble();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using CorrelationDistanceWindow: "
 							+ std::to_string(
 									m_dCorrelationMatchingDistanceWindow));
 		} else {
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default "
 							"CorrelationDistanceWindow: "
 							+ std::to_string(
@@ -871,13 +854,11 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 						== json::ValueType::DoubleVal)) {
 			m_iCorrelationCancelAge = params["CorrelationCancelAge"].ToDouble();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using CorrelationCancelAge: "
 							+ std::to_string(m_iCorrelationCancelAge));
 		} else {
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default CorrelationCancelAge: "
 							+ std::to_string(m_iCorrelationCancelAge));
 		}
@@ -889,13 +870,11 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 			m_dHypoMergingTimeWindow =
 					params["HypocenterTimeWindow"].ToDouble();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using HypocenterTimeWindow: "
 							+ std::to_string(m_dHypoMergingTimeWindow));
 		} else {
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default "
 							"HypocenterTimeWindow: "
 							+ std::to_string(m_dHypoMergingTimeWindow));
@@ -908,13 +887,11 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 			m_dHypoMergingDistanceWindow = params["HypocenterDistanceWindow"]
 					.ToDouble();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using HypocenterDistanceWindow: "
 							+ std::to_string(m_dHypoMergingDistanceWindow));
 		} else {
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default "
 							"HypocenterDistanceWindow: "
 							+ std::to_string(m_dHypoMergingDistanceWindow));
@@ -927,13 +904,11 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 			m_dBeamMatchingAzimuthWindow = params["BeamMatchingAzimuthWindow"]
 					.ToDouble();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using BeamMatchingAzimuthWindow: "
 							+ std::to_string(m_dBeamMatchingAzimuthWindow));
 		} else {
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default "
 							"BeamMatchingAzimuthWindow: "
 							+ std::to_string(m_dBeamMatchingAzimuthWindow));
@@ -946,13 +921,11 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 			m_dEventFragmentDepthThreshold =
 					params["EventFragmentDepthThreshold"].ToDouble();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using EventFragmentDepthThreshold: "
 							+ std::to_string(m_dEventFragmentDepthThreshold));
 		} else {
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default "
 							"EventFragmentDepthThreshold: "
 							+ std::to_string(m_dEventFragmentDepthThreshold));
@@ -965,13 +938,11 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 			m_dEventFragmentAzimuthThreshold =
 					params["EventFragmentAzimuthThreshold"].ToDouble();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using EventFragmentAzimuthThreshold: "
 							+ std::to_string(m_dEventFragmentAzimuthThreshold));
 		} else {
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default "
 							"EventFragmentAzimuthThreshold: "
 							+ std::to_string(m_dEventFragmentAzimuthThreshold));
@@ -1006,15 +977,13 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 			m_dReportingStackThreshold = params["ReportingStackThreshold"]
 					.ToDouble();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using ReportingStackThreshold: "
 							+ std::to_string(m_dReportingStackThreshold));
 		} else {
 			// default to overall thresh
 			m_dReportingStackThreshold = getNucleationStackThreshold();
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default ReportingStackThreshold "
 							"( = NucleationStackThreshold): "
 							+ std::to_string(m_dReportingStackThreshold));
@@ -1027,21 +996,18 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 			m_iReportingDataThreshold =
 					params["ReportingDataThreshold"].ToInt();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using ReportingDataThreshold: "
 							+ std::to_string(m_iReportingDataThreshold));
 		} else {
 			// default to overall nNucleate
 			m_iReportingDataThreshold = getNucleationDataCountThreshold();
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default ReportingDataThreshold: "
 							+ std::to_string(m_iReportingDataThreshold));
 		}
 	} else {
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"CGlass::initialize: Using default association and nucleation "
 				"parameters");
 	}
@@ -1052,15 +1018,12 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 		m_bTestLocator = (*com)["TestLocator"].ToBool();
 
 		if (m_bTestLocator) {
-			glass3::util::Logger::log(
-					"info", "CGlass::initialize: testLocator set to true");
+			GLASS3_LOG_INFO("CGlass::initialize: testLocator set to true");
 		} else {
-			glass3::util::Logger::log(
-					"info", "CGlass::initialize: testLocator set to false");
+			GLASS3_LOG_INFO("CGlass::initialize: testLocator set to false");
 		}
 	} else {
-		glass3::util::Logger::log(
-				"info", "CGlass::initialize: testLocator not Found!");
+		GLASS3_LOG_INFO("CGlass::initialize: testLocator not Found!");
 	}
 
 	// set maximum number of picks
@@ -1069,8 +1032,7 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 					== json::ValueType::IntVal)) {
 		m_iMaxNumPicks = (*com)["MaximumNumberOfPicks"].ToInt();
 
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"CGlass::initialize: Using MaximumNumberOfPicks: "
 						+ std::to_string(m_iMaxNumPicks));
 	}
@@ -1081,8 +1043,7 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 					== json::ValueType::IntVal)) {
 		m_iMaxNumCorrelations = (*com)["MaximumNumberOfCorrelations"].ToInt();
 
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"CGlass::initialize: Using MaximumNumberOfCorrelations: "
 						+ std::to_string(m_iMaxNumCorrelations));
 	}
@@ -1093,8 +1054,7 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 					== json::ValueType::IntVal)) {
 		m_iMaxNumHypos = (*com)["MaximumNumberOfHypos"].ToInt();
 
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"CGlass::initialize: Using MaximumNumberOfHypos: "
 						+ std::to_string(m_iMaxNumHypos));
 	}
@@ -1105,13 +1065,11 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 					== json::ValueType::DoubleVal)) {
 		m_dPickDuplicateTimeWindow = (*com)["PickDuplicateWindow"].ToDouble();
 
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"CGlass::initialize: Using PickDuplicateWindow: "
 						+ std::to_string(m_dPickDuplicateTimeWindow));
 	} else {
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"CGlass::initialize: Using default PickDuplicateWindow: "
 						+ std::to_string(m_dPickDuplicateTimeWindow));
 	}
@@ -1123,13 +1081,11 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 					== json::ValueType::IntVal)) {
 		numNucleationThreads = (*com)["NumberOfNucleationThreads"].ToInt();
 
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"CGlass::initialize: Using NumberOfNucleationThreads: "
 						+ std::to_string(numNucleationThreads));
 	} else {
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"CGlass::initialize: Using default NumberOfNucleationThreads: "
 						+ std::to_string(numNucleationThreads));
 	}
@@ -1141,13 +1097,11 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 					== json::ValueType::IntVal)) {
 		numHypoThreads = (*com)["NumberOfHypoThreads"].ToInt();
 
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"CGlass::initialize: Using NumberOfHypoThreads: "
 						+ std::to_string(numHypoThreads));
 	} else {
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"CGlass::initialize: Using default NumberOfHypoThreads: "
 						+ std::to_string(numHypoThreads));
 	}
@@ -1159,30 +1113,105 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 					== json::ValueType::IntVal)) {
 		numWebThreads = (*com)["NumberOfWebThreads"].ToInt();
 
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"CGlass::initialize: Using NumberOfWebThreads: "
 						+ std::to_string(numWebThreads));
 	} else {
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"CGlass::initialize: Using default NumberOfWebThreads: "
 						+ std::to_string(numWebThreads));
 	}
 
+	// set the number of nucleation work threads
+	int numNucleationWorkThreads = k_DefaultNumNucleationWorkThreads;
+	if ((com->HasKey("NumberOfNucleationWorkThreads"))
+			&& ((*com)["NumberOfNucleationWorkThreads"].GetType()
+					== json::ValueType::IntVal)) {
+		numNucleationWorkThreads = (*com)["NumberOfNucleationWorkThreads"]
+				.ToInt();
+
+		GLASS3_LOG_INFO(
+				"CGlass::initialize: Using NumberOfNucleationWorkThreads: "
+						+ std::to_string(numNucleationWorkThreads));
+	} else {
+		GLASS3_LOG_INFO(
+				"CGlass::initialize: Using default NumberOfNucleationWorkThreads: "
+						+ std::to_string(numNucleationWorkThreads));
+	}
+
+	// set the number of locator work threads
+	int numLocatorWorkThreads = k_DefaultNumLocatorWorkThreads;
+	if ((com->HasKey("NumberOfLocatorWorkThreads"))
+			&& ((*com)["NumberOfLocatorWorkThreads"].GetType()
+					== json::ValueType::IntVal)) {
+		numLocatorWorkThreads = (*com)["NumberOfLocatorWorkThreads"].ToInt();
+
+		GLASS3_LOG_INFO(
+				"CGlass::initialize: Using NumberOfLocatorWorkThreads: "
+						+ std::to_string(numLocatorWorkThreads));
+	} else {
+		GLASS3_LOG_INFO(
+				"CGlass::initialize: Using default NumberOfLocatorWorkThreads: "
+						+ std::to_string(numLocatorWorkThreads));
+	}
+
+	// set the number of locator chains
+	if ((com->HasKey("NumberOfLocatorChains"))
+			&& ((*com)["NumberOfLocatorChains"].GetType()
+					== json::ValueType::IntVal)) {
+		setNumLocatorChains((*com)["NumberOfLocatorChains"].ToInt());
+
+		GLASS3_LOG_INFO(
+				"CGlass::initialize: Using NumberOfLocatorChains: "
+						+ std::to_string(m_iNumLocatorChains));
+	}
+
+	// set the locator random seed
+	if ((com->HasKey("LocatorRandomSeed"))
+			&& ((*com)["LocatorRandomSeed"].GetType()
+					== json::ValueType::IntVal)) {
+		m_iLocatorRandomSeed = (*com)["LocatorRandomSeed"].ToInt();
+
+		GLASS3_LOG_INFO(
+				"CGlass::initialize: Using LocatorRandomSeed: "
+						+ std::to_string(m_iLocatorRandomSeed));
+	}
+
+	// set the hypo processing queue order
+	if ((com->HasKey("HypoProcessingQueueOrder"))
+			&& ((*com)["HypoProcessingQueueOrder"].GetType()
+					== json::ValueType::StringVal)) {
+		std::string order = (*com)["HypoProcessingQueueOrder"].ToString();
+
+		if (order == "FirstInFirstOut") {
+			setHypoQueueOrder(HypoQueueOrder::FirstInFirstOut);
+		} else if (order == "LeastProcessedFirst") {
+			setHypoQueueOrder(HypoQueueOrder::LeastProcessedFirst);
+		} else if (order == "HighestBayesFirst") {
+			setHypoQueueOrder(HypoQueueOrder::HighestBayesFirst);
+		} else {
+			GLASS3_LOG_ERROR(
+					"CGlass::initialize: Unknown HypoProcessingQueueOrder: "
+							+ order + ", using FirstInFirstOut");
+			setHypoQueueOrder(HypoQueueOrder::FirstInFirstOut);
+			order = "FirstInFirstOut";
+		}
+
+		GLASS3_LOG_INFO(
+				"CGlass::initialize: Using HypoProcessingQueueOrder: " + order);
+	}
+
 	int iHoursWithoutPicking = k_DefaultHoursWithoutPicking;
 	if ((com->HasKey("SiteHoursWithoutPicking"))
 			&& ((*com)["SiteHoursWithoutPicking"].GetType()
 					== json::ValueType::IntVal)) {
 		iHoursWithoutPicking = (*com)["SiteHoursWithoutPicking"].ToInt();
 
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"CGlass::initialize: Using SiteHoursWithoutPicking: "
 						+ std::to_string(iHoursWithoutPicking));
 	} else {
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"CGlass::initialize: Using default SiteHoursWithoutPicking: "
 						+ std::to_string(iHoursWithoutPicking));
 	}
@@ -1193,13 +1222,11 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 					== json::ValueType::IntVal)) {
 		iHoursBeforeLookingUp = (*com)["SiteLookupInterval"].ToInt();
 
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"CGlass::initialize: Using SiteLookupInterval: "
 						+ std::to_string(iHoursBeforeLookingUp));
 	} else {
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"CGlass::initialize: Using default SiteLookupInterval: "
 						+ std::to_string(iHoursBeforeLookingUp));
 	}
@@ -1210,13 +1237,11 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 					== json::ValueType::IntVal)) {
 		iMaxPicksPerHour = (*com)["SiteMaximumPicksPerHour"].ToInt();
 
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"CGlass::initialize: Using SiteMaximumPicksPerHour: "
 						+ std::to_string(iMaxPicksPerHour));
 	} else {
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"CGlass::initialize: Using default SiteMaximumPicksPerHour: "
 						+ std::to_string(iMaxPicksPerHour));
 	}
@@ -1226,12 +1251,21 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 			&& ((*com)["AllowPickUpdates"].GetType() == json::ValueType::BoolVal)) {  // NOLINT
 		m_bAllowPickUpdates = (*com)["AllowPickUpdates"].ToBool();
 
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"CGlass::initialize: Using AllowPickUpdates: "
 						+ std::to_string(m_bAllowPickUpdates));
 	}
 
+	// set whether sites publish pick snapshots for nucleation
+	if ((com->HasKey("SitePickSnapshots"))
+			&& ((*com)["SitePickSnapshots"].GetType() == json::ValueType::BoolVal)) {  // NOLINT
+		m_bSitePickSnapshots = (*com)["SitePickSnapshots"].ToBool();
+
+		GLASS3_LOG_INFO(
+				"CGlass::initialize: Using SitePickSnapshots: "
+						+ std::to_string(m_bSitePickSnapshots));
+	}
+
 	// pick classification
 	if ((com->HasKey("PickClassification"))
 			&& ((*com)["PickClassification"].GetType()
@@ -1246,15 +1280,13 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 			m_dPickNoiseClassificationThreshold =
 					classification["NoiseClassificationThreshold"].ToDouble();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using PickClassification NoiseThreshold: "
 							+ std::to_string(
 									m_dPickNoiseClassificationThreshold));
 		} else {
 			m_dPickNoiseClassificationThreshold = -1;
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default PickClassification NoiseThreshold: "
 							+ std::to_string(
 									m_dPickNoiseClassificationThreshold));
@@ -1267,15 +1299,13 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 			m_dPickPhaseClassificationThreshold =
 					classification["PhaseClassificationThreshold"].ToDouble();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using PickClassification PhaseThreshold: "
 							+ std::to_string(
 									m_dPickPhaseClassificationThreshold));
 		} else {
 			m_dPickPhaseClassificationThreshold = -1;
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default PhaseClassificationThreshold: "
 							+ std::to_string(
 									m_dPickPhaseClassificationThreshold));
@@ -1288,15 +1318,13 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 			m_dPickDistanceClassificationThreshold =
 					classification["DistanceClassificationThreshold"].ToDouble();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using PickClassification DistanceThreshold: "
 							+ std::to_string(
 									m_dPickDistanceClassificationThreshold));
 		} else {
 			m_dPickDistanceClassificationThreshold = -1;
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default DistanceClassificationThreshold: "
 							+ std::to_string(
 									m_dPickDistanceClassificationThreshold));
@@ -1309,15 +1337,13 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 			m_dPickAzimuthClassificationThreshold =
 					classification["AzimuthClassificationThreshold"].ToDouble();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using PickClassification AzimuthThreshold: "
 							+ std::to_string(
 									m_dPickAzimuthClassificationThreshold));
 		} else {
 			m_dPickAzimuthClassificationThreshold = -1;
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default AzimuthClassificationThreshold: "
 							+ std::to_string(
 									m_dPickAzimuthClassificationThreshold));
@@ -1330,15 +1356,13 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 			m_dPickAzimuthClassificationUncertainty =
 					classification["AzimuthClassificationUncertainty"].ToDouble();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using PickClassification AzimuthUncertainty: "
 							+ std::to_string(
 									m_dPickAzimuthClassificationUncertainty));
 		} else {
 			m_dPickAzimuthClassificationUncertainty = 999.;
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default AzimuthClassificationUncertainty: "
 							+ std::to_string(
 									m_dPickAzimuthClassificationUncertainty));
@@ -1358,15 +1382,13 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 				tempstr +=  std::to_string(m_dPickDistClassificationClasses[i]) + " ";
 			}
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using PickClassification Distance"
 					" ClassificationClasses: "
 							+ tempstr);
 		} else {
 			m_dPickDistClassificationClasses.clear();
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default (none) DistanceClassificationClasses");
 		}
 
@@ -1386,15 +1408,13 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 						m_dPickDistClassificationClassesUpperBound[i]) + " ";
 			}
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using PickClassification"
 					" DistanceClassificationClassesUpperBound: "
 							+ tempstr);
 		} else {
 			m_dPickDistClassificationClassesUpperBound.clear();
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default (none) "
 					" DistanceClassificationClassesUpperBound");
 		}
@@ -1416,15 +1436,13 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 						m_dPickDistClassificationClassesLowerBound[i]) + " ";
 			}
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using PickClassification "
 					"DistanceClassificationClassesLowerBound: "
 							+ tempstr);
 		} else {
 			m_dPickDistClassificationClassesLowerBound.clear();
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Using default (none) "
 					"DistanceClassificationClassesLowerBound");
 		}
@@ -1433,8 +1451,7 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 				!= m_dPickDistClassificationClassesUpperBound.size()
 				|| m_dPickDistClassificationClasses.size()
 						!= m_dPickDistClassificationClassesLowerBound.size()) {
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CGlass::initialize: Distance Class Bound Array "
 					"Sizes Don't Match. Not Using Them.");
 			m_dPickDistClassificationClasses.clear();
@@ -1473,6 +1490,23 @@ bool CGlass::initialize(std::shared_ptr<json::Object> com) {
 	}
 	m_pPickList->setSiteList(m_pSiteList);
 
+	// create nucleation work pool
+	if ((m_pNucleationWorkPool == NULL) && (numNucleationWorkThreads > 0)) {
+		m_pNucleationWorkPool = new glass3::util::ThreadPool(
+				"NucleationWorkPool", numNucleationWorkThreads,
+				k_iNucleationWorkSleepTime);
+	}
+
+	// create locator work pool
+	if ((m_pLocatorWorkPool == NULL) && (numLocatorWorkThreads > 0)) {
+		m_pLocatorWorkPool = new glass3::util::ThreadPool(
+				"LocatorWorkPool", numLocatorWorkThreads,
+				k_iLocatorWorkSleepTime);
+	}
+
+	// web updates share the nucleation work pool when there is one
+	m_pWebList->setJobPool(m_pNucleationWorkPool);
+
 	// create correlation list
 	if (m_pCorrelationList == NULL) {
 		m_pCorrelationList = new CCorrelationList();
@@ -1694,6 +1728,16 @@ CHypoList* CGlass::getHypoList() {
 	return (m_pHypoList);
 }
 
+// ------------------------------------------------getNucleationWorkPool
+glass3::util::ThreadPool* CGlass::getNucleationWorkPool() {
+	return (m_pNucleationWorkPool);
+}
+
+// ------------------------------------------------getLocatorWorkPool
+glass3::util::ThreadPool* CGlass::getLocatorWorkPool() {
+	return (m_pLocatorWorkPool);
+}
+
 // ------------------------------------------------getPickDuplicateTimeWindow
 double CGlass::getPickDuplicateTimeWindow() {
 	return (m_dPickDuplicateTimeWindow);
@@ -1766,6 +1810,49 @@ bool CGlass::getAllowPickUpdates() {
 	return (m_bAllowPickUpdates);
 }
 
+// ------------------------------------------------getSitePickSnapshots
+bool CGlass::getSitePickSnapshots() {
+	return (m_bSitePickSnapshots);
+}
+
+// ------------------------------------------------setSitePickSnapshots
+void CGlass::setSitePickSnapshots(bool use) {
+	m_bSitePickSnapshots = use;
+}
+
+// ------------------------------------------------getNumLocatorChains
+int CGlass::getNumLocatorChains() {
+	return (m_iNumLocatorChains);
+}
+
+// ------------------------------------------------setNumLocatorChains
+void CGlass::setNumLocatorChains(int numChains) {
+	if (numChains < 1) {
+		numChains = 1;
+	}
+	m_iNumLocatorChains = numChains;
+}
+
+// ------------------------------------------------getLocatorRandomSeed
+int CGlass::getLocatorRandomSeed() {
+	return (m_iLocatorRandomSeed);
+}
+
+// ------------------------------------------------setLocatorRandomSeed
+void CGlass::setLocatorRandomSeed(int seed) {
+	m_iLocatorRandomSeed = seed;
+}
+
+// ------------------------------------------------getHypoQueueOrder
+HypoQueueOrder CGlass::getHypoQueueOrder() {
+	return (static_cast<HypoQueueOrder>(m_iHypoQueueOrder.load()));
+}
+
+// ------------------------------------------------setHypoQueueOrder
+void CGlass::setHypoQueueOrder(HypoQueueOrder order) {
+	m_iHypoQueueOrder = order;
+}
+
 // ------------------------------------------getPickNoiseClassificationThreshold
 double CGlass::getPickNoiseClassificationThreshold() {
 	return (m_dPickNoiseClassificationThreshold);
@@ -5,13 +5,17 @@
 #include <taper.h>
 #include <glassid.h>
 #include <glassmath.h>
+#include <threadpool.h>
 #include <geo.h>
 #include <cmath>
 #include <string>
 #include <algorithm>
 #include <memory>
 #include <vector>
+#include <unordered_map>
+#include <utility>
 #include <mutex>
+#include <condition_variable>
 #include <fstream>
 #include <limits>
 #include "TTT.h"
@@ -59,7 +63,10 @@ constexpr double CHypo::k_dSearchRadiusTaperFactor;
 
 
 // ---------------------------------------------------------CHypo
-CHypo::CHypo() {
+CHypo::CHypo()
+		: m_iDataVersion(0),
+		  m_bProcessingClaimed(false),
+		  m_bProcessingDeferred(false) {
 	clear();
 }
 
@@ -70,7 +77,10 @@ CHypo::CHypo(double lat, double lon, double z, double time, std::string pid,
 				std::shared_ptr<traveltime::CTravelTime> secondTrav,
 				std::shared_ptr<traveltime::CTTT> ttt, double resolution,
 				double aziTap, double maxDep,
-				std::shared_ptr<traveltime::CZoneStats> zoneStats) {
+				std::shared_ptr<traveltime::CZoneStats> zoneStats)
+		: m_iDataVersion(0),
+		  m_bProcessingClaimed(false),
+		  m_bProcessingDeferred(false) {
 	if (!initialize(lat, lon, z, time, pid, web, bayes, thresh, cut, firstTrav,
 					secondTrav, ttt, resolution, aziTap, maxDep, zoneStats)) {
 		clear();
@@ -83,11 +93,13 @@ CHypo::CHypo(std::shared_ptr<json::Object> detection, double thresh, int cut,
 				std::shared_ptr<traveltime::CTravelTime> secondTrav,
 				std::shared_ptr<traveltime::CTTT> ttt, double resolution,
 				double aziTap, double maxDep, CSiteList *pSiteList,
-				std::shared_ptr<traveltime::CZoneStats> zoneStats) {
+				std::shared_ptr<traveltime::CZoneStats> zoneStats)
+		: m_iDataVersion(0),
+		  m_bProcessingClaimed(false),
+		  m_bProcessingDeferred(false) {
 	// null check json
 	if (detection == NULL) {
-		glass3::util::Logger::log("error",
-									"CHypo::CHypo: NULL json communication.");
+		GLASS3_LOG_ERROR("CHypo::CHypo: NULL json communication.");
 		return;
 	}
 
@@ -97,14 +109,12 @@ CHypo::CHypo(std::shared_ptr<json::Object> detection, double thresh, int cut,
 		std::string type = (*detection)["Type"].ToString();
 
 		if (type != "Detection") {
-			glass3::util::Logger::log(
-					"warning",
+			GLASS3_LOG_WARNING(
 					"CHypo::CHypo: Non-Detection message passed in.");
 			return;
 		}
 	} else {
-		glass3::util::Logger::log("error",
-									"CHypo::CHypo: Missing required Type Key.");
+		GLASS3_LOG_ERROR("CHypo::CHypo: Missing required Type Key.");
 		return;
 	}
 
@@ -131,8 +141,7 @@ CHypo::CHypo(std::shared_ptr<json::Object> detection, double thresh, int cut,
 			glass3::util::Date dt = glass3::util::Date();
 			time = dt.decodeISO8601Time(tiso);
 		} else {
-			glass3::util::Logger::log(
-					"error",
+			GLASS3_LOG_ERROR(
 					"CHypo::CHypo: Missing required Hypocenter Time Key.");
 
 			return;
@@ -145,8 +154,7 @@ CHypo::CHypo(std::shared_ptr<json::Object> detection, double thresh, int cut,
 			lat = hypocenter["Latitude"].ToDouble();
 
 		} else {
-			glass3::util::Logger::log(
-					"error",
+			GLASS3_LOG_ERROR(
 					"CHypo::CHypo: Missing required Hypocenter Latitude"
 					" Key.");
 
@@ -159,8 +167,7 @@ CHypo::CHypo(std::shared_ptr<json::Object> detection, double thresh, int cut,
 						== json::ValueType::DoubleVal)) {
 			lon = hypocenter["Longitude"].ToDouble();
 		} else {
-			glass3::util::Logger::log(
-					"error",
+			GLASS3_LOG_ERROR(
 					"CHypo::CHypo: Missing required Hypocenter Longitude"
 					" Key.");
 
@@ -172,15 +179,13 @@ CHypo::CHypo(std::shared_ptr<json::Object> detection, double thresh, int cut,
 				&& (hypocenter["Depth"].GetType() == json::ValueType::DoubleVal)) {
 			z = hypocenter["Depth"].ToDouble();
 		} else {
-			glass3::util::Logger::log(
-					"error", "CHypo::CHypo: Missing required Hypocenter Depth"
+			GLASS3_LOG_ERROR("CHypo::CHypo: Missing required Hypocenter Depth"
 					" Key.");
 
 			return;
 		}
 	} else {
-		glass3::util::Logger::log(
-				"error", "CHypo::CHypo: Missing required Hypocenter Key.");
+		GLASS3_LOG_ERROR("CHypo::CHypo: Missing required Hypocenter Key.");
 
 		return;
 	}
@@ -191,8 +196,7 @@ CHypo::CHypo(std::shared_ptr<json::Object> detection, double thresh, int cut,
 		bayes = (*detection)["Bayes"].ToDouble();
 
 	} else {
-		glass3::util::Logger::log(
-				"error", "CHypo::CHypo: Missing required Hypocenter Latitude"
+		GLASS3_LOG_ERROR("CHypo::CHypo: Missing required Hypocenter Latitude"
 				" Key.");
 
 		return;
@@ -251,18 +255,20 @@ CHypo::CHypo(std::shared_ptr<json::Object> detection, double thresh, int cut,
 
 // ---------------------------------------------------------CHypo
 CHypo::CHypo(std::shared_ptr<CTrigger> trigger,
-				std::shared_ptr<traveltime::CTTT> ttt) {
+				std::shared_ptr<traveltime::CTTT> ttt)
+		: m_iDataVersion(0),
+		  m_bProcessingClaimed(false),
+		  m_bProcessingDeferred(false) {
 	// null checks
 	if (trigger == NULL) {
-		glass3::util::Logger::log("error", "CHypo::CHypo: NULL node.");
+		GLASS3_LOG_ERROR("CHypo::CHypo: NULL node.");
 
 		clear();
 		return;
 	}
 
 	if (trigger->getWeb() == NULL) {
-		glass3::util::Logger::log("error",
-									"CHypo::CHypo: NULL trigger->getWeb().");
+		GLASS3_LOG_ERROR("CHypo::CHypo: NULL trigger->getWeb().");
 
 		clear();
 		return;
@@ -288,14 +294,17 @@ CHypo::CHypo(std::shared_ptr<CTrigger> trigger,
 CHypo::CHypo(std::shared_ptr<CCorrelation> corr,
 				std::shared_ptr<traveltime::CTravelTime> firstTrav,
 				std::shared_ptr<traveltime::CTravelTime> secondTrav,
-				std::shared_ptr<traveltime::CTTT> ttt) {
+				std::shared_ptr<traveltime::CTTT> ttt)
+		: m_iDataVersion(0),
+		  m_bProcessingClaimed(false),
+		  m_bProcessingDeferred(false) {
 	m_pTravelTimeTables = NULL;
 	m_pNucleationTravelTime1 = NULL;
 	m_pNucleationTravelTime2 = NULL;
 
 	// null checks
 	if (corr == NULL) {
-		glass3::util::Logger::log("error", "CHypo::CHypo: NULL correlation.");
+		GLASS3_LOG_ERROR("CHypo::CHypo: NULL correlation.");
 
 		clear();
 		return;
@@ -317,58 +326,48 @@ CHypo::~CHypo() {
 void CHypo::addCorrelationReference(std::shared_ptr<CCorrelation> corr) {
 	// null check
 	if (corr == NULL) {
-		glass3::util::Logger::log("warning",
-									"CHypo::addCorrelation: NULL correlation.");
+		GLASS3_LOG_WARNING("CHypo::addCorrelation: NULL correlation.");
 		return;
 	}
 
 	// lock mutex for this scope
 	std::lock_guard < std::recursive_mutex > guard(m_HypoMutex);
 
-	// for each correlation in the vector
-	for (auto q : m_vCorrelationData) {
-		// see if we have this same correlation
-		// NOTE: this only checks by ID, need to improve this to
-		// an ID/Source check
-		if (q->getID() == corr->getID()) {
-			char sLog[glass3::util::Logger::k_nMaxLogEntrySize];
-			snprintf(sLog, sizeof(sLog),
-						"CHypo::addCorrelation: ** Duplicate correlation %s",
-						corr->getSite()->getSCNL().c_str());
-			glass3::util::Logger::log(sLog);
+	// see if we have this same correlation
+	if (m_CorrelationDataSet.insert(corr.get()).second == false) {
+		GLASS3_LOG_DEBUG_FORMAT(
+					"CHypo::addCorrelation: ** Duplicate correlation %s",
+					corr->getSite()->getSCNL().c_str());
 
-			return;
-		}
+		return;
 	}
 
 	// add the pick to the vector.
 	m_vCorrelationData.push_back(corr);
 	m_bCorrelationAdded = true;
+	m_iDataVersion++;
 }
 
 // ---------------------------------------------------------addPickReference
 bool CHypo::addPickReference(std::shared_ptr<CPick> pck) {
 	// null check
 	if (pck == NULL) {
-		glass3::util::Logger::log("warning",
-									"CHypo::addPickReference: NULL pck.");
+		GLASS3_LOG_WARNING("CHypo::addPickReference: NULL pck.");
 		return (false);
 	}
 
 	// lock mutex for this scope
 	std::lock_guard < std::recursive_mutex > guard(m_HypoMutex);
 
-	// for each pick in the vector
-	for (auto aPick : m_vPickData) {
-		// see if we have this same pick
-		if (aPick->getID() == pck->getID()) {
-			// Don't add this duplicate pick
-			return(false);
-		}
+	// see if we have this same pick
+	if (m_PickDataSet.insert(pck.get()).second == false) {
+		// Don't add this duplicate pick
+		return(false);
 	}
 
 	// add the pick to the vector.
 	m_vPickData.push_back(pck);
+	m_iDataVersion++;
 	return(true);
 }
 
@@ -486,12 +485,16 @@ double CHypo::calculateAffinity(std::shared_ptr<CCorrelation> corr) {
 double CHypo::anneal(int nIter, double dStart, double dStop, double tStart,
 						double tStop) {
 	// lock mutex for this scope
-	std::lock_guard < std::recursive_mutex > guard(m_HypoMutex);
+	std::unique_lock < std::recursive_mutex > guard(m_HypoMutex);
 
 	// This is essentially a faster algorithmic implementation of iterate
 	// *** First, locate ***
 	if (CGlass::getMinimizeTTLocator() == false) {
+		// don't hold the hypo, so the locator can release it while its
+		// chains run
+		guard.unlock();
 		annealingLocateBayes(nIter, dStart, dStop, tStart, tStop, true);
+		guard.lock();
 	} else {
 		annealingLocateResidual(nIter, dStart, dStop, tStart, tStop, true);
 	}
@@ -504,15 +507,8 @@ double CHypo::anneal(int nIter, double dStart, double dStop, double tStart,
 	// create pick delete vector
 	std::vector < std::shared_ptr < CPick >> vRemovePicks;
 
-	// set the traveltime for the current hypo
-	if (m_pNucleationTravelTime1 != NULL) {
-		m_pNucleationTravelTime1->setTTOrigin(m_dLatitude, m_dLongitude,
-												m_dDepth);
-	}
-	if (m_pNucleationTravelTime2 != NULL) {
-		m_pNucleationTravelTime2->setTTOrigin(m_dLatitude, m_dLongitude,
-												m_dDepth);
-	}
+	// set the traveltime origin for the current hypo
+	glass3::util::Geo hypoGeo = getGeo();
 
 	// get number of picks
 	int npick = m_vPickData.size();
@@ -525,11 +521,13 @@ double CHypo::anneal(int nIter, double dStart, double dStop, double tStart,
 		// calculate the travel times
 		double tCal1 = -1;
 		if (m_pNucleationTravelTime1 != NULL) {
-			tCal1 = m_pNucleationTravelTime1->T(&pick->getSite()->getGeo());
+			tCal1 = m_pNucleationTravelTime1->getTravelTime(
+					hypoGeo, pick->getSite()->getGeo());
 		}
 		double tCal2 = -1;
 		if (m_pNucleationTravelTime2 != NULL) {
-			tCal2 = m_pNucleationTravelTime2->T(&pick->getSite()->getGeo());
+			tCal2 = m_pNucleationTravelTime2->getTravelTime(
+					hypoGeo, pick->getSite()->getGeo());
 		}
 
 		// calculate absolute residuals
@@ -574,7 +572,7 @@ double CHypo::anneal(int nIter, double dStart, double dStop, double tStart,
 		removePickReference(pick);
 	}
 
-	glass3::util::Logger::log("debug", "CHypo::anneal, Event: " + m_sID
+	GLASS3_LOG_DEBUG("CHypo::anneal, Event: " + getID()
 		+ " bayes: " + std::to_string(m_dBayesValue)
 		+ " removed: " + std::to_string(vRemovePicks.size()));
 
@@ -586,8 +584,9 @@ double CHypo::anneal(int nIter, double dStart, double dStop, double tStart,
 void CHypo::annealingLocateBayes(int nIter, double dStart, double dStop,
 									double tStart, double tStop,
 									bool nucleate) {
-	// lock mutex for this scope
-	std::lock_guard < std::recursive_mutex > guard(m_HypoMutex);
+	// lock mutex for this scope, the multiple chain locator releases it while
+	// its chains run
+	std::unique_lock < std::recursive_mutex > guard(m_HypoMutex);
 
 	// don't locate if the location is fixed
 	if (m_bFixed) {
@@ -627,6 +626,9 @@ void CHypo::annealingLocateBayes(int nIter, double dStart, double dStop,
 			currentLocationMaxDepthFromZoneStats*1.,
 			currentLocationMaxDepthFromZoneStats*1.5);
 
+	// gather the pick data once for all of the trial locations
+	gatherLocatorCache();
+
 	// these hold the values of the initial, current, and best stack location
 	double valStart = 0;
 	double valBest = 0;
@@ -640,7 +642,7 @@ void CHypo::annealingLocateBayes(int nIter, double dStart, double dStop,
 	// if testing locator, setup output file
 	std::ofstream outfile;
 	if (CGlass::getTestLocator()) {
-		std::string filename = "./locatorTest/" + m_sID + ".txt";
+		std::string filename = "./locatorTest/" + getID() + ".txt";
 		outfile.open(filename, std::ios::out | std::ios::app);
 		outfile << std::to_string(m_dLatitude) << " "
 				<< std::to_string(m_dLongitude) << " "
@@ -667,8 +669,17 @@ void CHypo::annealingLocateBayes(int nIter, double dStart, double dStop,
 								-k_dLocationTaperConstant,
 								nIter + k_dLocationTaperConstant);
 
+	// run independent chains instead of the single serial chain when
+	// configured, the serial chain still writes the locator test output
+	int numChains = CGlass::getNumLocatorChains();
+	bool useChains = (numChains > 1) && (CGlass::getTestLocator() == false);
+	if (useChains == true) {
+		valBest = runLocatorChains(&guard, numChains, nIter, dStart, dStop,
+									tStart, tStop, nucleate, valStart);
+	}
+
 	// for the number of requested iterations
-	for (int iter = 0; iter < nIter; iter++) {
+	for (int iter = 0; (useChains == false) && (iter < nIter); iter++) {
 		// compute the current step distance from the current iteration and
 		// starting and stopping values, use the taper to make the step distance
 		// slowly decrease
@@ -681,11 +692,13 @@ void CHypo::annealingLocateBayes(int nIter, double dStart, double dStop,
 		// the km for dx and dy is double so the epicentral search space is
 		// larger than the depth search space, because we live on a sphere
 		double dx = glass3::util::GlassMath::gauss(
-				0.0, dkm * k_dVerticalToHorizontalDistanceCorrectionFactor);
+				0.0, dkm * k_dVerticalToHorizontalDistanceCorrectionFactor,
+				&m_RandomGenerator);
 		double dy = glass3::util::GlassMath::gauss(
-				0.0, dkm * k_dVerticalToHorizontalDistanceCorrectionFactor);
-		double dz = glass3::util::GlassMath::gauss(0.0, dkm);
-		double dt = glass3::util::GlassMath::gauss(0.0, dOt);
+				0.0, dkm * k_dVerticalToHorizontalDistanceCorrectionFactor,
+				&m_RandomGenerator);
+		double dz = glass3::util::GlassMath::gauss(0.0, dkm, &m_RandomGenerator);
+		double dt = glass3::util::GlassMath::gauss(0.0, dOt, &m_RandomGenerator);
 
 		// compute current location using the hypo location and the x and y
 		// Gaussian step distances
@@ -730,49 +743,9 @@ void CHypo::annealingLocateBayes(int nIter, double dStart, double dStop,
 			// then this is the new best value
 			valBest = bayes;
 
-			// check to see if this is a "BIG" move.  If so, update audit
-			// information.
-			if ((sqrt(
-					(xlat - this->m_hapsAudit.dLatPrev)
-							* (xlat - this->m_hapsAudit.dLatPrev)
-							+ (xlon - this->m_hapsAudit.dLonPrev)
-									* cos(glass3::util::GlassMath::k_DegreesToRadians
-											* xlat)
-									* (xlon - this->m_hapsAudit.dLonPrev)
-									* cos(glass3::util::GlassMath::k_DegreesToRadians
-											* xlat))
-					* glass3::util::Geo::k_DegreesToKm
-					> m_dWebResolution * k_dLocationChangeWebResolutionRatio)
-					|| (fabs(this->m_hapsAudit.dDepthPrev - xz)
-							> k_dMinimumDepthChangeKMThreshold
-							&& fabs(m_dDepth - xz)
-									> this->m_hapsAudit.dDepthPrev
-											* k_dMinimumDepthChangeRatioThreshold)) {
-				// this represents a LARGE movement (currently
-				// m_dWebResolution / 2).  Update auditing information
-				this->m_hapsAudit.dtLastBigMove = glass3::util::Date::now();
-				this->m_hapsAudit.dtOrigin = oT;
-				this->m_hapsAudit.dMaxStackBeforeMove = this->m_hapsAudit
-						.dMaxStackSinceMove;
-				this->m_hapsAudit.nMaxPhasesBeforeMove = this->m_hapsAudit
-						.nMaxPhasesSinceMove;
-				this->m_hapsAudit.dLatPrev = m_dLatitude;
-				this->m_hapsAudit.dLonPrev = m_dLongitude;
-				this->m_hapsAudit.dDepthPrev = m_dDepth;
-			}
-
-			this->m_hapsAudit.dMaxStackSinceMove = valBest;
-			double dCurrDataCount = m_vPickData.size();
-			if (dCurrDataCount > this->m_hapsAudit.nMaxPhasesSinceMove) {
-				this->m_hapsAudit.nMaxPhasesSinceMove = dCurrDataCount;
-			}
-
-			// set the hypo location/depth/time from the new best
-			// locaton/depth/time
-			setLatitude(xlat);
-			setLongitude(xlon);
-			setDepth(xz);
-			setTOrigin(oT);
+			// update the audit information and move the hypo to the new best
+			// location/depth/time
+			commitLocatorMove(xlat, xlon, xz, oT, valBest);
 
 			// save this perturbation to the overall change
 			ddx += dx;
@@ -782,6 +755,9 @@ void CHypo::annealingLocateBayes(int nIter, double dStart, double dStop,
 		}
 	}
 
+	// the pick data may change once this locate is done
+	m_LocatorCache.bValid = false;
+
 	// set dBayes to current value
 	m_dBayesValue = valBest;
 	if (nucleate == true) {
@@ -795,7 +771,7 @@ void CHypo::annealingLocateBayes(int nIter, double dStart, double dStop,
 	 " (%.4f,%.4f,%.4f,%.4f) sPid:%s; new bayes value:%.4f; old bayes"
 	 " value:%.4f",
 	 getLatitude(), getLongitude(), getDepth(), getTOrigin(), ddx, ddy,
-	 ddz, ddt, m_sID.c_str(), valBest, valStart);
+	 ddz, ddt, getID().c_str(), valBest, valStart);
 	 glass3::util::Logger::log(sLog);
 	 */
 
@@ -811,6 +787,246 @@ void CHypo::annealingLocateBayes(int nIter, double dStart, double dStop,
 	return;
 }
 
+// ---------------------------------------------------------commitLocatorMove
+void CHypo::commitLocatorMove(double xlat, double xlon, double xz, double oT,
+								double valBest) {
+	// check to see if this is a "BIG" move.  If so, update audit
+	// information.
+	if ((sqrt(
+			(xlat - this->m_hapsAudit.dLatPrev)
+					* (xlat - this->m_hapsAudit.dLatPrev)
+					+ (xlon - this->m_hapsAudit.dLonPrev)
+							* cos(glass3::util::GlassMath::k_DegreesToRadians
+									* xlat)
+							* (xlon - this->m_hapsAudit.dLonPrev)
+							* cos(glass3::util::GlassMath::k_DegreesToRadians
+									* xlat))
+			* glass3::util::Geo::k_DegreesToKm
+			> m_dWebResolution * k_dLocationChangeWebResolutionRatio)
+			|| (fabs(this->m_hapsAudit.dDepthPrev - xz)
+					> k_dMinimumDepthChangeKMThreshold
+					&& fabs(m_dDepth - xz)
+							> this->m_hapsAudit.dDepthPrev
+									* k_dMinimumDepthChangeRatioThreshold)) {
+		// this represents a LARGE movement (currently
+		// m_dWebResolution / 2).  Update auditing information
+		this->m_hapsAudit.dtLastBigMove = glass3::util::Date::now();
+		this->m_hapsAudit.dtOrigin = oT;
+		this->m_hapsAudit.dMaxStackBeforeMove = this->m_hapsAudit
+				.dMaxStackSinceMove;
+		this->m_hapsAudit.nMaxPhasesBeforeMove = this->m_hapsAudit
+				.nMaxPhasesSinceMove;
+		this->m_hapsAudit.dLatPrev = m_dLatitude;
+		this->m_hapsAudit.dLonPrev = m_dLongitude;
+		this->m_hapsAudit.dDepthPrev = m_dDepth;
+	}
+
+	this->m_hapsAudit.dMaxStackSinceMove = valBest;
+	double dCurrDataCount = m_vPickData.size();
+	if (dCurrDataCount > this->m_hapsAudit.nMaxPhasesSinceMove) {
+		this->m_hapsAudit.nMaxPhasesSinceMove = dCurrDataCount;
+	}
+
+	// set the hypo location/depth/time from the new best
+	// locaton/depth/time
+	setLatitude(xlat);
+	setLongitude(xlon);
+	setDepth(xz);
+	setTOrigin(oT);
+}
+
+// ---------------------------------------------------------runLocatorChains
+double CHypo::runLocatorChains(
+		std::unique_lock<std::recursive_mutex> *hypoLock, int numChains,
+		int nIter, double dStart, double dStop, double tStart, double tStop,
+		bool nucleate, double valStart) {
+	// split the iterations between the chains
+	int chainIterations = (nIter + numChains - 1) / numChains;
+
+	// each chain gets its own copy of the gathered pick data and scratch
+	// arrays, and its own random number generator
+	std::vector<HypoLocatorChain> chains(numChains);
+	for (int i = 0; i < numChains; i++) {
+		HypoLocatorChain &chain = chains[i];
+		chain.Cache = m_LocatorCache;
+		chain.Generator.seed(m_RandomGenerator());
+		chain.iNumIterations = chainIterations;
+		chain.dStartDistance = dStart;
+		chain.dStopDistance = dStop;
+		chain.dStartTime = tStart;
+		chain.dStopTime = tStop;
+		chain.bNucleate = nucleate;
+		chain.dLatitude = m_dLatitude;
+		chain.dLongitude = m_dLongitude;
+		chain.dDepth = m_dDepth;
+		chain.dTOrigin = m_tOrigin;
+		chain.dBayes = 0;
+
+		// the first chain starts at the current location, the rest start a
+		// starting step distance away
+		if (i > 0) {
+			double dx = glass3::util::GlassMath::gauss(
+					0.0, dStart * k_dVerticalToHorizontalDistanceCorrectionFactor,
+					&chain.Generator);
+			double dy = glass3::util::GlassMath::gauss(
+					0.0, dStart * k_dVerticalToHorizontalDistanceCorrectionFactor,
+					&chain.Generator);
+			chain.dLongitude += cos(
+					glass3::util::GlassMath::k_DegreesToRadians * chain.dLatitude)
+					* dx / glass3::util::Geo::k_DegreesToKm;
+			chain.dLatitude += dy / glass3::util::Geo::k_DegreesToKm;
+			chain.dDepth = std::min(
+					std::max(
+							chain.dDepth
+									+ glass3::util::GlassMath::gauss(
+											0.0, dStart, &chain.Generator),
+							1.0),
+					static_cast<double>(m_dMaxDepth));
+			chain.dTOrigin += glass3::util::GlassMath::gauss(0.0, tStart,
+																&chain.Generator);
+		}
+	}
+
+	// remember what the chains were started from, so the result is only used
+	// if the hypo is still the same when they are done
+	int dataVersion = m_iDataVersion;
+	double startLatitude = m_dLatitude;
+	double startLongitude = m_dLongitude;
+	double startDepth = m_dDepth;
+	double startTOrigin = m_tOrigin;
+
+	// the chains have their own copies of the pick data, travel times, and
+	// tapers, so the hypo is released while they run, anyone using the
+	// locator cache in the mean time has to gather their own
+	m_LocatorCache.bValid = false;
+	hypoLock->unlock();
+
+	// run the chains on the locator work pool, along with this thread, or
+	// all on this thread if there is no pool
+	glass3::util::ThreadPool * pool = CGlass::getLocatorWorkPool();
+	std::mutex doneMutex;
+	std::condition_variable doneCondition;
+	int numPooled = 0;
+	int numDone = 0;
+	if (pool != NULL) {
+		for (int i = 1; i < numChains; i++) {
+			HypoLocatorChain * chain = &chains[i];
+			pool->addJob([this, chain, &doneMutex, &doneCondition, &numDone]() {
+				runLocatorChain(chain);
+
+				std::lock_guard<std::mutex> doneGuard(doneMutex);
+				numDone++;
+				doneCondition.notify_one();
+			});
+			numPooled++;
+		}
+	}
+	for (int i = numPooled + 1; i < numChains; i++) {
+		runLocatorChain(&chains[i]);
+	}
+	runLocatorChain(&chains[0]);
+
+	std::unique_lock<std::mutex> doneLock(doneMutex);
+	doneCondition.wait(doneLock, [&numDone, numPooled]() {
+		return (numDone >= numPooled);
+	});
+	doneLock.unlock();
+
+	hypoLock->lock();
+
+	// discard the result if the hypo's data changed or it was moved while
+	// the chains ran, and use the stack value at its current location
+	if ((m_iDataVersion != dataVersion) || (m_dLatitude != startLatitude)
+			|| (m_dLongitude != startLongitude) || (m_dDepth != startDepth)
+			|| (m_tOrigin != startTOrigin)) {
+		GLASS3_LOG_DEBUG(
+				"CHypo::runLocatorChains: hypo " + getID()
+						+ " changed while locating, discarding result");
+
+		gatherLocatorCache();
+		return (calculateCachedBayes(&m_LocatorCache, m_dLatitude, m_dLongitude,
+										m_dDepth, m_tOrigin, nucleate));
+	}
+
+	// pick the best chain, the lowest numbered on ties so that seeded runs
+	// are repeatable
+	int best = 0;
+	for (int i = 1; i < numChains; i++) {
+		if (chains[i].dBayes > chains[best].dBayes) {
+			best = i;
+		}
+	}
+
+	if (chains[best].dBayes <= valStart) {
+		return (valStart);
+	}
+
+	commitLocatorMove(chains[best].dLatitude, chains[best].dLongitude,
+						chains[best].dDepth, chains[best].dTOrigin,
+						chains[best].dBayes);
+
+	return (chains[best].dBayes);
+}
+
+// ---------------------------------------------------------runLocatorChain
+void CHypo::runLocatorChain(HypoLocatorChain *chain) {
+	// the same shrinking search as the serial chain in annealingLocateBayes
+	glass3::util::Taper taper;
+	taper = glass3::util::Taper(-k_dLocationTaperConstant,
+								-k_dLocationTaperConstant,
+								-k_dLocationTaperConstant,
+								chain->iNumIterations + k_dLocationTaperConstant);
+
+	chain->dBayes = calculateCachedBayes(&chain->Cache, chain->dLatitude,
+											chain->dLongitude, chain->dDepth,
+											chain->dTOrigin, chain->bNucleate);
+
+	for (int iter = 0; iter < chain->iNumIterations; iter++) {
+		double dkm = (chain->dStartDistance - chain->dStopDistance)
+				* taper.calculateValue(static_cast<double>(iter))
+				+ chain->dStopDistance;
+		double dOt = (chain->dStartTime - chain->dStopTime)
+				* taper.calculateValue(static_cast<double>(iter))
+				+ chain->dStopTime;
+
+		double dx = glass3::util::GlassMath::gauss(
+				0.0, dkm * k_dVerticalToHorizontalDistanceCorrectionFactor,
+				&chain->Generator);
+		double dy = glass3::util::GlassMath::gauss(
+				0.0, dkm * k_dVerticalToHorizontalDistanceCorrectionFactor,
+				&chain->Generator);
+		double dz = glass3::util::GlassMath::gauss(0.0, dkm, &chain->Generator);
+		double dt = glass3::util::GlassMath::gauss(0.0, dOt, &chain->Generator);
+
+		double xlon = chain->dLongitude
+				+ cos(glass3::util::GlassMath::k_DegreesToRadians
+						* chain->dLatitude) * dx
+						/ glass3::util::Geo::k_DegreesToKm;
+		double xlat = chain->dLatitude + dy / glass3::util::Geo::k_DegreesToKm;
+
+		// keep depth between 1 km and the maximum
+		double xz = chain->dDepth + dz;
+		if (xz < 1.0) {
+			xz = 1.0;
+		}
+		if (xz > m_dMaxDepth) {
+			xz = chain->dDepth;
+		}
+
+		double oT = chain->dTOrigin + dt;
+
+		double bayes = calculateCachedBayes(&chain->Cache, xlat, xlon, xz, oT,
+											chain->bNucleate);
+		if (bayes > chain->dBayes) {
+			chain->dBayes = bayes;
+			chain->dLatitude = xlat;
+			chain->dLongitude = xlon;
+			chain->dDepth = xz;
+			chain->dTOrigin = oT;
+		}
+	}
+}
+
 // ------------------------------------------------------annealingLocateResidual
 void CHypo::annealingLocateResidual(int nIter, double dStart, double dStop,
 									double tStart, double tStop,
@@ -819,34 +1035,30 @@ void CHypo::annealingLocateResidual(int nIter, double dStart, double dStop,
 	std::lock_guard < std::recursive_mutex > guard(m_HypoMutex);
 
 	if (m_pTravelTimeTables == NULL) {
-		glass3::util::Logger::log(
-				"error", "CHypo::annealingLocateResidual: NULL pTTT.");
+		GLASS3_LOG_ERROR("CHypo::annealingLocateResidual: NULL pTTT.");
 		return;
 	}
 
 	if (m_bFixed) {
 		return;
 	}
-	char sLog[glass3::util::Logger::k_nMaxLogEntrySize];
 
 	double delta;
 	double sigma;
 
-	m_pTravelTimeTables->setTTOrigin(m_dLatitude, m_dLongitude, m_dDepth);
+	// gather the pick data once for all of the trial locations
+	gatherLocatorCache();
 
 	double valStart = calculateAbsResidualSum(m_dLatitude, m_dLongitude,
 												m_dDepth, m_tOrigin, nucleate);
 	m_dBayesValue = calculateBayes(m_dLatitude, m_dLongitude, m_dDepth,
 									m_tOrigin, nucleate);
-	snprintf(sLog, sizeof(sLog), "CHypo::annealingLocate: old bayes value %.4f",
+	GLASS3_LOG_DEBUG_FORMAT("CHypo::annealingLocate: old bayes value %.4f",
 				getBayesValue());
-	glass3::util::Logger::log(sLog);
 
-	snprintf(
-			sLog, sizeof(sLog),
+	GLASS3_LOG_DEBUG_FORMAT(
 			"CHypo::annealingLocateResidual: old sum abs residual value %.4f",
 			valStart);
-	glass3::util::Logger::log(sLog);
 
 	double valBest = valStart;
 
@@ -876,11 +1088,13 @@ void CHypo::annealingLocateResidual(int nIter, double dStart, double dStop,
 
 		// init x, y, and z gaussian step distances
 		double dx = glass3::util::GlassMath::gauss(
-				0.0, dkm * k_dVerticalToHorizontalDistanceCorrectionFactor);
+				0.0, dkm * k_dVerticalToHorizontalDistanceCorrectionFactor,
+				&m_RandomGenerator);
 		double dy = glass3::util::GlassMath::gauss(
-				0.0, dkm * k_dVerticalToHorizontalDistanceCorrectionFactor);
-		double dz = glass3::util::GlassMath::gauss(0.0, dkm);
-		double dt = glass3::util::GlassMath::gauss(0.0, dOt);
+				0.0, dkm * k_dVerticalToHorizontalDistanceCorrectionFactor,
+				&m_RandomGenerator);
+		double dz = glass3::util::GlassMath::gauss(0.0, dkm, &m_RandomGenerator);
+		double dt = glass3::util::GlassMath::gauss(0.0, dOt, &m_RandomGenerator);
 
 		// compute current location using the hypo location and the x and y
 		// Gaussian step distances
@@ -906,7 +1120,6 @@ void CHypo::annealingLocateResidual(int nIter, double dStart, double dStop,
 		// compute current origin time
 		double oT = m_tOrigin + dt;
 
-		m_pTravelTimeTables->setTTOrigin(xlat, xlon, xz);
 		double calculateValue = calculateAbsResidualSum(xlat, xlon, xz, oT,
 														nucleate);
 		// geo.setGeographic(dLat, dLon, glass3::util::Geo::k_EarthRadiusKm - dZ);
@@ -963,19 +1176,20 @@ void CHypo::annealingLocateResidual(int nIter, double dStart, double dStop,
 
 	m_dBayesValue = calculateBayes(m_dLatitude, m_dLongitude, m_dDepth,
 									m_tOrigin, nucleate);
-	snprintf(sLog, sizeof(sLog), "CHypo::annealingLocate: old bayes value %.4f",
+
+	// the pick data may change once this locate is done
+	m_LocatorCache.bValid = false;
+
+	GLASS3_LOG_DEBUG_FORMAT("CHypo::annealingLocate: old bayes value %.4f",
 				getBayesValue());
-	glass3::util::Logger::log(sLog);
-	snprintf(sLog, sizeof(sLog),
+	GLASS3_LOG_DEBUG_FORMAT(
 				"CHypo::annealingLocate: total movement (%.4f,%.4f,%.4f,%.4f)"
 				" (%.4f,%.4f,%.4f,%.4f)",
 				getLatitude(), getLongitude(), getDepth(), getTOrigin(), ddx,
 				ddy, ddz, ddt);
-	glass3::util::Logger::log(sLog);
 
-	snprintf(sLog, sizeof(sLog),
+	GLASS3_LOG_DEBUG_FORMAT(
 				"CHypo::annealingLocate: new sum abs residual %.4f", valBest);
-	glass3::util::Logger::log(sLog);
 
 	if (CGlass::getGraphicsOut() == true) {
 		graphicsOutput();
@@ -991,18 +1205,18 @@ bool CHypo::canAssociate(std::shared_ptr<CPick> pick, double sigma,
 	std::lock_guard < std::recursive_mutex > guard(m_HypoMutex);
 
 	// check to see if this is a valid hypo, a hypo must always have an id
-	if (m_sID == "") {
+	if (m_ID.getHandle() == glass3::util::InternedID::k_iEmptyHandle) {
 		return (false);
 	}
 
 	// null check
 	if (pick == NULL) {
-		glass3::util::Logger::log("error", "CHypo::canAssociate: NULL pick.");
+		GLASS3_LOG_ERROR("CHypo::canAssociate: NULL pick.");
 		return (false);
 	}
 
 	if (m_pTravelTimeTables == NULL) {
-		glass3::util::Logger::log("error", "CHypo::canAssociate: NULL pTTT.");
+		GLASS3_LOG_ERROR("CHypo::canAssociate: NULL pTTT.");
 		return (false);
 	}
 
@@ -1029,7 +1243,7 @@ bool CHypo::canAssociate(std::shared_ptr<CPick> pick, double sigma,
 				> dAzimuthRange) {
 			// it is not, do not associate
 			if (debug) {
-				glass3::util::Logger::log("debug", "CHypo::canAssociate: Pick: "
+				GLASS3_LOG_DEBUG("CHypo::canAssociate: Pick: "
 							+ pick->getID() + " ("
 							+ pick->getSite()->getSCNL()
 							+ ") back azimuth "
@@ -1059,7 +1273,7 @@ bool CHypo::canAssociate(std::shared_ptr<CPick> pick, double sigma,
 					> CGlass::getPickAzimuthClassificationUncertainty()) {
 				// it is not, do not associate
 				if (debug) {
-					glass3::util::Logger::log("debug", "CHypo::canAssociate: Pick: "
+					GLASS3_LOG_DEBUG("CHypo::canAssociate: Pick: "
 								+ pick->getID() + " ("
 								+ pick->getSite()->getSCNL()
 								+ ") classified azimuth "
@@ -1099,7 +1313,7 @@ bool CHypo::canAssociate(std::shared_ptr<CPick> pick, double sigma,
 	// check if distance is beyond cutoff
 	if (siteDistance > m_dAssociationDistanceCutoff) {
 		if (debug) {
-			glass3::util::Logger::log("debug", "CHypo::canAssociate: Pick: "
+			GLASS3_LOG_DEBUG("CHypo::canAssociate: Pick: "
 						+ pick->getID() + " ("
 						+ pick->getSite()->getSCNL()
 						+ ") site distance "
@@ -1127,7 +1341,7 @@ bool CHypo::canAssociate(std::shared_ptr<CPick> pick, double sigma,
 							> CGlass::getDistanceClassUpperBound(
 									pick->getClassifiedDistance())) {
 				if (debug) {
-					glass3::util::Logger::log("debug", "CHypo::canAssociate: Pick: "
+					GLASS3_LOG_DEBUG("CHypo::canAssociate: Pick: "
 								+ pick->getID() + " ("
 								+ pick->getSite()->getSCNL()
 								+ ") site distance "
@@ -1155,7 +1369,7 @@ bool CHypo::canAssociate(std::shared_ptr<CPick> pick, double sigma,
     // give up if there's no valid residual
 	if (std::isnan(tRes) == true) {
 		if (debug) {
-			glass3::util::Logger::log("debug", "CHypo::canAssociate: Pick: "
+			GLASS3_LOG_DEBUG("CHypo::canAssociate: Pick: "
 							+ pick->getID() + " ("
 							+ pick->getSite()->getSCNL() + ")"
 							+ " does not have a valid residual, p_only is "
@@ -1241,7 +1455,7 @@ bool CHypo::canAssociate(std::shared_ptr<CPick> pick, double sigma,
 	// check if pick standard deviation is greater than cutoff
 	if (stdev > cutoff) {
 		if (debug) {
-			glass3::util::Logger::log("debug", "CHypo::canAssociate: Pick: "
+			GLASS3_LOG_DEBUG("CHypo::canAssociate: Pick: "
 							+ pick->getID() + " ("
 							+ pick->getSite()->getSCNL() + ")"
 							+ " standard deviation "
@@ -1271,7 +1485,7 @@ bool CHypo::canAssociate(std::shared_ptr<CCorrelation> corr, double tWindow,
 	std::lock_guard < std::recursive_mutex > guard(m_HypoMutex);
 
 	// check to see if this is a valid hypo, a hypo must always have an id
-	if (m_sID == "") {
+	if (m_ID.getHandle() == glass3::util::InternedID::k_iEmptyHandle) {
 		return (false);
 	}
 
@@ -1279,13 +1493,10 @@ bool CHypo::canAssociate(std::shared_ptr<CCorrelation> corr, double tWindow,
 	// wiser heads than mine may come up with a more robust approach JMP
 	// null check
 	if (corr == NULL) {
-		glass3::util::Logger::log("error",
-									"CHypo::associate: NULL correlation.");
+		GLASS3_LOG_ERROR("CHypo::associate: NULL correlation.");
 		return (false);
 	}
 
-	char sLog[glass3::util::Logger::k_nMaxLogEntrySize];
-
 	double tDist = 0;
 	double xDist = 0;
 
@@ -1303,47 +1514,39 @@ bool CHypo::canAssociate(std::shared_ptr<CCorrelation> corr, double tWindow,
 
 		// check if distance difference is within window
 		if (xDist < xWindow) {
-			snprintf(
-					sLog,
-					sizeof(sLog),
+			GLASS3_LOG_DEBUG_FORMAT(
 					"CHypo::associate: C-ASSOC Hypo:%s Time:%s Station:%s"
 					" Corr:%s tDist:%.2f<tWindow:%.2f"
 					" xDist:%.2f>xWindow:%.2f)",
-					m_sID.c_str(),
+					getID().c_str(),
 					glass3::util::Date::encodeDateTime(corr->getTCorrelation())
 							.c_str(),
 					corr->getSite()->getSCNL().c_str(), corr->getID().c_str(),
 					tDist, tWindow, xDist, xWindow);
-			glass3::util::Logger::log(sLog);
 
 			return (true);
 		}
 	}
 
 	if (xDist == 0) {
-		snprintf(
-				sLog,
-				sizeof(sLog),
+		GLASS3_LOG_DEBUG_FORMAT(
 				"CHypo::associate: C-NOASSOC Hypo:%s Time:%s Station:%s Corr:%s"
 				" tDist:%.2f>tWindow:%.2f",
-				m_sID.c_str(),
+				getID().c_str(),
 				glass3::util::Date::encodeDateTime(corr->getTCorrelation())
 						.c_str(),
 				corr->getSite()->getSCNL().c_str(), corr->getID().c_str(),
 				tDist, tWindow);
 	} else {
-		snprintf(
-				sLog,
-				sizeof(sLog),
+		GLASS3_LOG_DEBUG_FORMAT(
 				"CHypo::associate: C-NOASSOC Hypo:%s Time:%s Station:%s Corr:%s"
 				" tDist:%.2f<tWindow:%.2f xDist:%.2f>xWindow:%.2f)",
-				m_sID.c_str(),
+				getID().c_str(),
 				glass3::util::Date::encodeDateTime(corr->getTCorrelation())
 						.c_str(),
 				corr->getSite()->getSCNL().c_str(), corr->getID().c_str(),
 				tDist, tWindow, xDist, xWindow);
 	}
-	glass3::util::Logger::log(sLog);
 
 	// it is, don't associate
 	return (false);
@@ -1359,11 +1562,10 @@ std::shared_ptr<json::Object> CHypo::generateCancelMessage() {
 
 	// fill in cancel command from current hypocenter
 	(*cancel)["Cmd"] = "Cancel";
-	(*cancel)["Pid"] = m_sID;
+	(*cancel)["Pid"] = getID();
 
 	// log it
-	glass3::util::Logger::log(
-			"debug",
+	GLASS3_LOG_DEBUG(
 			"CHypo::event: Created cancel message:" + json::Serialize(*cancel));
 
 	return (cancel);
@@ -1381,20 +1583,21 @@ bool CHypo::cancelCheck() {
 		return (false);
 	}
 
-	char sLog[glass3::util::Logger::k_nMaxLogEntrySize * 2];
-	char sHypo[glass3::util::Logger::k_nMaxLogEntrySize];
-
 	// calculate a new bayes value to use for these checks
 	double bayes = calculateBayes(m_dLatitude, m_dLongitude, m_dDepth,
 									m_tOrigin, false);
 
-	glass3::util::Date dt = glass3::util::Date(m_tOrigin);
-	snprintf(sHypo, sizeof(sHypo), "CHypo::cancel: %s tOrg:%s; dLat:%9.4f; "
-				"dLon:%10.4f; dZ:%6.1f; bayes:%.2f; nPick:%d; nCorr:%d",
-				m_sID.c_str(), dt.dateTime().c_str(), getLatitude(),
-				getLongitude(), getDepth(), bayes,
-				static_cast<int>(m_vPickData.size()),
-				static_cast<int>(m_vCorrelationData.size()));
+	// describe the hypo for the cancel messages, if they will be logged
+	char sHypo[glass3::util::Logger::k_nMaxLogEntrySize] = "";
+	if (glass3::util::Logger::isLevelEnabled(spdlog::level::debug)) {
+		glass3::util::Date dt = glass3::util::Date(m_tOrigin);
+		snprintf(sHypo, sizeof(sHypo), "CHypo::cancel: %s tOrg:%s; dLat:%9.4f; "
+					"dLon:%10.4f; dZ:%6.1f; bayes:%.2f; nPick:%d; nCorr:%d",
+					getID().c_str(), dt.dateTime().c_str(), getLatitude(),
+					getLongitude(), getDepth(), bayes,
+					static_cast<int>(m_vPickData.size()),
+					static_cast<int>(m_vCorrelationData.size()));
+	}
 
 	// check correlations, we want a hypo created from a correlation
 	// to stick around awhile to have a chance to associate picks.
@@ -1409,34 +1612,29 @@ bool CHypo::cancelCheck() {
 			// count correlation as expired if it's creation time is older than
 			// the cancel age
 			if ((cor->getTCreate() + cancelAge) < now) {
-				snprintf(sLog, sizeof(sLog),
+				GLASS3_LOG_DEBUG_FORMAT(
 							"CHypo::cancel: Correlation:%s created: %f "
 							"limit:%d now:%f",
-							m_sID.c_str(), cor->getTCreate(), cancelAge, now);
-				glass3::util::Logger::log(sLog);
+							getID().c_str(), cor->getTCreate(), cancelAge, now);
 				expireCount++;
 			}
 		}
 
 		// only prevent cancellation if all correlations haven't expired
 		if (expireCount == m_vCorrelationData.size()) {
-			snprintf(
-					sLog, sizeof(sLog),
+			GLASS3_LOG_DEBUG_FORMAT(
 					"CHypo::cancel: $$Could cancel %s due to associated "
 					"correlations (%d) older than %d seconds",
-					m_sID.c_str(),
+					getID().c_str(),
 					(static_cast<int>(m_vCorrelationData.size()) - expireCount),
 					cancelAge);
-			glass3::util::Logger::log(sLog);
 		} else {
-			snprintf(
-					sLog, sizeof(sLog),
+			GLASS3_LOG_DEBUG_FORMAT(
 					"CHypo::cancel: $$Will not cancel %s due to associated "
 					"correlations (%d) younger than %d seconds",
-					m_sID.c_str(),
+					getID().c_str(),
 					(static_cast<int>(m_vCorrelationData.size()) - expireCount),
 					cancelAge);
-			glass3::util::Logger::log(sLog);
 
 			// Hypo is still viable, for now...
 			return (false);
@@ -1454,10 +1652,9 @@ bool CHypo::cancelCheck() {
 	int nCorrelations = static_cast<int>(m_vCorrelationData.size());
 	if ((nPicks + nCorrelations) < ncut) {
 		// there isn't
-		snprintf(sLog, sizeof(sLog), "CHypo::cancel: Insufficient data "
+		GLASS3_LOG_DEBUG_FORMAT("CHypo::cancel: Insufficient data "
 					"((%d + %d) < %d) Hypo: %s",
 					nPicks, nCorrelations, ncut, sHypo);
-		glass3::util::Logger::log(sLog);
 
 		// this hypo can be canceled
 		return (true);
@@ -1469,10 +1666,9 @@ bool CHypo::cancelCheck() {
 
 	if (bayes < thresh) {
 		// failure
-		snprintf(sLog, sizeof(sLog),
+		GLASS3_LOG_DEBUG_FORMAT(
 					"CHypo::cancel: Below threshold (%.1f < %.1f) Hypo: %s",
 					bayes, thresh, sHypo);
-		glass3::util::Logger::log(sLog);
 
 		// this hypo can be canceled
 		return (true);
@@ -1483,13 +1679,10 @@ bool CHypo::cancelCheck() {
 	if ((m_dDepth > CGlass::getEventFragmentDepthThreshold())
 			&& (m_dGap > CGlass::getEventFragmentAzimuthThreshold())) {
 		// failure
-		snprintf(
-				sLog,
-				sizeof(sLog),
+		GLASS3_LOG_DEBUG_FORMAT(
 				"CHypo::cancel: Event Fragment check (%.1f>%.1f, %.1f>%.1f) Hypo: %s",
 				getDepth(), CGlass::getEventFragmentDepthThreshold(), getGap(),
 				CGlass::getEventFragmentAzimuthThreshold(), sHypo);
-		glass3::util::Logger::log(sLog);
 
 		// this hypo can be canceled
 		return (true);
@@ -1508,8 +1701,16 @@ void CHypo::clear() {
 	setDepth(0.0);
 	setTOrigin(0.0);
 	// note that we intentionally do not clear tSort...
-	m_sID = "";
+	m_ID = glass3::util::InternedID();
 	m_iNucleationDataThreshold = 0;
+
+	// restart the locator's random sequence
+	int seed = CGlass::getLocatorRandomSeed();
+	if (seed >= 0) {
+		m_RandomGenerator.seed(static_cast<uint64_t>(seed));
+	} else {
+		m_RandomGenerator.seed(glass3::util::RandomEngine::randomSeed());
+	}
 	m_dNucleationStackThreshold = 0.0;
 	m_dBayesValue = 0.0;
 	m_dInitialBayesValue = 0.0;
@@ -1533,12 +1734,29 @@ void CHypo::clear() {
 	m_pNucleationTravelTime2.reset();
 
 	m_bCorrelationAdded = false;
+	m_LocatorCache.bValid = false;
+	m_LocatorCache.iNumPicks = 0;
 
 	clearPickReferences();
 	clearCorrelationReferences();
 
 	m_iTotalProcessCount = 0;
 	m_iReportCount = 0;
+
+	// forget the last messages
+	m_pLastHypoMessage.reset();
+	m_HypoMessageState.bValid = false;
+	m_HypoMessageState.vPickData.clear();
+	m_HypoMessageState.vPickVersions.clear();
+	m_HypoMessageState.vCorrelationData.clear();
+	m_HypoMessageState.vCorrelationVersions.clear();
+	m_EventMessageState.bValid = false;
+	m_EventMessageState.vPickData.clear();
+	m_EventMessageState.vPickVersions.clear();
+	m_EventMessageState.vCorrelationData.clear();
+	m_EventMessageState.vCorrelationVersions.clear();
+	m_mPickMessageData.clear();
+	m_mCorrelationMessageData.clear();
 }
 
 // ---------------------------------------------------clearCorrelationReferences
@@ -1555,11 +1773,13 @@ void CHypo::clearCorrelationReferences() {
 		// remove the hypo from the corr
 		// note only removes hypo if corr
 		// is linked
-		corr->removeHypoReference(m_sID);
+		corr->removeHypoReference(getID());
 	}
 
 	// remove all correlation links to this hypo
 	m_vCorrelationData.clear();
+	m_CorrelationDataSet.clear();
+	m_iDataVersion++;
 }
 
 // ---------------------------------------------------------clearPickReferences
@@ -1576,11 +1796,13 @@ void CHypo::clearPickReferences() {
 		// remove the hypo from the pick
 		// note only removes hypo if pick
 		// is linked
-		pck->removeHypoReference(m_sID);
+		pck->removeHypoReference(getID());
 	}
 
 	// remove all pick links to this hypo
 	m_vPickData.clear();
+	m_PickDataSet.clear();
+	m_iDataVersion++;
 }
 
 // ---------------------------------------------------------generateEventMessage
@@ -1593,13 +1815,20 @@ std::shared_ptr<json::Object> CHypo::generateEventMessage() {
 	}
 
 	m_bEventGenerated = true;
-	m_iReportCount++;
+
+	// only count a new version if the hypo has changed since the last event
+	// message, so an unchanged hypo isn't requested and published again
+	if (isMessageStateCurrent(m_EventMessageState) == false) {
+		m_iReportCount++;
+		recordMessageState(&m_EventMessageState);
+	}
+
 	std::shared_ptr<json::Object> event = std::make_shared < json::Object
 			> (json::Object());
 
 	// fill in Event command from current hypocenter
 	(*event)["Cmd"] = "Event";
-	(*event)["Pid"] = m_sID;
+	(*event)["Pid"] = getID();
 	(*event)["CreateTime"] = glass3::util::Date::encodeISO8601Time(m_tCreate);
 	(*event)["ReportTime"] = glass3::util::Date::encodeISO8601Time(
 			glass3::util::Date::now());
@@ -1615,8 +1844,7 @@ std::shared_ptr<json::Object> CHypo::generateEventMessage() {
 			+ static_cast<int>(m_vCorrelationData.size());
 
 	// log it
-	glass3::util::Logger::log(
-			"debug",
+	GLASS3_LOG_DEBUG(
 			"CHypo::event: Created event message:" + json::Serialize(*event));
 
 	return (event);
@@ -1627,7 +1855,7 @@ std::shared_ptr<json::Object> CHypo::generateExpireMessage() {
 	std::shared_ptr<json::Object> expire = std::make_shared < json::Object
 			> (json::Object());
 	(*expire)["Cmd"] = "Expire";
-	(*expire)["Pid"] = m_sID;
+	(*expire)["Pid"] = getID();
 
 	// add a copy of the expiring hypo to the message
 	// if we CAN report
@@ -1637,8 +1865,7 @@ std::shared_ptr<json::Object> CHypo::generateExpireMessage() {
 	}
 
 	// log it
-	glass3::util::Logger::log(
-			"debug",
+	GLASS3_LOG_DEBUG(
 			"CHypo::event: Created expire message:" + json::Serialize(*expire));
 
 	return (expire);
@@ -1653,42 +1880,167 @@ double CHypo::calculateGap(double lat, double lon, double z) {
 	glass3::util::Geo geo;
 	geo.setGeographic(lat, lon, glass3::util::Geo::k_EarthRadiusKm - z);
 
-	// create and populate vectors containing the
-	// pick distances and azimuths
-	std::vector<double> azm;
+	// gather the pick data, unless a locate call already has
+	bool gathered = false;
+	if (m_LocatorCache.bValid == false) {
+		gatherLocatorCache();
+		gathered = true;
+	}
 
-	for (auto pick : m_vPickData) {
-		// get the site
-		std::shared_ptr<CSite> site = pick->getSite();
+	double gap = calculateCachedGap(&m_LocatorCache, geo);
 
-		// compute the azimuth
-		double azimuth = geo.azimuth(&site->getGeo())
-				/ glass3::util::GlassMath::k_DegreesToRadians;
+	if (gathered == true) {
+		m_LocatorCache.bValid = false;
+	}
 
-		// add to azimuth vector
-		azm.push_back(azimuth);
+	return (gap);
+}
+
+// ---------------------------------------------------------gatherLocatorCache
+void CHypo::gatherLocatorCache() {
+	// lock mutex for this scope
+	std::lock_guard < std::recursive_mutex > guard(m_HypoMutex);
+
+	int npick = m_vPickData.size();
+	m_LocatorCache.iNumPicks = npick;
+
+	// the travel times and tapers the stack is calculated with
+	m_LocatorCache.pNucleationTravelTime1 = m_pNucleationTravelTime1;
+	m_LocatorCache.pNucleationTravelTime2 = m_pNucleationTravelTime2;
+	m_LocatorCache.pTravelTimeTables = m_pTravelTimeTables;
+	m_LocatorCache.taperGap = m_taperGap;
+	m_LocatorCache.taperDepth = m_taperDepth;
+
+	// the nucleation phase candidates are the same for every pick
+	m_LocatorCache.iNucleationPhaseID1 = traveltime::CTravelTime::k_iPhaseIDInvalid;
+	if (m_pNucleationTravelTime1) {
+		m_LocatorCache.iNucleationPhaseID1 = m_pNucleationTravelTime1
+				->m_iPhaseID;
 	}
+	m_LocatorCache.iNucleationPhaseID2 = traveltime::CTravelTime::k_iPhaseIDInvalid;
+	if (m_pNucleationTravelTime2) {
+		m_LocatorCache.iNucleationPhaseID2 = m_pNucleationTravelTime2
+				->m_iPhaseID;
+	}
+
+	// resize keeps the capacity from previous calls, so a locate on a hypo
+	// that has not grown does not allocate
+	m_LocatorCache.vdSiteUnitVectorX.resize(npick);
+	m_LocatorCache.vdSiteUnitVectorY.resize(npick);
+	m_LocatorCache.vdSiteUnitVectorZ.resize(npick);
+	m_LocatorCache.vdPickTimes.resize(npick);
+	m_LocatorCache.vdDeltas.resize(npick);
+	m_LocatorCache.vdTravelTimes1.resize(npick);
+	m_LocatorCache.vdTravelTimes2.resize(npick);
 
-	int nazm = azm.size();
+	// one more gap bin than picks
+	m_LocatorCache.vdAzimuths.resize(npick);
+	m_LocatorCache.vdGapBinMinimums.resize(npick + 1);
+	m_LocatorCache.vdGapBinMaximums.resize(npick + 1);
 
+	for (int ipick = 0; ipick < npick; ipick++) {
+		const std::shared_ptr<CPick> &pick = m_vPickData[ipick];
+		const glass3::util::Geo &siteGeo = pick->getSite()->getGeo();
+
+		m_LocatorCache.vdSiteUnitVectorX[ipick] = siteGeo.m_dUnitVectorX;
+		m_LocatorCache.vdSiteUnitVectorY[ipick] = siteGeo.m_dUnitVectorY;
+		m_LocatorCache.vdSiteUnitVectorZ[ipick] = siteGeo.m_dUnitVectorZ;
+		m_LocatorCache.vdPickTimes[ipick] = pick->getTPick();
+	}
+
+	m_LocatorCache.bValid = true;
+}
+
+// ---------------------------------------------------------calculateCachedGap
+double CHypo::calculateCachedGap(HypoLocatorCache *cache,
+									const glass3::util::Geo &geo) {
+	int nazm = cache->iNumPicks;
 	if (nazm <= 1) {
 		return 360.;
 	}
 
-	// sort the azimuths
-	sort(azm.begin(), azm.end());
+	// the quake radial normal, north, and east vectors are the same for every
+	// pick, so compute them once rather than in glass3::util::Geo::azimuth()
+	double sinLat = sin(
+			glass3::util::GlassMath::k_DegreesToRadians
+					* geo.m_dGeocentricLatitude);
+	double cosLat = cos(
+			glass3::util::GlassMath::k_DegreesToRadians
+					* geo.m_dGeocentricLatitude);
+	double sinLon = sin(
+			glass3::util::GlassMath::k_DegreesToRadians
+					* geo.m_dGeocentricLongitude);
+	double cosLon = cos(
+			glass3::util::GlassMath::k_DegreesToRadians
+					* geo.m_dGeocentricLongitude);
+	double qx = cosLat * cosLon;
+	double qy = cosLat * sinLon;
+	double qz = sinLat;
+	double nx = -sinLat * cosLon;
+	double ny = -sinLat * sinLon;
+	double nz = cosLat;
+	double ex = -sinLon;
+	double ey = cosLon;
+
+	double *azm = cache->vdAzimuths.data();
+	for (int i = 0; i < nazm; i++) {
+		double sx = cache->vdSiteUnitVectorX[i];
+		double sy = cache->vdSiteUnitVectorY[i];
+		double sz = cache->vdSiteUnitVectorZ[i];
+
+		// normal to great circle
+		double qsx = qy * sz - sy * qz;
+		double qsy = qz * sx - sz * qx;
+		double qsz = qx * sy - sx * qy;
+
+		// vector along great circle, the length does not change the azimuth
+		double ax = qsy * qz - qy * qsz;
+		double ay = qsz * qx - qz * qsx;
+		double az = qsx * qy - qx * qsy;
+
+		double azimuth = atan2(ax * ex + ay * ey, ax * nx + ay * ny + az * nz);
+		if (azimuth < 0.0) {
+			azimuth += glass3::util::GlassMath::k_TwoPi;
+		}
+		azm[i] = azimuth / glass3::util::GlassMath::k_DegreesToRadians;
+	}
 
-	// add the first (smallest) azimuth to the end by adding 360
-	azm.push_back(azm.front() + 360.0);
+	// bucket the azimuths, keeping the lowest and highest in each bin
+	int nbin = nazm + 1;
+	double binWidth = 360.0 / nbin;
+	double *binMin = cache->vdGapBinMinimums.data();
+	double *binMax = cache->vdGapBinMaximums.data();
+	for (int i = 0; i < nbin; i++) {
+		binMin[i] = std::numeric_limits<double>::max();
+		binMax[i] = -std::numeric_limits<double>::max();
+	}
+	for (int i = 0; i < nazm; i++) {
+		int bin = std::min(static_cast<int>(azm[i] / binWidth), nbin - 1);
+		binMin[bin] = std::min(binMin[bin], azm[i]);
+		binMax[bin] = std::max(binMax[bin], azm[i]);
+	}
 
-	// compute gap
+	// compute gap between consecutive occupied bins, the gaps within a bin
+	// are narrower than the empty bin
 	double tempGap = 0.0;
+	double firstAzimuth = -1.0;
+	double previousAzimuth = -1.0;
+	for (int i = 0; i < nbin; i++) {
+		if (binMin[i] > binMax[i]) {
+			continue;
+		}
 
-	for (int i = 0; i < nazm; i++) {
-		double gap = azm[i + 1] - azm[i];
-		if (gap > tempGap) {
-			tempGap = gap;
+		if (previousAzimuth < 0.0) {
+			firstAzimuth = binMin[i];
+		} else if (binMin[i] - previousAzimuth > tempGap) {
+			tempGap = binMin[i] - previousAzimuth;
 		}
+		previousAzimuth = binMax[i];
+	}
+
+	// the gap wrapping around north
+	if (firstAzimuth + 360.0 - previousAzimuth > tempGap) {
+		tempGap = firstAzimuth + 360.0 - previousAzimuth;
 	}
 
 	return tempGap;
@@ -1707,24 +2059,14 @@ double CHypo::getTravelTimeForPhase(std::shared_ptr<CPick> pick,
 	// lock mutex for this scope
 	std::lock_guard <std::recursive_mutex> guard(m_HypoMutex);
 
-	// setup traveltime interface for this hypo
-	m_pTravelTimeTables->setTTOrigin(m_dLatitude, m_dLongitude, m_dDepth);
-
-	// set up a geographic object for this hypo
-	glass3::util::Geo hypoGeo;
-	hypoGeo.setGeographic(m_dLatitude, m_dLongitude,
-							glass3::util::Geo::k_EarthRadiusKm - m_dDepth);
-
-	// get site
-	std::shared_ptr<CSite> site = pick->getSite();
-
 	// compute site distance in degrees
 	double siteDistance = calculateDistanceToPick(pick);
 
 	// get the traveltime for this phase depth and distance
-	double tCal = m_pTravelTimeTables->Td(siteDistance, phaseName, m_dDepth);
+	traveltime::TTTResultStruct result = m_pTravelTimeTables->getTravelTime(
+			siteDistance, m_dDepth, phaseName);
 
-	return (tCal);
+	return (result.dTravelTime);
 }
 
 // ---------------------------------------------calculateDistanceToPick
@@ -1754,6 +2096,9 @@ double CHypo::calculateDistanceToPick(std::shared_ptr<CPick> pick) {
 // --------------------------------------------------------calculateResidual
 double CHypo::calculateResidual(std::shared_ptr<CPick> pick,
 		bool * useForLocations, std::string * phaseName, bool p_only) {
+	// phase ids are process-wide, so only look up the ones we use once
+	static const int pPhaseID = traveltime::CTravelTime::getPhaseID("P");
+
 	if (pick == NULL) {
 		return(std::numeric_limits<double>::quiet_NaN());
 	}
@@ -1761,8 +2106,8 @@ double CHypo::calculateResidual(std::shared_ptr<CPick> pick,
 	// lock mutex for this scope
 	std::lock_guard < std::recursive_mutex > guard(m_HypoMutex);
 
-	// setup traveltime interface for this hypo
-	m_pTravelTimeTables->setTTOrigin(m_dLatitude, m_dLongitude, m_dDepth);
+	// setup traveltime origin for this hypo
+	glass3::util::Geo hypoGeo = getGeo();
 
 	// get site
 	std::shared_ptr<CSite> site = pick->getSite();
@@ -1771,7 +2116,9 @@ double CHypo::calculateResidual(std::shared_ptr<CPick> pick,
 	double tObs = pick->getTPick() - m_tOrigin;
 
 	// init expected travel time
-	double tCal = traveltime::CTravelTime::k_dTravelTimeInvalid;
+	traveltime::TTTResultStruct result;
+	result.dTravelTime = traveltime::CTravelTime::k_dTravelTimeInvalid;
+	result.bUseForLocations = false;
 
 	std::string phase = "??";
 
@@ -1788,18 +2135,21 @@ double CHypo::calculateResidual(std::shared_ptr<CPick> pick,
 			// valid phase classification,
 			// compute expected travel time based on the pick site location and
 			// the classified pick phase
-			tCal = m_pTravelTimeTables->T(&site->getGeo(),
-											pick->getClassifiedPhase());
+			result = m_pTravelTimeTables->getTravelTime(
+					hypoGeo, site->getGeo(), pick->getClassifiedPhase());
 			phase = pick->getClassifiedPhase();
 		} else {
 			// no valid phase classification,
 			// compute expected travel time based on the pick site location and
 			// the observed travel time
 			if (p_only == false) {
-				tCal = m_pTravelTimeTables->T(&site->getGeo(), tObs);
-				phase = m_pTravelTimeTables->m_sPhase;
+				result = m_pTravelTimeTables->getBestTravelTime(
+						hypoGeo, site->getGeo(), tObs);
+				phase = m_pTravelTimeTables->getPhaseName(result.iPhaseID);
 			} else {
-				tCal = m_pTravelTimeTables->T(&site->getGeo(), "P");
+				result = m_pTravelTimeTables->getTravelTime(hypoGeo,
+															site->getGeo(),
+															pPhaseID);
 				phase = "P";
 			}
 		}
@@ -1808,14 +2158,19 @@ double CHypo::calculateResidual(std::shared_ptr<CPick> pick,
 		// compute expected travel time based on the pick site location and
 		// the observed travel time
 		if (p_only == false) {
-			tCal = m_pTravelTimeTables->T(&site->getGeo(), tObs);
-			phase = m_pTravelTimeTables->m_sPhase;
+			result = m_pTravelTimeTables->getBestTravelTime(hypoGeo,
+															site->getGeo(),
+															tObs);
+			phase = m_pTravelTimeTables->getPhaseName(result.iPhaseID);
 		} else {
-			tCal = m_pTravelTimeTables->T(&site->getGeo(), "P");
+			result = m_pTravelTimeTables->getTravelTime(hypoGeo, site->getGeo(),
+														pPhaseID);
 			phase = "P";
 		}
 	}
 
+	double tCal = result.dTravelTime;
+
 	// Check if pick has an invalid travel time,
 	if (tCal <= traveltime::CTravelTime::k_dTravelTimeInvalid) {
 		// it does, don't associated
@@ -1827,7 +2182,7 @@ double CHypo::calculateResidual(std::shared_ptr<CPick> pick,
 
 	// get the use flag if the location is valid
 	if (useForLocations != NULL) {
-		*useForLocations = m_pTravelTimeTables->m_bUseForLocations;
+		*useForLocations = result.bUseForLocations;
 	}
 
 	if (phaseName != NULL) {
@@ -1883,7 +2238,7 @@ double CHypo::calculateCurrentBayes() {
 double CHypo::calculateBayes(double xlat, double xlon, double xZ, double oT,
 								bool nucleate) {
 	// check to see if this is a valid hypo, a hypo must always have an id
-	if (m_sID == "") {
+	if (m_ID.getHandle() == glass3::util::InternedID::k_iEmptyHandle) {
 		return (0);
 	}
 
@@ -1891,20 +2246,39 @@ double CHypo::calculateBayes(double xlat, double xlon, double xZ, double oT,
 	std::lock_guard < std::recursive_mutex > guard(m_HypoMutex);
 
 	if ((!m_pNucleationTravelTime1) && (!m_pNucleationTravelTime2)) {
-		glass3::util::Logger::log(
-				"error", "CHypo::calculateBayes: NULL pTrv1 and pTrv2.");
+		GLASS3_LOG_ERROR("CHypo::calculateBayes: NULL pTrv1 and pTrv2.");
 		return (0);
 	}
 
 	if (!m_pTravelTimeTables) {
-		glass3::util::Logger::log("error", "CHypo::calculateBayes: NULL pTTT.");
+		GLASS3_LOG_ERROR("CHypo::calculateBayes: NULL pTTT.");
 		return (0);
 	}
 
+	// gather the pick data, unless a locate call already has
+	bool gathered = false;
+	if (m_LocatorCache.bValid == false) {
+		gatherLocatorCache();
+		gathered = true;
+	}
+
+	double value = calculateCachedBayes(&m_LocatorCache, xlat, xlon, xZ, oT,
+										nucleate);
+
+	if (gathered == true) {
+		m_LocatorCache.bValid = false;
+	}
+
+	return value;
+}
+
+// ---------------------------------------------------------calculateCachedBayes
+double CHypo::calculateCachedBayes(HypoLocatorCache *cache, double xlat,
+									double xlon, double xZ, double oT,
+									bool nucleate) {
 	glass3::util::Geo geo;
 	double value = 0.;
 	double tcal;
-	char sLog[glass3::util::Logger::k_nMaxLogEntrySize];
 
 	// define a taper for sigma, makes close in readings have higher weight
 	// ranges from 0.75-3.0 from 0-2 degrees, than 3.0 after that (see loop)
@@ -1914,46 +2288,59 @@ double CHypo::calculateBayes(double xlat, double xlon, double xZ, double oT,
 	// geo is used for calculating distances to stations for determining sigma
 	geo.setGeographic(xlat, xlon, glass3::util::Geo::k_EarthRadiusKm - xZ);
 
-	// This sets the travel-time look up location
-	if (m_pNucleationTravelTime1) {
-		m_pNucleationTravelTime1->setTTOrigin(geo);
-	}
-	if (m_pNucleationTravelTime2) {
-		m_pNucleationTravelTime2->setTTOrigin(geo);
-	}
-
-	m_pTravelTimeTables->setTTOrigin(geo);
+	// the source depth used for the travel times
+	double depth = glass3::util::Geo::k_EarthRadiusKm - geo.m_dGeocentricRadius;
 
 	// The number of picks associated with the hypocenter
-	int npick = m_vPickData.size();
+	int npick = cache->iNumPicks;
+
+	// compute the distances and nucleation travel times for all picks as a
+	// batch
+	const double *deltas = cache->vdDeltas.data();
+	traveltime::CTravelTime::getDeltas(geo, npick,
+										cache->vdSiteUnitVectorX.data(),
+										cache->vdSiteUnitVectorY.data(),
+										cache->vdSiteUnitVectorZ.data(),
+										cache->vdDeltas.data());
+
+	const double *travelTimes1 = cache->vdTravelTimes1.data();
+	const double *travelTimes2 = cache->vdTravelTimes2.data();
+	if (nucleate == true) {
+		if (cache->pNucleationTravelTime1) {
+			cache->pNucleationTravelTime1->getTravelTimes(
+					npick, deltas, depth, cache->vdTravelTimes1.data());
+		}
+		if (cache->pNucleationTravelTime2) {
+			cache->pNucleationTravelTime2->getTravelTimes(
+					npick, deltas, depth, cache->vdTravelTimes2.data());
+		}
+	}
 
 	// Loop through each pick and find the residual, calculate
 	// the significance, and add to the stacks.
 	// Currently only P, S, and nucleation phases added to stack.
 	for (int ipick = 0; ipick < npick; ipick++) {
-		auto pick = m_vPickData[ipick];
 		double resi = std::numeric_limits<double>::quiet_NaN();
 
 		// calculate residual
-		double tobs = pick->getTPick() - oT;
-		std::shared_ptr<CSite> site = pick->getSite();
-		glass3::util::Geo siteGeo = site->getGeo();
+		double tobs = cache->vdPickTimes[ipick] - oT;
 
 		// only use nucleation phases if on nucleation branch
 		if (nucleate == true) {
-			if ((m_pNucleationTravelTime1) && (m_pNucleationTravelTime2)) {
+			if ((cache->pNucleationTravelTime1)
+					&& (cache->pNucleationTravelTime2)) {
 				// we have both nucleation phases
 				// first nucleation phase
 				// calculate the residual using the phase name
-				double tcal1 = m_pNucleationTravelTime1->T(&siteGeo);
+				double tcal1 = travelTimes1[ipick];
 				double resi1 = calculateWeightedResidual(
-						m_pNucleationTravelTime1->m_sPhase, tobs, tcal1);
+						cache->iNucleationPhaseID1, tobs, tcal1);
 
 				// second nucleation phase
 				// calculate the residual using the phase name
-				double tcal2 = m_pNucleationTravelTime2->T(&siteGeo);
+				double tcal2 = travelTimes2[ipick];
 				double resi2 = calculateWeightedResidual(
-						m_pNucleationTravelTime2->m_sPhase, tobs, tcal2);
+						cache->iNucleationPhaseID2, tobs, tcal2);
 
 				// use the smallest residual
 				if (abs(resi1) < abs(resi2)) {
@@ -1963,54 +2350,55 @@ double CHypo::calculateBayes(double xlat, double xlon, double xZ, double oT,
 					tcal = tcal2;
 					resi = resi2;
 				}
-			} else if ((m_pNucleationTravelTime1)
-					&& (!m_pNucleationTravelTime2)) {
+			} else if ((cache->pNucleationTravelTime1)
+					&& (!cache->pNucleationTravelTime2)) {
 				// we have just the first nucleation phase
-				tcal = m_pNucleationTravelTime1->T(&siteGeo);
+				tcal = travelTimes1[ipick];
 				resi = calculateWeightedResidual(
-						m_pNucleationTravelTime1->m_sPhase, tobs, tcal);
-			} else if ((!m_pNucleationTravelTime1)
-					&& (m_pNucleationTravelTime2)) {
+						cache->iNucleationPhaseID1, tobs, tcal);
+			} else if ((!cache->pNucleationTravelTime1)
+					&& (cache->pNucleationTravelTime2)) {
 				// we have just the second nucleation phase
-				tcal = m_pNucleationTravelTime2->T(&siteGeo);
+				tcal = travelTimes2[ipick];
 				resi = calculateWeightedResidual(
-						m_pNucleationTravelTime2->m_sPhase, tobs, tcal);
+						cache->iNucleationPhaseID2, tobs, tcal);
 			}
 		} else {
 			// use all available association phases
 			// take whichever phase has the smallest residual
-			tcal = m_pTravelTimeTables->T(&siteGeo, tobs);
+			traveltime::TTTResultStruct result =
+					cache->pTravelTimeTables->getBestTravelTime(deltas[ipick],
+																depth, tobs);
+			tcal = result.dTravelTime;
 
 			// check if we're allowed to use this phase in locations
-			if (m_pTravelTimeTables->m_bUseForLocations == false) {
+			if (result.bUseForLocations == false) {
 				// if not, skip it
 				continue;
 			}
 
-			// calculate the residual using the phase name
-			resi = calculateWeightedResidual(m_pTravelTimeTables->m_sPhase,
-												tobs, tcal);
+			// calculate the residual using the phase id
+			resi = calculateWeightedResidual(result.iPhaseID, tobs, tcal);
 		}
 
 		// make sure residual is valid
 		if (resi == std::numeric_limits<double>::quiet_NaN()) {
-			glass3::util::Logger::log("warning",
-										"CHypo::getBayes: invalid residual.");
+			GLASS3_LOG_WARNING("CHypo::getBayes: invalid residual.");
 			continue;
 		}
 
-		// calculate distance to station to get sigma
-		double delta = glass3::util::GlassMath::k_RadiansToDegrees
-				* geo.delta(&site->getGeo());
+		// use distance to station to get sigma
+		double delta = deltas[ipick];
 		double sigma = (tap.calculateValue(delta) * 2.25) + 0.75;
 
 		// calculate and add to the stack
 		value += glass3::util::GlassMath::sig(resi, sigma);
 	}
 
-	return value
-			* m_taperGap.calculateValue(calculateGap(xlat, xlon, xZ))
-			* ((m_taperDepth.calculateValue(xZ)*.75)+.25);
+	value *= cache->taperGap.calculateValue(calculateCachedGap(cache, geo))
+			* ((cache->taperDepth.calculateValue(xZ)*.75)+.25);
+
+	return value;
 }
 
 // --------------------------------------------------------getInitialBayesValue
@@ -2092,14 +2480,40 @@ double CHypo::getMinDistance() const {
 	return (m_dMinDistance);
 }
 
-// -----------------------------------------------------------getProcessingMutex
-std::mutex & CHypo::getProcessingMutex() {
-	return (m_ProcessingMutex);
+// ---------------------------------------------------------claimForProcessing
+bool CHypo::claimForProcessing() {
+	bool claimed = false;
+	return (m_bProcessingClaimed.compare_exchange_strong(claimed, true));
+}
+
+// ---------------------------------------------------------deferProcessing
+bool CHypo::deferProcessing() {
+	m_bProcessingDeferred = true;
+
+	// the owner may have released the claim before it saw the request, in
+	// which case nobody will requeue the hypo, so try claiming it again
+	if (claimForProcessing() == true) {
+		m_bProcessingDeferred = false;
+		return (true);
+	}
+
+	return (false);
+}
+
+// -----------------------------------------------------releaseProcessingClaim
+bool CHypo::releaseProcessingClaim() {
+	m_bProcessingClaimed = false;
+	return (m_bProcessingDeferred.exchange(false));
 }
 
 // ------------------------------------------------------------getID
 const std::string& CHypo::getID() const {
-	return (m_sID);
+	return (m_ID.getString());
+}
+
+// ---------------------------------------------------------getIDHandle
+unsigned int CHypo::getIDHandle() const {
+	return (m_ID.getHandle());
 }
 
 // ---------------------------------------------------------getTotalProcessCount
@@ -2176,9 +2590,12 @@ const std::string& CHypo::getWebName() const {
 // ---------------------------------------------------calculateAbsResidualSum
 double CHypo::calculateAbsResidualSum(double xlat, double xlon, double xZ,
 										double oT, bool nucleate) {
+	// phase ids are process-wide, so only look up the ones we use once
+	static const int pPhaseID = traveltime::CTravelTime::getPhaseID("P");
+	static const int sPhaseID = traveltime::CTravelTime::getPhaseID("S");
+
 	if (m_pTravelTimeTables == NULL) {
-		glass3::util::Logger::log("error",
-									"CHypo::getSumAbsResidual: NULL pTTT.");
+		GLASS3_LOG_ERROR("CHypo::getSumAbsResidual: NULL pTTT.");
 		return (0);
 	}
 
@@ -2187,46 +2604,66 @@ double CHypo::calculateAbsResidualSum(double xlat, double xlon, double xZ,
 
 	double sigma;
 	double value = 0.;
-	char sLog[glass3::util::Logger::k_nMaxLogEntrySize];
 
 	// This sets the travel-time look up location
-	if (m_pNucleationTravelTime1 != NULL) {
-		m_pNucleationTravelTime1->setTTOrigin(xlat, xlat, xZ);
-	}
-	if (m_pNucleationTravelTime2 != NULL) {
-		m_pNucleationTravelTime2->setTTOrigin(xlat, xlat, xZ);
-	}
+	glass3::util::Geo geo;
+	geo.setGeographic(xlat, xlon, glass3::util::Geo::k_EarthRadiusKm - xZ);
 
-	m_pTravelTimeTables->setTTOrigin(xlat, xlon, xZ);
+	// the source depth used for the travel times
+	double depth = glass3::util::Geo::k_EarthRadiusKm - geo.m_dGeocentricRadius;
+
+	// gather the pick data, unless a locate call already has
+	bool gathered = false;
+	if (m_LocatorCache.bValid == false) {
+		gatherLocatorCache();
+		gathered = true;
+	}
 
 	// The number of picks associated with the hypocenter
-	int npick = m_vPickData.size();
+	int npick = m_LocatorCache.iNumPicks;
+
+	// compute the distances and nucleation travel times for all picks as a
+	// batch
+	const double *deltas = m_LocatorCache.vdDeltas.data();
+	traveltime::CTravelTime::getDeltas(geo, npick,
+										m_LocatorCache.vdSiteUnitVectorX.data(),
+										m_LocatorCache.vdSiteUnitVectorY.data(),
+										m_LocatorCache.vdSiteUnitVectorZ.data(),
+										m_LocatorCache.vdDeltas.data());
+
+	const double *travelTimes = NULL;
+	if ((nucleate == true) && (m_pNucleationTravelTime2 == NULL)) {
+		m_pNucleationTravelTime1->getTravelTimes(
+				npick, deltas, depth, m_LocatorCache.vdTravelTimes1.data());
+		travelTimes = m_LocatorCache.vdTravelTimes1.data();
+	} else if ((nucleate == true) && (m_pNucleationTravelTime1 == NULL)) {
+		m_pNucleationTravelTime2->getTravelTimes(
+				npick, deltas, depth, m_LocatorCache.vdTravelTimes2.data());
+		travelTimes = m_LocatorCache.vdTravelTimes2.data();
+	}
 
 	// Loop through each pick and find the residual, calculate
 	// the resiudal, and sum.
 	// Currently only P, S, and nucleation phases added to stack.
 	// If residual is greater than 10, make it 10.
 	for (int ipick = 0; ipick < npick; ipick++) {
-		auto pick = m_vPickData[ipick];
 		double resi = 99999999;
 
 		// calculate residual
-		double tobs = pick->getTPick() - oT;
+		double tobs = m_LocatorCache.vdPickTimes[ipick] - oT;
 		double tcal;
-		std::shared_ptr<CSite> site = pick->getSite();
 
 		// only use nucleation phase if on nucleation branch
-		if ((nucleate == true) && (m_pNucleationTravelTime2 == NULL)) {
-			tcal = m_pNucleationTravelTime1->T(&site->getGeo());
-			resi = tobs - tcal;
-		} else if ((nucleate == true) && (m_pNucleationTravelTime1 == NULL)) {
-			tcal = m_pNucleationTravelTime2->T(&site->getGeo());
+		if (travelTimes != NULL) {
+			tcal = travelTimes[ipick];
 			resi = tobs - tcal;
 		} else {
 			// take whichever has the smallest residual, P or S
-			tcal = m_pTravelTimeTables->T(&site->getGeo(), tobs);
-			if (m_pTravelTimeTables->m_sPhase == "P"
-					|| m_pTravelTimeTables->m_sPhase == "S") {
+			traveltime::TTTResultStruct result =
+					m_pTravelTimeTables->getBestTravelTime(deltas[ipick], depth,
+															tobs);
+			tcal = result.dTravelTime;
+			if ((result.iPhaseID == pPhaseID) || (result.iPhaseID == sPhaseID)) {
 				resi = tobs - tcal;
 			}
 		}
@@ -2236,6 +2673,11 @@ double CHypo::calculateAbsResidualSum(double xlat, double xlon, double xZ,
 		}
 		value += resi;
 	}
+
+	if (gathered == true) {
+		m_LocatorCache.bValid = false;
+	}
+
 	return value;
 }
 
@@ -2250,15 +2692,19 @@ int64_t CHypo::getTSort() const {
 }
 
 // ----------------------------------------------------calculateWeightedResidual
-double CHypo::calculateWeightedResidual(std::string sPhase, double tObs,
+double CHypo::calculateWeightedResidual(int phaseID, double tObs,
 										double tCal) {
+	// phase ids are process-wide, so only look up the ones we weight once
+	static const int pPhaseID = traveltime::CTravelTime::getPhaseID("P");
+	static const int sPhaseID = traveltime::CTravelTime::getPhaseID("S");
+
 	if (tCal < 0) {
 		return (std::numeric_limits<double>::quiet_NaN());
 	}
 
-	if (sPhase == "P") {
+	if (phaseID == pPhaseID) {
 		return (tObs - tCal);
-	} else if (sPhase == "S") {
+	} else if (phaseID == sPhaseID) {
 		// Effectively halving the weight of S
 		// this value was selected by testing specific
 		// events with issues
@@ -2282,7 +2728,7 @@ double CHypo::getDepth() const {
 // ---------------------------------------------------graphicsOutput
 void CHypo::graphicsOutput() {
 	if (m_pTravelTimeTables == NULL) {
-		glass3::util::Logger::log("error", "CHypo::graphicsOutput: NULL pTTT.");
+		GLASS3_LOG_ERROR("CHypo::graphicsOutput: NULL pTTT.");
 		return;
 	}
 	// lock mutex for this scope
@@ -2290,7 +2736,7 @@ void CHypo::graphicsOutput() {
 
 	// create and open file
 	std::ofstream outfile;
-	std::string filename = CGlass::getGraphicsOutFolder() + m_sID + ".txt";
+	std::string filename = CGlass::getGraphicsOutFolder() + getID() + ".txt";
 	outfile.open(filename, std::ios::out);
 
 	// header
@@ -2323,7 +2769,8 @@ void CHypo::graphicsOutput() {
 							/ glass3::util::Geo::k_DegreesToKm;
 
 			// set up traveltimes
-			m_pTravelTimeTables->setTTOrigin(xlat, xlon, m_dDepth);
+			geo.setGeographic(xlat, xlon,
+								glass3::util::Geo::k_EarthRadiusKm - m_dDepth);
 			stack = 0;
 
 			// for each pick
@@ -2331,7 +2778,8 @@ void CHypo::graphicsOutput() {
 				auto pick = m_vPickData[ipick];
 				double tobs = pick->getTPick() - m_tOrigin;
 				std::shared_ptr<CSite> site = pick->getSite();
-				tcal = m_pTravelTimeTables->T(&site->getGeo(), tobs);
+				tcal = m_pTravelTimeTables->getBestTravelTime(
+						geo, site->getGeo(), tobs).dTravelTime;
 				delta = glass3::util::GlassMath::k_RadiansToDegrees
 						* geo.delta(&site->getGeo());
 
@@ -2362,61 +2810,44 @@ void CHypo::graphicsOutput() {
 bool CHypo::hasCorrelationReference(std::shared_ptr<CCorrelation> corr) {
 	// null check
 	if (corr == NULL) {
-		glass3::util::Logger::log("warning",
-									"CHypo::hasCorrelation: NULL correlation.");
+		GLASS3_LOG_WARNING("CHypo::hasCorrelation: NULL correlation.");
 		return (false);
 	}
 
 	// lock mutex for this scope
 	std::lock_guard < std::recursive_mutex > guard(m_HypoMutex);
 
-	// for each corr in the vector
-	for (const auto &q : m_vCorrelationData) {
-		// is this corr a match?
-		if (q->getID() == corr->getID()) {
-			return (true);
-		}
-	}
-
-	return (false);
+	// is this corr a match?
+	return (m_CorrelationDataSet.count(corr.get()) > 0);
 }
 
 // ---------------------------------------------------------hasPickReference
 bool CHypo::hasPickReference(std::shared_ptr<CPick> pck) {
 	// null check
 	if (pck == NULL) {
-		glass3::util::Logger::log("warning", "CHypo::hasPick: NULL pck.");
+		GLASS3_LOG_WARNING("CHypo::hasPick: NULL pck.");
 		return (false);
 	}
 
 	// lock mutex for this scope
 	std::lock_guard < std::recursive_mutex > guard(m_HypoMutex);
 
-	// for each pick in the vector
-	for (const auto &q : m_vPickData) {
-		// is this pick a match?
-		if (q->getID() == pck->getID()) {
-			return (true);
-		}
-	}
-
-	return (false);
+	// is this pick a match?
+	return (m_PickDataSet.count(pck.get()) > 0);
 }
 
 // ---------------------------------------------------------generateHypoMessage
 std::shared_ptr<json::Object> CHypo::generateHypoMessage() {
 	// null check
 	if (m_pTravelTimeTables == NULL) {
-		glass3::util::Logger::log("warning",
-									"CHypo::generateHypoMessage: NULL pTTT.");
+		GLASS3_LOG_WARNING("CHypo::generateHypoMessage: NULL pTTT.");
 		return (NULL);
 	}
 
 	// make sure this event hasn't been canceled
 	if (cancelCheck() == true) {
-		glass3::util::Logger::log(
-				"debug",
-				"CHypo::generateHypoMessage: hypo: " + m_sID
+		GLASS3_LOG_DEBUG(
+				"CHypo::generateHypoMessage: hypo: " + getID()
 						+ " has been canceled.");
 		// return a cancel message
 		return (generateCancelMessage());
@@ -2424,25 +2855,33 @@ std::shared_ptr<json::Object> CHypo::generateHypoMessage() {
 
 	// make sure this event is still reportable
 	if (reportCheck() == false) {
-		glass3::util::Logger::log(
-				"debug",
-				"CHypo::generateHypoMessage: hypo: " + m_sID
+		GLASS3_LOG_DEBUG(
+				"CHypo::generateHypoMessage: hypo: " + getID()
 						+ " is not reportable.");
 		// return a cancel message
 		return (generateCancelMessage());
 	}
 
+	// lock mutex for this scope
+	std::lock_guard < std::recursive_mutex > guard(m_HypoMutex);
+
+	// if nothing has changed since the last hypo message, reuse it, callers
+	// may modify the message so they get a copy
+	if ((m_pLastHypoMessage != NULL)
+			&& (isMessageStateCurrent(m_HypoMessageState) == true)) {
+		GLASS3_LOG_DEBUG(
+				"CHypo::generateHypoMessage: reusing unchanged hypo message for "
+				"sPid:" + getID());
+		return (std::make_shared<json::Object>(*m_pLastHypoMessage));
+	}
+
 	// create json object
 	std::shared_ptr<json::Object> hypo = std::make_shared < json::Object
 			> (json::Object());
 
-	glass3::util::Logger::log(
-			"debug",
+	GLASS3_LOG_DEBUG(
 			"CHypo::generateHypoMessage: generating hypo message for sPid:"
-					+ m_sID + " sWebName:" + m_sWebName);
-
-	// lock mutex for this scope
-	std::lock_guard < std::recursive_mutex > guard(m_HypoMutex);
+					+ getID() + " sWebName:" + m_sWebName);
 
 	// NOTE: Need to think about this format, currently it *almost*
 	// creates a detection formats json, but doesn't use the library
@@ -2452,7 +2891,7 @@ std::shared_ptr<json::Object> CHypo::generateHypoMessage() {
 	// basic info
 	(*hypo)["Cmd"] = "Hypo";
 	(*hypo)["Type"] = "Hypo";
-	(*hypo)["ID"] = m_sID;
+	(*hypo)["ID"] = getID();
 	(*hypo)["WebName"] = getWebName();
 
 	// source
@@ -2480,10 +2919,7 @@ std::shared_ptr<json::Object> CHypo::generateHypoMessage() {
 	(*hypo)["Web"] = m_sWebName;
 
 	// generate data array for this hypo
-	// set up traveltime object
-	m_pTravelTimeTables->setTTOrigin(m_dLatitude, m_dLongitude, m_dDepth);
-
-	// set up geo for distance calculations
+	// set up geo for traveltime and distance calculations
 	glass3::util::Geo geo;
 	geo.setGeographic(m_dLatitude, m_dLongitude,
 						glass3::util::Geo::k_EarthRadiusKm - m_dDepth);
@@ -2491,138 +2927,49 @@ std::shared_ptr<json::Object> CHypo::generateHypoMessage() {
 	// array to hold data
 	json::Array data;
 
-	// for each pick
+	// for each pick, reusing the data block from the last message if there
+	// is one, blocks for picks no longer in the hypo are dropped
+	std::unordered_map<std::shared_ptr<CPick>, HypoMessageData> pickData;
 	for (auto pick : m_vPickData) {
-		// get basic pick values
-		std::shared_ptr<CSite> site = pick->getSite();
-		double tobs = pick->getTPick() - m_tOrigin;
-		double tcal = m_pTravelTimeTables->T(&site->getGeo(), tobs);
-		double tres = tobs - tcal;
-		// should this be changed?
-		double sig = glass3::util::GlassMath::sig(tres, 1.0);
-
-		double dist = calculateDistanceToPick(pick);
+		HypoMessageData &pickBlock = pickData[pick];
+		auto found = m_mPickMessageData.find(pick);
+		if (found != m_mPickMessageData.end()) {
+			pickBlock = std::move(found->second);
+		} else {
+			pickBlock.bValid = false;
+		}
 
-		// glass3::util::Logger::log(
-		// "debug",
-		// "CHypo::generateHypoMessage Checking pick: " +
-		// m_pTravelTimeTables->m_sPhase + "; travtime: " +
-		// std::to_string(tobs) +
-		// "; distance: " + std::to_string(dist) +
-		// "; residual: " + std::to_string(tres) +
-		// "; publishable: " + std::to_string(m_pTravelTimeTables->m_bPublishable));
+		updatePickMessageData(pick, geo, &pickBlock);
 
 		// check if we're allowed to publish this pick based
 		// on whether the travel time phase is publishable
-		// m_bPublishable is set in the above m_pTravelTimeTables->T()
-		// call
-		if (m_pTravelTimeTables->m_bPublishable == false) {
+		if (pickBlock.bPublishable == false) {
 			continue;
 		}
 
-		// if we have it, use the shared pointer
-		json::Object pickObj;
-		std::shared_ptr<json::Object> jPick = pick->getJSONPick();
-		if (jPick) {
-			// start with a copy of json pick
-			// which has the site, source, time, etc
-			pickObj = json::Object(*jPick.get());
-
-			// add the lat/lon/elev to site
-			if (pickObj.HasKey("Site")) {
-				// get the site object
-				json::Object siteobj = pickObj["Site"].ToObject();
-				siteobj["Latitude"] = site->getRawLatitude();
-				siteobj["Longitude"] = site->getRawLongitude();
-				siteobj["Elevation"] = site->getRawElevation();
-				pickObj["Site"] = siteobj;
-			}
-
-			// add the association info
-			json::Object assocobj;
-			assocobj["Phase"] = m_pTravelTimeTables->m_sPhase;
-			assocobj["Distance"] = calculateDistanceToPick(pick);
-			assocobj["Azimuth"] = geo.azimuth(&site->getGeo())
-					/ glass3::util::GlassMath::k_DegreesToRadians;
-			assocobj["Residual"] = tres;
-			assocobj["Sigma"] = sig;
-			pickObj["AssociationInfo"] = assocobj;
-		} else {
-			// we don't have a jpick, so fill in what we know
-			pickObj["Site"] = site->getSCNL();
-			pickObj["Pid"] = pick->getID();
-			pickObj["T"] = glass3::util::Date::encodeDateTime(pick->getTPick());
-			pickObj["Time"] = glass3::util::Date::encodeISO8601Time(
-					pick->getTPick());
-			pickObj["Distance"] = calculateDistanceToPick(pick);
-			pickObj["Azimuth"] = geo.azimuth(&site->getGeo())
-					/ glass3::util::GlassMath::k_DegreesToRadians;
-			pickObj["Residual"] = tres;
-		}
-
 		// add new pick to list
-		data.push_back(pickObj);
+		data.push_back(pickBlock.jData);
 	}
+	m_mPickMessageData.swap(pickData);
 
-	// for each correlation
+	// for each correlation, the same way
+	std::unordered_map<std::shared_ptr<CCorrelation>, HypoMessageData>
+		correlationData;
 	for (auto correlation : m_vCorrelationData) {
-		// get basic pick values
-		std::shared_ptr<CSite> site = correlation->getSite();
-		double tobs = correlation->getTCorrelation() - m_tOrigin;
-		double tcal = m_pTravelTimeTables->T(&site->getGeo(), tobs);
-		double tres = tobs - tcal;
-		// should this be changed?
-		double sig = glass3::util::GlassMath::sig(tres, 1.0);
-
-		// if we have it, use the shared pointer
-		json::Object correlationObj;
-		std::shared_ptr<json::Object> jCorrelation = correlation
-				->getJSONCorrelation();
-		if (jCorrelation) {
-			// start with a copy of json pick
-			// which has the site, source, time, etc
-			correlationObj = json::Object(*jCorrelation.get());
-
-			// add the lat/lon/elev to site
-			if (correlationObj.HasKey("Site")) {
-				// get the site object
-				json::Object siteobj = correlationObj["Site"].ToObject();
-				siteobj["Latitude"] = site->getRawLatitude();
-				siteobj["Longitude"] = site->getRawLongitude();
-				siteobj["Elevation"] = site->getRawElevation();
-				correlationObj["Site"] = siteobj;
-			}
-
-			// add the association info
-			json::Object assocobj;
-			assocobj["Phase"] = m_pTravelTimeTables->m_sPhase;
-			assocobj["Distance"] = geo.delta(&site->getGeo())
-					/ glass3::util::GlassMath::k_DegreesToRadians;
-			assocobj["Azimuth"] = geo.azimuth(&site->getGeo())
-					/ glass3::util::GlassMath::k_DegreesToRadians;
-			assocobj["Residual"] = tres;
-			assocobj["Sigma"] = sig;
-			correlationObj["AssociationInfo"] = assocobj;
+		HypoMessageData &correlationBlock = correlationData[correlation];
+		auto found = m_mCorrelationMessageData.find(correlation);
+		if (found != m_mCorrelationMessageData.end()) {
+			correlationBlock = std::move(found->second);
 		} else {
-			// we don't have a jCorrelation, so fill in what we know
-			correlationObj["Site"] = site->getSCNL();
-			correlationObj["Pid"] = correlation->getID();
-			correlationObj["Time"] = glass3::util::Date::encodeISO8601Time(
-					correlation->getTCorrelation());
-			correlationObj["Latitude"] = correlation->getLatitude();
-			correlationObj["Longitude"] = correlation->getLongitude();
-			correlationObj["Depth"] = correlation->getDepth();
-			correlationObj["Distance"] = geo.delta(&site->getGeo())
-					/ glass3::util::GlassMath::k_DegreesToRadians;
-			correlationObj["Azimuth"] = geo.azimuth(&site->getGeo())
-					/ glass3::util::GlassMath::k_DegreesToRadians;
-			correlationObj["Residual"] = tres;
-			correlationObj["Correlation"] = correlation->getCorrelation();
+			correlationBlock.bValid = false;
 		}
 
-		// add new pick to list
-		data.push_back(correlationObj);
+		updateCorrelationMessageData(correlation, geo, &correlationBlock);
+
+		// add new correlation to list
+		data.push_back(correlationBlock.jData);
 	}
+	m_mCorrelationMessageData.swap(correlationData);
 
 	// add data array to object
 	(*hypo)["Data"] = data;
@@ -2631,9 +2978,8 @@ std::shared_ptr<json::Object> CHypo::generateHypoMessage() {
 	// hypo
 	if (m_bHypoGenerated == false) {
 		m_hapsAudit.dtFirstHypoMessage = glass3::util::Date::now();
-		glass3::util::Logger::log(
-				"info",
-				"CHypo::generateHypoMessage Auditing info for: " + m_sID + " "
+		GLASS3_LOG_INFO(
+				"CHypo::generateHypoMessage Auditing info for: " + getID() + " "
 						+ std::to_string(m_dLatitude) + " "
 						+ std::to_string(m_dLongitude) + " "
 						+ std::to_string(m_dDepth) + " "
@@ -2664,10 +3010,264 @@ std::shared_ptr<json::Object> CHypo::generateHypoMessage() {
 
 	m_bHypoGenerated = true;
 
+	// remember the message and what it was generated from
+	m_pLastHypoMessage = std::make_shared<json::Object>(*hypo);
+	recordMessageState(&m_HypoMessageState);
+
 	// done
 	return (hypo);
 }
 
+// ---------------------------------------------------------updatePickMessageData
+void CHypo::updatePickMessageData(std::shared_ptr<CPick> pick,
+									const glass3::util::Geo &geo,
+									HypoMessageData *data) {
+	std::shared_ptr<CSite> site = pick->getSite();
+
+	// (re)build the block if it is new, or the pick or site has changed
+	if ((data->bValid == false) || (data->iDataVersion != pick->getVersion())
+			|| (data->dTData != pick->getTPick())
+			|| (data->dSiteLatitude != site->getRawLatitude())
+			|| (data->dSiteLongitude != site->getRawLongitude())
+			|| (data->dSiteElevation != site->getRawElevation())) {
+		data->bValid = true;
+		data->bAssociated = false;
+		data->iDataVersion = pick->getVersion();
+		data->dTData = pick->getTPick();
+		data->dSiteLatitude = site->getRawLatitude();
+		data->dSiteLongitude = site->getRawLongitude();
+		data->dSiteElevation = site->getRawElevation();
+
+		// if we have it, use the shared pointer
+		std::shared_ptr<json::Object> jPick = pick->getJSONPick();
+		if (jPick) {
+			// start with a copy of json pick
+			// which has the site, source, time, etc
+			data->bHasJSON = true;
+			data->jData = json::Object(*jPick.get());
+
+			// add the lat/lon/elev to site
+			if (data->jData.HasKey("Site")) {
+				// get the site object
+				json::Object siteobj = data->jData["Site"].ToObject();
+				siteobj["Latitude"] = site->getRawLatitude();
+				siteobj["Longitude"] = site->getRawLongitude();
+				siteobj["Elevation"] = site->getRawElevation();
+				data->jData["Site"] = siteobj;
+			}
+		} else {
+			// we don't have a jpick, so fill in what we know
+			data->bHasJSON = false;
+			data->jData = json::Object();
+			data->jData["Site"] = site->getSCNL();
+			data->jData["Pid"] = pick->getID();
+			data->jData["T"] = glass3::util::Date::encodeDateTime(
+					pick->getTPick());
+			data->jData["Time"] = glass3::util::Date::encodeISO8601Time(
+					pick->getTPick());
+		}
+	}
+
+	// the association info only changes when the hypocenter moves
+	if ((data->bAssociated == true) && (data->dLatitude == m_dLatitude)
+			&& (data->dLongitude == m_dLongitude) && (data->dDepth == m_dDepth)
+			&& (data->dTOrigin == m_tOrigin)) {
+		return;
+	}
+	data->bAssociated = true;
+	data->dLatitude = m_dLatitude;
+	data->dLongitude = m_dLongitude;
+	data->dDepth = m_dDepth;
+	data->dTOrigin = m_tOrigin;
+
+	// get basic pick values
+	double tobs = pick->getTPick() - m_tOrigin;
+	traveltime::TTTResultStruct result =
+			m_pTravelTimeTables->getBestTravelTime(geo, site->getGeo(), tobs);
+	double tcal = result.dTravelTime;
+	double tres = tobs - tcal;
+
+	// check if we're allowed to publish this pick based
+	// on whether the travel time phase is publishable
+	data->bPublishable = result.bPublishable;
+	if (data->bPublishable == false) {
+		return;
+	}
+
+	if (data->bHasJSON == true) {
+		// should this be changed?
+		double sig = glass3::util::GlassMath::sig(tres, 1.0);
+
+		// add the association info
+		json::Object assocobj;
+		assocobj["Phase"] = m_pTravelTimeTables->getPhaseName(result.iPhaseID);
+		assocobj["Distance"] = calculateDistanceToPick(pick);
+		assocobj["Azimuth"] = geo.azimuth(&site->getGeo())
+				/ glass3::util::GlassMath::k_DegreesToRadians;
+		assocobj["Residual"] = tres;
+		assocobj["Sigma"] = sig;
+		data->jData["AssociationInfo"] = assocobj;
+	} else {
+		data->jData["Distance"] = calculateDistanceToPick(pick);
+		data->jData["Azimuth"] = geo.azimuth(&site->getGeo())
+				/ glass3::util::GlassMath::k_DegreesToRadians;
+		data->jData["Residual"] = tres;
+	}
+}
+
+// --------------------------------------------------updateCorrelationMessageData
+void CHypo::updateCorrelationMessageData(
+		std::shared_ptr<CCorrelation> correlation, const glass3::util::Geo &geo,
+		HypoMessageData *data) {
+	std::shared_ptr<CSite> site = correlation->getSite();
+
+	// (re)build the block if it is new, or the correlation or site has
+	// changed
+	if ((data->bValid == false)
+			|| (data->iDataVersion != correlation->getVersion())
+			|| (data->dTData != correlation->getTCorrelation())
+			|| (data->dSiteLatitude != site->getRawLatitude())
+			|| (data->dSiteLongitude != site->getRawLongitude())
+			|| (data->dSiteElevation != site->getRawElevation())) {
+		data->bValid = true;
+		data->bAssociated = false;
+		data->bPublishable = true;
+		data->iDataVersion = correlation->getVersion();
+		data->dTData = correlation->getTCorrelation();
+		data->dSiteLatitude = site->getRawLatitude();
+		data->dSiteLongitude = site->getRawLongitude();
+		data->dSiteElevation = site->getRawElevation();
+
+		// if we have it, use the shared pointer
+		std::shared_ptr<json::Object> jCorrelation = correlation
+				->getJSONCorrelation();
+		if (jCorrelation) {
+			// start with a copy of json correlation
+			// which has the site, source, time, etc
+			data->bHasJSON = true;
+			data->jData = json::Object(*jCorrelation.get());
+
+			// add the lat/lon/elev to site
+			if (data->jData.HasKey("Site")) {
+				// get the site object
+				json::Object siteobj = data->jData["Site"].ToObject();
+				siteobj["Latitude"] = site->getRawLatitude();
+				siteobj["Longitude"] = site->getRawLongitude();
+				siteobj["Elevation"] = site->getRawElevation();
+				data->jData["Site"] = siteobj;
+			}
+		} else {
+			// we don't have a jCorrelation, so fill in what we know
+			data->bHasJSON = false;
+			data->jData = json::Object();
+			data->jData["Site"] = site->getSCNL();
+			data->jData["Pid"] = correlation->getID();
+			data->jData["Time"] = glass3::util::Date::encodeISO8601Time(
+					correlation->getTCorrelation());
+			data->jData["Latitude"] = correlation->getLatitude();
+			data->jData["Longitude"] = correlation->getLongitude();
+			data->jData["Depth"] = correlation->getDepth();
+			data->jData["Correlation"] = correlation->getCorrelation();
+		}
+	}
+
+	// the association info only changes when the hypocenter moves
+	if ((data->bAssociated == true) && (data->dLatitude == m_dLatitude)
+			&& (data->dLongitude == m_dLongitude) && (data->dDepth == m_dDepth)
+			&& (data->dTOrigin == m_tOrigin)) {
+		return;
+	}
+	data->bAssociated = true;
+	data->dLatitude = m_dLatitude;
+	data->dLongitude = m_dLongitude;
+	data->dDepth = m_dDepth;
+	data->dTOrigin = m_tOrigin;
+
+	// get basic correlation values
+	double tobs = correlation->getTCorrelation() - m_tOrigin;
+	traveltime::TTTResultStruct result =
+			m_pTravelTimeTables->getBestTravelTime(geo, site->getGeo(), tobs);
+	double tcal = result.dTravelTime;
+	double tres = tobs - tcal;
+
+	if (data->bHasJSON == true) {
+		// should this be changed?
+		double sig = glass3::util::GlassMath::sig(tres, 1.0);
+
+		// add the association info
+		json::Object assocobj;
+		assocobj["Phase"] = m_pTravelTimeTables->getPhaseName(result.iPhaseID);
+		assocobj["Distance"] = geo.delta(&site->getGeo())
+				/ glass3::util::GlassMath::k_DegreesToRadians;
+		assocobj["Azimuth"] = geo.azimuth(&site->getGeo())
+				/ glass3::util::GlassMath::k_DegreesToRadians;
+		assocobj["Residual"] = tres;
+		assocobj["Sigma"] = sig;
+		data->jData["AssociationInfo"] = assocobj;
+	} else {
+		data->jData["Distance"] = geo.delta(&site->getGeo())
+				/ glass3::util::GlassMath::k_DegreesToRadians;
+		data->jData["Azimuth"] = geo.azimuth(&site->getGeo())
+				/ glass3::util::GlassMath::k_DegreesToRadians;
+		data->jData["Residual"] = tres;
+	}
+}
+
+// ---------------------------------------------------------recordMessageState
+void CHypo::recordMessageState(HypoMessageState *state) {
+	std::lock_guard < std::recursive_mutex > guard(m_HypoMutex);
+
+	state->bValid = true;
+	state->dLatitude = m_dLatitude;
+	state->dLongitude = m_dLongitude;
+	state->dDepth = m_dDepth;
+	state->dTOrigin = m_tOrigin;
+	state->dBayes = m_dBayesValue;
+	state->dMinDistance = m_dMinDistance;
+	state->dGap = m_dGap;
+	state->vPickData = m_vPickData;
+	state->vCorrelationData = m_vCorrelationData;
+
+	// remember the data versions, so updated data is noticed
+	state->vPickVersions.clear();
+	for (const auto &pick : m_vPickData) {
+		state->vPickVersions.push_back(pick->getVersion());
+	}
+	state->vCorrelationVersions.clear();
+	for (const auto &correlation : m_vCorrelationData) {
+		state->vCorrelationVersions.push_back(correlation->getVersion());
+	}
+}
+
+// -------------------------------------------------------isMessageStateCurrent
+bool CHypo::isMessageStateCurrent(const HypoMessageState &state) const {
+	std::lock_guard < std::recursive_mutex > guard(m_HypoMutex);
+
+	if ((state.bValid == false) || (state.dLatitude != m_dLatitude)
+			|| (state.dLongitude != m_dLongitude) || (state.dDepth != m_dDepth)
+			|| (state.dTOrigin != m_tOrigin) || (state.dBayes != m_dBayesValue)
+			|| (state.dMinDistance != m_dMinDistance) || (state.dGap != m_dGap)
+			|| (state.vPickData != m_vPickData)
+			|| (state.vCorrelationData != m_vCorrelationData)) {
+		return (false);
+	}
+
+	// the same data can still have been updated since
+	for (int i = 0; i < static_cast<int>(m_vPickData.size()); i++) {
+		if (state.vPickVersions[i] != m_vPickData[i]->getVersion()) {
+			return (false);
+		}
+	}
+	for (int i = 0; i < static_cast<int>(m_vCorrelationData.size()); i++) {
+		if (state.vCorrelationVersions[i]
+				!= m_vCorrelationData[i]->getVersion()) {
+			return (false);
+		}
+	}
+
+	return (true);
+}
+
 // ---------------------------------------------------incrementTotalProcessCount
 int CHypo::incrementTotalProcessCount() {
 	m_iTotalProcessCount++;
@@ -2694,7 +3294,7 @@ bool CHypo::initialize(double lat, double lon, double z, double time,
 	setDepth(z);
 	setTOrigin(time);
 	setTSort(time);
-	m_sID = pid;
+	m_ID = glass3::util::InternedID(pid);
 	m_sWebName = web;
 	m_dBayesValue = bayes;
 	m_dInitialBayesValue = bayes;
@@ -2719,22 +3319,12 @@ bool CHypo::initialize(double lat, double lon, double z, double time,
 	m_hapsAudit.dLonPrev = lon;
 	m_hapsAudit.dDepthPrev = z;
 
-	// make local copies of the travel times so that we don't
-	// have cross-thread contention for them between hypos
-	if (firstTrav != NULL) {
-		m_pNucleationTravelTime1 = std::make_shared < traveltime::CTravelTime
-				> (traveltime::CTravelTime(*firstTrav));
-	}
-
-	if (secondTrav != NULL) {
-		m_pNucleationTravelTime2 = std::make_shared < traveltime::CTravelTime
-				> (traveltime::CTravelTime(*secondTrav));
-	}
-
-	if (ttt != NULL) {
-		m_pTravelTimeTables = std::make_shared < traveltime::CTTT
-				> (traveltime::CTTT(*ttt));
-	}
+	// share the travel times, all hypo travel time lookups use the const
+	// travel time interfaces, so there is no cross-thread contention for
+	// them between hypos
+	m_pNucleationTravelTime1 = firstTrav;
+	m_pNucleationTravelTime2 = secondTrav;
+	m_pTravelTimeTables = ttt;
 	setTCreate(glass3::util::Date::now());
 
 	return (true);
@@ -2742,28 +3332,22 @@ bool CHypo::initialize(double lat, double lon, double z, double time,
 
 // --------------------------------------------------------isLockedForProcessing
 bool CHypo::isLockedForProcessing() {
-	if (m_ProcessingMutex.try_lock() == false) {
-		return (true);
-	}
-
-	m_ProcessingMutex.unlock();
-	return (false);
+	return (m_bProcessingClaimed);
 }
 
 // ---------------------------------------------------------localize
 double CHypo::localize() {
 	// lock mutex for this scope
-	std::lock_guard < std::recursive_mutex > guard(m_HypoMutex);
+	std::unique_lock < std::recursive_mutex > guard(m_HypoMutex);
 
 	// check to see if this is a valid hypo, a hypo must always have an id
-	if (m_sID == "") {
+	if (m_ID.getHandle() == glass3::util::InternedID::k_iEmptyHandle) {
 		return (m_dBayesValue);
 	}
 
 	// Localize this hypo
-	char sLog[glass3::util::Logger::k_nMaxLogEntrySize];
 
-	// glass3::util::Logger::log("debug", "CHypo::localize. " + m_sID);
+	// glass3::util::Logger::log("debug", "CHypo::localize. " + getID());
 
 	// if hypo is fixed, just return current bayesian value
 	// NOTE: What implication does this have for "seed hypos" like twitter
@@ -2798,31 +3382,32 @@ double CHypo::localize() {
 
 	// This should be the default
 	if (CGlass::getMinimizeTTLocator() == false) {
+		int nIter = 0;
 		if (npick < k_iLocationNPickThresholdMedium) {
-			annealingLocateBayes(k_iLocationNumIterationsLarge, searchR,
-									k_dLocationMinDistanceStepSize,
-									searchR / k_dLocationSearchRadiusToTime,
-									k_dLocationMinTimeStepSize);
+			nIter = k_iLocationNumIterationsLarge;
 		} else if (npick < k_iLocationNPickThresholdLarge
 				&& (npick % k_iLocationNPicksToSkipMedium) == 0) {
-			annealingLocateBayes(k_iLocationNumIterationsMedium, searchR,
-									k_dLocationMinDistanceStepSize,
-									searchR / k_dLocationSearchRadiusToTime,
-									k_dLocationMinTimeStepSize);
+			nIter = k_iLocationNumIterationsMedium;
 		} else if ((npick % k_iLocationNPicksToSkipLarge) == 0) {
-			annealingLocateBayes(k_iLocationNumIterationsSmall, searchR,
-									k_dLocationMinDistanceStepSize,
+			nIter = k_iLocationNumIterationsSmall;
+		}
+
+		if (nIter > 0) {
+			// don't hold the hypo, so the locator can release it while its
+			// chains run
+			guard.unlock();
+			annealingLocateBayes(nIter, searchR, k_dLocationMinDistanceStepSize,
 									searchR / k_dLocationSearchRadiusToTime,
 									k_dLocationMinTimeStepSize);
+			guard.lock();
 		} else {
 			// calculate bayes for resolve even if we didn't localize
 			m_dBayesValue = calculateBayes(m_dLatitude, m_dLongitude, m_dDepth,
 											m_tOrigin, false);
 
-			snprintf(sLog, sizeof(sLog),
+			GLASS3_LOG_DEBUG_FORMAT(
 						"CHypo::localize: Skipping localize with %d picks",
 						npick);
-			glass3::util::Logger::log(sLog);
 		}
 	} else {
 		if (npick < k_iLocationNPickThresholdSmall) {
@@ -2852,20 +3437,18 @@ double CHypo::localize() {
 			m_dBayesValue = calculateBayes(m_dLatitude, m_dLongitude, m_dDepth,
 											m_tOrigin, false);
 
-			snprintf(sLog, sizeof(sLog),
+			GLASS3_LOG_DEBUG_FORMAT(
 						"CHypo::localize: Skipping localize with %d picks",
 						npick);
-			glass3::util::Logger::log(sLog);
 		}
 	}
 
 	// log
 	glass3::util::Date dt = glass3::util::Date(m_tOrigin);
-	snprintf(sLog, sizeof(sLog),
-				"CHypo::localize: HYP %s %s%9.4f%10.4f%6.1f %d", m_sID.c_str(),
+	GLASS3_LOG_DEBUG_FORMAT(
+				"CHypo::localize: HYP %s %s%9.4f%10.4f%6.1f %d", getID().c_str(),
 				dt.dateTime().c_str(), getLatitude(), getLongitude(),
 				getDepth(), npick);
-	glass3::util::Logger::log(sLog);
 
 	// compute current stats after location
 	calculateStatistics();
@@ -2880,18 +3463,17 @@ bool CHypo::pruneData(CHypoList* parentThread) {
 	std::lock_guard < std::recursive_mutex > guard(m_HypoMutex);
 
 	// check to see if this is a valid hypo, a hypo must always have an id
-	if (m_sID == "") {
+	if (m_ID.getHandle() == glass3::util::InternedID::k_iEmptyHandle) {
 		return (false);
 	}
 
-	// glass3::util::Logger::log("debug", "CHypo::prune. " + m_sID);
+	// glass3::util::Logger::log("debug", "CHypo::prune. " + getID());
 
 	// set up local vector to track picks to remove
 	std::vector < std::shared_ptr < CPick >> vremove;
 
 	// get the standard deviation allowed for pruning
 	double sdprune = CGlass::getPruningSDCutoff();
-	char sLog[glass3::util::Logger::k_nMaxLogEntrySize];
 
 	// for each pick in this hypo
 	for (auto pck : m_vPickData) {
@@ -2904,11 +3486,9 @@ bool CHypo::pruneData(CHypoList* parentThread) {
 			// pick no longer associates, add to remove list
 			vremove.push_back(pck);
 
-			snprintf(
-					sLog, sizeof(sLog), "CHypo::prune: ASSOC-CUL %s %s",
+			GLASS3_LOG_DEBUG_FORMAT("CHypo::prune: ASSOC-CUL %s %s",
 					glass3::util::Date::encodeDateTime(pck->getTPick()).c_str(),
 					pck->getSite()->getSCNL().c_str());
-			glass3::util::Logger::log(sLog);
 
 			// on to the next pick
 			continue;
@@ -2920,12 +3500,10 @@ bool CHypo::pruneData(CHypoList* parentThread) {
 
 		// check if site is beyond distance limit
 		if (siteDistance > m_dAssociationDistanceCutoff) {
-			snprintf(
-					sLog, sizeof(sLog), "CHypo::prune: DIST-CUL %s %s (%.2f > %.2f)",
+			GLASS3_LOG_DEBUG_FORMAT("CHypo::prune: DIST-CUL %s %s (%.2f > %.2f)",
 					glass3::util::Date::encodeDateTime(pck->getTPick()).c_str(),
 					pck->getSite()->getSCNL().c_str(), siteDistance,
 					getAssociationDistanceCutoff());
-			glass3::util::Logger::log(sLog);
 
 			// add pick to remove list
 			vremove.push_back(pck);
@@ -2942,9 +3520,8 @@ bool CHypo::pruneData(CHypoList* parentThread) {
 		removePickReference(pck);
 	}
 
-	glass3::util::Logger::log(
-			"debug",
-			"CHypo::prune " + m_sID + + " removed " + std::to_string(pruneCount)
+	GLASS3_LOG_DEBUG(
+			"CHypo::prune " + getID() + + " removed " + std::to_string(pruneCount)
 			+ " picks.");
 
 	// set up local vector to track correlations to remove
@@ -2965,14 +3542,11 @@ bool CHypo::pruneData(CHypoList* parentThread) {
 			// correlation no longer associates, add to remove list
 			vcremove.push_back(cor);
 
-			snprintf(
-					sLog,
-					sizeof(sLog),
+			GLASS3_LOG_DEBUG_FORMAT(
 					"CHypo::prune: Corr-CUL %s %s",
 					glass3::util::Date::encodeDateTime(cor->getTCorrelation())
 							.c_str(),
 					cor->getSite()->getSCNL().c_str());
-			glass3::util::Logger::log(sLog);
 
 			// on to the next correlation
 			continue;
@@ -2988,7 +3562,7 @@ bool CHypo::pruneData(CHypoList* parentThread) {
 
 	// glass3::util::Logger::log(
 	// "debug",
-	// "CHypo::prune " + m_sID + + " removed " + std::to_string(pruneCount)
+	// "CHypo::prune " + getID() + + " removed " + std::to_string(pruneCount)
 	// + " correlations.");
 
 	// if we didn't find any data to remove, just
@@ -3005,16 +3579,18 @@ bool CHypo::pruneData(CHypoList* parentThread) {
 void CHypo::removeCorrelationReference(std::shared_ptr<CCorrelation> corr) {
 	// null check
 	if (corr == NULL) {
-		glass3::util::Logger::log("warning",
-									"CHypo::remCorrelation: NULL correlation.");
+		GLASS3_LOG_WARNING("CHypo::remCorrelation: NULL correlation.");
 		return;
 	}
 
 	// lock mutex for this scope
 	std::lock_guard < std::recursive_mutex > guard(m_HypoMutex);
 
-	// get the correlation id
-	std::string pid = corr->getID();
+	// nothing to do if we don't have this correlation
+	if (m_CorrelationDataSet.erase(corr.get()) == 0) {
+		return;
+	}
+	m_iDataVersion++;
 
 	// for each correlation in the vector
 	for (int i = 0; i < m_vCorrelationData.size(); i++) {
@@ -3022,7 +3598,7 @@ void CHypo::removeCorrelationReference(std::shared_ptr<CCorrelation> corr) {
 		auto correlation = m_vCorrelationData[i];
 
 		// is this correlation a match?
-		if (correlation->getID() == pid) {
+		if (correlation == corr) {
 			// remove correlation from vector
 			m_vCorrelationData.erase(m_vCorrelationData.cbegin() + i);
 			return;
@@ -3034,15 +3610,18 @@ void CHypo::removeCorrelationReference(std::shared_ptr<CCorrelation> corr) {
 void CHypo::removePickReference(std::shared_ptr<CPick> pck) {
 	// null check
 	if (pck == NULL) {
-		glass3::util::Logger::log("warning", "CHypo::remPick: NULL pck.");
+		GLASS3_LOG_WARNING("CHypo::remPick: NULL pck.");
 		return;
 	}
 
 	// lock mutex for this scope
 	std::lock_guard < std::recursive_mutex > guard(m_HypoMutex);
 
-	// get the pick id
-	std::string pid = pck->getID();
+	// nothing to do if we don't have this pick
+	if (m_PickDataSet.erase(pck.get()) == 0) {
+		return;
+	}
+	m_iDataVersion++;
 
 	// for each pick in the vector
 	for (int i = 0; i < m_vPickData.size(); i++) {
@@ -3050,7 +3629,7 @@ void CHypo::removePickReference(std::shared_ptr<CPick> pck) {
 		auto pick = m_vPickData[i];
 
 		// is this pick a match?
-		if (pick->getID() == pid) {
+		if (pick == pck) {
 			// remove pick from vector
 			m_vPickData.erase(m_vPickData.cbegin() + i);
 
@@ -3065,30 +3644,31 @@ bool CHypo::reportCheck() {
 	std::lock_guard < std::recursive_mutex > guard(m_HypoMutex);
 
 	// check to see if this is a valid hypo, a hypo must always have an id
-	if (m_sID == "") {
+	if (m_ID.getHandle() == glass3::util::InternedID::k_iEmptyHandle) {
 		return (false);
 	}
 
-	char sLog[glass3::util::Logger::k_nMaxLogEntrySize * 2];
-	char sHypo[glass3::util::Logger::k_nMaxLogEntrySize];
-
-	glass3::util::Date dt = glass3::util::Date(m_tOrigin);
-	snprintf(sHypo, sizeof(sHypo), "%s %s%9.4f%10.4f%6.1f %d", m_sID.c_str(),
-				dt.dateTime().c_str(), getLatitude(), getLongitude(),
-				getDepth(), static_cast<int>(m_vPickData.size()));
+	// describe the hypo for the report messages, if they will be logged
+	char sHypo[glass3::util::Logger::k_nMaxLogEntrySize] = "";
+	if (glass3::util::Logger::isLevelEnabled(spdlog::level::debug)) {
+		glass3::util::Date dt = glass3::util::Date(m_tOrigin);
+		snprintf(sHypo, sizeof(sHypo), "%s %s%9.4f%10.4f%6.1f %d",
+					getID().c_str(), dt.dateTime().c_str(), getLatitude(),
+					getLongitude(), getDepth(),
+					static_cast<int>(m_vPickData.size()));
+	}
 
 	int nReportCut = CGlass::getReportingDataThreshold();
 
 	// check data count
 	if ((m_vPickData.size() + m_vCorrelationData.size()) < nReportCut) {
 		// there isn't
-		snprintf(sLog, sizeof(sLog),
+		GLASS3_LOG_DEBUG_FORMAT(
 					"CHypo::reportCheck: Below data count threshold "
 					"((%d + %d) < %d) Hypo: %s",
 					static_cast<int>(m_vPickData.size()),
 					static_cast<int>(m_vCorrelationData.size()), nReportCut,
 					sHypo);
-		glass3::util::Logger::log(sLog);
 
 		// this hypo cannot be reported
 		return (false);
@@ -3100,12 +3680,10 @@ bool CHypo::reportCheck() {
 	double dReportThresh = CGlass::getReportingStackThreshold();
 	if (m_dBayesValue < dReportThresh) {
 		// failure
-		snprintf(
-				sLog, sizeof(sLog),
+		GLASS3_LOG_DEBUG_FORMAT(
 				"CHypo::reportCheck: Below bayesian threshold (%.1f < %.1f) "
 				"Hypo: %s",
 				getBayesValue(), dReportThresh, sHypo);
-		glass3::util::Logger::log(sLog);
 
 		// this hypo cannot be reported
 		return (false);
@@ -3127,14 +3705,13 @@ bool CHypo::resolveData(std::shared_ptr<CHypo> hyp, bool allowStealing,
 	}
 
 	// check to see if this is a valid hypo, a hypo must always have an id
-	if (m_sID == "") {
+	if (m_ID.getHandle() == glass3::util::InternedID::k_iEmptyHandle) {
 		return (false);
 	}
 
-	// glass3::util::Logger::log("debug", "CHypo::resolve. " + m_sID);
+	// glass3::util::Logger::log("debug", "CHypo::resolve. " + getID());
 
 	bool bAssoc = false;
-	char sLog[glass3::util::Logger::k_nMaxLogEntrySize];
 
 	// handle picks
 	// for each pick in this hypo
@@ -3169,7 +3746,7 @@ bool CHypo::resolveData(std::shared_ptr<CHypo> hyp, bool allowStealing,
 		std::string sOtherPid = pickHyp->getID();
 
 		// if this pick is linked to this hypo
-		if (sOtherPid == m_sID) {
+		if (sOtherPid == getID()) {
 			// nothing else to do
 			continue;
 		}
@@ -3180,12 +3757,11 @@ bool CHypo::resolveData(std::shared_ptr<CHypo> hyp, bool allowStealing,
 		// get the current pick's affinity to the hypo it's linked to
 		double aff2 = pickHyp->calculateAffinity(pck);
 
-		snprintf(sLog, sizeof(sLog),
+		GLASS3_LOG_DEBUG_FORMAT(
 					"CHypo::resolve: SCV COMPARE %s %s %s %s (%.2f, %.2f)",
-					m_sID.c_str(), sOtherPid.c_str(),
+					getID().c_str(), sOtherPid.c_str(),
 					glass3::util::Date::encodeDateTime(pck->getTPick()).c_str(),
 					pck->getSite()->getSCNL().c_str(), aff1, aff2);
-		glass3::util::Logger::log(sLog);
 
 		// check which affinity is better
 		if (aff1 > aff2) {
@@ -3226,9 +3802,8 @@ bool CHypo::resolveData(std::shared_ptr<CHypo> hyp, bool allowStealing,
 		}
 	}
 
-	glass3::util::Logger::log(
-			"debug",
-			"CHypo::resolve " + m_sID + " added:" + std::to_string(addedCount)
+	GLASS3_LOG_DEBUG(
+			"CHypo::resolve " + getID() + " added:" + std::to_string(addedCount)
 					+ " kept:" + std::to_string(keptCount)
 					+ " removed:" + std::to_string(removeCount));
 
@@ -3254,7 +3829,7 @@ bool CHypo::resolveData(std::shared_ptr<CHypo> hyp, bool allowStealing,
 		std::string sOtherPid = corrHyp->getID();
 
 		// if this corr is linked to this hypo
-		if (sOtherPid == m_sID) {
+		if (sOtherPid == getID()) {
 			// nothing else to do
 			continue;
 		}
@@ -3263,16 +3838,13 @@ bool CHypo::resolveData(std::shared_ptr<CHypo> hyp, bool allowStealing,
 		double aff1 = calculateAffinity(corr);
 		double aff2 = corrHyp->calculateAffinity(corr);
 
-		snprintf(
-				sLog,
-				sizeof(sLog),
+		GLASS3_LOG_DEBUG_FORMAT(
 				"CHypo::resolve: C SCV COMPARE %s %s %s %s (%.2f, %.2f )",
-				m_sID.c_str(),
+				getID().c_str(),
 				sOtherPid.c_str(),
 				glass3::util::Date::encodeDateTime(corr->getTCorrelation())
 						.c_str(),
 				corr->getSite()->getSCNL().c_str(), aff1, aff2);
-		glass3::util::Logger::log(sLog);
 
 		// check which affinity is better
 		if (aff1 > aff2) {
@@ -3428,7 +4000,6 @@ void CHypo::trap() {
 	// lock mutex for this scope
 	std::lock_guard < std::recursive_mutex > guard(m_HypoMutex);
 
-	char sLog[glass3::util::Logger::k_nMaxLogEntrySize];
 
 	// for each pick in this hypocenter
 	for (const auto &q : m_vPickData) {
@@ -3442,22 +4013,19 @@ void CHypo::trap() {
 		// check pointer
 		if (hyp == NULL) {
 			// bad hypo pointer
-			snprintf(sLog, sizeof(sLog),
+			GLASS3_LOG_WARNING_FORMAT(
 						"CHypo::trap: sPid %s Pick %s has no back link to hypo",
-						m_sID.c_str(), q->getID().c_str());
-			glass3::util::Logger::log("warning", sLog);
+						getID().c_str(), q->getID().c_str());
 
 			continue;
 		}
 
 		// check sPid
-		if (hyp->getID() != m_sID) {
+		if (hyp->getID() != getID()) {
 			// sPid is for a different hypo
-			snprintf(
-					sLog, sizeof(sLog),
+			GLASS3_LOG_WARNING_FORMAT(
 					"CHypo::trap: sPid %s Pick: %s linked to another hypo: %s",
-					m_sID.c_str(), q->getID().c_str(), hyp->getID().c_str());
-			glass3::util::Logger::log("warning", sLog);
+					getID().c_str(), q->getID().c_str(), hyp->getID().c_str());
 		}
 	}
 }
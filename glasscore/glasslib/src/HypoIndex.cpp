@@ -0,0 +1,192 @@
+#include "HypoIndex.h"
+#include <geo.h>
+#include <glassmath.h>
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "Hypo.h"
+#include "SiteIndex.h"
+
+namespace glasscore {
+
+constexpr double CHypoIndex::k_dMovementAllowance;
+
+// hypo sorting function
+// Compares hypo sort times for search results
+bool sortHypoTime(const std::pair<double, std::weak_ptr<CHypo>> &lhs,
+					const std::pair<double, std::weak_ptr<CHypo>> &rhs) {
+	return (lhs.first < rhs.first);
+}
+
+// ---------------------------------------------------------CHypoIndex
+CHypoIndex::CHypoIndex() {
+	clear();
+}
+
+// ---------------------------------------------------------~CHypoIndex
+CHypoIndex::~CHypoIndex() {
+}
+
+// ---------------------------------------------------------clear
+void CHypoIndex::clear() {
+	m_mHypoEntries.clear();
+	m_mCells.clear();
+}
+
+// ---------------------------------------------------------addHypo
+bool CHypoIndex::addHypo(std::shared_ptr<CHypo> hypo) {
+	// nullcheck
+	if (hypo == NULL) {
+		return (false);
+	}
+
+	// remove any existing entry, the hypo may have moved
+	removeHypo(hypo);
+
+	glass3::util::Geo hypoGeo = hypo->getGeo();
+	HypoIndexEntry entry;
+	entry.Hypo = hypo;
+	entry.dUnitVector[0] = hypoGeo.m_dUnitVectorX;
+	entry.dUnitVector[1] = hypoGeo.m_dUnitVectorY;
+	entry.dUnitVector[2] = hypoGeo.m_dUnitVectorZ;
+	entry.dCutoff = hypo->getAssociationDistanceCutoff()
+			* glass3::util::GlassMath::k_DegreesToRadians;
+
+	int cellIndex = CSiteIndex::getCellIndex(
+			CSiteIndex::getAxisIndex(entry.dUnitVector[0]),
+			CSiteIndex::getAxisIndex(entry.dUnitVector[1]),
+			CSiteIndex::getAxisIndex(entry.dUnitVector[2]));
+
+	auto cell = m_mCells.find(cellIndex);
+	if (cell == m_mCells.end()) {
+		HypoIndexCell newCell;
+		newCell.dMaxCutoff = 0;
+		cell = m_mCells.insert(
+				std::pair<int, HypoIndexCell>(cellIndex, newCell)).first;
+	}
+	cell->second.dMaxCutoff = std::max(cell->second.dMaxCutoff, entry.dCutoff);
+
+	CellHypos::iterator position = cell->second.Hypos.insert(
+			std::pair<double, HypoIndexEntry>(
+					static_cast<double>(hypo->getTSort()), entry));
+	m_mHypoEntries[hypo.get()] =
+			std::pair<int, CellHypos::iterator>(cellIndex, position);
+
+	return (true);
+}
+
+// ---------------------------------------------------------removeHypo
+bool CHypoIndex::removeHypo(std::shared_ptr<CHypo> hypo) {
+	if (hypo == NULL) {
+		return (false);
+	}
+
+	auto found = m_mHypoEntries.find(hypo.get());
+	if (found == m_mHypoEntries.end()) {
+		return (false);
+	}
+
+	// remove the hypo from its cell, and the cell if it is now empty
+	auto cell = m_mCells.find(found->second.first);
+	double cutoff = found->second.second->second.dCutoff;
+	cell->second.Hypos.erase(found->second.second);
+	if (cell->second.Hypos.empty() == true) {
+		m_mCells.erase(cell);
+	} else if (cutoff >= cell->second.dMaxCutoff) {
+		// this may have been the largest cutoff in the cell
+		cell->second.dMaxCutoff = 0;
+		for (const auto &cellHypo : cell->second.Hypos) {
+			cell->second.dMaxCutoff = std::max(cell->second.dMaxCutoff,
+												cellHypo.second.dCutoff);
+		}
+	}
+
+	m_mHypoEntries.erase(found);
+
+	return (true);
+}
+
+// ---------------------------------------------------------getHypos
+std::vector<std::weak_ptr<CHypo>> CHypoIndex::getHypos(
+		const glass3::util::Geo &geo, double maxDistance, double t1,
+		double t2) const {
+	return (search(geo, std::max(maxDistance, 0.0), t1, t2));
+}
+
+// ---------------------------------------------------------getAssociableHypos
+std::vector<std::weak_ptr<CHypo>> CHypoIndex::getAssociableHypos(
+		const glass3::util::Geo &geo, double t1, double t2) const {
+	return (search(geo, -1.0, t1, t2));
+}
+
+// ---------------------------------------------------------size
+int CHypoIndex::size() const {
+	return (m_mHypoEntries.size());
+}
+
+// ---------------------------------------------------------search
+std::vector<std::weak_ptr<CHypo>> CHypoIndex::search(
+		const glass3::util::Geo &geo, double maxDistance, double t1,
+		double t2) const {
+	std::vector<std::pair<double, std::weak_ptr<CHypo>>> found;
+	bool useCutoff = (maxDistance < 0);
+
+	for (const auto &cell : m_mCells) {
+		// skip cells too far away to hold a hypo within the distance
+		double cellDistance = useCutoff ? cell.second.dMaxCutoff : maxDistance;
+		if (CSiteIndex::getCellChord(geo, cell.first)
+				> getSearchChord(cellDistance)) {
+			continue;
+		}
+
+		// the hypos in the time window
+		CellHypos::const_iterator lower = cell.second.Hypos.lower_bound(t1);
+		CellHypos::const_iterator upper = cell.second.Hypos.upper_bound(t2);
+		for (CellHypos::const_iterator it = lower; it != upper; ++it) {
+			const HypoIndexEntry &entry = it->second;
+
+			// check the hypo's own snapshot
+			double dx = entry.dUnitVector[0] - geo.m_dUnitVectorX;
+			double dy = entry.dUnitVector[1] - geo.m_dUnitVectorY;
+			double dz = entry.dUnitVector[2] - geo.m_dUnitVectorZ;
+			double chord = sqrt(dx * dx + dy * dy + dz * dz);
+			double distance = useCutoff ? entry.dCutoff : maxDistance;
+			if (chord > getSearchChord(distance)) {
+				continue;
+			}
+
+			found.push_back(
+					std::pair<double, std::weak_ptr<CHypo>>(it->first,
+															entry.Hypo));
+		}
+	}
+
+	// merge the cells back into time order
+	std::stable_sort(found.begin(), found.end(), sortHypoTime);
+
+	std::vector<std::weak_ptr<CHypo>> hypos;
+	hypos.reserve(found.size());
+	for (const auto &entry : found) {
+		hypos.push_back(entry.second);
+	}
+
+	return (hypos);
+}
+
+// ---------------------------------------------------------getSearchChord
+double CHypoIndex::getSearchChord(double distance) {
+	// any hypo within the distance, even after moving the allowance, is
+	// within this chord of the location, padded for rounding
+	double paddedDistance = distance
+			+ (k_dMovementAllowance
+					* glass3::util::GlassMath::k_DegreesToRadians);
+	if (paddedDistance >= glass3::util::GlassMath::k_Pi) {
+		return (2.0);
+	}
+
+	return (2.0 * sin(paddedDistance / 2.0) + 1.0e-9);
+}
+}  // namespace glasscore
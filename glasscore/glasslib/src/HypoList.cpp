@@ -2,6 +2,7 @@
 #include <logger.h>
 #include <stringutil.h>
 #include <geo.h>
+#include <glassmath.h>
 #include <date.h>
 #include <json.h>
 #include <string>
@@ -16,6 +17,7 @@
 #include <thread>
 #include <chrono>
 #include <mutex>
+#include <cmath>
 #include "Site.h"
 #include "Pick.h"
 #include "Correlation.h"
@@ -56,8 +58,7 @@ bool CHypoList::addHypo(std::shared_ptr<CHypo> hypo, bool scheduleProcessing,
 		CPickList* parentThread) {
 	// nullcheck
 	if (hypo == NULL) {
-		glass3::util::Logger::log("error",
-									"CHypoList::addHypo: NULL hypo provided.");
+		GLASS3_LOG_ERROR("CHypoList::addHypo: NULL hypo provided.");
 
 		return (false);
 	}
@@ -116,8 +117,7 @@ bool CHypoList::addHypo(std::shared_ptr<CHypo> hypo, bool scheduleProcessing,
 						}
 					}
 
-					glass3::util::Logger::log(
-						"debug", "CHypoList::addHypo: Existing Proximal Hypo: "
+					GLASS3_LOG_DEBUG("CHypoList::addHypo: Existing Proximal Hypo: "
 						+ aHypo->getID()
 						+ "; ot:"
 						+ glass3::util::Date::encodeDateTime(aHypo->getTOrigin())
@@ -189,8 +189,7 @@ bool CHypoList::addHypo(std::shared_ptr<CHypo> hypo, bool scheduleProcessing,
 					/ static_cast<double>(numPicks);
 
 				if (percentCommon >= threshold) {
-					glass3::util::Logger::log(
-						"debug", "CHypoList::addHypo: Existing Hypo with "
+					GLASS3_LOG_DEBUG("CHypoList::addHypo: Existing Hypo with "
 						+ glass3::util::to_string_with_precision(percentCommon * 100, 1)
 						+ "% common picks found. Existing Hypo: "
 						+ aHypo->getID()
@@ -271,8 +270,11 @@ bool CHypoList::addHypo(std::shared_ptr<CHypo> hypo, bool scheduleProcessing,
 	// add to multiset
 	m_msHypoList.insert(hypo);
 
+	// add to the index
+	m_HypoIndex.addHypo(hypo);
+
 	// add to hypo map
-	m_mHypo[hypo->getID()] = hypo;
+	m_mHypo[hypo->getIDHandle()] = hypo;
 
 	// Schedule this hypo for refinement. Note that this
 	// hypo will be the first one in the queue, and will be the
@@ -289,8 +291,12 @@ bool CHypoList::addHypo(std::shared_ptr<CHypo> hypo, bool scheduleProcessing,
 bool CHypoList::associateData(std::shared_ptr<CPick> pk) {
 	// nullcheck
 	if (pk == NULL) {
-		glass3::util::Logger::log(
-				"warning", "CHypoList::associate: NULL pick provided.");
+		GLASS3_LOG_WARNING("CHypoList::associate: NULL pick provided.");
+
+		return (false);
+	}
+	if (pk->getSite() == NULL) {
+		GLASS3_LOG_WARNING("CHypoList::associate: pick without a site provided.");
 
 		return (false);
 	}
@@ -298,12 +304,13 @@ bool CHypoList::associateData(std::shared_ptr<CPick> pk) {
 	std::vector<std::shared_ptr<CHypo>> assocHypoList;
 
 	// compute the list of hypos to associate with
-	// (a potential hypo must be before the pick we're associating)
+	// (a potential hypo must be before the pick we're associating, and close
+	// enough for the pick's site to be within its distance cutoff)
 	// use the pick time minus 3600 seconds to compute the starting index
 	// NOTE: Hard coded time delta
-	std::vector<std::weak_ptr<CHypo>> hypoList = getHypos(
+	std::vector<std::weak_ptr<CHypo>> hypoList = getAssociableHypos(
 			pk->getTPick() - k_nHypoSearchPastDurationForPick,
-			pk->getTPick() + 10.0);
+			pk->getTPick() + 10.0, pk->getSite()->getGeo());
 
 	// make sure we got any hypos
 	if (hypoList.size() == 0) {
@@ -356,8 +363,7 @@ bool CHypoList::associateData(std::shared_ptr<CPick> pk) {
 		// link the hypo to the pick
 		bestHyp->addPickReference(pk);
 
-		glass3::util::Logger::log(
-				"debug",
+		GLASS3_LOG_DEBUG(
 				"CHypoList::associate ASSOC idPick:" + pk->getID()
 				+ "; idHypo: " + bestHyp->getID()
 				+ "; bayes: " + std::to_string(bestBayes));
@@ -383,8 +389,12 @@ bool CHypoList::associateData(std::shared_ptr<CPick> pk) {
 bool CHypoList::fitData(std::shared_ptr<CPick> pk) {
 	// nullcheck
 	if (pk == NULL) {
-		glass3::util::Logger::log(
-				"warning", "CHypoList::associate: NULL pick provided.");
+		GLASS3_LOG_WARNING("CHypoList::associate: NULL pick provided.");
+
+		return (false);
+	}
+	if (pk->getSite() == NULL) {
+		GLASS3_LOG_WARNING("CHypoList::fitData: pick without a site provided.");
 
 		return (false);
 	}
@@ -392,17 +402,18 @@ bool CHypoList::fitData(std::shared_ptr<CPick> pk) {
 	std::vector<std::shared_ptr<CHypo>> assocHypoList;
 
 	// compute the list of hypos to associate with
-	// (a potential hypo must be before the pick we're associating)
+	// (a potential hypo must be before the pick we're associating, and close
+	// enough for the pick's site to be within its distance cutoff)
 	// use the pick time minus 3600 seconds to compute the starting index
 	// NOTE: Hard coded time delta
-	std::vector<std::weak_ptr<CHypo>> hypoList = getHypos(
+	std::vector<std::weak_ptr<CHypo>> hypoList = getAssociableHypos(
 			pk->getTPick() - k_nHypoSearchPastDurationForPick,
-			pk->getTPick() + 10.0);
+			pk->getTPick() + 10.0, pk->getSite()->getGeo());
 
 	// make sure we got any hypos
 	if (hypoList.size() == 0) {
 		if (debug) {
-			glass3::util::Logger::log("debug",
+			GLASS3_LOG_DEBUG(
 				"CHypoList::fitData: No hypos to check Pick: "
 				+ pk->getID() + " ("
 				+ pk->getSite()->getSCNL() + ")"
@@ -444,7 +455,7 @@ bool CHypoList::fitData(std::shared_ptr<CPick> pk) {
 					(travelTimeObs <= travelTimeS) &&
 					(distance <= distanceLimit)) {
 					if (debug) {
-						glass3::util::Logger::log("debug",
+						GLASS3_LOG_DEBUG(
 							"CHypoList::fitData: Pick: "
 							+ pk->getID() + " ("
 							+ pk->getSite()->getSCNL() + ")"
@@ -472,7 +483,7 @@ bool CHypoList::fitData(std::shared_ptr<CPick> pk) {
 	}
 
 	if (debug) {
-		glass3::util::Logger::log("debug",
+		GLASS3_LOG_DEBUG(
 			"CHypoList::fitData: Pick: "
 			+ pk->getID() + " ("
 			+ pk->getSite()->getSCNL() + ")"
@@ -486,8 +497,7 @@ bool CHypoList::fitData(std::shared_ptr<CPick> pk) {
 bool CHypoList::associateData(std::shared_ptr<CCorrelation> corr) {
 	// nullcheck
 	if (corr == NULL) {
-		glass3::util::Logger::log(
-				"warning", "CHypoList::associate: NULL correlation provided.");
+		GLASS3_LOG_WARNING("CHypoList::associate: NULL correlation provided.");
 
 		return (false);
 	}
@@ -543,8 +553,7 @@ bool CHypoList::associateData(std::shared_ptr<CCorrelation> corr) {
 		// link the hypo to the correlation
 		bestHyp->addCorrelationReference(corr);
 
-		glass3::util::Logger::log(
-				"debug",
+		GLASS3_LOG_DEBUG(
 				"CHypoList::associate (correlation) sPid:" + bestHyp->getID()
 						+ " resetting cycle count due to new association");
 
@@ -560,8 +569,7 @@ bool CHypoList::associateData(std::shared_ptr<CCorrelation> corr) {
 
 	// For each hypo that the correlation could associate with
 	for (auto q : assocHypoList) {
-		glass3::util::Logger::log(
-				"debug",
+		GLASS3_LOG_DEBUG(
 				"CHypoList::associate (correlation) sPid:" + q->getID()
 						+ " resetting cycle count due to new association");
 
@@ -580,11 +588,14 @@ bool CHypoList::associateData(std::shared_ptr<CCorrelation> corr) {
 // ---------------------------------------------------------clear
 void CHypoList::clear() {
 	std::lock_guard<std::mutex> queueGuard(m_HypoProcessingQueueMutex);
-	m_lHypoProcessingQueue.clear();
+	m_mHypoProcessingQueue.clear();
+	m_mQueuedHypos.clear();
+	m_iHypoQueueSequence = 0;
 
 	std::lock_guard<std::recursive_mutex> listGuard(m_HypoListMutex);
 	m_msHypoList.clear();
 	m_mHypo.clear();
+	m_HypoIndex.clear();
 
 	// reset
 	m_iCountOfTotalHyposProcessed = 0;
@@ -599,9 +610,6 @@ glass3::util::WorkState CHypoList::work() {
 		return (glass3::util::WorkState::Idle);
 	}
 
-	// log the cycle count and queue size
-	char sLog[glass3::util::Logger::k_nMaxLogEntrySize];
-
 	// get the next hypo to process
 	std::shared_ptr<CHypo> hyp = getNextHypoFromProcessingQueue();
 
@@ -612,51 +620,22 @@ glass3::util::WorkState CHypoList::work() {
 		return (glass3::util::WorkState::Idle);
 	}
 
-	// std::lock_guard<std::mutex> hypoGuard(hyp->getProcessingMutex());
+	// we need to claim hyp for processing, if another thread has it, it
+	// will requeue hyp when it is done, so we don't wait for it
+	CHypoProcessingClaim hypoClaim(hyp, this);
+	if (hypoClaim.ownsClaim() == false) {
+		GLASS3_LOG_DEBUG_FORMAT(
+					"CHypoList::work: %s is being processed by another thread,"
+					" deferring.",
+					hyp->getID().c_str());
 
-	// we need to lock hyp for processing
-	int tryCount = 0;
-	int tryLimit = 10 * 10;  // 10 second converted to tenths of a second
-							 // (the sleep time)
-	std::unique_lock<std::mutex> hypoGuard(hyp->getProcessingMutex(),
-										std::defer_lock);
-
-	// loop for awhile trying to get lock
-	while (!hypoGuard.try_lock()) {
-		tryCount++;
-		if (tryCount <= tryLimit) {
-			// didn't get lock, wait a bit
-			std::this_thread::sleep_for(
-							std::chrono::milliseconds(100));
-			setThreadHealth();
-		} else {
-			break;
-		}
-	}
-
-	// last try
-	if (!hypoGuard.owns_lock()) {
-		if (!hypoGuard.try_lock()) {
-			// didn't get it, give up
-			snprintf(sLog, sizeof(sLog),
-						"CHypoList::work: could not"
-						" lock %s for processing after 10s, continuing.",
-						hyp->getID().c_str());
-			glass3::util::Logger::log(sLog);
-
-			// we can't lock this hypo
-			// put it back on the queue
-			appendToHypoProcessingQueue(hyp);
-
-			// move on
-			return (glass3::util::WorkState::OK);
-		}
+		// move on
+		return (glass3::util::WorkState::OK);
 	}
 
 	try {
 		// log the hypo we're working on
-		glass3::util::Logger::log(
-				"debug",
+		GLASS3_LOG_DEBUG(
 				"CHypoList::work Processing Hypo sPid:" + hyp->getID()
 						+ " Cycle:" + std::to_string(hyp->getProcessCount())
 						+ " Fifo Size:"
@@ -666,8 +645,7 @@ glass3::util::WorkState CHypoList::work() {
 		if (hyp->cancelCheck()) {
 			// this hypo is no longer viable
 			// log
-			glass3::util::Logger::log(
-					"debug",
+			GLASS3_LOG_DEBUG(
 					"CHypoList::work canceling sPid:" + hyp->getID()
 							+ " processCount:"
 							+ std::to_string(hyp->getTotalProcessCount()));
@@ -683,8 +661,7 @@ glass3::util::WorkState CHypoList::work() {
 		// hypo
 		if (hyp->getProcessCount() >= CGlass::getProcessLimit()) {
 			// log
-			glass3::util::Logger::log(
-					"debug",
+			GLASS3_LOG_DEBUG(
 					"CHypoList::work skipping sPid:" + hyp->getID()
 							+ " at cycle limit:"
 							+ std::to_string(hyp->getProcessCount())
@@ -702,8 +679,7 @@ glass3::util::WorkState CHypoList::work() {
 			updatePosition(hyp);
 		}
 	} catch (const std::exception &e) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CHypoList::work: Exception during processing: "
 						+ std::string(e.what()));
 		return (glass3::util::WorkState::Error);
@@ -717,8 +693,7 @@ glass3::util::WorkState CHypoList::work() {
 bool CHypoList::receiveExternalMessage(std::shared_ptr<json::Object> com) {
 	// null check json
 	if (com == NULL) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CHypoList::receiveExternalMessage: NULL json communication.");
 		return (false);
 	}
@@ -743,8 +718,7 @@ bool CHypoList::receiveExternalMessage(std::shared_ptr<json::Object> com) {
 bool CHypoList::processHypo(std::shared_ptr<CHypo> hyp) {
 	// nullcheck
 	if (hyp == NULL) {
-		glass3::util::Logger::log(
-				"warning", "CHypoList::processHypo: NULL hypo provided.");
+		GLASS3_LOG_WARNING("CHypoList::processHypo: NULL hypo provided.");
 		return (false);
 	}
 
@@ -793,8 +767,7 @@ bool CHypoList::processHypo(std::shared_ptr<CHypo> hyp) {
 
 		// make sure we didn't merge ourself out of existance
 		if (hyp->cancelCheck()) {
-			glass3::util::Logger::log(
-				"debug",
+			GLASS3_LOG_DEBUG(
 				"CHypoList::processHypo: Canceled sPid:" + pid + " cycle:"
 						+ std::to_string(hyp->getProcessCount())
 						+ " processCount:"
@@ -911,8 +884,7 @@ bool CHypoList::processHypo(std::shared_ptr<CHypo> hyp) {
 				std::chrono::duration<double>>(
 				tRemoveEndTime - tEvolveStartTime).count();
 
-		glass3::util::Logger::log(
-				"debug",
+		GLASS3_LOG_DEBUG(
 				"CHypoList::processHypo: Canceled sPid:" + pid + " cycle:"
 						+ std::to_string(hyp->getProcessCount())
 						+ " processCount:"
@@ -948,8 +920,7 @@ bool CHypoList::processHypo(std::shared_ptr<CHypo> hyp) {
 
 	// check to see if this is a new event
 	if (hyp->getTotalProcessCount() <= 1) {
-		glass3::util::Logger::log(
-				"debug",
+		GLASS3_LOG_DEBUG(
 				"CHypoList::processHypo: Should report new hypo sPid:" + pid
 						+ " cycle:" + std::to_string(hyp->getProcessCount())
 						+ " processCount:"
@@ -967,15 +938,13 @@ bool CHypoList::processHypo(std::shared_ptr<CHypo> hyp) {
 			// report to anyone listening outside of glasscore
 			CGlass::sendExternalMessage(hyp->generateEventMessage());
 
-			glass3::util::Logger::log(
-					"debug",
+			GLASS3_LOG_DEBUG(
 					"CHypoList::processHypo: Reported hypo sPid:" + pid
 							+ " cycle:" + std::to_string(hyp->getProcessCount())
 							+ " processCount:"
 							+ std::to_string(hyp->getTotalProcessCount()));
 		} else {
-			glass3::util::Logger::log(
-					"debug",
+			GLASS3_LOG_DEBUG(
 					"CHypoList::processHypo: hypo sPid:" + pid
 							+ " processCount:"
 							+ std::to_string(hyp->getTotalProcessCount())
@@ -1001,8 +970,7 @@ bool CHypoList::processHypo(std::shared_ptr<CHypo> hyp) {
 			std::chrono::duration_cast<std::chrono::duration<double>>(
 					tTrapEndTime - tEvolveStartTime).count();
 
-	glass3::util::Logger::log(
-			"debug",
+	GLASS3_LOG_DEBUG(
 			"CHypoList::processHypo: Finished sPid:" + pid + " cycle:"
 					+ std::to_string(hyp->getProcessCount()) + " processCount:"
 					+ std::to_string(hyp->getTotalProcessCount())
@@ -1037,7 +1005,7 @@ int CHypoList::getHypoProcessingQueueLength() {
 	std::lock_guard<std::mutex> queueGuard(m_HypoProcessingQueueMutex);
 
 	// return the current size of the queue
-	int size = m_lHypoProcessingQueue.size();
+	int size = m_mHypoProcessingQueue.size();
 	return (size);
 }
 
@@ -1122,6 +1090,38 @@ std::vector<std::weak_ptr<CHypo>> CHypoList::getHypos(double t1, double t2) {
 	return (hypos);
 }
 
+// ---------------------------------------------------------getHypos
+std::vector<std::weak_ptr<CHypo>> CHypoList::getHypos(
+		double t1, double t2, const glass3::util::Geo &geo,
+		double maxDistance) {
+	// swap t1 and t2 if necessary so that t1 <= t2
+	if (t1 > t2) {
+		std::swap(t1, t2);
+	}
+
+	std::lock_guard<std::recursive_mutex> listGuard(m_HypoListMutex);
+
+	// sort times are whole seconds
+	return (m_HypoIndex.getHypos(
+			geo, maxDistance * glass3::util::GlassMath::k_DegreesToRadians,
+			std::floor(t1), std::floor(t2)));
+}
+
+// ---------------------------------------------------------getAssociableHypos
+std::vector<std::weak_ptr<CHypo>> CHypoList::getAssociableHypos(
+		double t1, double t2, const glass3::util::Geo &geo) {
+	// swap t1 and t2 if necessary so that t1 <= t2
+	if (t1 > t2) {
+		std::swap(t1, t2);
+	}
+
+	std::lock_guard<std::recursive_mutex> listGuard(m_HypoListMutex);
+
+	// sort times are whole seconds
+	return (m_HypoIndex.getAssociableHypos(geo, std::floor(t1),
+											std::floor(t2)));
+}
+
 // ---------------------------------------------------------getHypoMax
 int CHypoList::getMaxAllowableHypoCount() const {
 	return (m_iMaxAllowableHypoCount);
@@ -1151,22 +1151,23 @@ bool CHypoList::findAndMergeMatchingHypos(std::shared_ptr<CHypo> hypo) {
 	}
 
 	std::string primaryID = hypo->getID();
-	char sLog[glass3::util::Logger::k_nMaxLogEntrySize];  // logging string
 	double distanceCut = CGlass::getHypoMergingDistanceWindow();
 	double timeCut = CGlass::getHypoMergingTimeWindow();
 	bool merged = false;
 
 	// Get the list of hypos to try merging with with
-	// (a potential hypo must be within time cut to consider)
+	// (a potential hypo must be within time cut and near enough to be within
+	// distance cut to consider)
 	std::vector<std::weak_ptr<CHypo>> mergeList = getHypos(
-			hypo->getTOrigin() - timeCut, hypo->getTOrigin() + timeCut);
+			hypo->getTOrigin() - timeCut, hypo->getTOrigin() + timeCut,
+			hypo->getGeo(), distanceCut);
 
 	setThreadHealth();
 
 	// make sure we got hypos returned
 	if (mergeList.size() == 0) {
 		// Log that there were no other events close enough to merge with
-		snprintf(sLog, sizeof(sLog),
+		GLASS3_LOG_DEBUG_FORMAT(
 					"CHypoList::findAndMergeMatchingHypos: No hypos in merge "
 					"window %s to %s for %s (%s)",
 					glass3::util::Date::encodeDateTime(
@@ -1176,7 +1177,6 @@ bool CHypoList::findAndMergeMatchingHypos(std::shared_ptr<CHypo> hypo) {
 					hypo->getID().c_str(),
 					glass3::util::Date::encodeDateTime(
 						hypo->getTOrigin()).c_str());
-		glass3::util::Logger::log(sLog);
 		return (merged);
 	} else {
 		// snprintf(sLog, sizeof(sLog),
@@ -1218,46 +1218,23 @@ bool CHypoList::findAndMergeMatchingHypos(std::shared_ptr<CHypo> hypo) {
 			continue;
 		}
 
-		snprintf(
-				sLog, sizeof(sLog),
+		GLASS3_LOG_DEBUG_FORMAT(
 				"CHypoList::findAndMergeMatchingHypos: Testing merger of"
 				" hypo %s and %s",
 				primaryID.c_str(), currentID.c_str());
-		glass3::util::Logger::log(sLog);
-
-		// lock ahypo for processing (we already have hypo locked)
-		// (couldn't get try_lock_until to build)
-		int tryCount = 0;
-		std::unique_lock<std::mutex> lock(aHypo->getProcessingMutex(),
-											std::defer_lock);
-
-		// loop for awhile trying to get lock
-		while (!lock.try_lock()) {
-			tryCount++;
-			if (tryCount <= 5) {
-				// didn't get lock, wait a bit
-				std::this_thread::sleep_for(
-								std::chrono::milliseconds(100));
-				setThreadHealth();
-			} else {
-				break;
-			}
-		}
 
-		// last try
-		if (!lock.owns_lock()) {
-			if (!lock.try_lock()) {
-				// didn't get it, give up
-				snprintf(sLog, sizeof(sLog),
-							"CHypoList::findAndMergeMatchingHypos: could not"
-							" lock %s for merging after 500ms, continuing.",
-							currentID.c_str());
-				glass3::util::Logger::log(sLog);
-
-				// we don't have this hypo locked
-				// move on
-				continue;
-			}
+		// claim ahypo for processing (we already have hypo claimed), if
+		// another thread has it, it will requeue ahypo when it is done,
+		// which will try this merge again from the other side
+		CHypoProcessingClaim aHypoClaim(aHypo, this);
+		if (aHypoClaim.ownsClaim() == false) {
+			GLASS3_LOG_DEBUG_FORMAT(
+						"CHypoList::findAndMergeMatchingHypos: %s is being"
+						" processed by another thread, deferring merge.",
+						currentID.c_str());
+
+			// move on
+			continue;
 		}
 
 		// prefer to merge into the hypo that has already been published
@@ -1289,7 +1266,7 @@ bool CHypoList::findAndMergeMatchingHypos(std::shared_ptr<CHypo> hypo) {
 		}
 
 		// Log info on the two hypos
-		snprintf(sLog, sizeof(sLog),
+		GLASS3_LOG_DEBUG_FORMAT(
 				"CHypoList::findAndMergeMatchingHypos: intoHypo:%s lat:%.3f, "
 				"lon:%.3f, depth:%.3f, time:%s, bayes: %.3f, nPicks:%d "
 				"created: %.3f, pub: %s",
@@ -1300,9 +1277,8 @@ bool CHypoList::findAndMergeMatchingHypos(std::shared_ptr<CHypo> hypo) {
 				static_cast<int>(intoHypo->getPickData().size()),
 				intoHypo->getTCreate(),
 				intoHypo->getHypoGenerated() ? "true" : "false");
-		glass3::util::Logger::log(sLog);
 
-		snprintf(sLog, sizeof(sLog),
+		GLASS3_LOG_DEBUG_FORMAT(
 				"CHypoList::findAndMergeMatchingHypos: fromHypo:%s lat:%.3f, "
 				"lon:%.3f, depth:%.3f, time:%s, bayes: %.3f, nPicks:%d "
 				"created: %.3f, pub: %s",
@@ -1313,7 +1289,6 @@ bool CHypoList::findAndMergeMatchingHypos(std::shared_ptr<CHypo> hypo) {
 				static_cast<int>(fromHypo->getPickData().size()),
 				fromHypo->getTCreate(),
 				fromHypo->getHypoGenerated() ? "true" : "false");
-		glass3::util::Logger::log(sLog);
 
 		// get geo objects
 		glass3::util::Geo fromGeo;
@@ -1332,13 +1307,12 @@ bool CHypoList::findAndMergeMatchingHypos(std::shared_ptr<CHypo> hypo) {
 		// check distance between hypos
 		if (distanceDiff > distanceCut) {
 			// didn't get it, give up
-			snprintf(sLog, sizeof(sLog),
+			GLASS3_LOG_DEBUG_FORMAT(
 						"CHypoList::findAndMergeMatchingHypos: distance"
 						" between fromHypo %s into intoHypo %s is %.3f"
 						" which is greater than cutoff %.3f, continuing",
 						fromHypo->getID().c_str(), intoHypo->getID().c_str(),
 						distanceDiff, distanceCut);
-			glass3::util::Logger::log(sLog);
 			continue;
 		}
 
@@ -1346,21 +1320,19 @@ bool CHypoList::findAndMergeMatchingHypos(std::shared_ptr<CHypo> hypo) {
 		// we know they're not sharing picks.
 		intoHypo->pruneData(this);
 		resolveData(intoHypo);
-		snprintf(sLog, sizeof(sLog),
+		GLASS3_LOG_DEBUG_FORMAT(
 				"CHypoList::findAndMergeMatchingHypos: %d picks"
 				" in intoHypo %s after resolve",
 				static_cast<int>(intoHypo->getPickData().size()),
 				intoHypo->getID().c_str());
-		glass3::util::Logger::log(sLog);
 
 		fromHypo->pruneData(this);
 		resolveData(fromHypo);
-		snprintf(sLog, sizeof(sLog),
+		GLASS3_LOG_DEBUG_FORMAT(
 				"CHypoList::findAndMergeMatchingHypos: %d picks"
 				" in fromHypo %s after resolve",
 				static_cast<int>(fromHypo->getPickData().size()),
 				fromHypo->getID().c_str());
-		glass3::util::Logger::log(sLog);
 
 		// check hypos to see if resolve removed enough
 		// of the picks to kill the hypo,
@@ -1389,21 +1361,19 @@ bool CHypoList::findAndMergeMatchingHypos(std::shared_ptr<CHypo> hypo) {
 			// if we've removed the primary hypo
 			// we're done with findAndMerge
 			if (hypo->getID() == "") {
-				snprintf(sLog, sizeof(sLog),
+				GLASS3_LOG_DEBUG_FORMAT(
 					"CHypoList::findAndMergeMatchingHypos: Primary"
 					" hypo %s removed, (0 phases after resolve)"
 					" returning", primaryID.c_str());
-				glass3::util::Logger::log(sLog);
 
 				return(merged);
 			} else {
 				// otherwise continue on
 				// to the next hypo in the merge list
-				snprintf(sLog, sizeof(sLog),
+				GLASS3_LOG_DEBUG_FORMAT(
 					"CHypoList::findAndMergeMatchingHypos: "
 					" Current Hypo %s removed, (0 phases after"
 					" resolve) continuing", currentID.c_str());
-				glass3::util::Logger::log(sLog);
 				continue;
 			}
 		}
@@ -1424,13 +1394,12 @@ bool CHypoList::findAndMergeMatchingHypos(std::shared_ptr<CHypo> hypo) {
 			}
 		}
 
-		snprintf(sLog, sizeof(sLog),
+		GLASS3_LOG_DEBUG_FORMAT(
 				"CHypoList::findAndMergeMatchingHypos: Added %d picks"
 				" from fromHypo %s to intoHypo %s fromHypo pick count"
 				" now %d", addPickCount, fromHypo->getID().c_str(),
 				intoHypo->getID().c_str(),
 				static_cast<int>(intoHypo->getPickData().size()));
-		glass3::util::Logger::log(sLog);
 
 		// initial localization attempt of intoHypo after adding picks
 		intoHypo->localize();
@@ -1441,12 +1410,11 @@ bool CHypoList::findAndMergeMatchingHypos(std::shared_ptr<CHypo> hypo) {
 			intoHypo->localize();
 		}
 
-		snprintf(sLog, sizeof(sLog),
+		GLASS3_LOG_DEBUG_FORMAT(
 				"CHypoList::findAndMergeMatchingHypos: %d picks"
 				" in intoHypo %s after localize and prune",
 				static_cast<int>(intoHypo->getPickData().size()),
 				intoHypo->getID().c_str());
-		glass3::util::Logger::log(sLog);
 
 		setThreadHealth();
 
@@ -1456,28 +1424,24 @@ bool CHypoList::findAndMergeMatchingHypos(std::shared_ptr<CHypo> hypo) {
 							+ (k_dMergeStackImprovementRatio
 							* std::min(intoBayes, fromBayes));
 
-		snprintf(
-				sLog, sizeof(sLog),
+		GLASS3_LOG_DEBUG_FORMAT(
 				"CHypoList::findAndMergeMatchingHypos: Merge Check:"
 				" newBayes:%.3f > threshold:%.3f, else"
 				" newBayes:%.3f >= intoHypo Bayes:%.3f"
 				" (* k_dMinimumRoundingProtectionRatio)",
 				newBayes, threshold, newBayes,
 				(intoBayes * k_dMinimumRoundingProtectionRatio));
-		glass3::util::Logger::log(sLog);
 
 		// check that the new bayes is better than either of the original
 		// bayes values
 		if (newBayes > threshold) {
-			snprintf(
-					sLog, sizeof(sLog),
+			GLASS3_LOG_DEBUG_FORMAT(
 					"CHypoList::findAndMergeMatchingHypos: merged fromHypo "
 					"%s into intoHypo %s because intoHypo is better "
 					"than fromHypo and original intoHypo, newBayes:%.3f > "
 					"intoHypo Bayes:%.3f, fromHypo bayes:%.3f",
 					fromHypo->getID().c_str(), intoHypo->getID().c_str(),
 					newBayes, intoBayes, fromBayes);
-			glass3::util::Logger::log(sLog);
 
 			if (fromHypo->getTCreate() < intoHypo->getTCreate()) {
 				intoHypo->setTCreate(fromHypo->getTCreate());
@@ -1519,15 +1483,12 @@ bool CHypoList::findAndMergeMatchingHypos(std::shared_ptr<CHypo> hypo) {
 
 			// check to see if fromHypo is still healthy
 			if (fromHypo->cancelCheck()) {
-				snprintf(
-						sLog,
-						sizeof(sLog),
+				GLASS3_LOG_DEBUG_FORMAT(
 						"CHypoList::findAndMergeMatchingHypos: merged "
 						"fromHypo %s into intoHypo %s because fromHypo failed "
 						"cancelCheck, intoHypo:Bayes %.3f, fromHypo:bayes %.3f",
 						fromHypo->getID().c_str(), intoHypo->getID().c_str(),
 						intoHypo->getBayesValue(), fromHypo->getBayesValue());
-				glass3::util::Logger::log(sLog);
 
 				if (fromHypo->getTCreate() < intoHypo->getTCreate()) {
 					intoHypo->setTCreate(fromHypo->getTCreate());
@@ -1554,26 +1515,21 @@ bool CHypoList::findAndMergeMatchingHypos(std::shared_ptr<CHypo> hypo) {
 
 				// the merged hypo (intoHypo) was not better, revert intoHypo.
 				// and fromHypo
-				snprintf(
-						sLog, sizeof(sLog),
+				GLASS3_LOG_DEBUG_FORMAT(
 						"CHypoList::findAndMergeMatchingHypos: keeping "
 						"modified hypos %s and %s because fromHypo passed "
 						"cancelCheck, intoHypo Bayes:%.3f, fromHypo "
 						"bayes:%.3f",
 						intoHypo->getID().c_str(), fromHypo->getID().c_str(),
 						intoHypo->getBayesValue(), fromHypo->getBayesValue());
-				glass3::util::Logger::log(sLog);
 			}  // end else (fromHypo->cancelCheck())
 		} else {
 			// the merged hypo (intoHypo) was not better, revert intoHypo.
-			snprintf(
-					sLog,
-					sizeof(sLog),
+			GLASS3_LOG_DEBUG_FORMAT(
 					"CHypoList::findAndMergeMatchingHypos: reverting original "
 					"hypo %s, newBayes:%.3f, intoHypo Bayes:%.3f",
 					intoHypo->getID().c_str(),
 					newBayes, intoBayes);
-			glass3::util::Logger::log(sLog);
 
 			// reset intoHypo to where it was
 			intoHypo->clearPickReferences();
@@ -1586,6 +1542,10 @@ bool CHypoList::findAndMergeMatchingHypos(std::shared_ptr<CHypo> hypo) {
 			// relocate intoHypo
 			intoHypo->localize();
 		}  // end else is toHypoBetter
+
+		// the candidate may have been relocated, reposition it in the list
+		// if it is still around (hypo is repositioned by work())
+		updatePosition(aHypo);
 	}
 
 	// return whether we've merged anything
@@ -1597,13 +1557,12 @@ int CHypoList::appendToHypoProcessingQueue(std::shared_ptr<CHypo> hyp) {
 	// don't use a lock guard for queue mutex and vhypolist mutex,
 	// to avoid a deadlock when both mutexes are locked
 	m_HypoProcessingQueueMutex.lock();
-	int size = m_lHypoProcessingQueue.size();
+	int size = m_mHypoProcessingQueue.size();
 	m_HypoProcessingQueueMutex.unlock();
 
 	// nullcheck
 	if (hyp == NULL) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CHypoList::appendToHypoProcessingQueue: NULL hypo provided.");
 		return (size);
 	}
@@ -1617,7 +1576,7 @@ int CHypoList::appendToHypoProcessingQueue(std::shared_ptr<CHypo> hyp) {
 
 	// use the map to get see if this hypo is even on the hypo list
 	m_HypoListMutex.lock();
-	if (m_mHypo[pid] == NULL) {
+	if (m_mHypo.find(hyp->getIDHandle()) == m_mHypo.end()) {
 		// it's not, we can't really process a hypo we don't have
 		m_HypoListMutex.unlock();
 
@@ -1627,28 +1586,50 @@ int CHypoList::appendToHypoProcessingQueue(std::shared_ptr<CHypo> hyp) {
 
 	setThreadHealth();
 
+	// compute the priority before locking the queue, it reads the hypo
+	double priority = getHypoQueuePriority(hyp);
+
 	// is this id already on the queue?
+	unsigned int handle = hyp->getIDHandle();
 	m_HypoProcessingQueueMutex.lock();
-	for (std::list<std::weak_ptr<CHypo>>::iterator it = m_lHypoProcessingQueue
-			.begin(); it != m_lHypoProcessingQueue.end(); ++it) {
-		std::shared_ptr<CHypo> aHyp = (*it).lock();
-
-		if ((aHyp != NULL) && (aHyp->getID() == hyp->getID())) {
-			// found it, don't bother adding it again
+	auto queued = m_mQueuedHypos.find(handle);
+	if (queued != m_mQueuedHypos.end()) {
+		if (queued->second->second.second.lock() == hyp) {
+			// found it, don't bother adding it again, but move it if its
+			// priority has changed
+			std::pair<double, uint64_t> key = queued->second->first;
+			if (key.first != priority) {
+				m_mHypoProcessingQueue.erase(queued->second);
+				key.first = priority;
+				queued->second = m_mHypoProcessingQueue.insert(
+						std::make_pair(key, std::make_pair(
+								handle, std::weak_ptr<CHypo>(hyp)))).first;
+			}
 			m_HypoProcessingQueueMutex.unlock();
 			return (size);
 		}
+
+		// the entry was left by a hypo that is gone and whose handle has
+		// been reused, replace it
+		m_mHypoProcessingQueue.erase(queued->second);
+		m_mQueuedHypos.erase(queued);
+		size--;
 	}
 
-	// add to queue (FIFO)
-	m_lHypoProcessingQueue.push_back(std::weak_ptr<CHypo>(hyp));
+	// add to queue
+	m_mQueuedHypos[handle] = m_mHypoProcessingQueue.insert(
+			std::make_pair(std::make_pair(priority, m_iHypoQueueSequence++),
+							std::make_pair(handle, std::weak_ptr<CHypo>(hyp))))
+			.first;
 
 	// added one
 	size++;
 	m_HypoProcessingQueueMutex.unlock();
 
-	glass3::util::Logger::log(
-			"debug",
+	// wake an idle hypo processing thread
+	wakeUp();
+
+	GLASS3_LOG_DEBUG(
 			"CHypoList::appendToHypoProcessingQueue: sPid:" + pid + " "
 					+ std::to_string(size) + " hypos in queue.");
 
@@ -1660,20 +1641,20 @@ std::shared_ptr<CHypo> CHypoList::getNextHypoFromProcessingQueue() {
 	std::lock_guard<std::mutex> queueGuard(m_HypoProcessingQueueMutex);
 
 	// is there anything on the queue?
-	if (m_lHypoProcessingQueue.size() == 0) {
+	if (m_mHypoProcessingQueue.size() == 0) {
 		// nope
 		return (NULL);
 	}
 
-	// Pop first hypocenter off processing queue (FIFO)
-	std::list<std::weak_ptr<CHypo>>::iterator it =
-			m_lHypoProcessingQueue.begin();
-	while (it != m_lHypoProcessingQueue.end()) {
-		// get the next hypo in the vector
-		std::shared_ptr<CHypo> hyp = (*it).lock();
+	// Pop the highest priority hypocenter off processing queue
+	HypoQueue::iterator it = m_mHypoProcessingQueue.begin();
+	while (it != m_mHypoProcessingQueue.end()) {
+		// get the next hypo in the queue
+		std::shared_ptr<CHypo> hyp = it->second.second.lock();
 
 		// one way or another we're done with this hypo
-		it = m_lHypoProcessingQueue.erase(it);
+		m_mQueuedHypos.erase(it->second.first);
+		it = m_mHypoProcessingQueue.erase(it);
 
 		// is it valid?
 		if ((hyp != NULL) && (hyp->getID() != "")) {
@@ -1685,12 +1666,49 @@ std::shared_ptr<CHypo> CHypoList::getNextHypoFromProcessingQueue() {
 	return (NULL);
 }
 
+// -----------------------------------------------------isOnHypoProcessingQueue
+bool CHypoList::isOnHypoProcessingQueue(std::shared_ptr<CHypo> hyp) {
+	if ((hyp == NULL) || (hyp->getID() == "")) {
+		return (false);
+	}
+
+	std::lock_guard<std::mutex> queueGuard(m_HypoProcessingQueueMutex);
+	return (m_mQueuedHypos.count(hyp->getIDHandle()) > 0);
+}
+
+// ----------------------------------------------removeFromHypoProcessingQueue
+void CHypoList::removeFromHypoProcessingQueue(std::shared_ptr<CHypo> hyp) {
+	std::lock_guard<std::mutex> queueGuard(m_HypoProcessingQueueMutex);
+
+	// the handle may be reused once the hypo is gone, so don't leave it
+	// marked as queued
+	auto queued = m_mQueuedHypos.find(hyp->getIDHandle());
+	if (queued == m_mQueuedHypos.end()) {
+		return;
+	}
+
+	m_mHypoProcessingQueue.erase(queued->second);
+	m_mQueuedHypos.erase(queued);
+}
+
+// --------------------------------------------------------getHypoQueuePriority
+double CHypoList::getHypoQueuePriority(std::shared_ptr<CHypo> hyp) {
+	switch (CGlass::getHypoQueueOrder()) {
+		case HypoQueueOrder::LeastProcessedFirst:
+			return (static_cast<double>(hyp->getProcessCount()));
+		case HypoQueueOrder::HighestBayesFirst:
+			return (-hyp->getBayesValue());
+		default:
+			// first in first out, the order queued decides
+			return (0.0);
+	}
+}
+
 // ---------------------------------------------------------removeHypo
 void CHypoList::removeHypo(std::shared_ptr<CHypo> hypo, bool reportCancel) {
 	// nullchecks
 	if (hypo == NULL) {
-		glass3::util::Logger::log(
-				"error", "CHypoList::removeHypo: NULL hypo provided.");
+		GLASS3_LOG_ERROR("CHypoList::removeHypo: NULL hypo provided.");
 		return;
 	}
 	if (hypo->getID() == "") {
@@ -1700,8 +1718,7 @@ void CHypoList::removeHypo(std::shared_ptr<CHypo> hypo, bool reportCancel) {
 	// log performance info
 	const HypoAuditingPerformanceStruct * perfInfo = hypo
 			->getHypoAuditingPerformanceInfo();
-	glass3::util::Logger::log(
-			"info",
+	GLASS3_LOG_INFO(
 			"CHypoList::removeHypo Final Audit for: " + hypo->getID() + " "
 					+ std::to_string(hypo->getLatitude()) + " "
 					+ std::to_string(hypo->getLongitude()) + " "
@@ -1747,9 +1764,12 @@ void CHypoList::removeHypo(std::shared_ptr<CHypo> hypo, bool reportCancel) {
 
 	// erase this hypo from the map
 	m_HypoListMutex.lock();
-	m_mHypo.erase(hypo->getID());
+	m_mHypo.erase(hypo->getIDHandle());
 	m_HypoListMutex.unlock();
 
+	// and from the processing queue
+	removeFromHypoProcessingQueue(hypo);
+
 	setThreadHealth();
 
 	// clear all other hypo data
@@ -1763,8 +1783,7 @@ void CHypoList::removeHypo(std::shared_ptr<CHypo> hypo, bool reportCancel) {
 bool CHypoList::requestHypo(std::shared_ptr<json::Object> com) {
 	// null check json
 	if (com == NULL) {
-		glass3::util::Logger::log(
-				"error", "CHypoList::requestHypo: NULL json communication.");
+		GLASS3_LOG_ERROR("CHypoList::requestHypo: NULL json communication.");
 		return (false);
 	}
 
@@ -1774,8 +1793,7 @@ bool CHypoList::requestHypo(std::shared_ptr<json::Object> com) {
 		std::string cmd = (*com)["Cmd"].ToString();
 
 		if (cmd != "ReqHypo") {
-			glass3::util::Logger::log(
-					"warning",
+			GLASS3_LOG_WARNING(
 					"HypoList::requestHypo: Non-requestHypo message passed in.");
 			return (false);
 		}
@@ -1784,14 +1802,12 @@ bool CHypoList::requestHypo(std::shared_ptr<json::Object> com) {
 		std::string type = (*com)["Type"].ToString();
 
 		if (type != "requestHypo") {
-			glass3::util::Logger::log(
-					"warning",
+			GLASS3_LOG_WARNING(
 					"HypoList::requestHypo: Non-requestHypo message passed in.");
 			return (false);
 		}
 	} else {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"HypoList::requestHypo: Missing required Cmd or Type Key.");
 		return (false);
 	}
@@ -1802,20 +1818,22 @@ bool CHypoList::requestHypo(std::shared_ptr<json::Object> com) {
 			&& ((*com)["Pid"].GetType() == json::ValueType::StringVal)) {
 		sPid = (*com)["Pid"].ToString();
 	} else {
-		glass3::util::Logger::log(
-				"error", "HypoList::requestHypo: Missing required Pid Key.");
+		GLASS3_LOG_ERROR("HypoList::requestHypo: Missing required Pid Key.");
 		return (false);
 	}
 
 	std::lock_guard<std::recursive_mutex> listGuard(m_HypoListMutex);
 
 	// get the hypo
-	std::shared_ptr<CHypo> hyp = m_mHypo[sPid];
+	std::shared_ptr<CHypo> hyp;
+	auto found = m_mHypo.find(glass3::util::InternedID::findHandle(sPid));
+	if (found != m_mHypo.end()) {
+		hyp = found->second;
+	}
 
 	// check the hypo
 	if (!hyp) {
-		glass3::util::Logger::log(
-				"warning",
+		GLASS3_LOG_WARNING(
 				"HypoList::requestHypo: Could not find hypo for pid " + sPid);
 
 		// return true even if we didn't find anything, since
@@ -1827,6 +1845,9 @@ bool CHypoList::requestHypo(std::shared_ptr<json::Object> com) {
 	if (resolveData(hyp)) {
 		// relocate the hypo
 		hyp->localize();
+
+		// reposition the hypo in the list
+		updatePosition(hyp);
 	}
 
 	// generate the hypo message
@@ -1840,8 +1861,7 @@ bool CHypoList::requestHypo(std::shared_ptr<json::Object> com) {
 bool CHypoList::resolveData(std::shared_ptr<CHypo> hyp, bool allowStealing) {
 	// null checks
 	if (hyp == NULL) {
-		glass3::util::Logger::log("warning",
-									"CHypoList::resolve: NULL hypo provided.");
+		GLASS3_LOG_WARNING("CHypoList::resolve: NULL hypo provided.");
 
 		return (false);
 	}
@@ -1887,6 +1907,9 @@ void CHypoList::updatePosition(std::shared_ptr<CHypo> hyp) {
 
 	// insert
 	m_msHypoList.insert(hyp);
+
+	// refresh the hypo's location, time, and cutoff in the index
+	m_HypoIndex.addHypo(hyp);
 }
 
 // ---------------------------------------------------------updatePosition
@@ -1903,6 +1926,8 @@ void CHypoList::eraseFromMultiset(std::shared_ptr<CHypo> hyp) {
 
 	setThreadHealth();
 
+	m_HypoIndex.removeHypo(hyp);
+
 	if (m_msHypoList.size() == 0) {
 		return;
 	}
@@ -1930,8 +1955,7 @@ void CHypoList::eraseFromMultiset(std::shared_ptr<CHypo> hyp) {
 		}
 	}
 
-	glass3::util::Logger::log(
-			"warning",
+	GLASS3_LOG_WARNING(
 			"CHypoList::eraseFromMultiset: efficient delete for hypo "
 					+ hyp->getID() + " didn't work.");
 
@@ -1951,9 +1975,41 @@ void CHypoList::eraseFromMultiset(std::shared_ptr<CHypo> hyp) {
 		}
 	}
 
-	glass3::util::Logger::log(
-			"error",
+	GLASS3_LOG_ERROR(
 			"CHypoList::eraseFromMultiset: did not delete hypo " + hyp->getID()
 					+ " in multiset, id not found.");
 }
+// ------------------------------------------------------CHypoProcessingClaim
+CHypoProcessingClaim::CHypoProcessingClaim(std::shared_ptr<CHypo> hypo,
+											CHypoList *hypoList)
+		: m_pHypo(hypo),
+		  m_pHypoList(hypoList),
+		  m_bOwnsClaim(false) {
+	if (m_pHypo == NULL) {
+		return;
+	}
+
+	if (m_pHypo->claimForProcessing() == true) {
+		m_bOwnsClaim = true;
+	} else {
+		m_bOwnsClaim = m_pHypo->deferProcessing();
+	}
+}
+
+// -----------------------------------------------------~CHypoProcessingClaim
+CHypoProcessingClaim::~CHypoProcessingClaim() {
+	if (m_bOwnsClaim == false) {
+		return;
+	}
+
+	// requeue the hypo if another thread wanted it while we had it
+	if ((m_pHypo->releaseProcessingClaim() == true) && (m_pHypoList != NULL)) {
+		m_pHypoList->appendToHypoProcessingQueue(m_pHypo);
+	}
+}
+
+// ---------------------------------------------------------ownsClaim
+bool CHypoProcessingClaim::ownsClaim() const {
+	return (m_bOwnsClaim);
+}
 }  // namespace glasscore
@@ -28,28 +28,6 @@ constexpr double CNode::k_dDepthShellResolutionKm;
 constexpr double CNode::k_dGridPointVsResolutionRatio;
 constexpr double CNode::k_residualDistanceAllowanceFactor;
 
-// site Link sorting function
-// Compares site links using travel times
-bool sortSiteLink(const SiteLink &lhs, const SiteLink &rhs) {
-	double travelTime1 = std::get < LINK_TT1 > (lhs);
-	if (travelTime1 < 0) {
-		travelTime1 = std::get < LINK_TT2 > (lhs);
-	}
-
-	double travelTime2 = std::get < LINK_TT1 > (rhs);
-	if (travelTime2 < 0) {
-		travelTime2 = std::get < LINK_TT2 > (rhs);
-	}
-
-	// compare
-	if (travelTime1 < travelTime2) {
-		return (true);
-	}
-
-	// travelTime2 > travelTime1
-	return (false);
-}
-
 // ---------------------------------------------------------CNode
 CNode::CNode() {
 	clear();
@@ -82,6 +60,8 @@ void CNode::clear() {
 	m_dMaxDepth = 0;
 	m_bEnabled = false;
 	m_bAseismic = false;
+	m_bCoarse = false;
+	m_pParentNode = NULL;
 	m_SourceSet.clear();
 }
 
@@ -92,18 +72,22 @@ void CNode::clearSiteLinks() {
 
 	m_dMaxSiteDistance = 0;
 
-	if (m_vSiteLinkList.size() == 0) {
+	if (m_vSiteLinkSites.size() == 0) {
 		return;
 	}
 
 	// remove any links that sites have TO this node
-	for (auto &link : m_vSiteLinkList) {
-		std::shared_ptr<CSite> aSite = std::get < LINK_PTR > (link);
+	for (auto &aSite : m_vSiteLinkSites) {
 		aSite->removeNode(getID());
 	}
 
 	// remove all the links from this node to sites
-	m_vSiteLinkList.clear();
+	m_vSiteLinkSites.clear();
+	m_vSiteLinkTravelTime1.clear();
+	m_vSiteLinkTravelTime2.clear();
+	m_vSiteLinkPhaseID1.clear();
+	m_vSiteLinkPhaseID2.clear();
+	m_vSiteLinkDistances.clear();
 }
 
 // ---------------------------------------------------------initialize
@@ -132,14 +116,12 @@ bool CNode::linkSite(std::shared_ptr<CSite> site, std::shared_ptr<CNode> node,
 	// nullchecks
 	// check site
 	if (site == NULL) {
-		glass3::util::Logger::log("error",
-									"CNode::linkSite: NULL site pointer.");
+		GLASS3_LOG_ERROR("CNode::linkSite: NULL site pointer.");
 		return (false);
 	}
 	// check node
 	if (node == NULL) {
-		glass3::util::Logger::log("error",
-									"CNode::linkSite: NULL node pointer.");
+		GLASS3_LOG_ERROR("CNode::linkSite: NULL node pointer.");
 		return (false);
 	}
 
@@ -148,9 +130,12 @@ bool CNode::linkSite(std::shared_ptr<CSite> site, std::shared_ptr<CNode> node,
 
 	// Link node to site using traveltime
 	// NOTE: No validation on travel times or distance
-	SiteLink link = std::make_tuple(site, travelTime1, phase1, travelTime2,
-									phase2, distDeg);
-	m_vSiteLinkList.push_back(link);
+	m_vSiteLinkSites.push_back(site);
+	m_vSiteLinkTravelTime1.push_back(travelTime1);
+	m_vSiteLinkTravelTime2.push_back(travelTime2);
+	m_vSiteLinkPhaseID1.push_back(traveltime::CTravelTime::getPhaseID(phase1));
+	m_vSiteLinkPhaseID2.push_back(traveltime::CTravelTime::getPhaseID(phase2));
+	m_vSiteLinkDistances.push_back(distDeg);
 
 	// link site to node, again using the traveltime
 	// NOTE: this used to be site->addNode(shared_ptr<CNode>(this), tt);
@@ -170,55 +155,22 @@ bool CNode::unlinkSite(std::shared_ptr<CSite> site) {
 	// nullchecks
 	// check site
 	if (site == NULL) {
-		glass3::util::Logger::log("error",
-									"CNode::unlinkSite: NULL site pointer.");
+		GLASS3_LOG_ERROR("CNode::unlinkSite: NULL site pointer.");
 		return (false);
 	}
 
-	// lock while searching / modifing vSite
+	// lock while searching / modifing the site links
 	m_SiteLinkListMutex.lock();
 
 	// search through each site linked to this node
-	bool found = false;
-	SiteLink foundLink;
-	std::shared_ptr<CSite> foundSite;
-	for (const auto &link : m_vSiteLinkList) {
-		// get the site
-		std::shared_ptr<CSite> currentSite = std::get < LINK_PTR > (link);
-
-		// if the new station would be before
-		// the current station
-		if (currentSite == site) {
-			found = true;
-			foundLink = link;
-			foundSite = currentSite;
-
-			// done
-			break;
-		}
-	}
+	for (int i = 0; i < static_cast<int>(m_vSiteLinkSites.size()); i++) {
+		if (m_vSiteLinkSites[i] == site) {
+			std::shared_ptr<CSite> foundSite = m_vSiteLinkSites[i];
 
-	if (found == true) {
-		// find site iterator to remove
-		auto it = std::find(m_vSiteLinkList.begin(), m_vSiteLinkList.end(),
-							foundLink);
-		if (it != m_vSiteLinkList.end()) {
-			// remove site
 			// unlink site from node
-			m_vSiteLinkList.erase(it);
-
-			// recompute furthest site distance
-			m_dMaxSiteDistance = 0;
-			for (const auto &link : m_vSiteLinkList) {
-				// get the distance
-				double distDeg = std::get < LINK_DIST > (link);
+			eraseSiteLink(i);
 
-				if (distDeg > m_dMaxSiteDistance) {
-					m_dMaxSiteDistance = distDeg;
-				}
-			}
-
-			// done modifying vSite
+			// done modifying the site links
 			m_SiteLinkListMutex.unlock();
 
 			// unlink node from site
@@ -251,21 +203,33 @@ bool CNode::unlinkLastSite() {
 	// lock mutex for this scope
 	std::lock_guard < std::mutex > guard(m_SiteLinkListMutex);
 
+	// the list may have changed while unlocked
+	if (m_vSiteLinkSites.size() == 0) {
+		return (false);
+	}
+
 	// unlink last site from node
-	m_vSiteLinkList.pop_back();
+	eraseSiteLink(m_vSiteLinkSites.size() - 1);
+
+	return (true);
+}
+
+// ---------------------------------------------------------eraseSiteLink
+void CNode::eraseSiteLink(int index) {
+	m_vSiteLinkSites.erase(m_vSiteLinkSites.begin() + index);
+	m_vSiteLinkTravelTime1.erase(m_vSiteLinkTravelTime1.begin() + index);
+	m_vSiteLinkTravelTime2.erase(m_vSiteLinkTravelTime2.begin() + index);
+	m_vSiteLinkPhaseID1.erase(m_vSiteLinkPhaseID1.begin() + index);
+	m_vSiteLinkPhaseID2.erase(m_vSiteLinkPhaseID2.begin() + index);
+	m_vSiteLinkDistances.erase(m_vSiteLinkDistances.begin() + index);
 
 	// recompute furthest site distance
 	m_dMaxSiteDistance = 0;
-	for (const auto &link : m_vSiteLinkList) {
-		// get the distance
-		double distDeg = std::get < LINK_DIST > (link);
-
+	for (const auto &distDeg : m_vSiteLinkDistances) {
 		if (distDeg > m_dMaxSiteDistance) {
 			m_dMaxSiteDistance = distDeg;
 		}
 	}
-
-	return (true);
 }
 
 // ---------------------------------------------------------nucleate
@@ -280,8 +244,7 @@ std::shared_ptr<CTrigger> CNode::nucleate(double tOrigin,
 	// nullchecks
 	// check web
 	if (m_pWeb == NULL) {
-		glass3::util::Logger::log("error",
-									"CNode::nucleate: NULL web pointer.");
+		GLASS3_LOG_ERROR("CNode::nucleate: NULL web pointer.");
 		return (NULL);
 	}
 
@@ -296,6 +259,13 @@ std::shared_ptr<CTrigger> CNode::nucleate(double tOrigin,
 		dThresh = m_pWeb->getASeismicNucleationStackThreshold();
 	}
 
+	// coarse nodes only screen their children, so use relaxed thresholds
+	if (m_bCoarse == true) {
+		nCut = static_cast<int>(std::floor(
+				nCut * m_pWeb->getCoarseThresholdFactor()));
+		dThresh *= m_pWeb->getCoarseThresholdFactor();
+	}
+
 	double dAzimuthRange = CGlass::getBeamMatchingAzimuthWindow();
 	// commented out because slowness matching of beams is not yet implemented
 	// but is scheduled to be soon
@@ -308,13 +278,17 @@ std::shared_ptr<CTrigger> CNode::nucleate(double tOrigin,
 
 	std::vector < std::shared_ptr < CPick >> vPick;
 
+	// the picks in the window at each site, reused for every site
+	std::vector < std::shared_ptr < CPick >> sitePicks;
+
 	// lock mutex for this scope (iterating through the site links)
 	std::lock_guard < std::mutex > guard(m_SiteLinkListMutex);
 
 	bool haltNucleation = false;
 
 	// search through each site linked to this node
-	for (const auto &link : m_vSiteLinkList) {
+	int numSiteLinks = m_vSiteLinkSites.size();
+	for (int linkIndex = 0; linkIndex < numSiteLinks; linkIndex++) {
 		// halt nucleation if the node has been disabled
 		if (m_bEnabled == false) {
 			haltNucleation = true;
@@ -333,8 +307,8 @@ std::shared_ptr<CTrigger> CNode::nucleate(double tOrigin,
 		std::shared_ptr<CPick> pickBest_phase1;
 		std::shared_ptr<CPick> pickBest_phase2;
 
-		// get shared pointer to site
-		std::shared_ptr<CSite> site = std::get < LINK_PTR > (link);
+		// get the site, by reference to avoid touching the reference count
+		const std::shared_ptr<CSite> &site = m_vSiteLinkSites[linkIndex];
 
 		// Ignore if station out of service
 		if (!site->getUse()) {
@@ -345,11 +319,9 @@ std::shared_ptr<CTrigger> CNode::nucleate(double tOrigin,
 		}
 
 		// get traveltime(s) to site
-		double travelTime1 = std::get < LINK_TT1 > (link);
-		std::string phase1 = std::get < LINK_PHS1 > (link);
-		double travelTime2 = std::get < LINK_TT2 > (link);
-		std::string phase2 = std::get < LINK_PHS2 > (link);
-		double distDeg = std::get < LINK_DIST > (link);
+		double travelTime1 = m_vSiteLinkTravelTime1[linkIndex];
+		double travelTime2 = m_vSiteLinkTravelTime2[linkIndex];
+		double distDeg = m_vSiteLinkDistances[linkIndex];
 
 		// the minimum and maximum time windows for picks
 		double min = 0.0;
@@ -390,8 +362,7 @@ std::shared_ptr<CTrigger> CNode::nucleate(double tOrigin,
 					+ (k_dTravelTimePickSelectionWindow / 2);
 		} else {
 			// no valid TTs
-			glass3::util::Logger::log(
-					"error", "CNode::nucleate: Bad Node Traveltimes while generating pick"
+			GLASS3_LOG_ERROR("CNode::nucleate: Bad Node Traveltimes while generating pick"
 					" SearchRange.");
 			continue;
 		}
@@ -409,20 +380,19 @@ std::shared_ptr<CTrigger> CNode::nucleate(double tOrigin,
 			}
 		}
 
-		// lock site pick list while we're extracting our picks
-		site->getPickMutex().lock();
+		// get the picks in the window at this site, this does not hold the
+		// site pick lock while we search through them
+		site->getPickWindow(min, max, &sitePicks);
+		int numSitePicks = sitePicks.size();
 
-		// compute bounds iterator
-		auto lower = site->getLower(min);
-
-		for (auto it = lower; (it != site->getEnd()); ++it) {
+		for (int pickIndex = 0; pickIndex < numSitePicks; pickIndex++) {
 			// halt nucleation if the node has been disabled
 			if (m_bEnabled == false) {
 				haltNucleation = true;
 				break;
 			}
 
-			auto pick = *it;
+			const std::shared_ptr<CPick> &pick = sitePicks[pickIndex];
 
 			bool phase1set = false;
 			bool phase2set = false;
@@ -536,6 +506,12 @@ std::shared_ptr<CTrigger> CNode::nucleate(double tOrigin,
 								> CGlass::getPickPhaseClassificationThreshold())) {
 					// check to see if the phase is classified as one of our
 					// nucleation phases
+					const std::string &phase1 =
+							traveltime::CTravelTime::getPhaseName(
+									m_vSiteLinkPhaseID1[linkIndex]);
+					const std::string &phase2 =
+							traveltime::CTravelTime::getPhaseName(
+									m_vSiteLinkPhaseID2[linkIndex]);
 					if (pick->getClassifiedPhase() == phase1) {
 						// match, we only consider traveltime1, disable
 						// traveltime2
@@ -627,8 +603,6 @@ std::shared_ptr<CTrigger> CNode::nucleate(double tOrigin,
 			}
 		}  // ---- end search through each pick at this site ----
 
-		site->getPickMutex().unlock();
-
 		// signal that we're still here
 		if (parentThread != NULL) {
 			parentThread->setThreadHealth();
@@ -752,10 +726,7 @@ std::shared_ptr<CSite> CNode::getSite(std::string siteID) {
 	// NOTE: could be made more efficient (faster)
 	// if we had a std::map
 	// for all sites
-	for (const auto &link : m_vSiteLinkList) {
-		// get the site
-		auto aSite = std::get < LINK_PTR > (link);
-
+	for (const auto &aSite : m_vSiteLinkSites) {
 		if (aSite->getSCNL() == siteID) {
 			// found
 			return (aSite);
@@ -775,8 +746,12 @@ std::shared_ptr<CSite> CNode::getLastSite() {
 	// lock mutex for this scope
 	std::lock_guard < std::mutex > guard(m_SiteLinkListMutex);
 
-	SiteLink lastLink = m_vSiteLinkList[m_vSiteLinkList.size() - 1];
-	std::shared_ptr<CSite> lastSite = std::get < LINK_PTR > (lastLink);
+	// the list may have changed while unlocked
+	if (m_vSiteLinkSites.size() == 0) {
+		return (NULL);
+	}
+
+	std::shared_ptr<CSite> lastSite = m_vSiteLinkSites.back();
 
 	// found
 	return (lastSite);
@@ -787,8 +762,57 @@ void CNode::sortSiteLinks() {
 	// lock mutex for this scope
 	std::lock_guard < std::mutex > guard(m_SiteLinkListMutex);
 
+	// sort the link indexes by travel time, using the second travel time when
+	// there is no first one
+	std::vector<double> travelTimes(m_vSiteLinkTravelTime1);
+	for (int i = 0; i < static_cast<int>(travelTimes.size()); i++) {
+		if (travelTimes[i] < 0) {
+			travelTimes[i] = m_vSiteLinkTravelTime2[i];
+		}
+	}
+
+	std::vector<int> order(travelTimes.size());
+	for (int i = 0; i < static_cast<int>(order.size()); i++) {
+		order[i] = i;
+	}
+	std::sort(order.begin(), order.end(), [&travelTimes](int lhs, int rhs) {
+		return (travelTimes[lhs] < travelTimes[rhs]);
+	});
+
 	// sort sites
-	sort(m_vSiteLinkList.begin(), m_vSiteLinkList.end(), sortSiteLink);
+	reorderSiteLinks(order);
+}
+
+// ---------------------------------------------------------reorderSiteLinks
+void CNode::reorderSiteLinks(const std::vector<int> &order) {
+	std::vector<std::shared_ptr<CSite>> sites;
+	std::vector<double> travelTimes1;
+	std::vector<double> travelTimes2;
+	std::vector<int> phaseIDs1;
+	std::vector<int> phaseIDs2;
+	std::vector<double> distances;
+	sites.reserve(order.size());
+	travelTimes1.reserve(order.size());
+	travelTimes2.reserve(order.size());
+	phaseIDs1.reserve(order.size());
+	phaseIDs2.reserve(order.size());
+	distances.reserve(order.size());
+
+	for (int index : order) {
+		sites.push_back(m_vSiteLinkSites[index]);
+		travelTimes1.push_back(m_vSiteLinkTravelTime1[index]);
+		travelTimes2.push_back(m_vSiteLinkTravelTime2[index]);
+		phaseIDs1.push_back(m_vSiteLinkPhaseID1[index]);
+		phaseIDs2.push_back(m_vSiteLinkPhaseID2[index]);
+		distances.push_back(m_vSiteLinkDistances[index]);
+	}
+
+	m_vSiteLinkSites.swap(sites);
+	m_vSiteLinkTravelTime1.swap(travelTimes1);
+	m_vSiteLinkTravelTime2.swap(travelTimes2);
+	m_vSiteLinkPhaseID1.swap(phaseIDs1);
+	m_vSiteLinkPhaseID2.swap(phaseIDs2);
+	m_vSiteLinkDistances.swap(distances);
 }
 
 // ---------------------------------------------------------getSitesString
@@ -798,9 +822,7 @@ std::string CNode::getSitesString() {
 	std::string siteString = "";
 
 	// write to station file
-	for (const auto &link : m_vSiteLinkList) {
-		// get the site
-		std::shared_ptr<CSite> currentSite = std::get < LINK_PTR > (link);
+	for (const auto &currentSite : m_vSiteLinkSites) {
 		double lat, lon, r;
 
 		currentSite->getGeo().getGeographic(&lat, &lon, &r);
@@ -817,7 +839,7 @@ std::string CNode::getSitesString() {
 int CNode::getSiteLinksCount() const {
 	// lock mutex for this scope
 	std::lock_guard < std::mutex > guard(m_SiteLinkListMutex);
-	return (m_vSiteLinkList.size());
+	return (m_vSiteLinkSites.size());
 }
 
 // ---------------------------------------------------------getEnabled
@@ -860,6 +882,26 @@ bool CNode::getAseismic() const {
 	return (m_bAseismic);
 }
 
+// ---------------------------------------------------------getCoarse
+bool CNode::getCoarse() const {
+	return (m_bCoarse);
+}
+
+// ---------------------------------------------------------setCoarse
+void CNode::setCoarse(bool coarse) {
+	m_bCoarse = coarse;
+}
+
+// ---------------------------------------------------------getParentNode
+CNode * CNode::getParentNode() const {
+	return (m_pParentNode);
+}
+
+// ---------------------------------------------------------setParentNode
+void CNode::setParentNode(CNode * parent) {
+	m_pParentNode = parent;
+}
+
 // ---------------------------------------------------------getGeo
 glass3::util::Geo CNode::getGeo() const {
 	glass3::util::Geo geoNode;
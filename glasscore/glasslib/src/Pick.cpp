@@ -28,12 +28,14 @@ constexpr double CPick::k_dNucleateInitialAnnealTimeStepSize;
 constexpr double CPick::k_dNucleateFinalAnnealTimeStepSize;
 
 // ---------------------------------------------------------CPick
-CPick::CPick() {
+CPick::CPick()
+		: m_iVersion(0) {
 	clear();
 }
 // ---------------------------------------------------------CPick
 CPick::CPick(std::shared_ptr<CSite> pickSite, double pickTime,
-				std::string pickIdString, double backAzimuth, double slowness) {
+				std::string pickIdString, double backAzimuth, double slowness)
+		: m_iVersion(0) {
 	initialize(pickSite, pickTime, pickIdString, "", backAzimuth, slowness, "",
 				std::numeric_limits<double>::quiet_NaN(),
 				std::numeric_limits<double>::quiet_NaN(),
@@ -53,7 +55,8 @@ CPick::CPick(std::shared_ptr<CSite> pickSite, double pickTime,
 				std::string phase, double phaseProb, double distance,
 				double distanceProb, double azimuth, double azimuthProb,
 				double depth, double depthProb, double magnitude,
-				double magnitudeProb) {
+				double magnitudeProb)
+		: m_iVersion(0) {
 	initialize(pickSite, pickTime, pickIdString, source, backAzimuth,
 				slowness, phase, phaseProb, distance, distanceProb,
 				azimuth, azimuthProb, depth, depthProb, magnitude,
@@ -61,13 +64,13 @@ CPick::CPick(std::shared_ptr<CSite> pickSite, double pickTime,
 }
 
 // ---------------------------------------------------------CPick
-CPick::CPick(std::shared_ptr<json::Object> pick, CSiteList *pSiteList) {
+CPick::CPick(std::shared_ptr<json::Object> pick, CSiteList *pSiteList)
+		: m_iVersion(0) {
 	clear();
 
 	// null check json
 	if (pick == NULL) {
-		glass3::util::Logger::log("error",
-									"CPick::CPick: NULL json communication.");
+		GLASS3_LOG_ERROR("CPick::CPick: NULL json communication.");
 		return;
 	}
 
@@ -77,15 +80,13 @@ CPick::CPick(std::shared_ptr<json::Object> pick, CSiteList *pSiteList) {
 		std::string type = (*pick)["Type"].ToString();
 
 		if (type != "Pick") {
-			glass3::util::Logger::log(
-					"warning",
+			GLASS3_LOG_WARNING(
 					"CPick::CPick: Non-Pick message passed in: "
 							+ json::Serialize(*pick));
 			return;
 		}
 	} else {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CPick::CPick: Missing required Type Key: "
 						+ json::Serialize(*pick));
 		return;
@@ -128,8 +129,7 @@ CPick::CPick(std::shared_ptr<json::Object> pick, CSiteList *pSiteList) {
 				&& (siteobj["Station"].GetType() == json::ValueType::StringVal)) {
 			sta = siteobj["Station"].ToString();
 		} else {
-			glass3::util::Logger::log(
-					"error",
+			GLASS3_LOG_ERROR(
 					"CPick::CPick: Missing required Station Key: "
 							+ json::Serialize(*pick));
 
@@ -149,8 +149,7 @@ CPick::CPick(std::shared_ptr<json::Object> pick, CSiteList *pSiteList) {
 				&& (siteobj["Network"].GetType() == json::ValueType::StringVal)) {
 			net = siteobj["Network"].ToString();
 		} else {
-			glass3::util::Logger::log(
-					"error",
+			GLASS3_LOG_ERROR(
 					"CPick::CPick: Missing required Network Key: "
 							+ json::Serialize(*pick));
 
@@ -166,8 +165,7 @@ CPick::CPick(std::shared_ptr<json::Object> pick, CSiteList *pSiteList) {
 		}
 	} else {
 		// no site key
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CPick::CPick: Missing required Site Key: "
 						+ json::Serialize(*pick));
 
@@ -181,8 +179,7 @@ CPick::CPick(std::shared_ptr<json::Object> pick, CSiteList *pSiteList) {
 
 	// check to see if we got a site
 	if (site == NULL) {
-		glass3::util::Logger::log(
-				"warning",
+		GLASS3_LOG_WARNING(
 				"CPick::CPick: Unknown site: " + json::Serialize(*pick));
 
 		return;
@@ -202,8 +199,7 @@ CPick::CPick(std::shared_ptr<json::Object> pick, CSiteList *pSiteList) {
 		glass3::util::Date dt = glass3::util::Date();
 		tPick = dt.decodeISO8601Time(ttt);
 	} else {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CPick::CPick: Missing required Time Key: "
 						+ json::Serialize(*pick));
 
@@ -216,8 +212,7 @@ CPick::CPick(std::shared_ptr<json::Object> pick, CSiteList *pSiteList) {
 			&& ((*pick)["ID"].GetType() == json::ValueType::StringVal)) {
 		pid = (*pick)["ID"].ToString();
 	} else {
-		glass3::util::Logger::log(
-				"warning",
+		GLASS3_LOG_WARNING(
 				"CPick::CPick: Missing required ID Key: "
 						+ json::Serialize(*pick));
 
@@ -236,8 +231,7 @@ CPick::CPick(std::shared_ptr<json::Object> pick, CSiteList *pSiteList) {
 						== json::ValueType::DoubleVal)) {
 			backAzimuth = beamobj["BackAzimuth"].ToDouble();
 		} else {
-			glass3::util::Logger::log(
-					"warning",
+			GLASS3_LOG_WARNING(
 					"CPick::CPick: Missing Beam BackAzimuth Key: "
 							+ json::Serialize(*pick));
 			backAzimuth = std::numeric_limits<double>::quiet_NaN();
@@ -248,8 +242,7 @@ CPick::CPick(std::shared_ptr<json::Object> pick, CSiteList *pSiteList) {
 				&& (beamobj["Slowness"].GetType() == json::ValueType::DoubleVal)) {
 			slowness = beamobj["Slowness"].ToDouble();
 		} else {
-			glass3::util::Logger::log(
-					"warning",
+			GLASS3_LOG_WARNING(
 					"CPick::CPick: Missing Beam Slowness Key: "
 							+ json::Serialize(*pick));
 			slowness = std::numeric_limits<double>::quiet_NaN();
@@ -389,8 +382,7 @@ CPick::CPick(std::shared_ptr<json::Object> pick, CSiteList *pSiteList) {
 					classifiedDistProb, classifiedAzm, classifiedAzmProb,
 					classifiedDepth, classifiedDepthProb, classifiedMag,
 					classifiedMagProb)) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CPick::CPick: Failed to initialize pick: "
 						+ json::Serialize(*pick));
 		return;
@@ -417,7 +409,7 @@ void CPick::clear() {
 
 	m_sPhaseName = "";
 	m_sSource = "";
-	m_sID = "";
+	m_ID = glass3::util::InternedID();
 	m_tPick = 0.0;
 	m_dBackAzimuth = std::numeric_limits<double>::quiet_NaN();
 	m_dSlowness = std::numeric_limits<double>::quiet_NaN();
@@ -451,7 +443,7 @@ bool CPick::initialize(std::shared_ptr<CSite> pickSite, double pickTime,
 
 	setTPick(pickTime);
 	setTSort(pickTime);
-	m_sID = pickIdString;
+	m_ID = glass3::util::InternedID(pickIdString);
 	m_sSource = source;
 	m_dBackAzimuth = backAzimuth;
 	m_dSlowness = slowness;
@@ -465,6 +457,7 @@ bool CPick::initialize(std::shared_ptr<CSite> pickSite, double pickTime,
 	m_dClassifiedDepthProbability = depthProb;
 	m_dClassifiedMagnitude = magnitude;
 	m_dClassifiedMagnitudeProbability = magnitudeProb;
+	m_iVersion++;
 
 	// nullcheck
 	if (pickSite == NULL) {
@@ -484,8 +477,7 @@ void CPick::addHypoReference(std::shared_ptr<CHypo> hyp, bool force) {
 
 	// nullcheck
 	if (hyp == NULL) {
-		glass3::util::Logger::log("error",
-									"CPick::addHypo: NULL hypo provided.");
+		GLASS3_LOG_ERROR("CPick::addHypo: NULL hypo provided.");
 		return;
 	}
 
@@ -505,8 +497,7 @@ void CPick::addHypoReference(std::shared_ptr<CHypo> hyp, bool force) {
 void CPick::removeHypoReference(std::shared_ptr<CHypo> hyp) {
 	// nullcheck
 	if (hyp == NULL) {
-		glass3::util::Logger::log("error",
-									"CPick::remHypo: NULL hypo provided.");
+		GLASS3_LOG_ERROR("CPick::remHypo: NULL hypo provided.");
 		return;
 	}
 
@@ -540,7 +531,6 @@ bool CPick::nucleate(CPickList* parentThread) {
 	// get the site shared_ptr
 	std::shared_ptr<CSite> pickSite = m_wpSite.lock();
 	std::string pt = glass3::util::Date::encodeDateTime(m_tPick);
-	char sLog[glass3::util::Logger::k_nMaxLogEntrySize];
 
 	setTNucleation();
 
@@ -557,7 +547,7 @@ bool CPick::nucleate(CPickList* parentThread) {
 		 glass3::util::Logger::log(
 		 "debug",
 		 "CPick::nucleate: NOTRG site:" + pickSite->getSCNL()
-		 + "; tPick:" + pt + "; sID:" + m_sID);
+		 + "; tPick:" + pt + "; sID:" + getID());
 		 */
 		return (false);
 	}
@@ -588,8 +578,7 @@ bool CPick::nucleate(CPickList* parentThread) {
 				// is the associated hypo close enough to this trigger to skip
 				// close enough means within the resolution of the trigger
 				if (dist < trigger->getWebResolution()) {
-					glass3::util::Logger::log(
-							"debug",
+					GLASS3_LOG_DEBUG(
 							"CPick::nucleate: SKIPTRG because pick proximal hypo ("
 									+ std::to_string(dist) + " < "
 									+ std::to_string(
@@ -721,7 +710,7 @@ bool CPick::nucleate(CPickList* parentThread) {
 			// since we only nucleate on a single phase.
 			if (npick < ncut) {
 				// we don't
-				snprintf(sLog, sizeof(sLog),
+				GLASS3_LOG_DEBUG_FORMAT(
 							"CPick::nucleate: -- Abandoning trigger %s "
 							"because the number of picks is below the cutoff "
 							"(npick:%d, ncut:%d, triggeringWeb:%s, "
@@ -729,7 +718,6 @@ bool CPick::nucleate(CPickList* parentThread) {
 							triggerString.c_str(), npick, ncut,
 							triggeringWeb.c_str(), controllingWeb.c_str(),
 							aSeismic.c_str());
-				glass3::util::Logger::log(sLog);
 
 				// don't bother making additional passes
 				bad = true;
@@ -740,7 +728,7 @@ bool CPick::nucleate(CPickList* parentThread) {
 			// hypo to survive.
 			if (bayes < thresh) {
 				// it isn't
-				snprintf(sLog, sizeof(sLog),
+				GLASS3_LOG_DEBUG_FORMAT(
 							"CPick::nucleate: -- Abandoning trigger %s "
 							"because the bayes value is below the threshold "
 							"(bayes:%f, thresh:%f, triggeringWeb:%s, "
@@ -748,7 +736,6 @@ bool CPick::nucleate(CPickList* parentThread) {
 							triggerString.c_str(), bayes, thresh,
 							triggeringWeb.c_str(), controllingWeb.c_str(),
 							aSeismic.c_str());
-				glass3::util::Logger::log(sLog);
 
 				// don't bother making additional passes
 				bad = true;
@@ -766,7 +753,7 @@ bool CPick::nucleate(CPickList* parentThread) {
 
 			if (depth > maxDepth) {
 				// it isn't
-				snprintf(sLog, sizeof(sLog),
+				GLASS3_LOG_DEBUG_FORMAT(
 							"CPick::nucleate: -- Abandoning trigger %s "
 							"because the depth is greater than the max depth "
 							"(depth:%f, maxDepth:%f, triggeringWeb:%s, "
@@ -774,7 +761,6 @@ bool CPick::nucleate(CPickList* parentThread) {
 							triggerString.c_str(), depth, maxDepth,
 							triggeringWeb.c_str(), controllingWeb.c_str(),
 							aSeismic.c_str());
-				glass3::util::Logger::log(sLog);
 
 				// don't bother making additional passes
 				bad = true;
@@ -802,10 +788,9 @@ bool CPick::nucleate(CPickList* parentThread) {
 
 		// log the hypo
 		std::string st = glass3::util::Date::encodeDateTime(hypo->getTOrigin());
-		glass3::util::Logger::log(
-				"debug",
+		GLASS3_LOG_DEBUG(
 				"CPick::nucleate: TRG site:" + pickSite->getSCNL() + "; tPick:"
-						+ pt + "; sID:" + m_sID + " => web:"
+						+ pt + "; sID:" + getID() + " => web:"
 						+ triggeringWeb + "; hyp: " + hypo->getID()
 						+ "; lat:"
 						+ glass3::util::to_string_with_precision(hypo->getLatitude(), 3)
@@ -857,7 +842,13 @@ const std::string& CPick::getPhaseName() const {
 // ---------------------------------------------------------getID
 const std::string& CPick::getID() const {
 	std::lock_guard < std::recursive_mutex > pickGuard(m_PickMutex);
-	return (m_sID);
+	return (m_ID.getString());
+}
+
+// ---------------------------------------------------------getIDHandle
+unsigned int CPick::getIDHandle() const {
+	std::lock_guard < std::recursive_mutex > pickGuard(m_PickMutex);
+	return (m_ID.getHandle());
 }
 
 // ---------------------------------------------------------getBackAzimuth
@@ -910,6 +901,11 @@ double CPick::getTNucleation() const {
 	return (m_tNucleation);
 }
 
+// --------------------------------------------------getVersion
+int CPick::getVersion() const {
+	return (m_iVersion);
+}
+
 // --------------------------------------------------setTNucleation
 void CPick::setTNucleation() {
 	m_tNucleation = glass3::util::Date::now();
@@ -0,0 +1,134 @@
+#include "PickIndex.h"
+#include <geo.h>
+#include <glassmath.h>
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "Pick.h"
+#include "Site.h"
+#include "SiteIndex.h"
+
+namespace glasscore {
+
+// pick sorting function
+// Compares pick sort times for search results
+bool sortPickTime(const std::pair<double, std::weak_ptr<CPick>> &lhs,
+					const std::pair<double, std::weak_ptr<CPick>> &rhs) {
+	return (lhs.first < rhs.first);
+}
+
+// ---------------------------------------------------------CPickIndex
+CPickIndex::CPickIndex() {
+	clear();
+}
+
+// ---------------------------------------------------------~CPickIndex
+CPickIndex::~CPickIndex() {
+}
+
+// ---------------------------------------------------------clear
+void CPickIndex::clear() {
+	m_mPickEntries.clear();
+	m_mCells.clear();
+}
+
+// ---------------------------------------------------------addPick
+bool CPickIndex::addPick(std::shared_ptr<CPick> pick) {
+	// nullchecks
+	if (pick == NULL) {
+		return (false);
+	}
+	std::shared_ptr<CSite> site = pick->getSite();
+	if (site == NULL) {
+		return (false);
+	}
+
+	// remove any existing entry, the sort time may have changed
+	removePick(pick);
+
+	glass3::util::Geo &siteGeo = site->getGeo();
+	int cellIndex = CSiteIndex::getCellIndex(
+			CSiteIndex::getAxisIndex(siteGeo.m_dUnitVectorX),
+			CSiteIndex::getAxisIndex(siteGeo.m_dUnitVectorY),
+			CSiteIndex::getAxisIndex(siteGeo.m_dUnitVectorZ));
+
+	CellPicks::iterator entry = m_mCells[cellIndex].insert(
+			std::pair<double, std::shared_ptr<CPick>>(pick->getTSort(), pick));
+	m_mPickEntries[pick.get()] =
+			std::pair<int, CellPicks::iterator>(cellIndex, entry);
+
+	return (true);
+}
+
+// ---------------------------------------------------------removePick
+bool CPickIndex::removePick(std::shared_ptr<CPick> pick) {
+	if (pick == NULL) {
+		return (false);
+	}
+
+	auto found = m_mPickEntries.find(pick.get());
+	if (found == m_mPickEntries.end()) {
+		return (false);
+	}
+
+	// remove the pick from its cell, and the cell if it is now empty
+	auto cell = m_mCells.find(found->second.first);
+	cell->second.erase(found->second.second);
+	if (cell->second.empty() == true) {
+		m_mCells.erase(cell);
+	}
+
+	m_mPickEntries.erase(found);
+
+	return (true);
+}
+
+// ---------------------------------------------------------getPicks
+std::vector<std::weak_ptr<CPick>> CPickIndex::getPicks(
+		const glass3::util::Geo &geo, double maxDistance, double t1,
+		double t2) const {
+	std::vector<std::pair<double, std::weak_ptr<CPick>>> found;
+
+	// any site within maxDistance is within this chord of the location,
+	// padded for rounding
+	double maxChord = 2.0;
+	if (maxDistance < glass3::util::GlassMath::k_Pi) {
+		maxChord = 2.0 * sin(std::max(maxDistance, 0.0) / 2.0) + 1.0e-9;
+	}
+
+	for (const auto &cell : m_mCells) {
+		// skip cells too far away to hold a site within maxDistance
+		if (CSiteIndex::getCellChord(geo, cell.first) > maxChord) {
+			continue;
+		}
+
+		// the picks in the time window
+		CellPicks::const_iterator lower = cell.second.lower_bound(t1);
+		CellPicks::const_iterator upper = cell.second.upper_bound(t2);
+		for (CellPicks::const_iterator it = lower; it != upper; ++it) {
+			found.push_back(
+					std::pair<double, std::weak_ptr<CPick>>(it->first,
+															it->second));
+		}
+	}
+
+	// merge the cells back into time order
+	std::stable_sort(found.begin(), found.end(), sortPickTime);
+
+	std::vector<std::weak_ptr<CPick>> picks;
+	picks.reserve(found.size());
+	for (const auto &entry : found) {
+		picks.push_back(entry.second);
+	}
+
+	return (picks);
+}
+
+// ---------------------------------------------------------size
+int CPickIndex::size() const {
+	return (m_mPickEntries.size());
+}
+}  // namespace glasscore
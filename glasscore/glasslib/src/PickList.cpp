@@ -2,6 +2,8 @@
 #include <json.h>
 #include <date.h>
 #include <logger.h>
+#include <geo.h>
+#include <glassmath.h>
 #include <string>
 #include <utility>
 #include <memory>
@@ -46,6 +48,7 @@ void CPickList::clear() {
 
 	// clear the multiset
 	m_msPickList.clear();
+	m_PickIndex.clear();
 
 	m_PicksToProcessMutex.lock();
 	while (m_qPicksToProcess.empty() == false) {
@@ -71,8 +74,7 @@ void CPickList::clear() {
 bool CPickList::receiveExternalMessage(std::shared_ptr<json::Object> com) {
 	// null check json
 	if (com == NULL) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CPickList::receiveExternalMessage: NULL json communication.");
 		return (false);
 	}
@@ -97,15 +99,13 @@ bool CPickList::receiveExternalMessage(std::shared_ptr<json::Object> com) {
 bool CPickList::addPick(std::shared_ptr<json::Object> pick) {
 	// null check json
 	if (pick == NULL) {
-		glass3::util::Logger::log("error",
-									"CPickList::addPick: NULL json pick.");
+		GLASS3_LOG_ERROR("CPickList::addPick: NULL json pick.");
 		return (false);
 	}
 
 	// null check pSiteList
 	if (m_pSiteList == NULL) {
-		glass3::util::Logger::log("error",
-									"CPickList::addPick: NULL pSiteList.");
+		GLASS3_LOG_ERROR("CPickList::addPick: NULL pSiteList.");
 		return (false);
 	}
 
@@ -115,8 +115,7 @@ bool CPickList::addPick(std::shared_ptr<json::Object> pick) {
 		std::string cmd = (*pick)["Cmd"].ToString();
 
 		if (cmd != "Pick") {
-			glass3::util::Logger::log(
-					"warning",
+			GLASS3_LOG_WARNING(
 					"CPickList::addPick: Non-Pick message passed in.");
 			return (false);
 		}
@@ -125,24 +124,18 @@ bool CPickList::addPick(std::shared_ptr<json::Object> pick) {
 		std::string type = (*pick)["Type"].ToString();
 
 		if (type != "Pick") {
-			glass3::util::Logger::log(
-					"warning",
+			GLASS3_LOG_WARNING(
 					"CPickList::addPick: Non-Pick message passed in.");
 			return (false);
 		}
 	} else {
 		// no command or type
-		glass3::util::Logger::log(
-				"error", "CPickList::addPick: Missing required Cmd/Type Key.");
+		GLASS3_LOG_ERROR("CPickList::addPick: Missing required Cmd/Type Key.");
 		return (false);
 	}
 
 	// get the current size of the queue
-	while (m_PicksToProcessMutex.try_lock() == false) {
-		std::this_thread::sleep_for(
-								std::chrono::milliseconds(100));
-		setThreadHealth();
-	}
+	m_PicksToProcessMutex.lock();
 	int queueSize = m_qPicksToProcess.size();
 	m_PicksToProcessMutex.unlock();
 	setThreadHealth();
@@ -168,6 +161,9 @@ bool CPickList::addPick(std::shared_ptr<json::Object> pick) {
 	m_PicksToProcessMutex.unlock();
 	setThreadHealth();
 
+	// wake an idle pick processing thread
+	wakeUp();
+
 	// we're done, message was processed
 	return (true);
 }
@@ -246,6 +242,17 @@ std::vector<std::weak_ptr<CPick>> CPickList::getPicks(double t1, double t2) {
 	return (picks);
 }
 
+// ---------------------------------------------------------getPicks
+std::vector<std::weak_ptr<CPick>> CPickList::getPicks(
+		double t1, double t2, const glass3::util::Geo &geo,
+		double maxDistance) {
+	std::lock_guard<std::recursive_mutex> listGuard(m_PickListMutex);
+
+	return (m_PickIndex.getPicks(
+			geo, maxDistance * glass3::util::GlassMath::k_DegreesToRadians, t1,
+			t2));
+}
+
 // -----------------------------------------------------getDuplicate
 std::shared_ptr<CPick> CPickList::getDuplicate(double newTPick,
 												std::string newSCNL,
@@ -286,8 +293,7 @@ std::shared_ptr<CPick> CPickList::getDuplicate(double newTPick,
 				// check if sites match
 				if (newSCNL == currentSCNL) {
 					// if match is found, log and return true
-					glass3::util::Logger::log(
-							"debug",
+					GLASS3_LOG_DEBUG(
 							"CPickList::getDuplicate: Duplicate pick found (window = "
 									+ std::to_string(tWindow) + "): existing pick: "
 									+ currentSCNL + " "
@@ -311,12 +317,10 @@ bool CPickList::scavenge(std::shared_ptr<CHypo> hyp, double tDuration) {
 
 	// null check
 	if (hyp == NULL) {
-		glass3::util::Logger::log(
-				"error", "CPickList::scavenge: NULL CHypo provided.");
+		GLASS3_LOG_ERROR("CPickList::scavenge: NULL CHypo provided.");
 		return (false);
 	}
 
-	char sLog[glass3::util::Logger::k_nMaxLogEntrySize];
 
 	// glass3::util::Logger::log("debug", "CPickList::scavenge. " + hyp->getID());
 
@@ -325,8 +329,15 @@ bool CPickList::scavenge(std::shared_ptr<CHypo> hyp, double tDuration) {
 	int addCount = 0;
 	bool associated = false;
 
+	// only consider picks from sites within the association distance cutoff,
+	// canAssociate() rejects the rest
+	glass3::util::Geo hypoGeo;
+	hypoGeo.setGeographic(
+			hyp->getLatitude(), hyp->getLongitude(),
+			glass3::util::Geo::k_EarthRadiusKm - hyp->getDepth());
 	std::vector<std::weak_ptr<CPick>> picks = getPicks(
-			hyp->getTOrigin() - tDuration, hyp->getTOrigin() + tDuration);
+			hyp->getTOrigin() - tDuration, hyp->getTOrigin() + tDuration,
+			hypoGeo, hyp->getAssociationDistanceCutoff());
 
 	if (picks.size() == 0) {
 		return (false);
@@ -382,8 +393,7 @@ bool CPickList::scavenge(std::shared_ptr<CHypo> hyp, double tDuration) {
 		}
 	}
 
-	glass3::util::Logger::log(
-			"debug",
+	GLASS3_LOG_DEBUG(
 			"CPickList::scavenge " + hyp->getID() + " added:"
 					+ std::to_string(addCount));
 
@@ -406,19 +416,16 @@ glass3::util::WorkState CPickList::work() {
 	if (CGlass::getHypoList()->getHypoProcessingQueueLength()
 			> (CGlass::getHypoList()->getNumThreads()
 					* CGlass::iMaxQueueLenPerThreadFactor)) {
-		glass3::util::Logger::log("debug",
+		GLASS3_LOG_DEBUG(
 									"CPickList::work. Delaying work due to "
 									"HypoList process queue size.");
 		// on to the next loop
 		return (glass3::util::WorkState::Idle);
 	}
 
-	// lock for queue access
-	while (m_PicksToProcessMutex.try_lock() == false) {
-		std::this_thread::sleep_for(
-								std::chrono::milliseconds(100));
-		setThreadHealth();
-	}
+	// lock for queue access, the queue is only ever held briefly, so wait
+	// for it rather than polling
+	m_PicksToProcessMutex.lock();
 
 	// are there any picks to process
 	if (m_qPicksToProcess.empty() == true) {
@@ -545,12 +552,10 @@ glass3::util::WorkState CPickList::work() {
 		m_iMaxAllowablePickCount = CGlass::getMaxNumPicks();
 	}
 
-	// lock while we're modifying the multiset
-	while (m_PickListMutex.try_lock() == false) {
-		std::this_thread::sleep_for(
-								std::chrono::milliseconds(100));
-		setThreadHealth();
-	}
+	// lock while we're modifying the multiset, waiting for it rather than
+	// polling so the pick isn't held for a sleep after the list frees up
+	m_PickListMutex.lock();
+	setThreadHealth();
 
 	// check to see if we're at the pick limit
 	if (m_msPickList.size() >= m_iMaxAllowablePickCount) {
@@ -574,6 +579,7 @@ glass3::util::WorkState CPickList::work() {
 
 		// remove from from multiset
 		m_msPickList.erase(oldest);
+		m_PickIndex.removePick(oldestPick);
 	}
 
 	// add to site specific pick list
@@ -581,6 +587,7 @@ glass3::util::WorkState CPickList::work() {
 
 	// add to multiset
 	m_msPickList.insert(pick);
+	m_PickIndex.addPick(pick);
 
 	// done modifying the multiset
 	m_PickListMutex.unlock();
@@ -604,8 +611,7 @@ glass3::util::WorkState CPickList::work() {
 		// nucleating
 		// NOTE: Hardcoded ratio threshold
 		if (adBayesRatio > 2.0) {
-			glass3::util::Logger::log(
-					"debug",
+			GLASS3_LOG_DEBUG(
 					"CPickList::work(): SKIPNUC tPick:" + pt + "; idPick:"
 							+ pick->getID() + " ("
 							+ pick->getSite()->getSCNL() +
@@ -626,8 +632,7 @@ glass3::util::WorkState CPickList::work() {
 	if (bNucleateThisPick == true) {
 		if (CGlass::getHypoList()->fitData(pick) == true) {
 			std::string pt = glass3::util::Date::encodeDateTime(pick->getTPick());
-			glass3::util::Logger::log(
-					"debug",
+			GLASS3_LOG_DEBUG(
 					"CPickList::work(): SKIPNUC tPick:" + pt + "; idPick:"
 							+ pick->getID() + " ("
 							+ pick->getSite()->getSCNL() +
@@ -702,6 +707,12 @@ void CPickList::updatePosition(std::shared_ptr<CPick> pick) {
 
 	// insert
 	m_msPickList.insert(pick);
+	m_PickIndex.addPick(pick);
+
+	// keep the site's pick buffer in time order as well
+	if (pick->getSite() != NULL) {
+		pick->getSite()->updatePosition(pick);
+	}
 }
 
 // ---------------------------------------------------------eraseFromMultiset
@@ -731,12 +742,12 @@ void CPickList::eraseFromMultiset(std::shared_ptr<CPick> pick) {
 		// only erase the correct one
 		if (aPick->getID() == pick->getID()) {
 			m_msPickList.erase(it);
+			m_PickIndex.removePick(aPick);
 			return;
 		}
 	}
 
-	glass3::util::Logger::log(
-			"warning",
+	GLASS3_LOG_WARNING(
 			"CPickList::eraseFromMultiset: efficient delete for pick "
 					+ pick->getID() + " didn't work.");
 
@@ -749,12 +760,12 @@ void CPickList::eraseFromMultiset(std::shared_ptr<CPick> pick) {
 		// only erase the correct one
 		if (aPick->getID() == pick->getID()) {
 			m_msPickList.erase(it);
+			m_PickIndex.removePick(aPick);
 			return;
 		}
 	}
 
-	glass3::util::Logger::log(
-			"error",
+	GLASS3_LOG_ERROR(
 			"CPickList::eraseFromMultiset: did not delete pick " + pick->getID()
 					+ " in multiset, id not found.");
 }
@@ -8,14 +8,17 @@
 #include <sstream>
 #include <cmath>
 #include <utility>
+#include <unordered_map>
 #include <tuple>
 #include <string>
 #include <memory>
 #include <vector>
-#include <set>
 #include <algorithm>
 #include <mutex>
+#include <condition_variable>
+#include <functional>
 #include <ctime>
+#include <threadpool.h>
 #include "Glass.h"
 #include "Pick.h"
 #include "PickList.h"
@@ -26,10 +29,48 @@
 
 namespace glasscore {
 
+/**
+ * \brief The state shared between the threads nucleating a pick at groups
+ * of the nodes linked to a site
+ */
+typedef struct _NucleationWork {
+	/**
+	 * \brief The number of node groups (jobs) to nucleate
+	 */
+	int iNumJobs;
+
+	/**
+	 * \brief The index of the next job to be claimed
+	 */
+	std::atomic<int> iNextJob;
+
+	/**
+	 * \brief The number of jobs finished, protected by DoneMutex
+	 */
+	int iJobsDone;
+
+	/**
+	 * \brief The triggers generated by each job
+	 */
+	std::vector<std::vector<std::shared_ptr<CTrigger>>> vJobTriggers;
+
+	/**
+	 * \brief A mutex protecting iJobsDone
+	 */
+	std::mutex DoneMutex;
+
+	/**
+	 * \brief A condition variable signaled when a job is finished
+	 */
+	std::condition_variable DoneCondition;
+} NucleationWork;
+
 // constants
 const int CSite::k_iUnitVectorXCoordinateIndex;
 const int CSite::k_iUnitVectorYCoordinateIndex;
 const int CSite::k_iUnitVectorZCoordinateIndex;
+const int CSite::k_iNodesPerNucleationJob;
+const int CSite::k_iMinimumPickBlockSize;
 
 // ---------------------------------------------------------CSite
 CSite::CSite() {
@@ -46,9 +87,11 @@ CSite::CSite(std::string sta, std::string comp, std::string net,
 
 // ---------------------------------------------------------CSite
 CSite::CSite(std::shared_ptr<json::Object> site) {
+	clear();
+
 	// null check json
 	if (site == NULL) {
-		glass3::util::Logger::log("error", "CSite::CSite: NULL json site.");
+		GLASS3_LOG_ERROR("CSite::CSite: NULL json site.");
 		return;
 	}
 
@@ -58,14 +101,12 @@ CSite::CSite(std::shared_ptr<json::Object> site) {
 		std::string type = (*site)["Type"].ToString();
 
 		if (type != "StationInfo") {
-			glass3::util::Logger::log(
-					"warning",
+			GLASS3_LOG_WARNING(
 					"CSite::CSite: Non-StationInfo message passed in.");
 			return;
 		}
 	} else {
-		glass3::util::Logger::log("error",
-									"CSite::CSite: Missing required Type Key.");
+		GLASS3_LOG_ERROR("CSite::CSite: Missing required Type Key.");
 		return;
 	}
 
@@ -96,8 +137,7 @@ CSite::CSite(std::shared_ptr<json::Object> site) {
 				&& (siteobj["Station"].GetType() == json::ValueType::StringVal)) {
 			station = siteobj["Station"].ToString();
 		} else {
-			glass3::util::Logger::log(
-					"error", "CSite::CSite: Missing required Station Key.");
+			GLASS3_LOG_ERROR("CSite::CSite: Missing required Station Key.");
 
 			return;
 		}
@@ -115,8 +155,7 @@ CSite::CSite(std::shared_ptr<json::Object> site) {
 				&& (siteobj["Network"].GetType() == json::ValueType::StringVal)) {
 			network = siteobj["Network"].ToString();
 		} else {
-			glass3::util::Logger::log(
-					"error", "CSite::CSite: Missing required Network Key.");
+			GLASS3_LOG_ERROR("CSite::CSite: Missing required Network Key.");
 
 			return;
 		}
@@ -168,8 +207,7 @@ CSite::CSite(std::shared_ptr<json::Object> site) {
 			// return;
 		// }
 	} else {
-		glass3::util::Logger::log(
-				"error", "CSite::CSite: Missing required Site Object.");
+		GLASS3_LOG_ERROR("CSite::CSite: Missing required Site Object.");
 
 		return;
 	}
@@ -243,8 +281,7 @@ CSite::CSite(std::shared_ptr<json::Object> site) {
 
 	// make sure we got a valid lat/lon/elev
 	if ((latitude == 0) && (longitude == 0) && (elevation == 0)) {
-		glass3::util::Logger::log(
-				"error", "CSite::CSite: Invalid Latitude / Longitude / Elevation (=0).");
+		GLASS3_LOG_ERROR("CSite::CSite: Invalid Latitude / Longitude / Elevation (=0).");
 		return;
 	}
 
@@ -269,33 +306,34 @@ bool CSite::initialize(std::string sta, std::string comp, std::string net,
 	std::lock_guard<std::recursive_mutex> guard(m_SiteMutex);
 
 	// generate scnl
-	m_sSCNL = "";
+	std::string scnl = "";
 
 	// station, required
 	if (sta != "") {
-		m_sSCNL += sta;
+		scnl += sta;
 	} else {
-		glass3::util::Logger::log("error", "CSite::initialize: missing sta.");
+		GLASS3_LOG_ERROR("CSite::initialize: missing sta.");
 		return (false);
 	}
 
 	// component, optional
 	if (comp != "") {
-		m_sSCNL += "." + comp;
+		scnl += "." + comp;
 	}
 
 	// network, required
 	if (net != "") {
-		m_sSCNL += "." + net;
+		scnl += "." + net;
 	} else {
-		glass3::util::Logger::log("error", "CSite::initialize: missing net.");
+		GLASS3_LOG_ERROR("CSite::initialize: missing net.");
 		return (false);
 	}
 
 	// location, optional
 	if (loc != "") {
-		m_sSCNL += "." + loc;
+		scnl += "." + loc;
 	}
+	m_SCNL = glass3::util::InternedID(scnl);
 
 	// fill in site/net/etc
 	m_sSite = sta;
@@ -305,7 +343,7 @@ bool CSite::initialize(std::string sta, std::string comp, std::string net,
 
 	// check latitude
 	if ((lat < -90.0) || (lat > 90.0)) {
-		glass3::util::Logger::log("error", "CSite::initialize: Latitude not in the"
+		GLASS3_LOG_ERROR("CSite::initialize: Latitude not in the"
 			"valid range of -90 to 90 degrees.");
 		return (false);
 	}
@@ -313,7 +351,7 @@ bool CSite::initialize(std::string sta, std::string comp, std::string net,
 
 	// check longitude
 	if ((lon < -180.0) || (lon > 180.0)) {
-		glass3::util::Logger::log("error", "CSite::initialize: Longitude not in the"
+		GLASS3_LOG_ERROR("CSite::initialize: Longitude not in the"
 			"valid range of -180 to 180 degrees.");
 		return (false);
 	}
@@ -322,7 +360,7 @@ bool CSite::initialize(std::string sta, std::string comp, std::string net,
 	// check elevation, we assume that a station is not deeper than the Dead Sea
 	// and not higher than the Himalayas
 	if ((elv < -5000.0) || (elv > 8000.0)) {
-		glass3::util::Logger::log("error", "CSite::initialize: Elevation not in the"
+		GLASS3_LOG_ERROR("CSite::initialize: Elevation not in the"
 			"valid range of -5000 to 8000 meters.");
 		return (false);
 	}
@@ -357,7 +395,7 @@ CSite::~CSite() {
 void CSite::clear() {
 	std::lock_guard<std::recursive_mutex> guard(m_SiteMutex);
 	// clear scnl
-	m_sSCNL = "";
+	m_SCNL = glass3::util::InternedID();
 	m_sSite = "";
 	m_sComponent = "";
 	m_sNetwork = "";
@@ -381,20 +419,22 @@ void CSite::clear() {
 	// clear lists
 	m_vNodeMutex.lock();
 	m_vNode.clear();
+	m_vCoarseNode.clear();
 	m_vNodeMutex.unlock();
 
 	vPickMutex.lock();
 
-	// init the upper and lower values
-	std::shared_ptr<CSite> nullSite;
-	if (m_LowerValue == NULL) {
-		m_LowerValue = std::make_shared<CPick>(nullSite, 0, "lower", 0, 0);
-	}
-	if (m_UpperValue == NULL) {
-		m_UpperValue = std::make_shared<CPick>(nullSite, 0, "upper", 0, 0);
-	}
-
-	m_msPickList.clear();
+	m_vPickBufferTimes.clear();
+	m_vPickBuffer.clear();
+	m_iPickBufferStart = 0;
+	std::atomic_store(&m_pPickSnapshot,
+						std::shared_ptr<const SitePickSnapshot>());
+	m_pPickBlock.reset();
+	m_iPickSnapshotStart = 0;
+	m_iPickSnapshotEnd = 0;
+	m_iPickSnapshotRemoved = 0;
+	m_iPickSnapshotAppended = 0;
+	m_bPickSnapshotRebuild = true;
 
 	vPickMutex.unlock();
 
@@ -409,7 +449,7 @@ void CSite::clear() {
 void CSite::update(CSite *aSite) {
 	std::lock_guard<std::recursive_mutex> guard(m_SiteMutex);
 	// scnl check
-	if (m_sSCNL != aSite->getSCNL()) {
+	if (m_SCNL != aSite->m_SCNL) {
 		return;
 	}
 
@@ -480,8 +520,7 @@ void CSite::setLocation(double lat, double lon, double z) {
 double CSite::getDelta(glass3::util::Geo *geo2) {
 	// nullcheck
 	if (geo2 == NULL) {
-		glass3::util::Logger::log("warning",
-									"CSite::getDelta: NULL CGeo provided.");
+		GLASS3_LOG_WARNING("CSite::getDelta: NULL CGeo provided.");
 		return (0);
 	}
 
@@ -493,8 +532,7 @@ double CSite::getDelta(glass3::util::Geo *geo2) {
 double CSite::getDistance(std::shared_ptr<CSite> site) {
 	// nullcheck
 	if (site == NULL) {
-		glass3::util::Logger::log("warning",
-									"CSite::getDistance: NULL CSite provided.");
+		GLASS3_LOG_WARNING("CSite::getDistance: NULL CSite provided.");
 		return (0);
 	}
 
@@ -518,22 +556,21 @@ void CSite::addPick(std::shared_ptr<CPick> pck) {
 
 	// nullcheck
 	if (pck == NULL) {
-		glass3::util::Logger::log("warning",
-									"CSite::addPick: NULL CPick provided.");
+		GLASS3_LOG_WARNING("CSite::addPick: NULL CPick provided.");
 		return;
 	}
 
 	// ensure this pick is for this site
-	if (pck->getSite()->m_sSCNL != m_sSCNL) {
-		glass3::util::Logger::log(
-				"warning",
-				"CSite::addPick: CPick for different site: (" + m_sSCNL + "!="
-						+ pck->getSite()->m_sSCNL + ")");
+	if (pck->getSite()->m_SCNL != m_SCNL) {
+		GLASS3_LOG_WARNING(
+				"CSite::addPick: CPick for different site: (" + getSCNL() + "!="
+						+ pck->getSite()->getSCNL() + ")");
 		return;
 	}
 
-	// add pick to site pick multiset
-	m_msPickList.insert(pck);
+	// add pick to site pick buffer
+	insertIntoPickBuffer(pck);
+	publishPickSnapshot();
 
 	// remember the time the last pick was added
 	m_tLastPickAdded = std::time(NULL);
@@ -546,8 +583,7 @@ void CSite::addPick(std::shared_ptr<CPick> pck) {
 void CSite::removePick(std::shared_ptr<CPick> pck) {
 	// nullcheck
 	if (pck == NULL) {
-		glass3::util::Logger::log("warning",
-									"CSite::removePick: NULL CPick provided.");
+		GLASS3_LOG_WARNING("CSite::removePick: NULL CPick provided.");
 		return;
 	}
 	if (pck->getID() == "") {
@@ -557,7 +593,8 @@ void CSite::removePick(std::shared_ptr<CPick> pck) {
 	std::lock_guard<std::mutex> guard(vPickMutex);
 
 	// erase it
-	eraseFromMultiset(pck);
+	eraseFromPickBuffer(pck);
+	publishPickSnapshot();
 }
 
 // ---------------------------------------------------------getVPick
@@ -570,45 +607,18 @@ std::vector<std::shared_ptr<CPick>> CSite::getPicks(double t1, double t2) {
 		t1 = temp;
 	}
 
-	// nullcheck
-	if ((m_LowerValue == NULL) || (m_UpperValue == NULL)) {
-		return (picks);
-	}
-
 	std::lock_guard<std::mutex> listGuard(vPickMutex);
 
-	// don't bother if the list is empty
-	if (m_msPickList.size() == 0) {
-		return (picks);
-	}
-
 	// get the bounds for this window
-	std::multiset<std::shared_ptr<CPick>, SitePickCompare>::iterator lower =
-			getLower(t1);
-	std::multiset<std::shared_ptr<CPick>, SitePickCompare>::iterator upper =
-			getUpper(t2);
-
-	// found nothing
-	if (lower == getEnd()) {
-		return (picks);
-	}
-
-	// found one
-	if ((lower == upper) && (lower != getEnd())) {
-		std::shared_ptr<CPick> aPick = *lower;
-
-		if (aPick != NULL) {
-			// add to the list of picks
-			picks.push_back(aPick);
-		}
-
-		return (picks);
-	}  // end found one
+	auto lower = std::lower_bound(
+			m_vPickBufferTimes.begin() + m_iPickBufferStart,
+			m_vPickBufferTimes.end(), t1);
+	auto upper = std::upper_bound(lower, m_vPickBufferTimes.end(), t2);
 
 	// loop through found picks
-	for (std::multiset<std::shared_ptr<CPick>, SitePickCompare>::iterator it =
-			lower; ((it != upper) && (it != getEnd())); ++it) {
-		std::shared_ptr<CPick> aPick = *it;
+	for (auto it = lower; it != upper; ++it) {
+		std::shared_ptr<CPick> aPick = m_vPickBuffer[it
+				- m_vPickBufferTimes.begin()];
 
 		if (aPick != NULL) {
 			// add to the list of picks
@@ -620,28 +630,47 @@ std::vector<std::shared_ptr<CPick>> CSite::getPicks(double t1, double t2) {
 	return (picks);
 }
 
-// ---------------------------------------------------------getLower
-std::multiset<std::shared_ptr<CPick>, SitePickCompare>::iterator CSite::getLower(  // NOLINT
-		double min) {
-	m_LowerValue->setTSort(min);
-	return (m_msPickList.lower_bound(m_LowerValue));
-}
+// ---------------------------------------------------------getPickWindow
+void CSite::getPickWindow(double min, double max,
+							std::vector<std::shared_ptr<CPick>> *picks) {
+	if (picks == NULL) {
+		return;
+	}
+	picks->clear();
+
+	// use the published snapshot if there is one
+	if (CGlass::getSitePickSnapshots() == true) {
+		std::shared_ptr<const SitePickSnapshot> snapshot = std::atomic_load(
+				&m_pPickSnapshot);
+		if (snapshot != NULL) {
+			const std::vector<double> &times = snapshot->pBlock->vdPickTimes;
+			auto lower = std::lower_bound(times.begin() + snapshot->iStart,
+											times.begin() + snapshot->iEnd,
+											min);
+			auto upper = std::upper_bound(lower,
+											times.begin() + snapshot->iEnd,
+											max);
+			picks->assign(
+					snapshot->pBlock->vPicks.begin() + (lower - times.begin()),
+					snapshot->pBlock->vPicks.begin() + (upper - times.begin()));
+			return;
+		}
+	}
 
-// ---------------------------------------------------------getUpper
-std::multiset<std::shared_ptr<CPick>, SitePickCompare>::iterator CSite::getUpper(  // NOLINT
-		double max) {
-	m_UpperValue->setTSort(max);
-	return (m_msPickList.upper_bound(m_UpperValue));
-}
+	std::lock_guard<std::mutex> listGuard(vPickMutex);
 
-// ---------------------------------------------------------getEnd
-std::multiset<std::shared_ptr<CPick>, SitePickCompare>::iterator CSite::getEnd() {  // NOLINT
-	return (m_msPickList.end());
+	// copy the picks in the window
+	auto lower = std::lower_bound(
+			m_vPickBufferTimes.begin() + m_iPickBufferStart,
+			m_vPickBufferTimes.end(), min);
+	auto upper = std::upper_bound(lower, m_vPickBufferTimes.end(), max);
+	picks->assign(m_vPickBuffer.begin() + (lower - m_vPickBufferTimes.begin()),
+					m_vPickBuffer.begin() + (upper - m_vPickBufferTimes.begin()));
 }
 
-// ---------------------------------------------------------getPickMutex
-std::mutex & CSite::getPickMutex() {
-	return (vPickMutex);
+// ---------------------------------------------------------getPickSnapshot
+std::shared_ptr<const SitePickSnapshot> CSite::getPickSnapshot() const {
+	return (std::atomic_load(&m_pPickSnapshot));
 }
 
 // ---------------------------------------------------------addNode
@@ -653,8 +682,7 @@ void CSite::addNode(std::shared_ptr<CNode> node, double distDeg,
 
 	// nullcheck
 	if (node == NULL) {
-		glass3::util::Logger::log("warning",
-									"CSite::addNode: NULL CNode provided.");
+		GLASS3_LOG_WARNING("CSite::addNode: NULL CNode provided.");
 		return;
 	}
 	// check travel times
@@ -671,7 +699,11 @@ void CSite::addNode(std::shared_ptr<CNode> node, double distDeg,
 	// same web can exist at the same site (travel times would be different)
 	NodeLink link = std::make_tuple(node, travelTime1, phase1, travelTime2,
 		phase2, distDeg);
-	m_vNode.push_back(link);
+	if (node->getCoarse() == true) {
+		m_vCoarseNode.push_back(link);
+	} else {
+		m_vNode.push_back(link);
+	}
 }
 
 // ---------------------------------------------------------removeNode
@@ -681,31 +713,32 @@ void CSite::removeNode(std::string nodeID) {
 
 	// nullcheck
 	if (nodeID == "") {
-		glass3::util::Logger::log(
-				"warning", "CSite::removeNode: empty web name provided.");
+		GLASS3_LOG_WARNING("CSite::removeNode: empty web name provided.");
 		return;
 	}
 
-	// clean up expired pointers
-	for (auto it = m_vNode.begin(); it != m_vNode.end();) {
-		if (std::get<LINK_PTR>(*it).expired() == true) {
-			it = m_vNode.erase(it);
-		} else {
-			++it;
+	for (std::vector<NodeLink> *nodeLinks : { &m_vNode, &m_vCoarseNode }) {
+		// clean up expired pointers
+		for (auto it = nodeLinks->begin(); it != nodeLinks->end();) {
+			if (std::get<LINK_PTR>(*it).expired() == true) {
+				it = nodeLinks->erase(it);
+			} else {
+				++it;
+			}
 		}
-	}
 
-	for (auto it = m_vNode.begin(); it != m_vNode.end();) {
-		if (auto aNode = std::get<LINK_PTR>(*it).lock()) {
-			// erase target pick
-			if (aNode->getID() == nodeID) {
-				it = m_vNode.erase(it);
-				return;
+		for (auto it = nodeLinks->begin(); it != nodeLinks->end();) {
+			if (auto aNode = std::get<LINK_PTR>(*it).lock()) {
+				// erase target pick
+				if (aNode->getID() == nodeID) {
+					it = nodeLinks->erase(it);
+					return;
+				} else {
+					++it;
+				}
 			} else {
 				++it;
 			}
-		} else {
-			++it;
 		}
 	}
 }
@@ -726,79 +759,174 @@ std::vector<std::shared_ptr<CTrigger>> CSite::nucleate(double tPick,
 	}
 	m_SiteMutex.unlock();
 
-	// for each node linked to this site
-	for (const auto &link : m_vNode) {
-		if (parentThread != NULL) {
-			parentThread->setThreadHealth();
+	// screen with the coarse nodes first, remembering which passed
+	std::unordered_map<const CNode *, bool> coarseResults;
+	for (const auto &link : m_vCoarseNode) {
+		std::shared_ptr<CNode> coarseNode = std::get<LINK_PTR>(link).lock();
+		if ((coarseNode == NULL) || (coarseNode->getEnabled() == false)) {
+			continue;
 		}
 
-		// compute potential origin time from tPick and travel time to node
-		// first get traveltime1 to node
-		double travelTime1 = std::get< LINK_TT1>(link);
+		coarseResults[coarseNode.get()] = (nucleateNode(link, tPick,
+														parentThread) != NULL);
+	}
 
-		// second get traveltime2 to node
-		double travelTime2 = std::get< LINK_TT2>(link);
+	int numNodes = m_vNode.size();
+	glass3::util::ThreadPool* workPool = CGlass::getNucleationWorkPool();
 
-		// third get shared pointer to node
-		std::shared_ptr<CNode> node = std::get<LINK_PTR>(link).lock();
+	// nucleate serially if there's no pool or not enough nodes to split
+	if ((workPool == NULL) || (numNodes <= k_iNodesPerNucleationJob)) {
+		nucleateNodes(0, numNodes, tPick, parentThread, &coarseResults,
+						&vTrigger);
+		return (vTrigger);
+	}
 
-		if (node == NULL) {
-			continue;
+	// split the nodes into jobs, the shared state is held by shared_ptr since
+	// pool threads may pick up a helper after every job has been claimed
+	std::shared_ptr<NucleationWork> work = std::make_shared<NucleationWork>();
+	work->iNumJobs = (numNodes + k_iNodesPerNucleationJob - 1)
+			/ k_iNodesPerNucleationJob;
+	work->iNextJob = 0;
+	work->iJobsDone = 0;
+	work->vJobTriggers.resize(work->iNumJobs);
+
+	// claims and runs jobs until there are none left
+	const std::unordered_map<const CNode *, bool> *screen = &coarseResults;
+	std::function<void()> runJobs =
+			[this, work, numNodes, tPick, parentThread, screen]() {
+				for (int job = work->iNextJob++; job < work->iNumJobs;
+						job = work->iNextJob++) {
+					int first = job * k_iNodesPerNucleationJob;
+					int last = std::min(first + k_iNodesPerNucleationJob,
+										numNodes);
+					nucleateNodes(first, last, tPick, parentThread, screen,
+									&(work->vJobTriggers[job]));
+
+					std::lock_guard<std::mutex> doneGuard(work->DoneMutex);
+					work->iJobsDone++;
+					work->DoneCondition.notify_one();
+				}
+			};
+
+	// add helpers to the pool, the calling thread runs jobs too so that the
+	// jobs get done even if every pool thread is busy
+	for (int i = 1; i < work->iNumJobs; i++) {
+		workPool->addJob(runJobs);
+	}
+	runJobs();
+
+	// wait for jobs claimed by pool threads
+	std::unique_lock<std::mutex> doneLock(work->DoneMutex);
+	work->DoneCondition.wait(doneLock, [&work]() {
+		return (work->iJobsDone == work->iNumJobs);
+	});
+	doneLock.unlock();
+
+	// merge the triggers in node order
+	for (const auto &jobTriggers : work->vJobTriggers) {
+		for (const auto &trigger : jobTriggers) {
+			addTriggerToList(&vTrigger, trigger);
 		}
+	}
 
-		if (node->getEnabled() == false) {
-			continue;
-		}
+	return (vTrigger);
+}
 
-		// compute first origin time
-		double tOrigin1 = -1;
-		if (travelTime1 > 0) {
-			tOrigin1 = tPick - travelTime1;
+// ---------------------------------------------------------nucleateNodes
+void CSite::nucleateNodes(
+		int first, int last, double tPick, CPickList* parentThread,
+		const std::unordered_map<const CNode *, bool> *coarseResults,
+		std::vector<std::shared_ptr<CTrigger>> *vTrigger) {
+	// for each node in the range
+	for (int nodeIndex = first; nodeIndex < last; nodeIndex++) {
+		const NodeLink &link = m_vNode[nodeIndex];
+
+		// skip nodes whose coarse node was tried here and did not pass
+		if ((coarseResults != NULL) && (coarseResults->empty() == false)) {
+			std::shared_ptr<CNode> node = std::get<LINK_PTR>(link).lock();
+			if ((node != NULL) && (node->getParentNode() != NULL)) {
+				auto result = coarseResults->find(node->getParentNode());
+				if ((result != coarseResults->end())
+						&& (result->second == false)) {
+					continue;
+				}
+			}
 		}
 
-		// compute second origin time
-		double tOrigin2 = -1;
-		if (travelTime2 > 0) {
-			tOrigin2 = tPick - travelTime2;
-		}
+		// if node triggered, add to triggered vector
+		addTriggerToList(vTrigger, nucleateNode(link, tPick, parentThread));
+	}
+}
 
-		// attempt to nucleate an event located
-		// at the current node with the potential origin times
-		bool primarySuccessful = false;
-		if (tOrigin1 > 0) {
-			std::shared_ptr<CTrigger> trigger1 = node->nucleate(tOrigin1,
-				parentThread);
-
-			if (trigger1 != NULL) {
-				// if node triggered, add to triggered vector
-				addTriggerToList(&vTrigger, trigger1);
-				primarySuccessful = true;
-			}
-		}
+// ---------------------------------------------------------nucleateNode
+std::shared_ptr<CTrigger> CSite::nucleateNode(const NodeLink &link,
+												double tPick,
+												CPickList* parentThread) {
+	if (parentThread != NULL) {
+		parentThread->setThreadHealth();
+	}
 
-		// only attempt secondary phase nucleation if primary nucleation
-		// was unsuccessful
-		if ((primarySuccessful == false) && (tOrigin2 > 0)) {
-			std::shared_ptr<CTrigger> trigger2 = node->nucleate(tOrigin2,
-				parentThread);
+	// compute potential origin time from tPick and travel time to node
+	// first get traveltime1 to node
+	double travelTime1 = std::get< LINK_TT1>(link);
 
-			if (trigger2 != NULL) {
-				// if node triggered, add to triggered vector
-				addTriggerToList(&vTrigger, trigger2);
-			}
+	// second get traveltime2 to node
+	double travelTime2 = std::get< LINK_TT2>(link);
+
+	// third get shared pointer to node
+	std::shared_ptr<CNode> node = std::get<LINK_PTR>(link).lock();
+
+	if (node == NULL) {
+		return (NULL);
+	}
+
+	if (node->getEnabled() == false) {
+		return (NULL);
+	}
+
+	// compute first origin time
+	double tOrigin1 = -1;
+	if (travelTime1 > 0) {
+		tOrigin1 = tPick - travelTime1;
+	}
+
+	// compute second origin time
+	double tOrigin2 = -1;
+	if (travelTime2 > 0) {
+		tOrigin2 = tPick - travelTime2;
+	}
+
+	// attempt to nucleate an event located
+	// at the current node with the potential origin times
+	if (tOrigin1 > 0) {
+		std::shared_ptr<CTrigger> trigger1 = node->nucleate(tOrigin1,
+			parentThread);
+
+		if (trigger1 != NULL) {
+			return (trigger1);
 		}
+	}
 
-		if ((tOrigin1 < 0) && (tOrigin2 < 0)) {
-			glass3::util::Logger::log(
-					"warning",
-					"CSite::nucleate: " + m_sSCNL + " No valid travel times. ("
-							+ std::to_string(travelTime1) + ", "
-							+ std::to_string(travelTime2) + ") web: "
-							+ node->getWeb()->getName());
+	// only attempt secondary phase nucleation if primary nucleation
+	// was unsuccessful
+	if (tOrigin2 > 0) {
+		std::shared_ptr<CTrigger> trigger2 = node->nucleate(tOrigin2,
+			parentThread);
+
+		if (trigger2 != NULL) {
+			return (trigger2);
 		}
 	}
 
-	return (vTrigger);
+	if ((tOrigin1 < 0) && (tOrigin2 < 0)) {
+		GLASS3_LOG_WARNING(
+				"CSite::nucleate: " + getSCNL() + " No valid travel times. ("
+						+ std::to_string(travelTime1) + ", "
+						+ std::to_string(travelTime2) + ") web: "
+						+ node->getWeb()->getName());
+	}
+
+	return (NULL);
 }
 
 // ---------------------------------------------------------addTrigger
@@ -922,7 +1050,12 @@ const std::string& CSite::getNetwork() const {
 
 // ---------------------------------------------------------getSCNL
 const std::string& CSite::getSCNL() const {
-	return (m_sSCNL);
+	return (m_SCNL.getString());
+}
+
+// ---------------------------------------------------------getSCNLHandle
+unsigned int CSite::getSCNLHandle() const {
+	return (m_SCNL.getHandle());
 }
 
 // ---------------------------------------------------------getSite
@@ -947,8 +1080,8 @@ int CSite::getPickCountSinceCheck() const {
 
 // ------------------------------------------------------getPickCount
 int CSite::getPickCount() const {
-	std::lock_guard<std::recursive_mutex> guard(m_SiteMutex);
-	return (m_msPickList.size());
+	std::lock_guard<std::mutex> guard(vPickMutex);
+	return (m_vPickBuffer.size() - m_iPickBufferStart);
 }
 
 // --------------------------------------------------------updatePosition
@@ -961,25 +1094,21 @@ void CSite::updatePosition(std::shared_ptr<CPick> pick) {
 		return;
 	}
 
-	std::lock_guard<std::recursive_mutex> listGuard(m_SiteMutex);
+	std::lock_guard<std::mutex> listGuard(vPickMutex);
 
-	// from my research, the best way to "update" the position of an item
-	// in a multiset when the key value has changed (in this case, the pick
-	// time) is to remove and re-add the item. This will give us O(log n)
-	// complexity for updating one item, which is better than a full sort
-	// (which I'm not really sure how to do on a multiset)
 	// erase
-	eraseFromMultiset(pick);
+	eraseFromPickBuffer(pick);
 
 	// update tSort
 	pick->setTSort(pick->getTPick());
 
 	// insert
-	m_msPickList.insert(pick);
+	insertIntoPickBuffer(pick);
+	publishPickSnapshot();
 }
 
-// ---------------------------------------------------------eraseFromMultiset
-void CSite::eraseFromMultiset(std::shared_ptr<CPick> pick) {
+// ---------------------------------------------------------eraseFromPickBuffer
+void CSite::eraseFromPickBuffer(std::shared_ptr<CPick> pick) {
 	// nullchecks
 	if (pick == NULL) {
 		return;
@@ -988,52 +1117,171 @@ void CSite::eraseFromMultiset(std::shared_ptr<CPick> pick) {
 		return;
 	}
 
-	std::lock_guard<std::recursive_mutex> listGuard(m_SiteMutex);
+	int size = m_vPickBuffer.size();
+	if (m_iPickBufferStart >= size) {
+		return;
+	}
+
+	// first, look for the pick at its sort time, multiple picks can have the
+	// same sort time so confirm the pick itself
+	int index = -1;
+	auto lower = std::lower_bound(
+			m_vPickBufferTimes.begin() + m_iPickBufferStart,
+			m_vPickBufferTimes.end(), pick->getTSort());
+	for (int i = lower - m_vPickBufferTimes.begin();
+			(i < size) && (m_vPickBufferTimes[i] == pick->getTSort()); i++) {
+		if (m_vPickBuffer[i] == pick) {
+			index = i;
+			break;
+		}
+	}
+
+	// the sort time may have changed since the pick was inserted, so fall
+	// back to looking through all picks
+	if (index < 0) {
+		for (int i = m_iPickBufferStart; i < size; i++) {
+			if (m_vPickBuffer[i] == pick) {
+				index = i;
+				break;
+			}
+		}
+	}
 
-	if (m_msPickList.size() == 0) {
+	if (index < 0) {
+		GLASS3_LOG_ERROR(
+				"CSite::eraseFromPickBuffer: did not delete pick "
+						+ pick->getID() + " in pick buffer, pick not found.");
 		return;
 	}
 
-	// first, try to delete the hypo the efficient way
-	// we need to be careful, because multiple hypos in the mulitset
-	// can have the same tSort, and a simple erase would delete
-	// them all, which would be BAD, so we need to confirm the id
-	auto lower = m_msPickList.lower_bound(pick);
-	auto upper = m_msPickList.upper_bound(pick);
+	if (index == m_iPickBufferStart) {
+		// the oldest pick, just vacate its slot
+		m_vPickBuffer[index].reset();
+		m_iPickBufferStart++;
+		m_iPickSnapshotRemoved++;
+	} else {
+		m_vPickBufferTimes.erase(m_vPickBufferTimes.begin() + index);
+		m_vPickBuffer.erase(m_vPickBuffer.begin() + index);
+		m_bPickSnapshotRebuild = true;
+	}
+
+	// compact the buffer once over half of it has been vacated
+	size = m_vPickBuffer.size();
+	if ((m_iPickBufferStart > 0) && (m_iPickBufferStart * 2 >= size)) {
+		m_vPickBufferTimes.erase(
+				m_vPickBufferTimes.begin(),
+				m_vPickBufferTimes.begin() + m_iPickBufferStart);
+		m_vPickBuffer.erase(m_vPickBuffer.begin(),
+							m_vPickBuffer.begin() + m_iPickBufferStart);
+		m_iPickBufferStart = 0;
+	}
+}
 
-	// for all matching (tSort range) hypos
-	for (auto it = lower; ((it != upper) && (it != m_msPickList.end())); ++it) {
-		std::shared_ptr<CPick> aPick = *it;
+// ---------------------------------------------------------insertIntoPickBuffer
+void CSite::insertIntoPickBuffer(std::shared_ptr<CPick> pick) {
+	double tSort = pick->getTSort();
 
-		// only erase the correct one
-		if (aPick->getID() == pick->getID()) {
-			m_msPickList.erase(it);
-			return;
-		}
+	// picks usually arrive in time order, so check the end first
+	if ((m_vPickBufferTimes.size() == 0)
+			|| (m_vPickBufferTimes.back() <= tSort)) {
+		m_vPickBufferTimes.push_back(tSort);
+		m_vPickBuffer.push_back(pick);
+		m_iPickSnapshotAppended++;
+		return;
 	}
 
-	glass3::util::Logger::log(
-			"warning",
-			"CSite::eraseFromMultiset: efficient delete for pick "
-					+ pick->getID() + " didn't work.");
+	m_bPickSnapshotRebuild = true;
 
-	// if we didn't delete it efficiently, loop through all picks, I know this is
-	// brute force, but the efficient delete didn't work and we want to be sure
-	// note: this may just be me being paranoid
-	for (auto it = m_msPickList.begin(); (it != m_msPickList.end()); ++it) {
-		std::shared_ptr<CPick> aPick = *it;
+	// insert after any picks with the same sort time
+	auto upper = std::upper_bound(
+			m_vPickBufferTimes.begin() + m_iPickBufferStart,
+			m_vPickBufferTimes.end(), tSort);
+	int index = upper - m_vPickBufferTimes.begin();
 
-		// only erase the correct one
-		if (aPick->getID() == pick->getID()) {
-			m_msPickList.erase(it);
-			return;
+	// reuse a vacated slot if the pick is older than every pick
+	if ((index == m_iPickBufferStart) && (m_iPickBufferStart > 0)) {
+		m_iPickBufferStart--;
+		m_vPickBufferTimes[m_iPickBufferStart] = tSort;
+		m_vPickBuffer[m_iPickBufferStart] = pick;
+		return;
+	}
+
+	m_vPickBufferTimes.insert(upper, tSort);
+	m_vPickBuffer.insert(m_vPickBuffer.begin() + index, pick);
+}
+
+// ---------------------------------------------------------publishPickSnapshot
+void CSite::publishPickSnapshot() {
+	if (CGlass::getSitePickSnapshots() == false) {
+		// drop any snapshot so it isn't used once it is out of date, and
+		// start over with a new block if snapshots are turned back on
+		if (m_pPickBlock != NULL) {
+			std::atomic_store(&m_pPickSnapshot,
+								std::shared_ptr<const SitePickSnapshot>());
+			m_pPickBlock.reset();
 		}
+		m_bPickSnapshotRebuild = true;
+		m_iPickSnapshotRemoved = 0;
+		m_iPickSnapshotAppended = 0;
+		return;
+	}
+
+	int numPicks = m_vPickBuffer.size() - m_iPickBufferStart;
+	int start = m_iPickSnapshotStart + m_iPickSnapshotRemoved;
+	int end = m_iPickSnapshotEnd + m_iPickSnapshotAppended;
+
+	// the current block can be reused if the picks were only removed from
+	// the front or appended to the end, and the appended picks fit
+	bool rebuild = m_bPickSnapshotRebuild;
+	if ((m_pPickBlock == NULL)
+			|| (m_iPickSnapshotRemoved
+					> (m_iPickSnapshotEnd - m_iPickSnapshotStart))
+			|| (end - start != numPicks)
+			|| (end > static_cast<int>(m_pPickBlock->vPicks.size()))) {
+		rebuild = true;
+	}
+
+	// start a new block once over half of the current one has been removed,
+	// so that removed picks are released
+	if ((start > 0) && (start * 2 >= end)) {
+		rebuild = true;
+	}
+
+	if (rebuild == true) {
+		int size = std::max(k_iMinimumPickBlockSize, numPicks * 2);
+		m_pPickBlock = std::make_shared<SitePickBlock>();
+		m_pPickBlock->vdPickTimes.resize(size);
+		m_pPickBlock->vPicks.resize(size);
+		std::copy(m_vPickBufferTimes.begin() + m_iPickBufferStart,
+					m_vPickBufferTimes.end(),
+					m_pPickBlock->vdPickTimes.begin());
+		std::copy(m_vPickBuffer.begin() + m_iPickBufferStart,
+					m_vPickBuffer.end(), m_pPickBlock->vPicks.begin());
+		start = 0;
+		end = numPicks;
+	} else {
+		// append the new picks past the end of the published snapshot,
+		// which no snapshot reader looks at
+		int first = m_vPickBuffer.size() - m_iPickSnapshotAppended;
+		std::copy(m_vPickBufferTimes.begin() + first, m_vPickBufferTimes.end(),
+					m_pPickBlock->vdPickTimes.begin() + m_iPickSnapshotEnd);
+		std::copy(m_vPickBuffer.begin() + first, m_vPickBuffer.end(),
+					m_pPickBlock->vPicks.begin() + m_iPickSnapshotEnd);
 	}
 
-	glass3::util::Logger::log(
-			"error",
-			"CSite::eraseFromMultiset: did not delete pick " + pick->getID()
-					+ " in multiset, id not found.");
+	std::shared_ptr<SitePickSnapshot> snapshot = std::make_shared<
+			SitePickSnapshot>();
+	snapshot->pBlock = m_pPickBlock;
+	snapshot->iStart = start;
+	snapshot->iEnd = end;
+	std::atomic_store(&m_pPickSnapshot,
+						std::shared_ptr<const SitePickSnapshot>(snapshot));
+
+	m_iPickSnapshotStart = start;
+	m_iPickSnapshotEnd = end;
+	m_iPickSnapshotRemoved = 0;
+	m_iPickSnapshotAppended = 0;
+	m_bPickSnapshotRebuild = false;
 }
 
 }  // namespace glasscore
@@ -0,0 +1,231 @@
+#include "SiteIndex.h"
+#include <geo.h>
+#include <internedid.h>
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Site.h"
+
+namespace glasscore {
+
+// constants
+const int CSiteIndex::k_iNumCellsPerAxis;
+
+// site sorting function
+// Compares nodal distance for nearest site assignment
+bool sortSite(const std::pair<double, std::shared_ptr<CSite>> &lhs,
+				const std::pair<double, std::shared_ptr<CSite>> &rhs) {
+	// compare
+	if (lhs.first < rhs.first) {
+		return (true);
+	}
+
+	// lhs > rhs
+	return (false);
+}
+
+// ---------------------------------------------------------CSiteIndex
+CSiteIndex::CSiteIndex() {
+	clear();
+}
+
+// ---------------------------------------------------------~CSiteIndex
+CSiteIndex::~CSiteIndex() {
+}
+
+// ---------------------------------------------------------clear
+void CSiteIndex::clear() {
+	m_vCells.clear();
+	m_vCells.resize(
+			k_iNumCellsPerAxis * k_iNumCellsPerAxis * k_iNumCellsPerAxis);
+	m_mSiteCells.clear();
+}
+
+// ---------------------------------------------------------addSite
+bool CSiteIndex::addSite(std::shared_ptr<CSite> site) {
+	// nullcheck
+	if (site == NULL) {
+		return (false);
+	}
+
+	// remove any existing entry, the site may have moved
+	removeSite(site->getSCNL());
+
+	// use a copy of the site location
+	glass3::util::Geo siteGeo = site->getGeo();
+
+	int cellIndex = getCellIndex(getAxisIndex(siteGeo.m_dUnitVectorX),
+									getAxisIndex(siteGeo.m_dUnitVectorY),
+									getAxisIndex(siteGeo.m_dUnitVectorZ));
+
+	m_vCells[cellIndex].push_back(
+			std::pair<glass3::util::Geo, std::shared_ptr<CSite>>(siteGeo, site));
+	m_mSiteCells[site->getSCNLHandle()] = cellIndex;
+
+	return (true);
+}
+
+// ---------------------------------------------------------removeSite
+bool CSiteIndex::removeSite(const std::string &scnl) {
+	auto found = m_mSiteCells.find(
+			glass3::util::InternedID::findHandle(scnl));
+	if (found == m_mSiteCells.end()) {
+		return (false);
+	}
+
+	// remove the site from its cell
+	std::vector<std::pair<glass3::util::Geo, std::shared_ptr<CSite>>> &cell =
+			m_vCells[found->second];
+	for (auto it = cell.begin(); it != cell.end(); ++it) {
+		if ((*it).second->getSCNL() == scnl) {
+			cell.erase(it);
+			break;
+		}
+	}
+
+	m_mSiteCells.erase(found);
+
+	return (true);
+}
+
+// ---------------------------------------------------------hasSite
+bool CSiteIndex::hasSite(const std::string &scnl) const {
+	return (m_mSiteCells.find(glass3::util::InternedID::findHandle(scnl))
+			!= m_mSiteCells.end());
+}
+
+// ---------------------------------------------------------getNearestSites
+std::vector<std::pair<double, std::shared_ptr<CSite>>> CSiteIndex::getNearestSites(  // NOLINT
+		const glass3::util::Geo &geo, int numSites) const {
+	std::vector<std::pair<double, std::shared_ptr<CSite>>> nearestSites;
+
+	if ((numSites <= 0) || (m_mSiteCells.size() == 0)) {
+		return (nearestSites);
+	}
+
+	if (numSites > static_cast<int>(m_mSiteCells.size())) {
+		numSites = m_mSiteCells.size();
+	}
+
+	// the cell containing the location
+	int xIndex = getAxisIndex(geo.m_dUnitVectorX);
+	int yIndex = getAxisIndex(geo.m_dUnitVectorY);
+	int zIndex = getAxisIndex(geo.m_dUnitVectorZ);
+
+	double cellSize = 2.0 / static_cast<double>(k_iNumCellsPerAxis);
+
+	// search outward one shell of cells at a time, keeping the nearest sites
+	// found so far in a max heap on distance
+	for (int shell = 0; shell <= k_iNumCellsPerAxis; shell++) {
+		for (int i = std::max(xIndex - shell, 0);
+				i <= std::min(xIndex + shell, k_iNumCellsPerAxis - 1); i++) {
+			for (int j = std::max(yIndex - shell, 0);
+					j <= std::min(yIndex + shell, k_iNumCellsPerAxis - 1); j++) {
+				for (int k = std::max(zIndex - shell, 0);
+						k <= std::min(zIndex + shell, k_iNumCellsPerAxis - 1);
+						k++) {
+					// only the cells on this shell, the inner ones are done
+					if ((std::abs(i - xIndex) != shell)
+							&& (std::abs(j - yIndex) != shell)
+							&& (std::abs(k - zIndex) != shell)) {
+						continue;
+					}
+
+					for (const auto &entry : m_vCells[getCellIndex(i, j, k)]) {
+						// compute the distance the same way as CSite::getDelta
+						double distance = entry.first.delta(&geo);
+
+						if (static_cast<int>(nearestSites.size()) < numSites) {
+							nearestSites.push_back(
+									std::pair<double, std::shared_ptr<CSite>>(
+											distance, entry.second));
+							std::push_heap(nearestSites.begin(),
+											nearestSites.end(), sortSite);
+						} else if (distance < nearestSites.front().first) {
+							std::pop_heap(nearestSites.begin(), nearestSites.end(),
+											sortSite);
+							nearestSites.back() =
+									std::pair<double, std::shared_ptr<CSite>>(
+											distance, entry.second);
+							std::push_heap(nearestSites.begin(),
+											nearestSites.end(), sortSite);
+						}
+					}
+				}
+			}
+		}
+
+		// any site outside the searched cells is at least this far away, as
+		// a chord between unit vectors
+		double minimumChord = static_cast<double>(shell) * cellSize;
+
+		// done once the farthest site kept is closer than any unsearched one
+		if ((static_cast<int>(nearestSites.size()) == numSites)
+				&& (minimumChord < 2.0)
+				&& (nearestSites.front().first
+						< 2.0 * asin(minimumChord / 2.0) * (1.0 - 1.0e-9))) {
+			break;
+		}
+	}
+
+	std::sort_heap(nearestSites.begin(), nearestSites.end(), sortSite);
+
+	return (nearestSites);
+}
+
+// ---------------------------------------------------------size
+int CSiteIndex::size() const {
+	return (m_mSiteCells.size());
+}
+
+// ---------------------------------------------------------getAxisIndex
+int CSiteIndex::getAxisIndex(double unitVector) {
+	int index = static_cast<int>(floor(
+			(unitVector + 1.0) / 2.0 * static_cast<double>(k_iNumCellsPerAxis)));
+
+	// bounds checks
+	if (index < 0) {
+		return (0);
+	} else if (index >= k_iNumCellsPerAxis) {
+		return (k_iNumCellsPerAxis - 1);
+	}
+
+	return (index);
+}
+
+// ---------------------------------------------------------getCellIndex
+int CSiteIndex::getCellIndex(int xIndex, int yIndex, int zIndex) {
+	return ((xIndex * k_iNumCellsPerAxis + yIndex) * k_iNumCellsPerAxis
+			+ zIndex);
+}
+
+// ---------------------------------------------------------getCellChord
+double CSiteIndex::getCellChord(const glass3::util::Geo &geo, int cellIndex) {
+	int numCells = k_iNumCellsPerAxis;
+	double cellSize = 2.0 / static_cast<double>(numCells);
+	int axisIndexes[3] = { cellIndex / (numCells * numCells), (cellIndex
+			/ numCells) % numCells, cellIndex % numCells };
+	double unitVector[3] = { geo.m_dUnitVectorX, geo.m_dUnitVectorY,
+			geo.m_dUnitVectorZ };
+
+	// distance from the unit vector to the nearest point in the cell's box
+	double sumSquares = 0;
+	for (int i = 0; i < 3; i++) {
+		double lower = -1.0 + axisIndexes[i] * cellSize;
+		double upper = lower + cellSize;
+		double difference = 0;
+		if (unitVector[i] < lower) {
+			difference = lower - unitVector[i];
+		} else if (unitVector[i] > upper) {
+			difference = unitVector[i] - upper;
+		}
+		sumSquares += difference * difference;
+	}
+
+	return (sqrt(sumSquares));
+}
+}  // namespace glasscore
@@ -58,8 +58,7 @@ void CSiteList::clear() {
 bool CSiteList::receiveExternalMessage(std::shared_ptr<json::Object> com) {
 	// null check json
 	if (com == NULL) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CSiteList::receiveExternalMessage: NULL json communication.");
 		return (false);
 	}
@@ -101,8 +100,7 @@ bool CSiteList::receiveExternalMessage(std::shared_ptr<json::Object> com) {
 bool CSiteList::addSiteFromJSON(std::shared_ptr<json::Object> com) {
 	// null check json
 	if (com == NULL) {
-		glass3::util::Logger::log("error",
-								"CSiteList::addSite: NULL json configuration.");
+		GLASS3_LOG_ERROR("CSiteList::addSite: NULL json configuration.");
 		return (false);
 	}
 
@@ -112,15 +110,12 @@ bool CSiteList::addSiteFromJSON(std::shared_ptr<json::Object> com) {
 		std::string type = (*com)["Type"].ToString();
 
 		if (type != "StationInfo") {
-			glass3::util::Logger::log(
-					"warning",
+			GLASS3_LOG_WARNING(
 					"CSiteList::addSite: Non-StationInfo message passed in.");
 			return (false);
 		}
 	} else {
-		glass3::util::Logger::log(
-				"error",
-				"CSiteList::addSite: Missing required Cmd Key.");
+		GLASS3_LOG_ERROR("CSiteList::addSite: Missing required Cmd Key.");
 	}
 
 	// create a new a site from the json message;
@@ -128,8 +123,7 @@ bool CSiteList::addSiteFromJSON(std::shared_ptr<json::Object> com) {
 
 	// make sure a site was actually created
 	if (site->getSCNL() == "") {
-		glass3::util::Logger::log("warning",
-								"CSiteList::addSite: Site not created.");
+		GLASS3_LOG_WARNING("CSiteList::addSite: Site not created.");
 		delete (site);
 		return (false);
 	}
@@ -144,9 +138,7 @@ bool CSiteList::addSiteFromJSON(std::shared_ptr<json::Object> com) {
 bool CSiteList::addListOfSitesFromJSON(std::shared_ptr<json::Object> com) {
 	// null check json
 	if (com == NULL) {
-		glass3::util::Logger::log(
-				"error",
-				"CSiteList::addSiteList: NULL json configuration.");
+		GLASS3_LOG_ERROR("CSiteList::addSiteList: NULL json configuration.");
 		return (false);
 	}
 
@@ -156,16 +148,13 @@ bool CSiteList::addListOfSitesFromJSON(std::shared_ptr<json::Object> com) {
 		std::string type = (*com)["Type"].ToString();
 
 		if (type != "StationInfoList") {
-			glass3::util::Logger::log(
-					"warning",
+			GLASS3_LOG_WARNING(
 					"CSiteList::addSite: Non-StationInfoList message passed"
 					" in.");
 			return (false);
 		}
 	} else {
-		glass3::util::Logger::log(
-				"error",
-				"CSiteList::addSite: Missing required Type Key.");
+		GLASS3_LOG_ERROR("CSiteList::addSite: Missing required Type Key.");
 	}
 
 	// what time is it
@@ -191,8 +180,7 @@ bool CSiteList::addListOfSitesFromJSON(std::shared_ptr<json::Object> com) {
 
 				// make sure a site was actually created
 				if (site->getSCNL() == "") {
-					glass3::util::Logger::log(
-							"warning",
+					GLASS3_LOG_WARNING(
 							"CSiteList::addSiteList: Site not created.");
 					delete (site);
 					continue;
@@ -210,8 +198,7 @@ bool CSiteList::addListOfSitesFromJSON(std::shared_ptr<json::Object> com) {
 					// have we not seen data?
 					if ((tNow - newSite->getTLastPickAdded())
 							> (k_nHoursToSeconds * m_iMaxHoursWithoutPicking)) {
-						glass3::util::Logger::log(
-							"debug",
+						GLASS3_LOG_DEBUG(
 							"CSiteList::addSiteList: Marking Site " + site->getSCNL()
 							+ " not used due to exceeding MaxHoursWithoutPicking.");
 						newSite->setUse(false);
@@ -230,8 +217,7 @@ bool CSiteList::addListOfSitesFromJSON(std::shared_ptr<json::Object> com) {
 
 				// add the new site to the list
 				if (addSite(newSite) == false) {
-					glass3::util::Logger::log(
-							"warning",
+					GLASS3_LOG_WARNING(
 							"CSiteList::addSiteList: Site " + site->getSCNL()
 							+ " not added.");
 					delete (site);
@@ -246,8 +232,7 @@ bool CSiteList::addListOfSitesFromJSON(std::shared_ptr<json::Object> com) {
 		}
 	}
 
-	glass3::util::Logger::log(
-							"debug",
+	GLASS3_LOG_DEBUG(
 							"CSiteList::addSiteList: Loaded " + std::to_string(siteCount)
 							+ " sites; " + std::to_string(usedSiteCount) + " usable sites.");
 
@@ -258,8 +243,7 @@ bool CSiteList::addListOfSitesFromJSON(std::shared_ptr<json::Object> com) {
 bool CSiteList::addSite(std::shared_ptr<CSite> site) {
 	// null check
 	if (site == NULL) {
-		glass3::util::Logger::log("error",
-								"CSiteList::addSite: NULL CSite provided.");
+		GLASS3_LOG_ERROR("CSiteList::addSite: NULL CSite provided.");
 		return (false);
 	}
 
@@ -280,7 +264,7 @@ bool CSiteList::addSite(std::shared_ptr<CSite> site) {
 	} else {
 		// add new site to list and map
 		m_vSite.push_back(site);
-		m_mSite[site->getSCNL()] = site;
+		m_mSite[site->getSCNLHandle()] = site;
 
 		// pass new site to webs
 		if (CGlass::getWebList()) {
@@ -305,17 +289,16 @@ bool CSiteList::addSite(std::shared_ptr<CSite> site) {
 // ---------------------------------------------------------getSite
 std::shared_ptr<CSite> CSiteList::getSite(std::string scnl) {
 	if (scnl == "") {
-		glass3::util::Logger::log("error",
-								"CSiteList::getSite: Empty site passed in.");
+		GLASS3_LOG_ERROR("CSiteList::getSite: Empty site passed in.");
 		return (NULL);
 	}
 
 	std::lock_guard<std::recursive_mutex> guard(m_SiteListMutex);
 
 	// lookup the site in the map by scnl
-	auto itsite = m_mSite.find(scnl);
+	auto itsite = m_mSite.find(glass3::util::InternedID::findHandle(scnl));
 	if (itsite != m_mSite.end()) {
-		return (m_mSite[scnl]);
+		return (itsite->second);
 	}
 
 	// nothing found
@@ -326,14 +309,12 @@ std::shared_ptr<CSite> CSiteList::getSite(std::string scnl) {
 std::shared_ptr<CSite> CSiteList::getSite(std::string site, std::string comp,
 											std::string net, std::string loc) {
 	if (site == "") {
-		glass3::util::Logger::log("error",
-								"CSiteList::getSite: Empty site passed in.");
+		GLASS3_LOG_ERROR("CSiteList::getSite: Empty site passed in.");
 		return (NULL);
 	}
 
 	if (net == "") {
-		glass3::util::Logger::log("error",
-								"CSiteList::getSite: Empty network passed in.");
+		GLASS3_LOG_ERROR("CSiteList::getSite: Empty network passed in.");
 		return (NULL);
 	}
 
@@ -344,8 +325,7 @@ std::shared_ptr<CSite> CSiteList::getSite(std::string site, std::string comp,
 	if (site != "") {
 		scnl += site;
 	} else {
-		glass3::util::Logger::log("error",
-								"CSiteList::getSite: missing sSite.");
+		GLASS3_LOG_ERROR("CSiteList::getSite: missing sSite.");
 		return (NULL);
 	}
 
@@ -358,8 +338,7 @@ std::shared_ptr<CSite> CSiteList::getSite(std::string site, std::string comp,
 	if (net != "") {
 		scnl += "." + net;
 	} else {
-		glass3::util::Logger::log("error",
-								"CSiteList::getSite: missing sNet.");
+		GLASS3_LOG_ERROR("CSiteList::getSite: missing sNet.");
 		return (NULL);
 	}
 
@@ -407,11 +386,9 @@ std::shared_ptr<CSite> CSiteList::getSite(std::string site, std::string comp,
 			(*request)["Loc"] = loc;
 
 			// log
-			char sLog[glass3::util::Logger::k_nMaxLogEntrySize];
-			snprintf(sLog, sizeof(sLog), "CSiteList::getSite: SCNL:%s, "
+			GLASS3_LOG_DEBUG_FORMAT("CSiteList::getSite: SCNL:%s, "
 						"requesting information.",
 						scnl.c_str());
-			glass3::util::Logger::log(sLog);
 
 			// send request
 			CGlass::sendExternalMessage(request);
@@ -535,7 +512,7 @@ glass3::util::WorkState CSiteList::work() {
 	// remember when we last checked
 	m_tLastChecked = tNow;
 
-	glass3::util::Logger::log("info",
+	GLASS3_LOG_INFO(
 							"CSiteList::work: Updating used sites based on statistics.");
 
 	// create a vector to hold the sites that have changed
@@ -560,8 +537,7 @@ glass3::util::WorkState CSiteList::work() {
 				// have we not seen data?
 				if ((tNow - tLastPickAdded)
 						> (k_nHoursToSeconds * m_iMaxHoursWithoutPicking)) {
-					glass3::util::Logger::log(
-							"debug",
+					GLASS3_LOG_DEBUG(
 							"CSiteList::work: Removing " + aSite->getSCNL()
 									+ " for not picking in "
 									+ std::to_string(tNow - tLastPickAdded)
@@ -577,8 +553,7 @@ glass3::util::WorkState CSiteList::work() {
 
 				// we check every hour, so picks since check is picks per hour
 				if (picksSinceCheck > m_iMaxPicksPerHour) {
-					glass3::util::Logger::log(
-							"debug",
+					GLASS3_LOG_DEBUG(
 							"CSiteList::work: Removing " + aSite->getSCNL()
 									+ " for picking more than "
 									+ std::to_string(m_iMaxPicksPerHour)
@@ -623,8 +598,7 @@ glass3::util::WorkState CSiteList::work() {
 				// have we seen data?
 				if ((tNow - tLastPickAdded)
 						< (k_nHoursToSeconds * m_iMaxHoursWithoutPicking)) {
-					glass3::util::Logger::log(
-							"debug",
+					GLASS3_LOG_DEBUG(
 							"CSiteList::work: Added " + aSite->getSCNL()
 									+ " because it has picked within "
 									+ std::to_string(tNow - tLastPickAdded)
@@ -642,8 +616,7 @@ glass3::util::WorkState CSiteList::work() {
 				// we check every hour, so picks since check is picks per hour
 				// also, don't bother turning on a site that hasn't seen any picks
 				if ((picksSinceCheck > 0) && (picksSinceCheck < m_iMaxPicksPerHour)) {
-					glass3::util::Logger::log(
-							"debug",
+					GLASS3_LOG_DEBUG(
 							"CSiteList::work: Added " + aSite->getSCNL()
 									+ " for picking less than "
 									+ std::to_string(m_iMaxPicksPerHour)
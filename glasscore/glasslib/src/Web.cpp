@@ -2,6 +2,7 @@
 #include <json.h>
 #include <logger.h>
 #include <geo.h>
+#include <threadpool.h>
 #include <cmath>
 #include <algorithm>
 #include <string>
@@ -27,29 +28,20 @@ namespace glasscore {
 // constants
 constexpr double CWeb::k_dAzimuthTaperDefault;
 constexpr double CWeb::k_dDepthResolutionUndefined;
+constexpr double CWeb::k_dCoarseResolutionUndefined;
+constexpr double CWeb::k_dCoarseThresholdFactorDefault;
 constexpr double CWeb::k_dFibonacciRatio;
 const int CWeb::k_iNodeLatitudeIndex;
 const int CWeb::k_iNodeLongitudeIndex;
 const int CWeb::k_iNodeDepthIndex;
 constexpr double CWeb::k_dMinimumMaxNodeDepth;
 
-// site sorting function
-// Compares nodal distance for nearest site assignment
-bool sortSite(const std::pair<double, std::shared_ptr<CSite>> &lhs,
-				const std::pair<double, std::shared_ptr<CSite>> &rhs) {
-	// compare
-	if (lhs.first < rhs.first) {
-		return (true);
-	}
-
-	// lhs > rhs
-	return (false);
-}
-
 // ---------------------------------------------------------CWeb
 CWeb::CWeb(int numThreads, int sleepTime, int checkInterval)
 		: glass3::util::ThreadBaseClass("Web", sleepTime, numThreads,
 										checkInterval) {
+	m_pJobPool = NULL;
+	m_bJobsScheduled = false;
 	clear();
 
 	// start up the threads
@@ -65,6 +57,8 @@ CWeb::CWeb(std::string name, double thresh, int numDetect, int numNucleate,
 			double aSeismicThresh, int numASeismicNucleate)
 		: glass3::util::ThreadBaseClass("Web", sleepTime, numThreads,
 										checkInterval) {
+	m_pJobPool = NULL;
+	m_bJobsScheduled = false;
 	clear();
 
 	initialize(name, thresh, numDetect, numNucleate, resolution, update,
@@ -77,6 +71,11 @@ CWeb::CWeb(std::string name, double thresh, int numDetect, int numNucleate,
 
 // ---------------------------------------------------------~CWeb
 CWeb::~CWeb() {
+	// wait for any queued jobs running in the job pool to let go of us
+	std::unique_lock<std::mutex> queueLock(m_QueueMutex);
+	m_JobsScheduledCondition.wait(queueLock, [this]() {
+		return (m_bJobsScheduled == false);
+	});
 }
 
 // ---------------------------------------------------------clear
@@ -89,6 +88,8 @@ void CWeb::clear() {
 	m_dASeismicNucleationStackThreshold = 2.5;
 	m_dNodeResolution = 100;
 	m_dDepthResolution = k_dDepthResolutionUndefined;
+	m_dCoarseResolution = k_dCoarseResolutionUndefined;
+	m_dCoarseThresholdFactor = k_dCoarseThresholdFactorDefault;
 	m_sName = "UNDEFINED";
 	m_pSiteList = NULL;
 	m_bUpdate = false;
@@ -122,6 +123,7 @@ void CWeb::clear() {
 	try {
 		m_vSiteMutex.lock();
 		m_vSitesSortedForCurrentNode.clear();
+		m_SiteIndex.clear();
 	} catch (...) {
 		// ensure the vSite mutex is unlocked
 		m_vSiteMutex.unlock();
@@ -172,8 +174,7 @@ bool CWeb::initialize(std::string name, double thresh, int numDetect,
 
 	m_tLastUpdated = -1;
 
-	glass3::util::Logger::log(
-			"debug",
+	GLASS3_LOG_DEBUG(
 			"CWeb::initialize: aSeismicThresh=" + std::to_string(aSeismicThresh));
 
 	// default to nucleation stack threshold
@@ -182,8 +183,7 @@ bool CWeb::initialize(std::string name, double thresh, int numDetect,
 		m_dASeismicNucleationStackThreshold = aSeismicThresh;
 	}
 
-	glass3::util::Logger::log(
-			"debug",
+	GLASS3_LOG_DEBUG(
 			"CWeb::initialize: numASeismicNucleate="
 			+ std::to_string(numASeismicNucleate));
 
@@ -201,8 +201,7 @@ bool CWeb::initialize(std::string name, double thresh, int numDetect,
 bool CWeb::receiveExternalMessage(std::shared_ptr<json::Object> com) {
 	// null check json
 	if (com == NULL) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CWeb::receiveExternalMessage: NULL json communication.");
 		return (false);
 	}
@@ -235,17 +234,15 @@ bool CWeb::receiveExternalMessage(std::shared_ptr<json::Object> com) {
 
 // ---------------------------------------------------------generateGlobalGrid
 bool CWeb::generateGlobalGrid(std::shared_ptr<json::Object> gridConfiguration) {
-	glass3::util::Logger::log("debug", "CWeb::generateGlobalGrid");
+	GLASS3_LOG_DEBUG("CWeb::generateGlobalGrid");
 
 	// nullchecks
 	// check json
 	if (gridConfiguration == NULL) {
-		glass3::util::Logger::log(
-				"error", "CWeb::generateGlobalGrid: NULL json configuration.");
+		GLASS3_LOG_ERROR("CWeb::generateGlobalGrid: NULL json configuration.");
 		return (false);
 	}
 
-	char sLog[glass3::util::Logger::k_nMaxLogEntrySize];
 	std::vector<double> depthLayerArray;
 	int numDepthLayers = 0;
 
@@ -266,8 +263,7 @@ bool CWeb::generateGlobalGrid(std::shared_ptr<json::Object> gridConfiguration) {
 		}
 		numDepthLayers = static_cast<int>(depthLayerArray.size());
 	} else {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CWeb::generateGlobalGrid: Missing required DepthLayers Array.");
 		return (false);
 	}
@@ -286,9 +282,8 @@ bool CWeb::generateGlobalGrid(std::shared_ptr<json::Object> gridConfiguration) {
 		numNodes += 1;
 	}
 
-	snprintf(sLog, sizeof(sLog),
+	GLASS3_LOG_DEBUG_FORMAT(
 				"CWeb::generateGlobalGrid: Calculated numNodes:%d;", numNodes);
-	glass3::util::Logger::log(sLog);
 
 	// create / open gridfile for saving
 	std::ofstream outfile;
@@ -387,6 +382,9 @@ bool CWeb::generateGlobalGrid(std::shared_ptr<json::Object> gridConfiguration) {
 		}  // end for each depth in depthLayerArray
 	}  // end for each sample
 
+	// screen the nodes with coarse nodes if configured
+	generateCoarseNodes();
+
 	// close generateLocalGrid file
 	if (getSaveGrid()) {
 		outfile.close();
@@ -402,8 +400,7 @@ bool CWeb::generateGlobalGrid(std::shared_ptr<json::Object> gridConfiguration) {
 	}
 
 	// log grid info
-	snprintf(
-			sLog, sizeof(sLog),
+	GLASS3_LOG_INFO_FORMAT(
 			"CWeb::generateGlobalGrid sName:%s Phase(s):%s; nZ:%d; resol:%.2f;"
 			" nDetect:%d; nNucleate:%d; dThresh:%.2f; ASnNucleate:%d; ASdThresh:%.2f;"
 			" vNetFilter:%d; vSitesFilter:%d; bUseOnlyTeleseismicStations:%d;"
@@ -416,7 +413,6 @@ bool CWeb::generateGlobalGrid(std::shared_ptr<json::Object> gridConfiguration) {
 			static_cast<int>(m_vNetworksFilter.size()),
 			static_cast<int>(m_vSitesFilter.size()),
 			static_cast<int>(m_bUseOnlyTeleseismicStations), iNodeCount);
-	glass3::util::Logger::log("info", sLog);
 
 	// success
 	return (true);
@@ -424,17 +420,15 @@ bool CWeb::generateGlobalGrid(std::shared_ptr<json::Object> gridConfiguration) {
 
 // ---------------------------------------------------------generateLocalGrid
 bool CWeb::generateLocalGrid(std::shared_ptr<json::Object> gridConfiguration) {
-	glass3::util::Logger::log("debug", "CWeb::generateLocalGrid");
+	GLASS3_LOG_DEBUG("CWeb::generateLocalGrid");
 
 	// nullchecks
 	// check json
 	if (gridConfiguration == NULL) {
-		glass3::util::Logger::log(
-				"error", "CWeb::generateLocalGrid: NULL json configuration.");
+		GLASS3_LOG_ERROR("CWeb::generateLocalGrid: NULL json configuration.");
 		return (false);
 	}
 
-	char sLog[glass3::util::Logger::k_nMaxLogEntrySize];
 	double lat = 0;
 	double lon = 0;
 	int rows = 0;
@@ -453,8 +447,7 @@ bool CWeb::generateLocalGrid(std::shared_ptr<json::Object> gridConfiguration) {
 					== json::ValueType::DoubleVal)) {
 		lat = (*gridConfiguration)["CenterLatitude"].ToDouble();
 	} else {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CWeb::generateLocalGrid: Missing required CenterLatitude Key.");
 		return (false);
 	}
@@ -465,8 +458,7 @@ bool CWeb::generateLocalGrid(std::shared_ptr<json::Object> gridConfiguration) {
 					== json::ValueType::DoubleVal)) {
 		lon = (*gridConfiguration)["CenterLongitude"].ToDouble();
 	} else {
-		glass3::util::Logger::log(
-				"error", "CWeb::generateLocalGrid: Missing required Lon Key.");
+		GLASS3_LOG_ERROR("CWeb::generateLocalGrid: Missing required Lon Key.");
 		return (false);
 	}
 
@@ -482,8 +474,7 @@ bool CWeb::generateLocalGrid(std::shared_ptr<json::Object> gridConfiguration) {
 		}
 		numDepthLayers = static_cast<int>(depthLayerArray.size());
 	} else {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CWeb::generateLocalGrid: Missing required DepthLayers Array.");
 		return (false);
 	}
@@ -494,8 +485,7 @@ bool CWeb::generateLocalGrid(std::shared_ptr<json::Object> gridConfiguration) {
 					== json::ValueType::IntVal)) {
 		rows = (*gridConfiguration)["NumberOfRows"].ToInt();
 	} else {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CWeb::generateLocalGrid: Missing required NumberOfRows Key.");
 		return (false);
 	}
@@ -506,8 +496,7 @@ bool CWeb::generateLocalGrid(std::shared_ptr<json::Object> gridConfiguration) {
 					== json::ValueType::IntVal)) {
 		cols = (*gridConfiguration)["NumberOfColumns"].ToInt();
 	} else {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CWeb::generateLocalGrid: Missing required NumberOfColumns Key.");
 		return (false);
 	}
@@ -571,8 +560,7 @@ bool CWeb::generateLocalGrid(std::shared_ptr<json::Object> gridConfiguration) {
 		double latrow = lat0 - (irow * latDistance);
 
 		// log the latitude
-		snprintf(sLog, sizeof(sLog), "LatRow:%.2f", latrow);
-		glass3::util::Logger::log("debug", sLog);
+		GLASS3_LOG_DEBUG_FORMAT("LatRow:%.2f", latrow);
 		// for each col
 		for (int icol = 0; icol < cols; icol++) {
 			// compute the current column longitude by adding the
@@ -633,6 +621,9 @@ bool CWeb::generateLocalGrid(std::shared_ptr<json::Object> gridConfiguration) {
 		}  // end for each lon-column in grid
 	}  // end for each lat-row in grid
 
+	// screen the nodes with coarse nodes if configured
+	generateCoarseNodes();
+
 	// close generateLocalGrid file
 	if (getSaveGrid()) {
 		outfile.close();
@@ -648,9 +639,7 @@ bool CWeb::generateLocalGrid(std::shared_ptr<json::Object> gridConfiguration) {
 	}
 
 	// log local grid info
-	snprintf(
-			sLog,
-			sizeof(sLog),
+	GLASS3_LOG_INFO_FORMAT(
 			"CWeb::generateLocalGrid sName:%s Phase(s):%s; Ranges:Lat(%.2f,%.2f),"
 			" Lon:(%.2f,%.2f); nRow:%d; nCol:%d; nZ:%d; resol:%.2f;"
 			" nDetect:%d; nNucleate:%d; dThresh:%.2f; ASnNucleate:%d; ASdThresh:%.2f;"
@@ -666,7 +655,6 @@ bool CWeb::generateLocalGrid(std::shared_ptr<json::Object> gridConfiguration) {
 			static_cast<int>(m_vNetworksFilter.size()),
 			static_cast<int>(m_vSitesFilter.size()),
 			static_cast<int>(m_bUseOnlyTeleseismicStations), iNodeCount);
-	glass3::util::Logger::log("info", sLog);
 
 	// success
 	return (true);
@@ -675,18 +663,16 @@ bool CWeb::generateLocalGrid(std::shared_ptr<json::Object> gridConfiguration) {
 // ---------------------------------------------------------generateExplicitGrid
 bool CWeb::generateExplicitGrid(
 		std::shared_ptr<json::Object> gridConfiguration) {
-	glass3::util::Logger::log("debug", "CWeb::generateExplicitGrid");
+	GLASS3_LOG_DEBUG("CWeb::generateExplicitGrid");
 
 	// nullchecks
 	// check json
 	if (gridConfiguration == NULL) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CWeb::generateExplicitGrid: NULL json configuration.");
 		return (false);
 	}
 
-	char sLog[glass3::util::Logger::k_nMaxLogEntrySize];
 
 	// load basic (common) grid configuration
 	if (loadGridConfiguration(gridConfiguration) == false) {
@@ -711,8 +697,7 @@ bool CWeb::generateExplicitGrid(
 		int i = 0;
 		for (const auto &val : nodeList) {
 			if (val.GetType() != json::ValueType::ObjectVal) {
-				glass3::util::Logger::log(
-						"error",
+				GLASS3_LOG_ERROR(
 						"CWeb::generateExplicitGrid: Bad Node Definition found"
 						" in Node List.");
 				continue;
@@ -721,8 +706,7 @@ bool CWeb::generateExplicitGrid(
 			if (obj["Latitude"].GetType() != json::ValueType::DoubleVal
 					|| obj["Longitude"].GetType() != json::ValueType::DoubleVal
 					|| obj["Depth"].GetType() != json::ValueType::DoubleVal) {
-				glass3::util::Logger::log(
-						"error",
+				GLASS3_LOG_ERROR(
 						"CWeb::generateExplicitGrid: Node Lat, Lon, or Depth not"
 						" a  double in param file.");
 				return (false);
@@ -737,8 +721,7 @@ bool CWeb::generateExplicitGrid(
 			i++;
 		}
 	} else {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CWeb::generateExplicitGrid: Missing required NodeList Key.");
 		return (false);
 	}
@@ -819,6 +802,9 @@ bool CWeb::generateExplicitGrid(
 		}  // end if getSaveGrid()
 	}
 
+	// screen the nodes with coarse nodes if configured
+	generateCoarseNodes();
+
 	// close grid file
 	if (getSaveGrid()) {
 		outfile.close();
@@ -854,8 +840,7 @@ bool CWeb::generateExplicitGrid(
 	}
 
 	// log explicit grid info
-	snprintf(
-			sLog, sizeof(sLog),
+	GLASS3_LOG_INFO_FORMAT(
 			"CWeb::generateExplicitGrid sName:%s Phase(s):%s; nDetect:%d;"
 			" nNucleate:%d; dThresh:%.2f; ASnNucleate:%d; ASdThresh:%.2f;"
 			" vNetFilter:%d; bUseOnlyTeleseismicStations:%d; vSitesFilter:%d;"
@@ -867,7 +852,6 @@ bool CWeb::generateExplicitGrid(
 			static_cast<int>(m_vNetworksFilter.size()),
 			static_cast<int>(m_vSitesFilter.size()),
 			static_cast<int>(m_bUseOnlyTeleseismicStations), iNodeCount);
-	glass3::util::Logger::log("info", sLog);
 
 	// success
 	return (true);
@@ -879,8 +863,7 @@ bool CWeb::loadGridConfiguration(
 	// nullchecks
 	// check json
 	if (gridConfiguration == NULL) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CWeb::loadGridConfiguration: NULL json configuration.");
 		return (false);
 	}
@@ -916,15 +899,13 @@ bool CWeb::loadGridConfiguration(
 				.ToObject();
 
 		if (loadTravelTimes(&nucleationPhases) == false) {
-			glass3::util::Logger::log(
-					"error",
+			GLASS3_LOG_ERROR(
 					"CWeb::loadGridConfiguration: Error Loading NucleationPhases");
 			return (false);
 		}
 	} else {
 		if (loadTravelTimes((json::Object *) NULL) == false) {
-			glass3::util::Logger::log(
-					"error",
+			GLASS3_LOG_ERROR(
 					"CWeb::loadGridConfiguration: Error Loading default "
 					"NucleationPhases");
 			return (false);
@@ -958,8 +939,7 @@ bool CWeb::loadGridConfiguration(
 					== json::ValueType::DoubleVal)) {
 		resol = (*gridConfiguration)["NodeResolution"].ToDouble();
 	} else {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CWeb::loadGridConfiguration: Missing required Resolution Key.");
 		return (false);
 	}
@@ -1011,6 +991,26 @@ bool CWeb::loadGridConfiguration(
 		m_dDepthResolution = k_dDepthResolutionUndefined;
 	}
 
+	// sets the m_dCoarseResolution value
+	if ((*gridConfiguration).HasKey("CoarseResolution")
+			&& ((*gridConfiguration)["CoarseResolution"].GetType()
+					== json::ValueType::DoubleVal)) {
+		m_dCoarseResolution = (*gridConfiguration)["CoarseResolution"]
+				.ToDouble();
+	} else {
+		m_dCoarseResolution = k_dCoarseResolutionUndefined;
+	}
+
+	// sets the m_dCoarseThresholdFactor value
+	if ((*gridConfiguration).HasKey("CoarseThresholdFactor")
+			&& ((*gridConfiguration)["CoarseThresholdFactor"].GetType()
+					== json::ValueType::DoubleVal)) {
+		m_dCoarseThresholdFactor = (*gridConfiguration)["CoarseThresholdFactor"]
+				.ToDouble();
+	} else {
+		m_dCoarseThresholdFactor = k_dCoarseThresholdFactorDefault;
+	}
+
 	// number of picks that need to associate to start an event in an aseismic area
 	if (((*gridConfiguration).HasKey("ASeismicNucleationDataCountThreshold"))
 			&& ((*gridConfiguration)["ASeismicNucleationDataCountThreshold"].GetType()
@@ -1052,8 +1052,7 @@ bool CWeb::loadGridConfiguration(
 	if (!m_sZoneStatsFileName.empty()) {
 		m_pZoneStats = std::make_shared<traveltime::CZoneStats>();
 		if (!m_pZoneStats->setup(&m_sZoneStatsFileName)) {
-			glass3::util::Logger::log(
-					"error",
+			GLASS3_LOG_ERROR(
 					"CWeb::loadGridConfiguration: ZoneStats filename specified, "
 							"but unable to load valid data from"
 							+ m_sZoneStatsFileName);
@@ -1068,8 +1067,7 @@ bool CWeb::loadGridConfiguration(
 bool CWeb::loadTravelTimes(json::Object *gridConfiguration) {
 	// check json
 	if (gridConfiguration == NULL) {
-		glass3::util::Logger::log(
-				"info", "CWeb::loadTravelTimes: NULL json configuration "
+		GLASS3_LOG_INFO("CWeb::loadTravelTimes: NULL json configuration "
 				"Using default first phase and no second phase");
 
 		// if no json object, default to P
@@ -1120,21 +1118,18 @@ bool CWeb::loadTravelTimes(json::Object *gridConfiguration) {
 		if (phsObj.HasKey("TravFile")) {
 			file = phsObj["TravFile"].ToString();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CWeb::loadTravelTimes: Using file location: " + file
 							+ " for first phase: " + phs);
 		} else {
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CWeb::loadTravelTimes: Using default file location for "
 							"first phase: " + phs);
 		}
 
 		// set up the first phase travel time
 		if (m_pNucleationTravelTime1->setup(phs, file) == false) {
-			glass3::util::Logger::log(
-					"error", "CWeb::loadTravelTimes: Failed to load file "
+			GLASS3_LOG_ERROR("CWeb::loadTravelTimes: Failed to load file "
 							"location " + file + " for first phase: " + phs);
 			return (false);
 		}
@@ -1178,8 +1173,7 @@ bool CWeb::loadTravelTimes(json::Object *gridConfiguration) {
 			m_pNucleationTravelTime1->setup("P");
 		}
 
-		glass3::util::Logger::log(
-				"info", "CWeb::loadTravelTimes: Using default first phase");
+		GLASS3_LOG_INFO("CWeb::loadTravelTimes: Using default first phase");
 	}
 
 	// load the second travel time
@@ -1207,21 +1201,18 @@ bool CWeb::loadTravelTimes(json::Object *gridConfiguration) {
 		if (phsObj.HasKey("TravFile")) {
 			file = phsObj["TravFile"].ToString();
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CWeb::loadTravelTimes: Using file location: " + file
 							+ " for second phase: " + phs);
 		} else {
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"CWeb::loadTravelTimes: Using default file location for "
 							"second phase: " + phs);
 		}
 
 		// set up the second phase travel time
 		if (m_pNucleationTravelTime2->setup(phs, file) == false) {
-			glass3::util::Logger::log(
-					"error", "CWeb::loadTravelTimes: Failed to load file "
+			GLASS3_LOG_ERROR("CWeb::loadTravelTimes: Failed to load file "
 							"location " + file + " for second phase: " + phs);
 			return (false);
 		}
@@ -1254,8 +1245,7 @@ bool CWeb::loadTravelTimes(json::Object *gridConfiguration) {
 		// clean out old phase if any
 		m_pNucleationTravelTime2.reset();
 
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"CWeb::loadTravelTimes: Not using secondary nucleation phase");
 	}
 
@@ -1267,8 +1257,7 @@ bool CWeb::loadFilters(std::shared_ptr<json::Object> gridConfiguration) {
 	// nullchecks
 	// check json
 	if (gridConfiguration == NULL) {
-		glass3::util::Logger::log("error",
-									"loadFilters: NULL json configuration.");
+		GLASS3_LOG_ERROR("loadFilters: NULL json configuration.");
 		return (false);
 	}
 
@@ -1298,8 +1287,7 @@ bool CWeb::loadFilters(std::shared_ptr<json::Object> gridConfiguration) {
 		}
 
 		if (netFilterCount > 0) {
-			glass3::util::Logger::log(
-					"debug",
+			GLASS3_LOG_DEBUG(
 					"CWeb::loadFilters: " + std::to_string(netFilterCount)
 							+ " network filters configured.");
 		}
@@ -1329,8 +1317,7 @@ bool CWeb::loadFilters(std::shared_ptr<json::Object> gridConfiguration) {
 		}
 
 		if (staFilterCount > 0) {
-			glass3::util::Logger::log(
-					"debug",
+			GLASS3_LOG_DEBUG(
 					"CWeb::loadFilters: " + std::to_string(staFilterCount)
 							+ " SCNL filters configured.");
 		}
@@ -1360,8 +1347,7 @@ bool CWeb::loadFilters(std::shared_ptr<json::Object> gridConfiguration) {
 		}
 
 		if (sourceFilterCount > 0) {
-			glass3::util::Logger::log(
-					"debug",
+			GLASS3_LOG_DEBUG(
 					"CWeb::loadFilters: " + std::to_string(sourceFilterCount)
 							+ " pick source filters configured.");
 		}
@@ -1374,8 +1360,7 @@ bool CWeb::loadFilters(std::shared_ptr<json::Object> gridConfiguration) {
 		m_bUseOnlyTeleseismicStations =
 				(*gridConfiguration)["UseOnlyTeleseismicStations"].ToBool();
 
-		glass3::util::Logger::log(
-				"debug",
+		GLASS3_LOG_DEBUG(
 				"CWeb::loadFilters: bUseOnlyTeleseismicStations is "
 						+ std::to_string(m_bUseOnlyTeleseismicStations) + ".");
 	}
@@ -1387,8 +1372,7 @@ bool CWeb::loadFilters(std::shared_ptr<json::Object> gridConfiguration) {
 		m_dQualityFilter =
 				(*gridConfiguration)["QualityFilter"].ToDouble();
 
-		glass3::util::Logger::log(
-				"debug",
+		GLASS3_LOG_DEBUG(
 				"CWeb::loadFilters: m_dQualityFilter is "
 						+ std::to_string(m_dQualityFilter) + ".");
 	} else {
@@ -1402,8 +1386,7 @@ bool CWeb::loadFilters(std::shared_ptr<json::Object> gridConfiguration) {
 		m_dMaxSiteDistanceFilter =
 				(*gridConfiguration)["MaxSiteDistance"].ToDouble();
 
-		glass3::util::Logger::log(
-				"debug",
+		GLASS3_LOG_DEBUG(
 				"CWeb::loadFilters: m_dMaxSiteDistanceFilter is "
 						+ std::to_string(m_dMaxSiteDistanceFilter) + ".");
 	} else {
@@ -1475,8 +1458,7 @@ bool CWeb::loadWebSiteList() {
 	// nullchecks
 	// check pSiteList
 	if (m_pSiteList == NULL) {
-		glass3::util::Logger::log(
-				"error", "CWeb::loadWebSiteList: NULL pSiteList pointer.");
+		GLASS3_LOG_ERROR("CWeb::loadWebSiteList: NULL pSiteList pointer.");
 		return (false);
 	}
 
@@ -1494,20 +1476,18 @@ bool CWeb::loadWebSiteList() {
 
 	// don't bother continuing if we have no sites
 	if (nsite <= 0) {
-		glass3::util::Logger::log(
-				"warning", "CWeb::loadWebSiteList: No sites in site list.");
+		GLASS3_LOG_WARNING("CWeb::loadWebSiteList: No sites in site list.");
 		return (false);
 	}
 
 	// log
-	char sLog[glass3::util::Logger::k_nMaxLogEntrySize];
-	snprintf(sLog, sizeof(sLog),
+	GLASS3_LOG_DEBUG_FORMAT(
 				"CWeb::loadWebSiteList: %d sites available for web %s", nsite,
 				m_sName.c_str());
-	glass3::util::Logger::log("debug", sLog);
 
 	// clear web site list
 	m_vSitesSortedForCurrentNode.clear();
+	m_SiteIndex.clear();
 
 	std::vector<std::shared_ptr<CSite>> siteList =
 			m_pSiteList->getListOfSites();
@@ -1523,17 +1503,15 @@ bool CWeb::loadWebSiteList() {
 		}
 
 		if (isSiteAllowed(site)) {
-			m_vSitesSortedForCurrentNode.push_back(
-					std::pair<double, std::shared_ptr<CSite>>(0.0, site));
+			m_SiteIndex.addSite(site);
 		}
 	}
 
 	// log
-	snprintf(sLog, sizeof(sLog),
+	GLASS3_LOG_INFO_FORMAT(
 				"CWeb::loadWebSiteList: %d sites selected for web %s",
-				static_cast<int>(m_vSitesSortedForCurrentNode.size()),
+				m_SiteIndex.size(),
 				m_sName.c_str());
-	glass3::util::Logger::log("info", sLog);
 
 	return (true);
 }
@@ -1546,22 +1524,10 @@ void CWeb::sortSiteListForNode(double lat, double lon, double depth) {
 	// NOTE: node depth is ignored here
 	geo.setGeographic(lat, lon, glass3::util::Geo::k_EarthRadiusKm - depth);
 
-	// set the distance to each site
-	for (int i = 0; i < m_vSitesSortedForCurrentNode.size(); i++) {
-		// get the site
-		auto p = m_vSitesSortedForCurrentNode[i];
-		std::shared_ptr<CSite> site = p.second;
-
-		// compute the distance
-		p.first = site->getDelta(&geo);
-
-		// set the distance in the vector
-		m_vSitesSortedForCurrentNode[i] = p;
-	}
-
-	// sort sites
-	std::sort(m_vSitesSortedForCurrentNode.begin(),
-				m_vSitesSortedForCurrentNode.end(), sortSite);
+	// get the nearest sites and their distances, only the sites that can be
+	// linked to the node are needed
+	m_vSitesSortedForCurrentNode = m_SiteIndex.getNearestSites(
+			geo, m_iNumStationsPerNode);
 }
 
 // ---------------------------------------------------------addSiteToSiteList
@@ -1580,12 +1546,11 @@ bool CWeb::addSiteToSiteList(std::shared_ptr<CSite> site) {
 				std::chrono::milliseconds(getSleepTime()));
 	}
 
-	m_vSitesSortedForCurrentNode.push_back(
-					std::pair<double, std::shared_ptr<CSite>>(0.0, site));
+	bool added = m_SiteIndex.addSite(site);
 
 	m_vSiteMutex.unlock();
 
-	return(true);
+	return(added);
 }
 
 // -----------------------------------------------------removeSiteFromSiteList
@@ -1604,35 +1569,19 @@ bool CWeb::removeSiteFromSiteList(std::shared_ptr<CSite> site) {
 				std::chrono::milliseconds(getSleepTime()));
 	}
 
-	// for each site
-	for (auto it = m_vSitesSortedForCurrentNode.begin();
-			(it != m_vSitesSortedForCurrentNode.end()); ++it) {
-		std::shared_ptr<CSite> aSite = (*it).second;
-
-		if (aSite == NULL) {
-			continue;
-		}
-
-		// only erase the correct one
-		if (site->getSCNL() == aSite->getSCNL()) {
-			m_vSitesSortedForCurrentNode.erase(it);
-			m_vSiteMutex.unlock();
-			return(true);
-		}
-	}
+	bool removed = m_SiteIndex.removeSite(site->getSCNL());
 
 	m_vSiteMutex.unlock();
-	return(false);
+	return(removed);
 }
 
 // ---------------------------------------------------------generateNode
 std::shared_ptr<CNode> CWeb::generateNode(double lat, double lon, double z,
-											double resol) {
+											double resol, bool coarse) {
 	// nullcheck
 	if ((m_pNucleationTravelTime1 == NULL)
 			&& (m_pNucleationTravelTime2 == NULL)) {
-		glass3::util::Logger::log("error",
-									"CWeb::genNode: No valid trav pointers.");
+		GLASS3_LOG_ERROR("CWeb::genNode: No valid trav pointers.");
 		return (NULL);
 	}
 
@@ -1662,9 +1611,12 @@ std::shared_ptr<CNode> CWeb::generateNode(double lat, double lon, double z,
 	// set parent web
 	node->setWeb(this);
 
+	// coarse nodes need to be flagged before they are linked to sites
+	node->setCoarse(coarse);
+
 	// return empty node if we don't
 	// have any sites
-	if (m_vSitesSortedForCurrentNode.size() == 0) {
+	if (m_SiteIndex.size() == 0) {
 		return (node);
 	}
 
@@ -1679,6 +1631,112 @@ std::shared_ptr<CNode> CWeb::generateNode(double lat, double lon, double z,
 	return (node);
 }
 
+// ---------------------------------------------------------generateCoarseNodes
+int CWeb::generateCoarseNodes() {
+	// don't bother if coarse nodes aren't configured, or wouldn't be coarser
+	if (m_dCoarseResolution <= getNodeResolution()) {
+		return (0);
+	}
+
+	// copy the current nodes
+	std::vector<std::shared_ptr<CNode>> nodes;
+	m_vNodeMutex.lock();
+	nodes = m_vNode;
+	m_vNodeMutex.unlock();
+
+	// cluster the nodes by cells of about the coarse resolution in unit
+	// vector space, separately for each depth layer
+	double cellSize = m_dCoarseResolution / glass3::util::Geo::k_EarthRadiusKm;
+	std::map<std::tuple<int, int, int, double>,
+			std::vector<std::shared_ptr<CNode>>> clusters;
+	for (const auto &node : nodes) {
+		if (node->getCoarse() == true) {
+			continue;
+		}
+
+		glass3::util::Geo nodeGeo;
+		nodeGeo.setGeographic(node->getLatitude(), node->getLongitude(), 1.0);
+
+		clusters[std::make_tuple(
+				static_cast<int>(std::floor(nodeGeo.m_dUnitVectorX / cellSize)),
+				static_cast<int>(std::floor(nodeGeo.m_dUnitVectorY / cellSize)),
+				static_cast<int>(std::floor(nodeGeo.m_dUnitVectorZ / cellSize)),
+				node->getDepth())].push_back(node);
+	}
+
+	int iCoarseNodeCount = 0;
+	for (const auto &cluster : clusters) {
+		const std::vector<std::shared_ptr<CNode>> &children = cluster.second;
+
+		// a single node gains nothing from screening
+		if (children.size() < 2) {
+			continue;
+		}
+
+		// the center of the cluster
+		double sumX = 0;
+		double sumY = 0;
+		double sumZ = 0;
+		std::vector<glass3::util::Geo> childGeos;
+		for (const auto &child : children) {
+			glass3::util::Geo childGeo;
+			childGeo.setGeographic(child->getLatitude(), child->getLongitude(),
+									1.0);
+			sumX += childGeo.m_dUnitVectorX;
+			sumY += childGeo.m_dUnitVectorY;
+			sumZ += childGeo.m_dUnitVectorZ;
+			childGeos.push_back(childGeo);
+		}
+		glass3::util::Geo centerGeo;
+		centerGeo.setCartesian(sumX, sumY, sumZ);
+		double lat;
+		double lon;
+		double r;
+		centerGeo.getGeographic(&lat, &lon, &r);
+		centerGeo.setGeographic(lat, lon, 1.0);
+
+		// the coarse node needs to cover an event anywhere near any of its
+		// children, so grow its resolution so that the residual allowance in
+		// CNode::getSignificance() covers the distance to the farthest child
+		// plus the allowance of the child itself
+		double maxChildDistance = 0;
+		for (const auto &childGeo : childGeos) {
+			maxChildDistance = std::max(
+					maxChildDistance,
+					centerGeo.delta(&childGeo)
+							* glass3::util::Geo::k_EarthRadiusKm);
+		}
+		double resolution = std::max(
+				static_cast<double>(m_dCoarseResolution),
+				(2.0 / std::sqrt(3.0)) * maxChildDistance + getNodeResolution());
+
+		// create the coarse node
+		std::shared_ptr<CNode> coarseNode;
+		m_vSiteMutex.lock();
+		sortSiteListForNode(lat, lon, std::get<3>(cluster.first));
+		coarseNode = generateNode(lat, lon, std::get<3>(cluster.first),
+									resolution, true);
+		m_vSiteMutex.unlock();
+
+		if (addNode(coarseNode) == false) {
+			continue;
+		}
+		iCoarseNodeCount++;
+
+		// screen the children with it
+		for (const auto &child : children) {
+			child->setParentNode(coarseNode.get());
+		}
+	}
+
+	GLASS3_LOG_INFO(
+			"CWeb::generateCoarseNodes: sName:" + m_sName + " created "
+					+ std::to_string(iCoarseNodeCount) + " coarse nodes for "
+					+ std::to_string(nodes.size()) + " nodes.");
+
+	return (iCoarseNodeCount);
+}
+
 // ---------------------------------------------------------addNode
 bool CWeb::addNode(std::shared_ptr<CNode> node) {
 	// nullcheck
@@ -1697,56 +1755,46 @@ std::shared_ptr<CNode> CWeb::generateNodeSites(std::shared_ptr<CNode> node) {
 	// nullchecks
 	// check node
 	if (node == NULL) {
-		glass3::util::Logger::log("error",
-									"CWeb::genNodeSites: NULL node pointer.");
+		GLASS3_LOG_ERROR("CWeb::genNodeSites: NULL node pointer.");
 		return (NULL);
 	}
 	// check trav
 	if ((m_pNucleationTravelTime1 == NULL)
 			&& (m_pNucleationTravelTime2 == NULL)) {
-		glass3::util::Logger::log(
-				"error", "CWeb::genNodeSites: No valid trav pointers.");
+		GLASS3_LOG_ERROR("CWeb::genNodeSites: No valid trav pointers.");
 		return (NULL);
 	}
 	// check sites
 	if (m_vSitesSortedForCurrentNode.size() == 0) {
-		glass3::util::Logger::log("error", "CWeb::genNodeSites: No sites.");
+		GLASS3_LOG_ERROR("CWeb::genNodeSites: No sites.");
 		return (node);
 	}
 	// check nDetect
 	if (m_iNumStationsPerNode == 0) {
-		glass3::util::Logger::log("error", "CWeb::genNodeSites: nDetect is 0.");
+		GLASS3_LOG_ERROR("CWeb::genNodeSites: nDetect is 0.");
 		return (node);
 	}
 
 	int sitesAllowed = m_iNumStationsPerNode;
 	if (m_vSitesSortedForCurrentNode.size() < m_iNumStationsPerNode) {
-		glass3::util::Logger::log("warning",
+		GLASS3_LOG_WARNING(
 									"CWeb::genNodeSites: nDetect is greater "
 									"than the number of sites.");
 		sitesAllowed = m_vSitesSortedForCurrentNode.size();
 	}
 
-	// setup traveltimes for this node
-	if (m_pNucleationTravelTime1 != NULL) {
-		m_pNucleationTravelTime1->setTTOrigin(node->getLatitude(),
-											node->getLongitude(),
-											node->getDepth());
-	}
-	if (m_pNucleationTravelTime2 != NULL) {
-		m_pNucleationTravelTime2->setTTOrigin(node->getLatitude(),
-											node->getLongitude(),
-											node->getDepth());
-	}
-
 	// clear node of any existing sites
 	node->clearSiteLinks();
 
-	// for the number of allowed sites per node
+	// for the number of allowed sites per node, collect the sites with valid
+	// node-site distances
+	std::vector<std::shared_ptr<CSite>> sites;
+	std::vector<double> siteDistances;
+	sites.reserve(sitesAllowed);
+	siteDistances.reserve(sitesAllowed);
 	for (int i = 0; i < sitesAllowed; i++) {
 		// get each site
 		auto aSite = m_vSitesSortedForCurrentNode[i];
-		std::shared_ptr<CSite> site = aSite.second;
 
 		// compute delta distance between site and node
 		double siteDistance = glass3::util::GlassMath::k_RadiansToDegrees
@@ -1766,29 +1814,41 @@ std::shared_ptr<CNode> CWeb::generateNodeSites(std::shared_ptr<CNode> node) {
 			}
 		}
 
-		// compute traveltimes between site and node
-		double travelTime1 = traveltime::CTravelTime::k_dTravelTimeInvalid;
-		std::string phase1 = traveltime::CTravelTime::k_dPhaseInvalid;
-		if (m_pNucleationTravelTime1 != NULL) {
-			travelTime1 = m_pNucleationTravelTime1->T(siteDistance);
-			phase1 = m_pNucleationTravelTime1->m_sPhase;
-		}
+		sites.push_back(aSite.second);
+		siteDistances.push_back(siteDistance);
+	}
 
-		double travelTime2 = traveltime::CTravelTime::k_dTravelTimeInvalid;
-		std::string phase2 = traveltime::CTravelTime::k_dPhaseInvalid;
-		if (m_pNucleationTravelTime2 != NULL) {
-			travelTime2 = m_pNucleationTravelTime2->T(siteDistance);
-			phase2 = m_pNucleationTravelTime2->m_sPhase;
-		}
+	// compute traveltimes between the sites and node as a batch
+	int numSites = sites.size();
+	std::vector<double> travelTimes1(numSites,
+			traveltime::CTravelTime::k_dTravelTimeInvalid);
+	std::string phase1 = traveltime::CTravelTime::k_dPhaseInvalid;
+	if (m_pNucleationTravelTime1 != NULL) {
+		m_pNucleationTravelTime1->getTravelTimes(numSites, siteDistances.data(),
+													node->getDepth(),
+													travelTimes1.data());
+		phase1 = m_pNucleationTravelTime1->m_sPhase;
+	}
+
+	std::vector<double> travelTimes2(numSites,
+			traveltime::CTravelTime::k_dTravelTimeInvalid);
+	std::string phase2 = traveltime::CTravelTime::k_dPhaseInvalid;
+	if (m_pNucleationTravelTime2 != NULL) {
+		m_pNucleationTravelTime2->getTravelTimes(numSites, siteDistances.data(),
+													node->getDepth(),
+													travelTimes2.data());
+		phase2 = m_pNucleationTravelTime2->m_sPhase;
+	}
 
+	for (int i = 0; i < numSites; i++) {
 		// skip site if there are no valid times
-		if ((travelTime1 < 0) && (travelTime2 < 0)) {
+		if ((travelTimes1[i] < 0) && (travelTimes2[i] < 0)) {
 			continue;
 		}
 
 		// Link node to site using traveltimes
-		node->linkSite(site, node, siteDistance, travelTime1, phase1, travelTime2,
-			phase2);
+		node->linkSite(sites[i], node, siteDistances[i], travelTimes1[i],
+						phase1, travelTimes2[i], phase2);
 	}
 
 	// sort the site links
@@ -1823,22 +1883,23 @@ void CWeb::addSite(std::shared_ptr<CSite> site) {
 		// the station out of the web
 		if (isSiteAllowed(site) == false) {
 			removeSite(site);
+			return;
 		}
 
 		// this is this is effectively an "update" where the change ends up not
-		// affecting the station's presence in the web
+		// affecting the station's presence in the web, refresh the site's
+		// location in the site index in case it moved
+		addSiteToSiteList(site);
 		return;
 	}
 
-	glass3::util::Logger::log(
-			"debug",
+	GLASS3_LOG_DEBUG(
 			"CWeb::addSite: New potential station " + site->getSCNL()
 					+ " for web: " + m_sName + ".");
 
 	// if this site is not allowed, we should not add it
 	if (isSiteAllowed(site) == false) {
-		glass3::util::Logger::log(
-				"debug",
+		GLASS3_LOG_DEBUG(
 				"CWeb::addSite: Station " + site->getSCNL()
 						+ " not allowed in web " + m_sName + ".");
 		return;
@@ -1938,29 +1999,19 @@ void CWeb::addSite(std::shared_ptr<CSite> site) {
 			continue;
 		}
 
-		// setup traveltimes for this node
-		if (m_pNucleationTravelTime1 != NULL) {
-			m_pNucleationTravelTime1->setTTOrigin(node->getLatitude(),
-												node->getLongitude(),
-												node->getDepth());
-		}
-		if (m_pNucleationTravelTime2 != NULL) {
-			m_pNucleationTravelTime2->setTTOrigin(node->getLatitude(),
-												node->getLongitude(),
-												node->getDepth());
-		}
-
 		// compute traveltimes between site and node
 		double travelTime1 = traveltime::CTravelTime::k_dTravelTimeInvalid;
 		std::string phase1 = traveltime::CTravelTime::k_dPhaseInvalid;
 		if (m_pNucleationTravelTime1 != NULL) {
-			travelTime1 = m_pNucleationTravelTime1->T(nodeSiteDistance);
+			travelTime1 = m_pNucleationTravelTime1->getTravelTime(
+					nodeSiteDistance, node->getDepth());
 			phase1 = m_pNucleationTravelTime1->m_sPhase;
 		}
 		double travelTime2 = traveltime::CTravelTime::k_dTravelTimeInvalid;
 		std::string phase2 = traveltime::CTravelTime::k_dPhaseInvalid;
 		if (m_pNucleationTravelTime2 != NULL) {
-			travelTime2 = m_pNucleationTravelTime2->T(nodeSiteDistance);
+			travelTime2 = m_pNucleationTravelTime2->getTravelTime(
+					nodeSiteDistance, node->getDepth());
 			phase2 = m_pNucleationTravelTime2->m_sPhase;
 		}
 
@@ -2004,19 +2055,14 @@ void CWeb::addSite(std::shared_ptr<CSite> site) {
 
 	// log info if we've added a site
 	if (nodeModCount > 0) {
-		char sLog[glass3::util::Logger::k_nMaxLogEntrySize];
-		snprintf(
-				sLog, sizeof(sLog),
+		GLASS3_LOG_INFO_FORMAT(
 				"CWeb::addSite: Site: %s added to %d node(s) in web: %s "
 				"in %.2f seconds.", site->getSCNL().c_str(), nodeModCount,
 				m_sName.c_str(), addTime);
-		glass3::util::Logger::log("info", sLog);
 	} else {
-		char sLog[glass3::util::Logger::k_nMaxLogEntrySize];
-		snprintf(sLog, sizeof(sLog), "CWeb::addSite: Site %s not added to "
+		GLASS3_LOG_INFO_FORMAT("CWeb::addSite: Site %s not added to "
 				" any nodes in web: %s in %.2f seconds", site->getSCNL().c_str(),
 				m_sName.c_str(), addTime);
-		glass3::util::Logger::log("info", sLog);
 	}
 }
 
@@ -2041,8 +2087,7 @@ void CWeb::removeSite(std::shared_ptr<CSite> site) {
 		return;
 	}
 
-	glass3::util::Logger::log(
-			"debug",
+	GLASS3_LOG_DEBUG(
 			"CWeb::removeSite: Trying to remove station " + site->getSCNL()
 					+ " from web " + m_sName + ".");
 
@@ -2123,18 +2168,6 @@ void CWeb::removeSite(std::shared_ptr<CSite> site) {
 				sitesAllowed = m_vSitesSortedForCurrentNode.size();
 			}
 
-			// setup traveltimes for this node
-			if (m_pNucleationTravelTime1 != NULL) {
-				m_pNucleationTravelTime1->setTTOrigin(node->getLatitude(),
-													node->getLongitude(),
-													node->getDepth());
-			}
-			if (m_pNucleationTravelTime2 != NULL) {
-				m_pNucleationTravelTime2->setTTOrigin(node->getLatitude(),
-													node->getLongitude(),
-													node->getDepth());
-			}
-
 			// for the number of allowed sites per node
 			for (int i = 0; i < sitesAllowed; i++) {
 				// update thread status
@@ -2168,13 +2201,15 @@ void CWeb::removeSite(std::shared_ptr<CSite> site) {
 				double travelTime1 = traveltime::CTravelTime::k_dTravelTimeInvalid;
 				std::string phase1 = traveltime::CTravelTime::k_dPhaseInvalid;
 				if (m_pNucleationTravelTime1 != NULL) {
-					travelTime1 = m_pNucleationTravelTime1->T(newDistance);
+					travelTime1 = m_pNucleationTravelTime1->getTravelTime(
+							newDistance, node->getDepth());
 					phase1 = m_pNucleationTravelTime1->m_sPhase;
 				}
 				double travelTime2 = traveltime::CTravelTime::k_dTravelTimeInvalid;
 				std::string phase2 = traveltime::CTravelTime::k_dPhaseInvalid;
 				if (m_pNucleationTravelTime2 != NULL) {
-					travelTime2 = m_pNucleationTravelTime2->T(newDistance);
+					travelTime2 = m_pNucleationTravelTime2->getTravelTime(
+							newDistance, node->getDepth());
 					phase2 = m_pNucleationTravelTime2->m_sPhase;
 				}
 
@@ -2186,8 +2221,7 @@ void CWeb::removeSite(std::shared_ptr<CSite> site) {
 				// Link node to new site using traveltimes
 				if (node->linkSite(newSite, node, newDistance, travelTime1, phase1,
 									travelTime2, phase2) == false) {
-					glass3::util::Logger::log(
-							"error",
+					GLASS3_LOG_ERROR(
 							"CWeb::removeSite: Failed to add station "
 									+ newSite->getSCNL() + " to web " + m_sName
 									+ ".");
@@ -2202,8 +2236,7 @@ void CWeb::removeSite(std::shared_ptr<CSite> site) {
 
 			m_vSiteMutex.unlock();
 		} else {
-			glass3::util::Logger::log(
-					"error",
+			GLASS3_LOG_ERROR(
 					"CWeb::removeSite: Failed to remove station " + site->getSCNL()
 							+ " from web " + m_sName + ".");
 		}
@@ -2220,31 +2253,29 @@ void CWeb::removeSite(std::shared_ptr<CSite> site) {
 
 	// log info if we've removed a site
 	if (nodeModCount > 0) {
-		char sLog[glass3::util::Logger::k_nMaxLogEntrySize];
-		snprintf(
-				sLog, sizeof(sLog),
+		GLASS3_LOG_INFO_FORMAT(
 				"CWeb::removeSite: Site: %s removed from %d node(s) in web: %s "
 				"in %.2f seconds.", site->getSCNL().c_str(), nodeModCount,
 				m_sName.c_str(), removeTime);
-		glass3::util::Logger::log("info", sLog);
 	} else {
-		char sLog[glass3::util::Logger::k_nMaxLogEntrySize];
-		snprintf(sLog, sizeof(sLog), "CWeb::removeSite: Site %s not removed from "
+		GLASS3_LOG_INFO_FORMAT("CWeb::removeSite: Site %s not removed from "
 				" any nodes in web: %s in %.2f seconds", site->getSCNL().c_str(),
 				m_sName.c_str(), removeTime);
-		glass3::util::Logger::log("info", sLog);
 	}
 }
 
 // ---------------------------------------------------------addJob
 void CWeb::addJob(std::function<void()> newjob) {
-	if (getNumThreads() == 0) {
+	m_QueueMutex.lock();
+	glass3::util::ThreadPool * jobPool = m_pJobPool;
+	m_QueueMutex.unlock();
+
+	if ((getNumThreads() == 0) && (jobPool == NULL)) {
 		// no background thread, just run the job
 		try {
 			newjob();
 		} catch (const std::exception &e) {
-			glass3::util::Logger::log(
-					"error",
+			GLASS3_LOG_ERROR(
 					"CWeb::jobLoop: Exception during job(): "
 							+ std::string(e.what()));
 		}
@@ -2253,8 +2284,60 @@ void CWeb::addJob(std::function<void()> newjob) {
 	}
 
 	// add the job to the queue
-	std::lock_guard<std::mutex> guard(m_QueueMutex);
+	m_QueueMutex.lock();
 	m_JobQueue.push(newjob);
+
+	// only one runQueuedJobs() at a time, so our jobs stay in order
+	bool scheduleJobs = false;
+	if ((jobPool != NULL) && (m_bJobsScheduled == false)) {
+		m_bJobsScheduled = true;
+		scheduleJobs = true;
+	}
+	m_QueueMutex.unlock();
+
+	if (jobPool == NULL) {
+		// wake an idle background thread to run it
+		wakeUp();
+	} else if (scheduleJobs == true) {
+		jobPool->addJob(std::bind(&CWeb::runQueuedJobs, this));
+	}
+}
+
+// ---------------------------------------------------------setJobPool
+void CWeb::setJobPool(glass3::util::ThreadPool * jobPool) {
+	std::lock_guard<std::mutex> queueGuard(m_QueueMutex);
+	m_pJobPool = jobPool;
+}
+
+// ---------------------------------------------------------runQueuedJobs
+void CWeb::runQueuedJobs() {
+	// the last job run is kept until we're done with the queue, since it may
+	// hold the last reference to this web
+	std::function<void()> newjob;
+	while (true) {
+		m_QueueMutex.lock();
+		if (m_JobQueue.empty() == true) {
+			// signal while holding the lock, since the destructor may run as
+			// soon as it is released
+			m_bJobsScheduled = false;
+			m_JobsScheduledCondition.notify_all();
+			m_QueueMutex.unlock();
+			break;
+		}
+
+		newjob = m_JobQueue.front();
+		m_JobQueue.pop();
+		m_QueueMutex.unlock();
+
+		// run the job
+		try {
+			newjob();
+		} catch (const std::exception &e) {
+			GLASS3_LOG_ERROR(
+					"CWeb::runQueuedJobs: Exception during job(): "
+							+ std::string(e.what()));
+		}
+	}
 }
 
 // ---------------------------------------------------------work
@@ -2281,8 +2364,7 @@ glass3::util::WorkState CWeb::work() {
 	try {
 		newjob();
 	} catch (const std::exception &e) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CWeb::workLoop: Exception during job(): "
 						+ std::string(e.what()));
 		return (glass3::util::WorkState::Error);
@@ -2355,6 +2437,16 @@ double CWeb::getNodeResolution() const {
 	return (m_dNodeResolution);
 }
 
+// ---------------------------------------------------------getCoarseResolution
+double CWeb::getCoarseResolution() const {
+	return (m_dCoarseResolution);
+}
+
+// ---------------------------------------------------getCoarseThresholdFactor
+double CWeb::getCoarseThresholdFactor() const {
+	return (m_dCoarseThresholdFactor);
+}
+
 // --------------------------------------------------getNucleationStackThreshold
 double CWeb::getNucleationStackThreshold() const {
 	return (m_dNucleationStackThreshold);
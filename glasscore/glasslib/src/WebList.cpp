@@ -15,6 +15,7 @@ namespace glasscore {
 // ---------------------------------------------------------CWebList
 CWebList::CWebList(int numThreads) {
 	m_iNumThreads = numThreads;
+	m_pJobPool = NULL;
 	clear();
 }
 
@@ -39,8 +40,7 @@ void CWebList::clear() {
 bool CWebList::receiveExternalMessage(std::shared_ptr<json::Object> com) {
 	// null check json
 	if (com == NULL) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"CWebList::receiveExternalMessage: NULL json configuration.");
 		return (false);
 	}
@@ -70,8 +70,7 @@ bool CWebList::receiveExternalMessage(std::shared_ptr<json::Object> com) {
 bool CWebList::addWeb(std::shared_ptr<json::Object> com) {
 	// null check json
 	if (com == NULL) {
-		glass3::util::Logger::log("error",
-								"CWebList::addWeb: NULL json configuration.");
+		GLASS3_LOG_ERROR("CWebList::addWeb: NULL json configuration.");
 		return (false);
 	}
 
@@ -91,16 +90,18 @@ bool CWebList::addWeb(std::shared_ptr<json::Object> com) {
 
 		// look for name match
 		if (web->getName() == name) {
-			glass3::util::Logger::log(
-					"warning",
+			GLASS3_LOG_WARNING(
 					"CWebList::addWeb: Already have a web with the name " + name
 							+ " call RemoveWeb before adding a new web.");
 			return (false);
 		}
 	}
 
-	// Create a new web object
-	std::shared_ptr<CWeb> web(new CWeb(m_iNumThreads));
+	// Create a new web object, webs using the job pool don't need their own
+	// threads
+	std::shared_ptr<CWeb> web(
+			new CWeb((m_pJobPool != NULL) ? 0 : m_iNumThreads));
+	web->setJobPool(m_pJobPool);
 	if (m_pSiteList != NULL) {
 		web->setSiteList(m_pSiteList);
 	}
@@ -121,9 +122,7 @@ bool CWebList::addWeb(std::shared_ptr<json::Object> com) {
 bool CWebList::removeWeb(std::shared_ptr<json::Object> com) {
 	// null check json
 	if (com == NULL) {
-		glass3::util::Logger::log(
-				"error",
-				"CWebList::removeWeb: NULL json configuration.");
+		GLASS3_LOG_ERROR("CWebList::removeWeb: NULL json configuration.");
 		return (false);
 	}
 
@@ -137,8 +136,7 @@ bool CWebList::removeWeb(std::shared_ptr<json::Object> com) {
 
 	// make sure we have a valid name for removal
 	if (name == "Nemo") {
-		glass3::util::Logger::log(
-				"warning",
+		GLASS3_LOG_WARNING(
 				"CWebList::removeWeb: Unnamed subnets cannot be removed.");
 		return (false);
 	}
@@ -170,8 +168,7 @@ void CWebList::updateSite(std::shared_ptr<CSite> site) {
 		return;
 	}
 
-	glass3::util::Logger::log(
-			"debug",
+	GLASS3_LOG_DEBUG(
 			"CWebList::updateSite: Updating station " + site->getSCNL() + ".");
 
 	// Update all web node site lists that might be changed
@@ -250,6 +247,12 @@ void CWebList::setSiteList(CSiteList* siteList) {
 	m_pSiteList = siteList;
 }
 
+// ---------------------------------------------------------setJobPool
+void CWebList::setJobPool(glass3::util::ThreadPool* jobPool) {
+	std::lock_guard<std::recursive_mutex> webListGuard(m_WebListMutex);
+	m_pJobPool = jobPool;
+}
+
 // ---------------------------------------------------------size
 int CWebList::size() const {
 	std::lock_guard<std::recursive_mutex> webListGuard(m_WebListMutex);
@@ -145,6 +145,8 @@ TEST(GlassTest, Construction) {
 	ASSERT_TRUE(testGlass->getSiteList() == NULL)<< "site list null";
 	ASSERT_TRUE(testGlass->getHypoList() == NULL)<< "hypo list null";
 	ASSERT_TRUE(testGlass->getPickList() == NULL)<< "pick list null";
+	ASSERT_TRUE(testGlass->getNucleationWorkPool() == NULL)<<
+	"nucleation work pool null";
 	ASSERT_TRUE(testGlass->getCorrelationList() == NULL)<<
 	"correlation list null";
 	ASSERT_TRUE(testGlass->getDetectionProcessor() == NULL)<<
@@ -240,6 +242,8 @@ TEST(GlassTest, Init) {
 	ASSERT_TRUE(testGlass->getSiteList() != NULL)<< "site list";
 	ASSERT_TRUE(testGlass->getHypoList() != NULL)<< "hypo list";
 	ASSERT_TRUE(testGlass->getPickList() != NULL)<< "pick list";
+	ASSERT_TRUE(testGlass->getNucleationWorkPool() != NULL)<<
+	"nucleation work pool";
 	ASSERT_TRUE(testGlass->getCorrelationList() != NULL)<<
 	"correlation list";
 	ASSERT_TRUE(testGlass->getDetectionProcessor() != NULL)<<
@@ -1,11 +1,20 @@
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <sstream>
 #include <iostream>
 #include <fstream>
+#include <chrono>
+#include <cmath>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <limits>
 
 #include <logger.h>
+#include <geo.h>
+#include <glassmath.h>
 
 #include "Site.h"
 #include "SiteList.h"
@@ -21,6 +30,10 @@
 #define HYPOFILENAME "testhypo1.json"
 #define INITFILENAME "initialize.d"
 
+#define GAP_TOLERANCE 0.000001
+#define GAP_NUMLOCATIONS 20
+#define GAP_BENCHMARK_EVALUATIONS 2000000
+
 #define LATITUDE -21.849968
 #define LONGITUDE 170.034750
 #define DEPTH 10.000000
@@ -76,6 +89,15 @@
 #define LOCALIZE_RES_TIME 3648515731.985167
 #define LOCALIZE_RES_BAYES 31.389001001003624
 
+#define BENCHMARK_LATITUDE 40.0
+#define BENCHMARK_LONGITUDE -110.0
+#define BENCHMARK_DEPTH 10.0
+#define BENCHMARK_TIME 3648515732.0
+#define BENCHMARK_OFFSET 0.2
+#define BENCHMARK_ITERATIONS 5000
+#define BENCHMARK_MINDISTANCE 0.5
+#define BENCHMARK_MAXDISTANCE 15.0
+
 #define PRUNESIZE 0
 #define RESOLVESIZE 36
 
@@ -394,13 +416,219 @@ TEST(HypoTest, PickOperations) {
 	ASSERT_EQ(expectedSize, testHypo->getPickDataSize())<<
 	"hypo vPick not larger than max";
 
+	// check membership
+	ASSERT_TRUE(testHypo->hasPickReference(sharedPick))<< "hypo has pick";
+	ASSERT_FALSE(testHypo->addPickReference(sharedPick))<< "duplicate pick";
+	ASSERT_EQ(expectedSize, testHypo->getPickDataSize())<<
+	"duplicate pick not added";
+
 	// remove picks from hypo
 	testHypo->removePickReference(sharedPick);
 	testHypo->removePickReference(sharedPick2);
+	testHypo->removePickReference(sharedPick2);
 
 	// check to see that only one pick remains
 	expectedSize = 1;
 	ASSERT_EQ(expectedSize, testHypo->getPickDataSize())<< "hypo has only one pick";
+	ASSERT_FALSE(testHypo->hasPickReference(sharedPick))<< "pick removed";
+	ASSERT_FALSE(testHypo->hasPickReference(sharedPick2))<< "pick2 removed";
+	ASSERT_TRUE(testHypo->hasPickReference(sharedPick3))<< "pick3 remains";
+
+	// clear picks from hypo
+	testHypo->clearPickReferences();
+	ASSERT_EQ(0, testHypo->getPickDataSize())<< "hypo has no picks";
+	ASSERT_FALSE(testHypo->hasPickReference(sharedPick3))<< "pick3 cleared";
+	ASSERT_TRUE(testHypo->addPickReference(sharedPick3))<< "pick3 re-added";
+
+	// a pick updated in place gets a new id, but is still the same pick
+	sharedPick3->initialize(sharedPick3->getSite(), sharedPick3->getTPick(),
+							"UPDATED", "", -1, -1, "",
+							std::numeric_limits<double>::quiet_NaN(),
+							std::numeric_limits<double>::quiet_NaN(),
+							std::numeric_limits<double>::quiet_NaN(),
+							std::numeric_limits<double>::quiet_NaN(),
+							std::numeric_limits<double>::quiet_NaN(),
+							std::numeric_limits<double>::quiet_NaN(),
+							std::numeric_limits<double>::quiet_NaN(),
+							std::numeric_limits<double>::quiet_NaN(),
+							std::numeric_limits<double>::quiet_NaN());
+	ASSERT_TRUE(testHypo->hasPickReference(sharedPick3))<< "updated pick";
+	ASSERT_FALSE(testHypo->addPickReference(sharedPick3))<<
+	"updated pick not added twice";
+	ASSERT_EQ(1, testHypo->getPickDataSize())<< "updated pick once";
+	testHypo->removePickReference(sharedPick3);
+	ASSERT_EQ(0, testHypo->getPickDataSize())<< "updated pick removed";
+	ASSERT_FALSE(testHypo->hasPickReference(sharedPick3))<<
+	"updated pick not referenced";
+}
+
+// computes the gap by sorting the azimuths from each site
+double calculateReferenceGap(
+		const std::vector<std::shared_ptr<glasscore::CPick>> &picks,
+		double lat, double lon, double z) {
+	glass3::util::Geo geo;
+	geo.setGeographic(lat, lon, glass3::util::Geo::k_EarthRadiusKm - z);
+
+	std::vector<double> azm;
+	for (const auto &pick : picks) {
+		azm.push_back(
+				geo.azimuth(&pick->getSite()->getGeo())
+						/ glass3::util::GlassMath::k_DegreesToRadians);
+	}
+	if (azm.size() <= 1) {
+		return (360.0);
+	}
+
+	std::sort(azm.begin(), azm.end());
+	azm.push_back(azm.front() + 360.0);
+
+	double gap = 0.0;
+	for (int i = 0; i < static_cast<int>(azm.size()) - 1; i++) {
+		gap = std::max(gap, azm[i + 1] - azm[i]);
+	}
+
+	return (gap);
+}
+
+// tests to see if the gap matches sorting the azimuths
+TEST(HypoTest, GapValidation) {
+	glass3::util::Logger::disable();
+
+	std::shared_ptr<traveltime::CTravelTime> nullTrav;
+	std::shared_ptr<traveltime::CTTT> nullTTT;
+
+	std::vector<int> pickCounts = { 0, 1, 2, 3, 10, 100, 1000 };
+	for (int numPicks : pickCounts) {
+		glasscore::CHypo testHypo(LATITUDE, LONGITUDE, DEPTH, TIME,
+									std::string(ID), std::string(WEB), BAYES,
+									THRESH, CUT, nullTrav, nullTrav, nullTTT);
+
+		// sites scattered around, some repeated so azimuths coincide
+		std::vector<std::shared_ptr<glasscore::CSite>> sites;
+		std::vector<std::shared_ptr<glasscore::CPick>> picks;
+		for (int i = 0; i < numPicks; i++) {
+			int siteNumber = (i % 7 == 6) ? i - 1 : i;
+			double lat = -80.0 + ((siteNumber * 37) % 160);
+			double lon = -179.0 + ((siteNumber * 71) % 358);
+			sites.push_back(
+					std::make_shared<glasscore::CSite>(
+							"G" + std::to_string(siteNumber), "BHZ", "US", "",
+							lat, lon, 0.0, 1.0, true, true));
+			picks.push_back(
+					std::make_shared<glasscore::CPick>(sites.back(), TIME + i,
+														std::to_string(i), -1,
+														-1));
+			testHypo.addPickReference(picks.back());
+		}
+
+		for (int j = 0; j < GAP_NUMLOCATIONS; j++) {
+			double lat = -85.0 + (j * 8.6);
+			double lon = -175.0 + (j * 17.1);
+			double z = j * 30.0;
+			ASSERT_NEAR(calculateReferenceGap(picks, lat, lon, z),
+						testHypo.calculateGap(lat, lon, z), GAP_TOLERANCE)<<
+			"gap for " << numPicks << " picks at location " << j;
+		}
+	}
+}
+
+// benchmarks the gap against sorting the azimuths
+TEST(HypoTest, GapBenchmark) {
+	glass3::util::Logger::disable();
+
+	std::shared_ptr<traveltime::CTravelTime> nullTrav;
+	std::shared_ptr<traveltime::CTTT> nullTTT;
+
+	std::vector<int> pickCounts = { 10, 100, 1000 };
+	for (int numPicks : pickCounts) {
+		glasscore::CHypo testHypo(LATITUDE, LONGITUDE, DEPTH, TIME,
+									std::string(ID), std::string(WEB), BAYES,
+									THRESH, CUT, nullTrav, nullTrav, nullTTT);
+
+		std::vector<std::shared_ptr<glasscore::CSite>> sites;
+		std::vector<std::shared_ptr<glasscore::CPick>> picks;
+		for (int i = 0; i < numPicks; i++) {
+			sites.push_back(
+					std::make_shared<glasscore::CSite>(
+							"G" + std::to_string(i), "BHZ", "US", "",
+							-80.0 + ((i * 37) % 160), -179.0 + ((i * 71) % 358),
+							0.0, 1.0, true, true));
+			picks.push_back(
+					std::make_shared<glasscore::CPick>(sites.back(), TIME + i,
+														std::to_string(i), -1,
+														-1));
+			testHypo.addPickReference(picks.back());
+		}
+
+		int numCalls = GAP_BENCHMARK_EVALUATIONS / numPicks;
+		double referenceGap = 0;
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < numCalls; i++) {
+			referenceGap += calculateReferenceGap(picks, LATITUDE + (i % 10),
+													LONGITUDE, DEPTH);
+		}
+		double referenceSeconds = std::chrono::duration<double>(
+				std::chrono::steady_clock::now() - start).count();
+
+		double gap = 0;
+		start = std::chrono::steady_clock::now();
+		for (int i = 0; i < numCalls; i++) {
+			gap += testHypo.calculateGap(LATITUDE + (i % 10), LONGITUDE, DEPTH);
+		}
+		double gapSeconds = std::chrono::duration<double>(
+				std::chrono::steady_clock::now() - start).count();
+
+		std::cout << "[ BENCH    ] " << numPicks << " picks: sorted "
+					<< (referenceSeconds / numCalls) * 1.0e6 << " us, binned "
+					<< (gapSeconds / numCalls) * 1.0e6 << " us per gap"
+					<< std::endl;
+
+		ASSERT_NEAR(referenceGap / numCalls, gap / numCalls, GAP_TOLERANCE)<<
+		"gap";
+	}
+}
+
+// benchmarks checking pick membership for hypos with many picks
+TEST(HypoTest, PickMembershipBenchmark) {
+	glass3::util::Logger::disable();
+
+	std::shared_ptr<traveltime::CTravelTime> nullTrav;
+	std::shared_ptr<traveltime::CTTT> nullTTT;
+	glasscore::CHypo testHypo(LATITUDE, LONGITUDE, DEPTH, TIME, std::string(ID),
+								std::string(WEB), BAYES, THRESH, CUT, nullTrav,
+								nullTrav, nullTTT);
+
+	std::shared_ptr<glasscore::CSite> site = std::make_shared<glasscore::CSite>(
+			"MEM", "BHZ", "US", "", LATITUDE, LONGITUDE, 0.0, 1.0, true, true);
+
+	int numPicks = 1000;
+	std::vector<std::shared_ptr<glasscore::CPick>> picks;
+	for (int i = 0; i < 2 * numPicks; i++) {
+		picks.push_back(
+				std::make_shared<glasscore::CPick>(site, TIME + i,
+													std::to_string(i), -1, -1));
+	}
+
+	for (int i = 0; i < numPicks; i++) {
+		ASSERT_TRUE(testHypo.addPickReference(picks[i]));
+	}
+
+	// half the checks are members, half are not
+	int found = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (const auto &pick : picks) {
+		if (testHypo.hasPickReference(pick) == true) {
+			found++;
+		}
+	}
+	double checkSeconds = std::chrono::duration<double>(
+			std::chrono::steady_clock::now() - start).count();
+
+	std::cout << "[ BENCH    ] " << numPicks << " picks: "
+				<< (checkSeconds / picks.size()) * 1.0e9
+				<< " ns per membership check" << std::endl;
+
+	ASSERT_EQ(numPicks, found)<< "members found";
 }
 
 // test to see if the localize operation works
@@ -810,3 +1038,427 @@ TEST(HypoTest, Messaging) {
 	ASSERT_TRUE(expireMessage != NULL)<< "expire message";
 }
 
+
+// builds a hypo away from the benchmark location, supported by numPicks
+// picks with exact travel times at sites spread around the benchmark location,
+// the sites are kept in sites since picks only hold weak references to them
+std::shared_ptr<glasscore::CHypo> buildBenchmarkHypo(
+		glasscore::CGlass *testGlass, int numPicks,
+		std::vector<std::shared_ptr<glasscore::CSite>> *sites) {
+	std::shared_ptr<traveltime::CTravelTime> nullTrav;
+	std::shared_ptr<traveltime::CTravelTime> nucleationTrav = testGlass
+			->getDefaultNucleationTravelTime();
+
+	std::shared_ptr<glasscore::CHypo> hypo = std::make_shared<glasscore::CHypo>(
+			BENCHMARK_LATITUDE + BENCHMARK_OFFSET,
+			BENCHMARK_LONGITUDE + BENCHMARK_OFFSET, BENCHMARK_DEPTH,
+			BENCHMARK_TIME, "BENCHMARK" + std::to_string(numPicks), "Test", 0.0,
+			testGlass->getNucleationStackThreshold(),
+			testGlass->getNucleationDataCountThreshold(), nucleationTrav,
+			nullTrav, testGlass->getAssociationTravelTimes(), 100, 360.0, 800.0);
+
+	glass3::util::Geo hypoGeo;
+	hypoGeo.setGeographic(BENCHMARK_LATITUDE, BENCHMARK_LONGITUDE,
+							glass3::util::Geo::k_EarthRadiusKm - BENCHMARK_DEPTH);
+
+	for (int i = 0; i < numPicks; i++) {
+		// spiral the sites outward so every count covers all azimuths
+		double azimuth = i * 137.5 * glass3::util::GlassMath::k_DegreesToRadians;
+		double distance = BENCHMARK_MINDISTANCE
+				+ (BENCHMARK_MAXDISTANCE - BENCHMARK_MINDISTANCE) * (i + 0.5)
+						/ numPicks;
+		double lat = BENCHMARK_LATITUDE + distance * cos(azimuth);
+		double lon = BENCHMARK_LONGITUDE
+				+ distance * sin(azimuth)
+						/ cos(glass3::util::GlassMath::k_DegreesToRadians * lat);
+
+		std::shared_ptr<glasscore::CSite> site = std::make_shared<
+				glasscore::CSite>("B" + std::to_string(i), "BHZ", "US", "", lat,
+									lon, 0.0, 1.0, true, true);
+		sites->push_back(site);
+		double travelTime = nucleationTrav->getTravelTime(hypoGeo,
+															site->getGeo());
+
+		hypo->addPickReference(
+				std::make_shared<glasscore::CPick>(site,
+													BENCHMARK_TIME + travelTime,
+													std::to_string(i), -1, -1));
+	}
+
+	return (hypo);
+}
+
+// benchmarks the annealing locator for various numbers of picks
+TEST(HypoTest, LocatorBenchmark) {
+	glass3::util::Logger::disable();
+
+	// load config file
+	std::ifstream initFile;
+	initFile.open(
+			"./" + std::string(TESTPATH) + "/" + std::string(INITFILENAME),
+			std::ios::in);
+	std::string initLine = "";
+	std::getline(initFile, initLine);
+	initFile.close();
+
+	std::shared_ptr<json::Object> initConfig = std::make_shared<json::Object>(
+			json::Deserialize(initLine));
+
+	// construct a glass
+	glasscore::CGlass * testGlass = new glasscore::CGlass();
+	testGlass->receiveExternalMessage(initConfig);
+
+	std::vector<int> pickCounts = { 10, 100, 1000 };
+	for (int numPicks : pickCounts) {
+		std::vector<std::shared_ptr<glasscore::CSite>> sites;
+		std::shared_ptr<glasscore::CHypo> hypo = buildBenchmarkHypo(testGlass,
+																	numPicks,
+																	&sites);
+		ASSERT_EQ(numPicks, hypo->getPickDataSize())<< "pick count";
+
+		// a locate call gathers the pick data once for all iterations
+		auto start = std::chrono::steady_clock::now();
+		hypo->annealingLocateBayes(BENCHMARK_ITERATIONS, 100.0, 1.0, 5.0, .5,
+									true);
+		double locateSeconds = std::chrono::duration<double>(
+				std::chrono::steady_clock::now() - start).count();
+
+		// single evaluations gather the pick data every call
+		int numSingle = BENCHMARK_ITERATIONS / 10;
+		double singleValue = 0;
+		start = std::chrono::steady_clock::now();
+		for (int i = 0; i < numSingle; i++) {
+			singleValue = hypo->calculateBayes(hypo->getLatitude(),
+												hypo->getLongitude(),
+												hypo->getDepth(),
+												hypo->getTOrigin(), true);
+		}
+		double singleSeconds = std::chrono::duration<double>(
+				std::chrono::steady_clock::now() - start).count();
+
+		std::cout << "[ BENCH    ] " << numPicks << " picks: locate "
+					<< BENCHMARK_ITERATIONS / locateSeconds
+					<< " evaluations/s, single " << numSingle / singleSeconds
+					<< " evaluations/s" << std::endl;
+
+		// the locator should have moved to the benchmark location, and the
+		// stored stack should match a fresh evaluation there
+		ASSERT_NEAR(BENCHMARK_LATITUDE, hypo->getLatitude(), BENCHMARK_OFFSET)
+				<< "latitude";
+		ASSERT_NEAR(BENCHMARK_LONGITUDE, hypo->getLongitude(), BENCHMARK_OFFSET)
+				<< "longitude";
+		ASSERT_NEAR(hypo->getBayesValue(), singleValue, 0.000001)<< "bayes";
+		ASSERT_GT(singleValue, 0.0)<< "bayes positive";
+	}
+}
+
+// tests to see if the multiple chain locator is repeatable for a given seed,
+// and benchmarks it against the single chain locator
+TEST(HypoTest, LocatorChains) {
+	glass3::util::Logger::disable();
+
+	// load config file
+	std::ifstream initFile;
+	initFile.open(
+			"./" + std::string(TESTPATH) + "/" + std::string(INITFILENAME),
+			std::ios::in);
+	std::string initLine = "";
+	std::getline(initFile, initLine);
+	initFile.close();
+
+	std::shared_ptr<json::Object> initConfig = std::make_shared<json::Object>(
+			json::Deserialize(initLine));
+
+	// construct a glass
+	glasscore::CGlass * testGlass = new glasscore::CGlass();
+	testGlass->receiveExternalMessage(initConfig);
+
+	// hypos take their locator seed when they are created
+	glasscore::CGlass::setLocatorRandomSeed(42);
+	ASSERT_EQ(42, glasscore::CGlass::getLocatorRandomSeed())<< "seed";
+
+	int numPicks = 100;
+	std::vector<std::shared_ptr<glasscore::CSite>> sites;
+	std::shared_ptr<glasscore::CHypo> serialHypo = buildBenchmarkHypo(
+			testGlass, numPicks, &sites);
+	std::shared_ptr<glasscore::CHypo> chainHypo = buildBenchmarkHypo(
+			testGlass, numPicks, &sites);
+	std::shared_ptr<glasscore::CHypo> repeatHypo = buildBenchmarkHypo(
+			testGlass, numPicks, &sites);
+
+	auto start = std::chrono::steady_clock::now();
+	serialHypo->annealingLocateBayes(BENCHMARK_ITERATIONS, 100.0, 1.0, 5.0, .5,
+										true);
+	double serialSeconds = std::chrono::duration<double>(
+			std::chrono::steady_clock::now() - start).count();
+
+	glasscore::CGlass::setNumLocatorChains(4);
+	ASSERT_EQ(4, glasscore::CGlass::getNumLocatorChains())<< "chains";
+
+	start = std::chrono::steady_clock::now();
+	chainHypo->annealingLocateBayes(BENCHMARK_ITERATIONS, 100.0, 1.0, 5.0, .5,
+									true);
+	double chainSeconds = std::chrono::duration<double>(
+			std::chrono::steady_clock::now() - start).count();
+
+	repeatHypo->annealingLocateBayes(BENCHMARK_ITERATIONS, 100.0, 1.0, 5.0, .5,
+										true);
+
+	glasscore::CGlass::setNumLocatorChains(1);
+	glasscore::CGlass::setLocatorRandomSeed(-1);
+
+	std::cout << "[ BENCH    ] " << numPicks << " picks: single chain "
+				<< serialSeconds * 1000.0 << " ms (bayes "
+				<< serialHypo->getBayesValue() << "), 4 chains "
+				<< chainSeconds * 1000.0 << " ms (bayes "
+				<< chainHypo->getBayesValue() << ")" << std::endl;
+
+	// the same seed should give the same location
+	ASSERT_DOUBLE_EQ(chainHypo->getLatitude(), repeatHypo->getLatitude())<<
+	"repeat latitude";
+	ASSERT_DOUBLE_EQ(chainHypo->getLongitude(), repeatHypo->getLongitude())<<
+	"repeat longitude";
+	ASSERT_DOUBLE_EQ(chainHypo->getDepth(), repeatHypo->getDepth())<<
+	"repeat depth";
+	ASSERT_DOUBLE_EQ(chainHypo->getTOrigin(), repeatHypo->getTOrigin())<<
+	"repeat origin time";
+	ASSERT_DOUBLE_EQ(chainHypo->getBayesValue(), repeatHypo->getBayesValue())<<
+	"repeat bayes";
+
+	// and the chains should have found the benchmark location
+	ASSERT_NEAR(BENCHMARK_LATITUDE, chainHypo->getLatitude(), BENCHMARK_OFFSET)
+			<< "latitude";
+	ASSERT_NEAR(BENCHMARK_LONGITUDE, chainHypo->getLongitude(),
+				BENCHMARK_OFFSET)<< "longitude";
+	ASSERT_GT(chainHypo->getBayesValue(), 0.0)<< "bayes positive";
+}
+
+// tests to see if the multiple chain locator releases the hypo while its
+// chains run, and discards its result if the hypo changes in the mean time
+TEST(HypoTest, LocatorChainsUnlocked) {
+	glass3::util::Logger::disable();
+
+	// load config file
+	std::ifstream initFile;
+	initFile.open(
+			"./" + std::string(TESTPATH) + "/" + std::string(INITFILENAME),
+			std::ios::in);
+	std::string initLine = "";
+	std::getline(initFile, initLine);
+	initFile.close();
+
+	std::shared_ptr<json::Object> initConfig = std::make_shared<json::Object>(
+			json::Deserialize(initLine));
+
+	// construct a glass
+	glasscore::CGlass * testGlass = new glasscore::CGlass();
+	testGlass->receiveExternalMessage(initConfig);
+
+	int numPicks = 1000;
+	std::vector<std::shared_ptr<glasscore::CSite>> sites;
+	std::shared_ptr<glasscore::CHypo> hypo = buildBenchmarkHypo(testGlass,
+																numPicks,
+																&sites);
+	double startLatitude = hypo->getLatitude();
+	double startLongitude = hypo->getLongitude();
+
+	glasscore::CGlass::setNumLocatorChains(4);
+
+	// locate on another thread
+	std::atomic<bool> locateDone(false);
+	std::thread locateThread([hypo, &locateDone]() {
+		hypo->annealingLocateBayes(BENCHMARK_ITERATIONS, 100.0, 1.0, 5.0, .5,
+									true);
+		locateDone = true;
+	});
+
+	// add a pick once the chains are running, which shouldn't have to wait
+	// for them to finish
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	std::shared_ptr<glasscore::CPick> addedPick = std::make_shared<
+			glasscore::CPick>(sites[0], BENCHMARK_TIME + 100.0, "ADDED", -1, -1);
+	ASSERT_TRUE(hypo->addPickReference(addedPick))<< "pick added";
+	bool addedBeforeDone = (locateDone == false);
+
+	locateThread.join();
+	glasscore::CGlass::setNumLocatorChains(1);
+
+	ASSERT_TRUE(addedBeforeDone)<< "hypo usable while chains run";
+
+	// the pick data changed, so the chains' location was discarded
+	ASSERT_DOUBLE_EQ(startLatitude, hypo->getLatitude())<< "latitude kept";
+	ASSERT_DOUBLE_EQ(startLongitude, hypo->getLongitude())<< "longitude kept";
+	ASSERT_NEAR(hypo->calculateBayes(hypo->getLatitude(), hypo->getLongitude(),
+										hypo->getDepth(), hypo->getTOrigin(),
+										true),
+				hypo->getBayesValue(), 0.000001)<< "bayes at kept location";
+}
+
+// tests to see if the single chain locator is repeatable for a given seed
+TEST(HypoTest, LocatorSeed) {
+	glass3::util::Logger::disable();
+
+	// load config file
+	std::ifstream initFile;
+	initFile.open(
+			"./" + std::string(TESTPATH) + "/" + std::string(INITFILENAME),
+			std::ios::in);
+	std::string initLine = "";
+	std::getline(initFile, initLine);
+	initFile.close();
+
+	std::shared_ptr<json::Object> initConfig = std::make_shared<json::Object>(
+			json::Deserialize(initLine));
+
+	// construct a glass
+	glasscore::CGlass * testGlass = new glasscore::CGlass();
+	testGlass->receiveExternalMessage(initConfig);
+
+	glasscore::CGlass::setLocatorRandomSeed(7);
+
+	int numPicks = 10;
+	std::vector<std::shared_ptr<glasscore::CSite>> sites;
+	std::shared_ptr<glasscore::CHypo> hypo = buildBenchmarkHypo(testGlass,
+																numPicks,
+																&sites);
+	std::shared_ptr<glasscore::CHypo> repeatHypo = buildBenchmarkHypo(
+			testGlass, numPicks, &sites);
+
+	glasscore::CGlass::setLocatorRandomSeed(-1);
+
+	// locate the hypos on different threads, each hypo's draws are its own
+	std::thread locateThread([hypo]() {
+		hypo->annealingLocateBayes(BENCHMARK_ITERATIONS, 100.0, 1.0, 5.0, .5,
+									true);
+	});
+	repeatHypo->annealingLocateBayes(BENCHMARK_ITERATIONS, 100.0, 1.0, 5.0, .5,
+										true);
+	locateThread.join();
+
+	ASSERT_DOUBLE_EQ(hypo->getLatitude(), repeatHypo->getLatitude())<<
+	"repeat latitude";
+	ASSERT_DOUBLE_EQ(hypo->getLongitude(), repeatHypo->getLongitude())<<
+	"repeat longitude";
+	ASSERT_DOUBLE_EQ(hypo->getDepth(), repeatHypo->getDepth())<<
+	"repeat depth";
+	ASSERT_DOUBLE_EQ(hypo->getTOrigin(), repeatHypo->getTOrigin())<<
+	"repeat origin time";
+	ASSERT_DOUBLE_EQ(hypo->getBayesValue(), repeatHypo->getBayesValue())<<
+	"repeat bayes";
+}
+
+// tests to see if hypo messages are reused while the hypo is unchanged, and
+// benchmarks generating them
+TEST(HypoTest, MessageCaching) {
+	glass3::util::Logger::disable();
+
+	// load config file
+	std::ifstream initFile;
+	initFile.open(
+			"./" + std::string(TESTPATH) + "/" + std::string(INITFILENAME),
+			std::ios::in);
+	std::string initLine = "";
+	std::getline(initFile, initLine);
+	initFile.close();
+
+	std::shared_ptr<json::Object> initConfig = std::make_shared<json::Object>(
+			json::Deserialize(initLine));
+
+	// construct a glass
+	glasscore::CGlass * testGlass = new glasscore::CGlass();
+	testGlass->receiveExternalMessage(initConfig);
+
+	// two hypos that locate the same way, one to generate messages from
+	// scratch to compare against
+	glasscore::CGlass::setLocatorRandomSeed(7);
+
+	int numPicks = 1000;
+	std::vector<std::shared_ptr<glasscore::CSite>> sites;
+	std::shared_ptr<glasscore::CHypo> hypo = buildBenchmarkHypo(testGlass,
+																numPicks,
+																&sites);
+	std::shared_ptr<glasscore::CHypo> freshHypo = buildBenchmarkHypo(
+			testGlass, numPicks, &sites);
+
+	glasscore::CGlass::setLocatorRandomSeed(-1);
+
+	hypo->annealingLocateBayes(BENCHMARK_ITERATIONS / 10, 100.0, 1.0, 5.0, .5,
+								true);
+	freshHypo->annealingLocateBayes(BENCHMARK_ITERATIONS / 10, 100.0, 1.0, 5.0,
+									.5, true);
+
+	// the first message builds every data block
+	auto start = std::chrono::steady_clock::now();
+	std::shared_ptr<json::Object> firstMessage = hypo->generateHypoMessage();
+	double firstSeconds = std::chrono::duration<double>(
+			std::chrono::steady_clock::now() - start).count();
+	ASSERT_TRUE(firstMessage != NULL)<< "first message";
+	ASSERT_STREQ("Hypo", (*firstMessage)["Cmd"].ToString().c_str())<<
+	"first message is a hypo";
+	int numData = (*firstMessage)["Data"].ToArray().size();
+	ASSERT_GT(numData, 0)<< "first message data";
+
+	// an unchanged hypo gets a copy of the last message
+	start = std::chrono::steady_clock::now();
+	std::shared_ptr<json::Object> unchangedMessage = hypo
+			->generateHypoMessage();
+	double unchangedSeconds = std::chrono::duration<double>(
+			std::chrono::steady_clock::now() - start).count();
+	ASSERT_EQ(json::Serialize(*firstMessage),
+				json::Serialize(*unchangedMessage))<< "unchanged message";
+	ASSERT_NE(firstMessage.get(), unchangedMessage.get())<< "message copied";
+
+	// the event version only changes with the hypo
+	int version = (*hypo->generateEventMessage())["Version"].ToInt();
+	ASSERT_EQ(version, (*hypo->generateEventMessage())["Version"].ToInt())<<
+	"unchanged event version";
+
+	// a moved hypo reuses the data blocks, but updates their association info
+	hypo->setLatitude(hypo->getLatitude() + BENCHMARK_OFFSET / 10);
+	freshHypo->setLatitude(freshHypo->getLatitude() + BENCHMARK_OFFSET / 10);
+	start = std::chrono::steady_clock::now();
+	std::shared_ptr<json::Object> movedMessage = hypo->generateHypoMessage();
+	double movedSeconds = std::chrono::duration<double>(
+			std::chrono::steady_clock::now() - start).count();
+	ASSERT_NE(json::Serialize(*firstMessage), json::Serialize(*movedMessage))<<
+	"moved message";
+	ASSERT_EQ(json::Serialize(*freshHypo->generateHypoMessage()),
+				json::Serialize(*movedMessage))<< "moved matches fresh";
+	ASSERT_EQ(version + 1, (*hypo->generateEventMessage())["Version"].ToInt())<<
+	"moved event version";
+
+	// removed data is dropped from the message
+	ASSERT_EQ(numPicks, numData)<< "all picks publishable";
+	hypo->removePickReference(hypo->getPickData()[0]);
+	std::shared_ptr<json::Object> removedMessage = hypo->generateHypoMessage();
+	ASSERT_EQ(numData - 1,
+				static_cast<int>((*removedMessage)["Data"].ToArray().size()))<<
+	"removed pick dropped";
+
+	// a pick updated in place is regenerated, even though the hypo is not
+	// otherwise changed
+	version = (*hypo->generateEventMessage())["Version"].ToInt();
+	std::shared_ptr<glasscore::CPick> updatedPick = hypo->getPickData()[0];
+	updatedPick->initialize(updatedPick->getSite(), updatedPick->getTPick(),
+							"UPDATED", "", -1, -1, "",
+							std::numeric_limits<double>::quiet_NaN(),
+							std::numeric_limits<double>::quiet_NaN(),
+							std::numeric_limits<double>::quiet_NaN(),
+							std::numeric_limits<double>::quiet_NaN(),
+							std::numeric_limits<double>::quiet_NaN(),
+							std::numeric_limits<double>::quiet_NaN(),
+							std::numeric_limits<double>::quiet_NaN(),
+							std::numeric_limits<double>::quiet_NaN(),
+							std::numeric_limits<double>::quiet_NaN());
+	std::shared_ptr<json::Object> updatedMessage = hypo->generateHypoMessage();
+	ASSERT_NE(std::string::npos,
+				json::Serialize(*updatedMessage).find("\"UPDATED\""))<<
+	"updated pick regenerated";
+	ASSERT_EQ(version + 1, (*hypo->generateEventMessage())["Version"].ToInt())<<
+	"updated event version";
+
+	std::cout << "[ BENCH    ] " << numPicks << " picks: first message "
+				<< firstSeconds * 1000.0 << " ms, unchanged "
+				<< unchangedSeconds * 1000.0 << " ms, moved "
+				<< movedSeconds * 1000.0 << " ms" << std::endl;
+}
@@ -0,0 +1,310 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <logger.h>
+#include <geo.h>
+#include <glassmath.h>
+
+#include "Glass.h"
+#include "Hypo.h"
+#include "HypoIndex.h"
+#include "HypoList.h"
+#include "Pick.h"
+#include "Site.h"
+
+#define NUMSEQUENCES 40
+#define HYPOSPERSEQUENCE 25
+#define NUMHYPOPICKS 5
+#define SEQUENCESPAN 3600.0
+#define STARTTIME 3628281643.59000
+#define NUMLOCATIONS 50
+#define SEARCHPAST 3600.0
+#define SEARCHFUTURE 10.0
+#define MERGEDISTANCE 3.0
+#define COMP "BHZ"
+#define NET "US"
+#define LOC ""
+#define ELEVATION 100.0
+#define QUALITY 1.0
+
+// generates concurrent earthquake sequences spread over the globe, each a
+// cluster of hypos whose picks are at a distance that varies by sequence,
+// so the association distance cutoffs vary too, picks don't keep their sites
+// so the sites are added to sites
+std::vector<std::shared_ptr<glasscore::CHypo>> generateSequenceHypos(
+		std::vector<std::shared_ptr<glasscore::CSite>> *sites) {
+	std::shared_ptr<traveltime::CTravelTime> nullTrav;
+	std::shared_ptr<traveltime::CTTT> nullTTT;
+
+	std::vector<std::shared_ptr<glasscore::CHypo>> hypos;
+	for (int i = 0; i < NUMSEQUENCES; i++) {
+		double seqLat = -70.0 + ((i * 37) % 140);
+		double seqLon = -179.0 + ((i * 97) % 358);
+		double pickDistance = 2.0 + (i % 8) * 2.0;
+
+		for (int j = 0; j < HYPOSPERSEQUENCE; j++) {
+			int index = i * HYPOSPERSEQUENCE + j;
+			double lat = seqLat + (j % 5) * 0.2;
+			double lon = seqLon + (j / 5) * 0.2;
+			double tOrigin = STARTTIME
+					+ SEQUENCESPAN
+							* static_cast<double>((index * 7919)
+									% (NUMSEQUENCES * HYPOSPERSEQUENCE))
+							/ (NUMSEQUENCES * HYPOSPERSEQUENCE);
+
+			std::shared_ptr<glasscore::CHypo> hypo = std::make_shared<
+					glasscore::CHypo>(lat, lon, 10.0, tOrigin,
+										"H" + std::to_string(index), "Test", 1.0,
+										0.5, 6, nullTrav, nullTrav, nullTTT);
+
+			for (int k = 0; k < NUMHYPOPICKS; k++) {
+				std::shared_ptr<glasscore::CSite> site = std::make_shared<
+						glasscore::CSite>(
+						"H" + std::to_string(index) + "S" + std::to_string(k),
+						COMP, NET, LOC, lat + pickDistance, lon + k, ELEVATION,
+						QUALITY, true, true);
+				sites->push_back(site);
+				hypo->addPickReference(
+						std::make_shared<glasscore::CPick>(
+								site, tOrigin + 60.0,
+								"H" + std::to_string(index) + "P" + std::to_string(k),
+								-1, -1));
+			}
+			hypo->calculateStatistics();
+
+			hypos.push_back(hypo);
+		}
+	}
+
+	return (hypos);
+}
+
+// gets the location of a search
+glass3::util::Geo getHypoSearchGeo(int i) {
+	glass3::util::Geo geo;
+	geo.setGeographic(-85.0 + (i * 3.4), -175.0 + (i * 37.1),
+						glass3::util::Geo::k_EarthRadiusKm);
+	return (geo);
+}
+
+// finds the hypos in the window and distance by checking every hypo, a
+// negative distance uses each hypo's association distance cutoff
+std::set<glasscore::CHypo *> checkAllHypos(
+		const std::vector<std::shared_ptr<glasscore::CHypo>> &hypos,
+		glass3::util::Geo *geo, double maxDistance, double t1, double t2) {
+	std::set<glasscore::CHypo *> found;
+	for (auto hypo : hypos) {
+		if ((hypo->getTSort() < t1) || (hypo->getTSort() > t2)) {
+			continue;
+		}
+
+		double distance = hypo->getGeo().delta(geo)
+				/ glass3::util::GlassMath::k_DegreesToRadians;
+		double cutoff = maxDistance;
+		if (cutoff < 0) {
+			cutoff = hypo->getAssociationDistanceCutoff();
+		}
+		if (distance > cutoff) {
+			continue;
+		}
+		found.insert(hypo.get());
+	}
+
+	return (found);
+}
+
+// tests to see if hypos can be added and removed
+TEST(HypoIndexTest, AddRemove) {
+	glass3::util::Logger::disable();
+
+	// sets the distance cutoff defaults
+	glasscore::CGlass * testGlass = new glasscore::CGlass();
+
+	std::vector<std::shared_ptr<glasscore::CSite>> sites;
+	std::vector<std::shared_ptr<glasscore::CHypo>> hypos =
+			generateSequenceHypos(&sites);
+	ASSERT_GE(hypos[0]->getAssociationDistanceCutoff(),
+				testGlass->getMinDistanceCutoff())<< "cutoff";
+
+	glasscore::CHypoIndex hypoIndex;
+	ASSERT_EQ(0, hypoIndex.size())<< "empty size";
+
+	for (int i = 0; i < 100; i++) {
+		ASSERT_TRUE(hypoIndex.addHypo(hypos[i]));
+	}
+	ASSERT_EQ(100, hypoIndex.size())<< "size";
+	ASSERT_FALSE(hypoIndex.addHypo(NULL))<< "null hypo";
+
+	// adding again moves rather than duplicates
+	hypos[0]->setLatitude(-hypos[0]->getLatitude());
+	hypos[0]->setTSort(hypos[0]->getTSort() + 10.0);
+	ASSERT_TRUE(hypoIndex.addHypo(hypos[0]));
+	ASSERT_EQ(100, hypoIndex.size())<< "size after update";
+
+	ASSERT_TRUE(hypoIndex.removeHypo(hypos[1]));
+	ASSERT_FALSE(hypoIndex.removeHypo(hypos[1]))<< "remove twice";
+	ASSERT_EQ(99, hypoIndex.size())<< "size after remove";
+
+	// everything, everywhere
+	glass3::util::Geo geo = getHypoSearchGeo(0);
+	std::vector<std::weak_ptr<glasscore::CHypo>> found = hypoIndex.getHypos(
+			geo, glass3::util::GlassMath::k_Pi, 0.0,
+			STARTTIME + 2.0 * SEQUENCESPAN);
+	ASSERT_EQ(99, static_cast<int>(found.size()))<< "all hypos";
+	for (int i = 1; i < static_cast<int>(found.size()); i++) {
+		ASSERT_LE(found[i - 1].lock()->getTSort(), found[i].lock()->getTSort())<<
+		"time order";
+	}
+	for (auto hypo : found) {
+		ASSERT_NE(hypos[1].get(), hypo.lock().get())<< "removed hypo";
+	}
+
+	hypoIndex.clear();
+	ASSERT_EQ(0, hypoIndex.size())<< "cleared size";
+}
+
+// tests to see if searches find every hypo checking all hypos does, even
+// after the hypos move a little
+TEST(HypoIndexTest, Search) {
+	glass3::util::Logger::disable();
+
+	glasscore::CGlass * testGlass = new glasscore::CGlass();
+
+	std::vector<std::shared_ptr<glasscore::CSite>> sites;
+	std::vector<std::shared_ptr<glasscore::CHypo>> hypos =
+			generateSequenceHypos(&sites);
+	ASSERT_GE(hypos.back()->getAssociationDistanceCutoff(),
+				testGlass->getMinDistanceCutoff())<< "cutoff";
+
+	glasscore::CHypoIndex hypoIndex;
+	for (auto hypo : hypos) {
+		hypoIndex.addHypo(hypo);
+	}
+
+	// move every hypo within the allowance without telling the index
+	double move = glasscore::CHypoIndex::k_dMovementAllowance / 2.0;
+	for (int i = 0; i < static_cast<int>(hypos.size()); i += 3) {
+		hypos[i]->setLatitude(
+				hypos[i]->getLatitude() + ((i % 2 == 0) ? move : -move));
+	}
+
+	for (int i = 0; i < NUMLOCATIONS; i++) {
+		glass3::util::Geo geo = getHypoSearchGeo(i);
+		double t1 = STARTTIME + i * 60.0 - SEARCHPAST;
+		double t2 = STARTTIME + i * 60.0 + SEARCHFUTURE;
+
+		// fixed distance
+		std::set<glasscore::CHypo *> expected = checkAllHypos(hypos, &geo,
+																MERGEDISTANCE,
+																t1, t2);
+		std::vector<std::weak_ptr<glasscore::CHypo>> found = hypoIndex.getHypos(
+				geo, MERGEDISTANCE * glass3::util::GlassMath::k_DegreesToRadians,
+				t1, t2);
+
+		std::set<glasscore::CHypo *> foundSet;
+		for (auto hypo : found) {
+			std::shared_ptr<glasscore::CHypo> aHypo = hypo.lock();
+			ASSERT_GE(aHypo->getTSort(), t1)<< "after window start";
+			ASSERT_LE(aHypo->getTSort(), t2)<< "before window end";
+			foundSet.insert(aHypo.get());
+		}
+		for (auto hypo : expected) {
+			ASSERT_EQ(1, static_cast<int>(foundSet.count(hypo)))<<
+			"found hypo within distance";
+		}
+
+		// association distance cutoff
+		expected = checkAllHypos(hypos, &geo, -1.0, t1, t2);
+		found = hypoIndex.getAssociableHypos(geo, t1, t2);
+
+		foundSet.clear();
+		for (auto hypo : found) {
+			foundSet.insert(hypo.lock().get());
+		}
+		for (auto hypo : expected) {
+			ASSERT_EQ(1, static_cast<int>(foundSet.count(hypo)))<<
+			"found hypo within cutoff";
+		}
+	}
+}
+
+// compares the association candidates from the time window alone against
+// the candidates from the hypo list's index, for picks around the globe
+// during concurrent sequences
+TEST(HypoIndexTest, CandidateBenchmark) {
+	glass3::util::Logger::disable();
+
+	glasscore::CGlass * testGlass = new glasscore::CGlass();
+	testGlass->setMaxNumHypos(-1);
+
+	std::vector<std::shared_ptr<glasscore::CSite>> sites;
+	std::vector<std::shared_ptr<glasscore::CHypo>> hypos =
+			generateSequenceHypos(&sites);
+
+	// no processing threads
+	glasscore::CHypoList * testHypoList = new glasscore::CHypoList(0);
+	testHypoList->setMaxAllowableHypoCount(hypos.size());
+	for (auto hypo : hypos) {
+		testHypoList->addHypo(hypo, false);
+	}
+	ASSERT_EQ(static_cast<int>(hypos.size()), testHypoList->length());
+
+	int timeCandidates = 0;
+	int indexCandidates = 0;
+	int withinCutoff = 0;
+	double timeSeconds = 0;
+	double indexSeconds = 0;
+
+	for (int i = 0; i < NUMLOCATIONS; i++) {
+		glass3::util::Geo geo = getHypoSearchGeo(i);
+		double tPick = STARTTIME + SEQUENCESPAN / 2.0 + i * 30.0;
+
+		// what association used to consider
+		auto start = std::chrono::steady_clock::now();
+		std::vector<std::weak_ptr<glasscore::CHypo>> found =
+				testHypoList->getHypos(tPick - SEARCHPAST, tPick + SEARCHFUTURE);
+		timeSeconds += std::chrono::duration<double>(
+				std::chrono::steady_clock::now() - start).count();
+		timeCandidates += found.size();
+
+		start = std::chrono::steady_clock::now();
+		found = testHypoList->getAssociableHypos(tPick - SEARCHPAST,
+													tPick + SEARCHFUTURE, geo);
+		indexSeconds += std::chrono::duration<double>(
+				std::chrono::steady_clock::now() - start).count();
+		indexCandidates += found.size();
+
+		withinCutoff += checkAllHypos(hypos, &geo, -1.0,
+										std::floor(tPick - SEARCHPAST),
+										std::floor(tPick + SEARCHFUTURE)).size();
+	}
+
+	std::cout << "[ BENCH    ] " << hypos.size() << " hypos in "
+				<< NUMSEQUENCES << " sequences, " << NUMLOCATIONS << " picks"
+				<< std::endl;
+	std::cout << "[ BENCH    ] time window candidates: " << timeCandidates
+				<< ", indexed candidates: " << indexCandidates
+				<< ", within cutoff: " << withinCutoff << std::endl;
+	std::cout << "[ BENCH    ] time window search: "
+				<< (timeSeconds / NUMLOCATIONS) * 1000.0
+				<< " ms per pick, indexed search: "
+				<< (indexSeconds / NUMLOCATIONS) * 1000.0 << " ms per pick"
+				<< std::endl;
+
+	ASSERT_LE(withinCutoff, indexCandidates)<< "no hypo within cutoff missed";
+	ASSERT_LT(indexCandidates, timeCandidates)<< "fewer candidates";
+
+	// the index follows the list
+	testHypoList->clear();
+	ASSERT_EQ(0, static_cast<int>(testHypoList->getAssociableHypos(
+			STARTTIME - SEARCHPAST, STARTTIME + SEQUENCESPAN,
+			getHypoSearchGeo(0)).size()))<< "cleared";
+
+	delete (testHypoList);
+}
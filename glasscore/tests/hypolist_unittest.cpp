@@ -4,6 +4,8 @@
 #include <sstream>
 #include <iostream>
 #include <fstream>
+#include <chrono>
+#include <vector>
 
 #include <logger.h>
 
@@ -33,6 +35,9 @@
 
 #define MAXNHYPO 5
 
+#define QUEUE_NUMHYPOS 1000
+#define QUEUE_NUMREQUEUES 200
+
 #define ASSOCPICKJSON "{\"Type\":\"Pick\",\"ID\":\"96499\",\"Site\":{\"Station\":\"BERG\",\"Network\":\"AK\",\"Channel\":\"BHZ\",\"Location\":\"--\"},\"Source\":{\"AgencyID\":\"US\",\"Author\":\"228041013\"},\"Time\":\"2015-08-14T00:39:08.527Z\",\"Phase\":\"P\",\"Polarity\":\"up\",\"Picker\":\"raypicker\",\"Filter\":[{\"HighPass\":1.05,\"LowPass\":2.65}],\"Amplitude\":{\"Amplitude\":0.0,\"Period\":0.0,\"SNR\":3.81},\"AssociationInfo\":{\"Phase\":\"P\",\"Distance\":4.522347499827323,\"Azimuth\":80.51195539508707,\"Residual\":-0.07935762576066452,\"Sigma\":0.9968561359397737}}"  // NOLINT
 #define ASSOCPICK2JSON "{\"Type\":\"Pick\",\"ID\":\"96386\",\"Site\":{\"Station\":\"HOM\",\"Network\":\"AK\",\"Channel\":\"BHZ\",\"Location\":\"--\"},\"Source\":{\"AgencyID\":\"US\",\"Author\":\"228041013\"},\"Time\":\"2015-08-14T00:38:18.207Z\",\"Phase\":\"P\",\"Polarity\":\"up\",\"Picker\":\"raypicker\",\"Filter\":[{\"HighPass\":1.05,\"LowPass\":2.65}],\"Amplitude\":{\"Amplitude\":0.0,\"Period\":0.0,\"SNR\":5.0},\"AssociationInfo\":{\"Phase\":\"P\",\"Distance\":0.6123794730349522,\"Azimuth\":118.57193866082869,\"Residual\":-1.1292614242197293,\"Sigma\":0.5285511568133225}}"  // NOLINT
 
@@ -552,3 +557,189 @@ TEST(HypoListTest, FailTests) {
 	ASSERT_FALSE(testHypoList->receiveExternalMessage(nullMessage));
 	ASSERT_FALSE(testHypoList->requestHypo(nullMessage));
 }
+
+// builds a hypo for the processing queue tests
+std::shared_ptr<glasscore::CHypo> buildQueueHypo(int index, double bayes) {
+	std::shared_ptr<traveltime::CTravelTime> nullTrav;
+	std::shared_ptr<traveltime::CTTT> nullTTT;
+
+	// spread the hypos out in time so none are merged
+	return (std::make_shared<glasscore::CHypo>(
+			-21.84, 170.03, 10.0, TORG + (index * 100.0),
+			"Q" + std::to_string(index), "Test", bayes, 0.5, 6, nullTrav,
+			nullTrav, nullTTT));
+}
+
+// test the processing queue orders
+TEST(HypoListTest, QueueOrder) {
+	glass3::util::Logger::disable();
+
+	// no processing threads, so the queue is only drained here
+	glasscore::CHypoList * testHypoList = new glasscore::CHypoList(0);
+	glasscore::CGlass::setMaxNumHypos(-1);
+
+	std::shared_ptr<glasscore::CHypo> hypo1 = buildQueueHypo(1, 1.0);
+	std::shared_ptr<glasscore::CHypo> hypo2 = buildQueueHypo(2, 3.0);
+	std::shared_ptr<glasscore::CHypo> hypo3 = buildQueueHypo(3, 2.0);
+	testHypoList->addHypo(hypo1, false);
+	testHypoList->addHypo(hypo2, false);
+	testHypoList->addHypo(hypo3, false);
+
+	// first in first out, without duplicates
+	glasscore::CGlass::setHypoQueueOrder(
+			glasscore::HypoQueueOrder::FirstInFirstOut);
+	ASSERT_EQ(1, testHypoList->appendToHypoProcessingQueue(hypo1));
+	ASSERT_EQ(2, testHypoList->appendToHypoProcessingQueue(hypo2));
+	ASSERT_EQ(3, testHypoList->appendToHypoProcessingQueue(hypo3));
+	ASSERT_EQ(3, testHypoList->appendToHypoProcessingQueue(hypo1))<<
+	"duplicate";
+	ASSERT_TRUE(testHypoList->isOnHypoProcessingQueue(hypo1))<< "queued";
+	ASSERT_TRUE(testHypoList->getNextHypoFromProcessingQueue() == hypo1);
+	ASSERT_FALSE(testHypoList->isOnHypoProcessingQueue(hypo1))<< "dequeued";
+	ASSERT_TRUE(testHypoList->getNextHypoFromProcessingQueue() == hypo2);
+	ASSERT_TRUE(testHypoList->getNextHypoFromProcessingQueue() == hypo3);
+	ASSERT_TRUE(testHypoList->getNextHypoFromProcessingQueue() == NULL);
+
+	// highest bayes first
+	glasscore::CGlass::setHypoQueueOrder(
+			glasscore::HypoQueueOrder::HighestBayesFirst);
+	testHypoList->appendToHypoProcessingQueue(hypo1);
+	testHypoList->appendToHypoProcessingQueue(hypo2);
+	testHypoList->appendToHypoProcessingQueue(hypo3);
+	ASSERT_TRUE(testHypoList->getNextHypoFromProcessingQueue() == hypo2);
+	ASSERT_TRUE(testHypoList->getNextHypoFromProcessingQueue() == hypo3);
+	ASSERT_TRUE(testHypoList->getNextHypoFromProcessingQueue() == hypo1);
+
+	// least processed first, requeueing updates the priority
+	glasscore::CGlass::setHypoQueueOrder(
+			glasscore::HypoQueueOrder::LeastProcessedFirst);
+	hypo1->setProcessCount(0);
+	hypo2->setProcessCount(1);
+	hypo3->setProcessCount(2);
+	testHypoList->appendToHypoProcessingQueue(hypo1);
+	testHypoList->appendToHypoProcessingQueue(hypo2);
+	testHypoList->appendToHypoProcessingQueue(hypo3);
+	hypo1->setProcessCount(5);
+	ASSERT_EQ(3, testHypoList->appendToHypoProcessingQueue(hypo1))<<
+	"requeue";
+	ASSERT_TRUE(testHypoList->getNextHypoFromProcessingQueue() == hypo2);
+
+	// removed hypos leave the queue
+	testHypoList->removeHypo(hypo3, false);
+	ASSERT_EQ(1, testHypoList->getHypoProcessingQueueLength())<< "removed";
+	ASSERT_TRUE(testHypoList->getNextHypoFromProcessingQueue() == hypo1);
+	ASSERT_TRUE(testHypoList->getNextHypoFromProcessingQueue() == NULL);
+
+	glasscore::CGlass::setHypoQueueOrder(
+			glasscore::HypoQueueOrder::FirstInFirstOut);
+}
+
+// benchmarks requeueing with a long queue, and how long a new hypo waits
+// behind hypos that have been processed many times
+TEST(HypoListTest, QueueBenchmark) {
+	glass3::util::Logger::disable();
+
+	glasscore::CHypoList * testHypoList = new glasscore::CHypoList(0);
+	glasscore::CGlass::setMaxNumHypos(-1);
+	testHypoList->setMaxAllowableHypoCount(QUEUE_NUMHYPOS + 1);
+
+	std::vector<std::shared_ptr<glasscore::CHypo>> hypos;
+	for (int i = 0; i < QUEUE_NUMHYPOS; i++) {
+		std::shared_ptr<glasscore::CHypo> hypo = buildQueueHypo(i, 1.0);
+		hypo->setProcessCount(1 + (i % 50));
+		testHypoList->addHypo(hypo, false);
+		hypos.push_back(hypo);
+	}
+	std::shared_ptr<glasscore::CHypo> newHypo = buildQueueHypo(QUEUE_NUMHYPOS,
+																1.0);
+	testHypoList->addHypo(newHypo, false);
+
+	std::vector<glasscore::HypoQueueOrder> orders = {
+			glasscore::HypoQueueOrder::FirstInFirstOut,
+			glasscore::HypoQueueOrder::LeastProcessedFirst };
+	std::vector<int> waits;
+	for (auto order : orders) {
+		glasscore::CGlass::setHypoQueueOrder(order);
+
+		// every hypo is requeued many times, as during a swarm
+		auto start = std::chrono::steady_clock::now();
+		for (int r = 0; r < QUEUE_NUMREQUEUES; r++) {
+			for (auto hypo : hypos) {
+				testHypoList->appendToHypoProcessingQueue(hypo);
+			}
+		}
+		double appendSeconds = std::chrono::duration<double>(
+				std::chrono::steady_clock::now() - start).count();
+		ASSERT_EQ(QUEUE_NUMHYPOS, testHypoList->getHypoProcessingQueueLength())<<
+		"no duplicates";
+
+		// then a new hypo arrives
+		testHypoList->appendToHypoProcessingQueue(newHypo);
+		int wait = 0;
+		while (testHypoList->getNextHypoFromProcessingQueue() != newHypo) {
+			wait++;
+		}
+		waits.push_back(wait);
+
+		// drain the rest
+		while (testHypoList->getNextHypoFromProcessingQueue() != NULL) {
+		}
+
+		std::cout << "[ BENCH    ] order " << order << ": "
+					<< (appendSeconds * 1.0e9)
+							/ (QUEUE_NUMREQUEUES * QUEUE_NUMHYPOS)
+					<< " ns per append with " << QUEUE_NUMHYPOS
+					<< " queued, new hypo waited behind " << wait << std::endl;
+	}
+
+	ASSERT_EQ(QUEUE_NUMHYPOS, waits[0])<< "first in first out wait";
+	ASSERT_EQ(0, waits[1])<< "least processed first wait";
+
+	glasscore::CGlass::setHypoQueueOrder(
+			glasscore::HypoQueueOrder::FirstInFirstOut);
+}
+
+// test that a hypo claimed by another thread is deferred rather than waited
+// on, and requeued when the claim is released
+TEST(HypoListTest, ProcessingClaim) {
+	glass3::util::Logger::disable();
+
+	glasscore::CHypoList * testHypoList = new glasscore::CHypoList(0);
+	glasscore::CGlass::setMaxNumHypos(-1);
+
+	std::shared_ptr<glasscore::CHypo> hypo = buildQueueHypo(1, 1.0);
+	testHypoList->addHypo(hypo, false);
+
+	{
+		// another thread is processing the hypo
+		glasscore::CHypoProcessingClaim claim(hypo, testHypoList);
+		ASSERT_TRUE(claim.ownsClaim())<< "claimed";
+		ASSERT_TRUE(hypo->isLockedForProcessing())<< "locked";
+
+		glasscore::CHypoProcessingClaim otherClaim(hypo, testHypoList);
+		ASSERT_FALSE(otherClaim.ownsClaim())<< "already claimed";
+
+		// so work() defers it immediately
+		testHypoList->appendToHypoProcessingQueue(hypo);
+		auto start = std::chrono::steady_clock::now();
+		ASSERT_EQ(glass3::util::WorkState::OK, testHypoList->work());
+		double workSeconds = std::chrono::duration<double>(
+				std::chrono::steady_clock::now() - start).count();
+		ASSERT_LT(workSeconds, 0.1)<< "didn't wait for the claim";
+		ASSERT_EQ(0, testHypoList->getHypoProcessingQueueLength())<<
+		"deferred";
+	}
+
+	// releasing the claim requeued it
+	ASSERT_FALSE(hypo->isLockedForProcessing())<< "released";
+	ASSERT_EQ(1, testHypoList->getHypoProcessingQueueLength())<< "requeued";
+	ASSERT_TRUE(testHypoList->getNextHypoFromProcessingQueue() == hypo);
+
+	// without a deferral, releasing doesn't requeue
+	{
+		glasscore::CHypoProcessingClaim claim(hypo, testHypoList);
+		ASSERT_TRUE(claim.ownsClaim())<< "claimed again";
+	}
+	ASSERT_EQ(0, testHypoList->getHypoProcessingQueueLength())<<
+	"not requeued";
+}
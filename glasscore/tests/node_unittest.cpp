@@ -116,6 +116,61 @@ TEST(NodeTest, SiteOperations) {
 	ASSERT_EQ(expectedSize, testNode->getSiteLinksCount())<< "sitelist cleared";
 }
 
+// tests to see if site links are kept sorted and unlinked correctly
+TEST(NodeTest, SiteLinkOrdering) {
+	glass3::util::Logger::disable();
+
+	// construct a node
+	std::shared_ptr<glasscore::CNode> testNode(
+			new glasscore::CNode(std::string(NAME), LATITUDE, LONGITUDE, DEPTH,
+									RESOLUTION, MAXDEPTH, ASEISMIC));
+
+	// construct sites
+	std::shared_ptr<glasscore::CSite> testSite1(
+			new glasscore::CSite("LRM", "EHZ", "MB", "", 45.822170, -112.451000,
+									2326.0, 1.0, true, true));
+	std::shared_ptr<glasscore::CSite> testSite2(
+			new glasscore::CSite("HRY", "EHZ", "MB", "", 46.711330, -111.831200,
+									1342.0, 1.0, true, true));
+	std::shared_ptr<glasscore::CSite> testSite3(
+			new glasscore::CSite("TST", "EHZ", "MB", "", 45.0, -111.0, 1000.0,
+									1.0, true, true));
+
+	// link out of travel time order, the third site only has a second travel
+	// time
+	ASSERT_TRUE(testNode->linkSite(testSite1, testNode, DISTANCE_FOR_TT * 3,
+									TRAVELTIME * 3, PHASE));
+	ASSERT_TRUE(testNode->linkSite(testSite2, testNode, DISTANCE_FOR_TT,
+									TRAVELTIME, PHASE));
+	ASSERT_TRUE(testNode->linkSite(testSite3, testNode, DISTANCE_FOR_TT * 2,
+									-1, "", TRAVELTIME * 2, PHASE));
+	ASSERT_EQ(3, testNode->getSiteLinksCount())<< "node has three sites";
+	ASSERT_EQ(DISTANCE_FOR_TT * 3, testNode->getMaxSiteDistance());
+
+	// sort by travel time
+	testNode->sortSiteLinks();
+	ASSERT_EQ(testSite1, testNode->getLastSite())<< "last site after sort";
+	ASSERT_EQ(testSite2, testNode->getSite(testSite2->getSCNL()))<< "get site";
+
+	// unlink the farthest
+	ASSERT_TRUE(testNode->unlinkLastSite());
+	ASSERT_EQ(2, testNode->getSiteLinksCount())<< "node has two sites";
+	ASSERT_TRUE(testNode->getSite(testSite1->getSCNL()) == NULL);
+	ASSERT_EQ(testSite3, testNode->getLastSite())<< "last site after unlink";
+	ASSERT_EQ(DISTANCE_FOR_TT * 2, testNode->getMaxSiteDistance());
+
+	// unlink from the middle
+	ASSERT_TRUE(testNode->unlinkSite(testSite2));
+	ASSERT_FALSE(testNode->unlinkSite(testSite2))<< "unlink twice";
+	ASSERT_EQ(1, testNode->getSiteLinksCount())<< "node has one site";
+	ASSERT_EQ(testSite3, testNode->getLastSite())<< "last site after unlink";
+
+	testNode->clearSiteLinks();
+	ASSERT_EQ(0, testNode->getSiteLinksCount())<< "sitelist cleared";
+	ASSERT_TRUE(testNode->getLastSite() == NULL);
+	ASSERT_FALSE(testNode->unlinkLastSite());
+}
+
 // test various failure cases
 TEST(NodeTest, FailTests) {
 	glass3::util::Logger::disable();
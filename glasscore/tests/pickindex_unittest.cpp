@@ -0,0 +1,240 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <logger.h>
+#include <geo.h>
+#include <glassmath.h>
+
+#include "Pick.h"
+#include "PickIndex.h"
+#include "Site.h"
+
+#define NUMSITES 2000
+#define NUMPICKS 50000
+#define PICKSPAN 14400.0
+#define STARTTIME 3628281643.59000
+#define SEARCHWINDOW 3600.0
+#define NUMLOCATIONS 20
+#define BENCHMARKCUTOFF 30.0
+#define COMP "BHZ"
+#define NET "US"
+#define LOC ""
+#define ELEVATION 100.0
+#define QUALITY 1.0
+
+// generates a set of sites spread unevenly over the globe
+std::vector<std::shared_ptr<glasscore::CSite>> generatePickIndexSites() {
+	std::vector<std::shared_ptr<glasscore::CSite>> sites;
+	for (int i = 0; i < NUMSITES; i++) {
+		// cluster half of the sites in a small region
+		double lat;
+		double lon;
+		if (i % 2 == 0) {
+			lat = 30.0 + (i % 17) * 0.5;
+			lon = -120.0 + (i % 23) * 0.5;
+		} else {
+			lat = -89.0 + ((i * 37) % 178);
+			lon = -179.0 + ((i * 71) % 358);
+		}
+
+		sites.push_back(
+				std::make_shared<glasscore::CSite>("S" + std::to_string(i),
+													COMP, NET, LOC, lat, lon,
+													ELEVATION, QUALITY, true,
+													true));
+	}
+
+	return (sites);
+}
+
+// generates picks spread over the sites and PICKSPAN seconds
+std::vector<std::shared_ptr<glasscore::CPick>> generateIndexPicks(
+		const std::vector<std::shared_ptr<glasscore::CSite>> &sites,
+		int numPicks) {
+	std::vector<std::shared_ptr<glasscore::CPick>> picks;
+	for (int i = 0; i < numPicks; i++) {
+		double tPick = STARTTIME
+				+ PICKSPAN * static_cast<double>((i * 7919) % numPicks)
+						/ numPicks;
+		picks.push_back(
+				std::make_shared<glasscore::CPick>(sites[(i * 13) % sites.size()],
+													tPick, std::to_string(i), -1,
+													-1));
+	}
+
+	return (picks);
+}
+
+// finds the picks in the window and distance by checking every pick
+std::set<glasscore::CPick *> checkAllPicks(
+		const std::vector<std::shared_ptr<glasscore::CPick>> &picks,
+		glass3::util::Geo *geo, double maxDistance, double t1, double t2) {
+	std::set<glasscore::CPick *> found;
+	for (auto pick : picks) {
+		if ((pick->getTSort() < t1) || (pick->getTSort() > t2)) {
+			continue;
+		}
+		if (pick->getSite()->getDelta(geo) > maxDistance) {
+			continue;
+		}
+		found.insert(pick.get());
+	}
+
+	return (found);
+}
+
+// tests to see if picks can be added and removed
+TEST(PickIndexTest, AddRemove) {
+	glass3::util::Logger::disable();
+
+	std::vector<std::shared_ptr<glasscore::CSite>> sites =
+			generatePickIndexSites();
+	std::vector<std::shared_ptr<glasscore::CPick>> picks = generateIndexPicks(
+			sites, 100);
+
+	glasscore::CPickIndex pickIndex;
+	ASSERT_EQ(0, pickIndex.size())<< "empty size";
+
+	for (auto pick : picks) {
+		ASSERT_TRUE(pickIndex.addPick(pick));
+	}
+	ASSERT_EQ(100, pickIndex.size())<< "size";
+	ASSERT_FALSE(pickIndex.addPick(NULL))<< "null pick";
+
+	// adding again moves rather than duplicates
+	picks[0]->setTSort(picks[0]->getTSort() + 10.0);
+	ASSERT_TRUE(pickIndex.addPick(picks[0]));
+	ASSERT_EQ(100, pickIndex.size())<< "size after update";
+
+	ASSERT_TRUE(pickIndex.removePick(picks[1]));
+	ASSERT_FALSE(pickIndex.removePick(picks[1]))<< "remove twice";
+	ASSERT_EQ(99, pickIndex.size())<< "size after remove";
+
+	// everything, everywhere
+	glass3::util::Geo geo;
+	geo.setGeographic(0.0, 0.0, glass3::util::Geo::k_EarthRadiusKm);
+	std::vector<std::weak_ptr<glasscore::CPick>> found = pickIndex.getPicks(
+			geo, glass3::util::GlassMath::k_Pi, 0.0, STARTTIME + 2.0 * PICKSPAN);
+	ASSERT_EQ(99, static_cast<int>(found.size()))<< "all picks";
+	for (int i = 1; i < static_cast<int>(found.size()); i++) {
+		ASSERT_LE(found[i - 1].lock()->getTSort(), found[i].lock()->getTSort())<<
+		"time order";
+	}
+	for (auto pick : found) {
+		ASSERT_NE(picks[1].get(), pick.lock().get())<< "removed pick";
+	}
+
+	pickIndex.clear();
+	ASSERT_EQ(0, pickIndex.size())<< "cleared size";
+}
+
+// tests to see if searches find every pick checking all picks does
+TEST(PickIndexTest, Search) {
+	glass3::util::Logger::disable();
+
+	std::vector<std::shared_ptr<glasscore::CSite>> sites =
+			generatePickIndexSites();
+	std::vector<std::shared_ptr<glasscore::CPick>> picks = generateIndexPicks(
+			sites, NUMPICKS / 10);
+
+	glasscore::CPickIndex pickIndex;
+	for (auto pick : picks) {
+		pickIndex.addPick(pick);
+	}
+
+	for (int i = 0; i < NUMLOCATIONS; i++) {
+		glass3::util::Geo geo;
+		geo.setGeographic(-85.0 + (i * 8.6), -175.0 + (i * 17.1),
+							glass3::util::Geo::k_EarthRadiusKm - (i * 10.0));
+		double maxDistance = (1.0 + i * 9.0)
+				* glass3::util::GlassMath::k_DegreesToRadians;
+		double t1 = STARTTIME + i * 300.0;
+		double t2 = t1 + SEARCHWINDOW;
+
+		std::set<glasscore::CPick *> expected = checkAllPicks(picks, &geo,
+																maxDistance, t1,
+																t2);
+		std::vector<std::weak_ptr<glasscore::CPick>> found = pickIndex.getPicks(
+				geo, maxDistance, t1, t2);
+
+		std::set<glasscore::CPick *> foundSet;
+		for (auto pick : found) {
+			std::shared_ptr<glasscore::CPick> aPick = pick.lock();
+			ASSERT_GE(aPick->getTSort(), t1)<< "after window start";
+			ASSERT_LE(aPick->getTSort(), t2)<< "before window end";
+			foundSet.insert(aPick.get());
+		}
+
+		for (auto pick : expected) {
+			ASSERT_EQ(1, static_cast<int>(foundSet.count(pick)))<<
+			"found pick within distance";
+		}
+	}
+}
+
+// compares the scavenging candidates from the time window alone against the
+// candidates from the index
+TEST(PickIndexTest, CandidateBenchmark) {
+	glass3::util::Logger::disable();
+
+	std::vector<std::shared_ptr<glasscore::CSite>> sites =
+			generatePickIndexSites();
+	std::vector<std::shared_ptr<glasscore::CPick>> picks = generateIndexPicks(
+			sites, NUMPICKS);
+
+	glasscore::CPickIndex pickIndex;
+	for (auto pick : picks) {
+		pickIndex.addPick(pick);
+	}
+
+	int timeCandidates = 0;
+	int indexCandidates = 0;
+	int withinCutoff = 0;
+	double indexSeconds = 0;
+	double maxDistance = BENCHMARKCUTOFF
+			* glass3::util::GlassMath::k_DegreesToRadians;
+
+	for (int i = 0; i < NUMLOCATIONS; i++) {
+		glass3::util::Geo geo;
+		geo.setGeographic(-85.0 + (i * 8.6), -175.0 + (i * 17.1),
+							glass3::util::Geo::k_EarthRadiusKm);
+		double tOrigin = STARTTIME + (PICKSPAN / 2.0);
+
+		// what scavenging used to consider
+		for (auto pick : picks) {
+			if (std::abs(pick->getTSort() - tOrigin) <= SEARCHWINDOW) {
+				timeCandidates++;
+			}
+		}
+
+		auto start = std::chrono::steady_clock::now();
+		std::vector<std::weak_ptr<glasscore::CPick>> found = pickIndex.getPicks(
+				geo, maxDistance, tOrigin - SEARCHWINDOW, tOrigin + SEARCHWINDOW);
+		indexSeconds += std::chrono::duration<double>(
+				std::chrono::steady_clock::now() - start).count();
+		indexCandidates += found.size();
+
+		withinCutoff += checkAllPicks(picks, &geo, maxDistance,
+										tOrigin - SEARCHWINDOW,
+										tOrigin + SEARCHWINDOW).size();
+	}
+
+	std::cout << "[ BENCH    ] " << NUMPICKS << " picks, " << NUMLOCATIONS
+				<< " hypos, " << BENCHMARKCUTOFF << " degree cutoff"
+				<< std::endl;
+	std::cout << "[ BENCH    ] time window candidates: " << timeCandidates
+				<< ", indexed candidates: " << indexCandidates
+				<< ", within cutoff: " << withinCutoff << std::endl;
+	std::cout << "[ BENCH    ] indexed search: "
+				<< (indexSeconds / NUMLOCATIONS) * 1000.0 << " ms per hypo"
+				<< std::endl;
+
+	ASSERT_LE(withinCutoff, indexCandidates)<< "no pick within cutoff missed";
+	ASSERT_LT(indexCandidates, timeCandidates)<< "fewer candidates";
+}
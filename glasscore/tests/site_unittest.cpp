@@ -2,10 +2,12 @@
 #include <memory>
 #include <string>
 #include <cmath>
+#include <vector>
 
 #include <logger.h>
 #include <geo.h>
 
+#include "Glass.h"
 #include "Site.h"
 #include "Pick.h"
 #include "Node.h"
@@ -302,6 +304,119 @@ TEST(SiteTest, PickOperations) {
 	ASSERT_EQ(expectedSize, testSite->getPickCount())<< "Removed pick";
 }
 
+// tests to see if the pick buffer stays in time order
+TEST(SiteTest, PickBufferOperations) {
+	glass3::util::Logger::disable();
+
+	std::shared_ptr<json::Object> siteJSON = std::make_shared<json::Object>(
+			json::Object(json::Deserialize(std::string(SITEJSON))));
+	std::shared_ptr<glasscore::CSite> testSite(new glasscore::CSite(siteJSON));
+
+	// add picks out of time order
+	double pickTimes[] = { 20.0, 10.0, 30.0, 15.0, 5.0, 25.0, 15.0 };
+	int numPicks = sizeof(pickTimes) / sizeof(pickTimes[0]);
+	std::vector<std::shared_ptr<glasscore::CPick>> picks;
+	for (int i = 0; i < numPicks; i++) {
+		std::shared_ptr<glasscore::CPick> pick = std::make_shared<
+				glasscore::CPick>(testSite, pickTimes[i], std::to_string(i), -1,
+									-1);
+		picks.push_back(pick);
+		testSite->addPick(pick);
+	}
+	ASSERT_EQ(numPicks, testSite->getPickCount())<< "Added picks";
+
+	// picks come back in time order
+	std::vector<std::shared_ptr<glasscore::CPick>> testPicks = testSite
+			->getPicks(0.0, 100.0);
+	ASSERT_EQ(numPicks, static_cast<int>(testPicks.size()))<< "all picks";
+	for (int i = 1; i < numPicks; i++) {
+		ASSERT_LE(testPicks[i - 1]->getTPick(), testPicks[i]->getTPick());
+	}
+
+	// picks with the same time keep insertion order
+	testPicks = testSite->getPicks(15.0, 15.0);
+	ASSERT_EQ(2, static_cast<int>(testPicks.size()))<< "same time picks";
+	ASSERT_STREQ("3", testPicks[0]->getID().c_str());
+	ASSERT_STREQ("6", testPicks[1]->getID().c_str());
+
+	// remove the oldest and a middle pick
+	testSite->removePick(picks[4]);
+	testSite->removePick(picks[0]);
+	ASSERT_EQ(numPicks - 2, testSite->getPickCount())<< "Removed picks";
+	testPicks = testSite->getPicks(0.0, 100.0);
+	ASSERT_STREQ("1", testPicks[0]->getID().c_str())<< "oldest pick";
+	testPicks = testSite->getPicks(16.0, 24.0);
+	ASSERT_EQ(0, static_cast<int>(testPicks.size()))<< "removed middle pick";
+
+	// add a pick older than every pick
+	std::shared_ptr<glasscore::CPick> oldPick = std::make_shared<
+			glasscore::CPick>(testSite, 1.0, "old", -1, -1);
+	testSite->addPick(oldPick);
+	testPicks = testSite->getPicks(0.0, 100.0);
+	ASSERT_STREQ("old", testPicks[0]->getID().c_str())<< "older pick";
+
+	// move a pick
+	picks[2]->setTPick(12.0);
+	testSite->updatePosition(picks[2]);
+	testPicks = testSite->getPicks(11.0, 13.0);
+	ASSERT_EQ(1, static_cast<int>(testPicks.size()))<< "moved pick";
+	ASSERT_STREQ("2", testPicks[0]->getID().c_str())<< "moved pick";
+
+	// a window copied under lock only holds picks from the times asked for
+	std::vector<std::shared_ptr<glasscore::CPick>> windowPicks;
+	testSite->getPickWindow(14.0, 30.0, &windowPicks);
+	ASSERT_EQ(3, static_cast<int>(windowPicks.size()))<< "window picks";
+	ASSERT_EQ(15.0, windowPicks[0]->getTSort());
+	ASSERT_TRUE(testSite->getPickSnapshot() == NULL)<< "no snapshot";
+
+	// a published snapshot holds every pick, and doesn't change
+	glasscore::CGlass::setSitePickSnapshots(true);
+	testSite->removePick(oldPick);
+	std::shared_ptr<const glasscore::SitePickSnapshot> snapshot = testSite
+			->getPickSnapshot();
+	ASSERT_EQ(testSite->getPickCount(), snapshot->iEnd - snapshot->iStart)<<
+			"full snapshot";
+	testSite->getPickWindow(14.0, 30.0, &windowPicks);
+	ASSERT_EQ(3, static_cast<int>(windowPicks.size()))<< "snapshot window";
+	ASSERT_EQ(15.0, windowPicks[0]->getTSort());
+
+	// appending and removing the oldest pick share the snapshot's block
+	std::shared_ptr<glasscore::CPick> newPick = std::make_shared<
+			glasscore::CPick>(testSite, 50.0, "new", -1, -1);
+	testSite->addPick(newPick);
+	std::shared_ptr<const glasscore::SitePickSnapshot> appended = testSite
+			->getPickSnapshot();
+	ASSERT_TRUE(appended->pBlock == snapshot->pBlock)<< "appended block";
+	ASSERT_EQ(snapshot->iEnd + 1, appended->iEnd)<< "appended snapshot";
+	testSite->removePick(picks[1]);
+	std::shared_ptr<const glasscore::SitePickSnapshot> removed = testSite
+			->getPickSnapshot();
+	ASSERT_TRUE(removed->pBlock == snapshot->pBlock)<< "removed block";
+	ASSERT_EQ(appended->iStart + 1, removed->iStart)<< "removed snapshot";
+	ASSERT_EQ(testSite->getPickCount(), removed->iEnd - removed->iStart);
+
+	// other changes get a new block, the old snapshots don't change
+	testSite->removePick(picks[6]);
+	std::shared_ptr<const glasscore::SitePickSnapshot> rebuilt = testSite
+			->getPickSnapshot();
+	ASSERT_TRUE(rebuilt->pBlock != snapshot->pBlock)<< "new block";
+	ASSERT_EQ(testSite->getPickCount(), rebuilt->iEnd - rebuilt->iStart)<<
+			"new snapshot";
+	ASSERT_EQ(testSite->getPickCount() + 1,
+				snapshot->iEnd - snapshot->iStart)<< "old snapshot";
+	ASSERT_TRUE(snapshot->pBlock->vPicks[snapshot->iStart] == picks[1])<<
+			"old snapshot picks";
+	testSite->getPickWindow(0.0, 100.0, &windowPicks);
+	for (int i = 1; i < static_cast<int>(windowPicks.size()); i++) {
+		ASSERT_LE(windowPicks[i - 1]->getTSort(), windowPicks[i]->getTSort());
+	}
+	ASSERT_STREQ("new", windowPicks.back()->getID().c_str())<< "youngest pick";
+	glasscore::CGlass::setSitePickSnapshots(false);
+
+	testSite->clear();
+	ASSERT_EQ(0, testSite->getPickCount())<< "cleared picks";
+}
+
 // tests to see if nodes can be added to and removed from the site
 TEST(SiteTest, NodeOperations) {
 	glass3::util::Logger::disable();
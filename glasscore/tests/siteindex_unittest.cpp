@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <logger.h>
+#include <geo.h>
+
+#include "Site.h"
+#include "SiteIndex.h"
+
+#define NUMSITES 500
+#define NUMNEAREST 20
+#define NUMLOCATIONS 50
+#define COMP "BHZ"
+#define NET "US"
+#define LOC ""
+#define ELEVATION 100.0
+#define QUALITY 1.0
+
+// generates a set of sites spread unevenly over the globe
+std::vector<std::shared_ptr<glasscore::CSite>> generateIndexSites() {
+	std::vector<std::shared_ptr<glasscore::CSite>> sites;
+	for (int i = 0; i < NUMSITES; i++) {
+		// cluster half of the sites in a small region
+		double lat;
+		double lon;
+		if (i % 2 == 0) {
+			lat = 30.0 + (i % 17) * 0.5;
+			lon = -120.0 + (i % 23) * 0.5;
+		} else {
+			lat = -89.0 + ((i * 37) % 178);
+			lon = -179.0 + ((i * 71) % 358);
+		}
+
+		sites.push_back(
+				std::make_shared<glasscore::CSite>("S" + std::to_string(i),
+													COMP, NET, LOC, lat, lon,
+													ELEVATION, QUALITY, true,
+													true));
+	}
+
+	return (sites);
+}
+
+// computes the nearest sites the way CWeb used to, by sorting every site
+std::vector<std::pair<double, std::shared_ptr<glasscore::CSite>>> sortAllSites(
+		const std::vector<std::shared_ptr<glasscore::CSite>> &sites,
+		glass3::util::Geo *geo, int numSites) {
+	std::vector<std::pair<double, std::shared_ptr<glasscore::CSite>>> sorted;
+	for (auto site : sites) {
+		sorted.push_back(
+				std::pair<double, std::shared_ptr<glasscore::CSite>>(
+						site->getDelta(geo), site));
+	}
+	std::sort(sorted.begin(), sorted.end(),
+		[](const std::pair<double, std::shared_ptr<glasscore::CSite>> &lhs,
+			const std::pair<double, std::shared_ptr<glasscore::CSite>> &rhs) {
+				return (lhs.first < rhs.first);
+			});
+	if (static_cast<int>(sorted.size()) > numSites) {
+		sorted.resize(numSites);
+	}
+
+	return (sorted);
+}
+
+// tests to see if sites can be added and removed
+TEST(SiteIndexTest, AddRemove) {
+	glass3::util::Logger::disable();
+
+	glasscore::CSiteIndex siteIndex;
+	ASSERT_EQ(0, siteIndex.size())<< "empty size";
+
+	std::vector<std::shared_ptr<glasscore::CSite>> sites = generateIndexSites();
+	for (auto site : sites) {
+		ASSERT_TRUE(siteIndex.addSite(site));
+	}
+	ASSERT_EQ(NUMSITES, siteIndex.size())<< "size";
+	ASSERT_FALSE(siteIndex.addSite(NULL))<< "null site";
+
+	// adding again updates rather than duplicates
+	ASSERT_TRUE(siteIndex.addSite(sites[0]));
+	ASSERT_EQ(NUMSITES, siteIndex.size())<< "size after update";
+
+	ASSERT_TRUE(siteIndex.hasSite(sites[1]->getSCNL()));
+	ASSERT_TRUE(siteIndex.removeSite(sites[1]->getSCNL()));
+	ASSERT_FALSE(siteIndex.hasSite(sites[1]->getSCNL()));
+	ASSERT_FALSE(siteIndex.removeSite(sites[1]->getSCNL()))<< "remove twice";
+	ASSERT_EQ(NUMSITES - 1, siteIndex.size())<< "size after remove";
+
+	siteIndex.clear();
+	ASSERT_EQ(0, siteIndex.size())<< "cleared size";
+}
+
+// tests to see if the nearest sites match sorting every site
+TEST(SiteIndexTest, NearestSites) {
+	glass3::util::Logger::disable();
+
+	std::vector<std::shared_ptr<glasscore::CSite>> sites = generateIndexSites();
+
+	glasscore::CSiteIndex siteIndex;
+	for (auto site : sites) {
+		siteIndex.addSite(site);
+	}
+
+	for (int i = 0; i < NUMLOCATIONS; i++) {
+		glass3::util::Geo geo;
+		geo.setGeographic(-85.0 + (i * 3.4), -175.0 + (i * 7.1),
+							glass3::util::Geo::k_EarthRadiusKm);
+
+		std::vector<std::pair<double, std::shared_ptr<glasscore::CSite>>> expected =  // NOLINT
+				sortAllSites(sites, &geo, NUMNEAREST);
+		std::vector<std::pair<double, std::shared_ptr<glasscore::CSite>>> nearest =  // NOLINT
+				siteIndex.getNearestSites(geo, NUMNEAREST);
+
+		ASSERT_EQ(expected.size(), nearest.size())<< "nearest size";
+		for (int j = 0; j < static_cast<int>(expected.size()); j++) {
+			ASSERT_EQ(expected[j].first, nearest[j].first)<< "nearest distance";
+		}
+	}
+
+	// removed sites are no longer found
+	glass3::util::Geo geo;
+	geo.setGeographic(sites[0]->getRawLatitude(), sites[0]->getRawLongitude(),
+						glass3::util::Geo::k_EarthRadiusKm);
+	siteIndex.removeSite(sites[0]->getSCNL());
+	std::vector<std::pair<double, std::shared_ptr<glasscore::CSite>>> nearest =
+			siteIndex.getNearestSites(geo, NUMSITES);
+	ASSERT_EQ(NUMSITES - 1, static_cast<int>(nearest.size()))<< "all sites";
+	for (auto aSite : nearest) {
+		ASSERT_STRNE(sites[0]->getSCNL().c_str(), aSite.second->getSCNL().c_str());
+	}
+
+	// no sites
+	ASSERT_EQ(0, static_cast<int>(siteIndex.getNearestSites(geo, 0).size()));
+	siteIndex.clear();
+	ASSERT_EQ(0,
+			static_cast<int>(siteIndex.getNearestSites(geo, NUMNEAREST).size()));
+}
@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <iostream>
 #include <string>
+#include <vector>
 
 #include <logger.h>
 
@@ -26,6 +29,8 @@
 #define GEOTIME 529.217199
 #define TIME2 169.71368
 #define BILINEAR 529.217200
+#define NUMBATCHRECEIVERS 1000
+#define NUMBATCHREPEATS 1000
 
 // tests to see if the traveltime can be constructed
 TEST(TravelTimeTest, Construction) {
@@ -204,3 +209,149 @@ TEST(TravelTimeTest, Operations) {
 	// bilinear
 	// ASSERT_NEAR(BILINEAR, traveltime.bilinear(DISTANCE,DEPTH), 0.001)<< "bilinear Check"; // NOLINT
 }
+
+// tests traveltime const (stateless) operations
+TEST(TravelTimeTest, ConstOperations) {
+	glass3::util::Logger::disable();
+
+	std::string phasefile = "./" + std::string(TESTPATH) + "/"
+			+ std::string(PHASEFILENAME);
+	std::string phasename = std::string(PHASE);
+
+	// construct a traveltime
+	traveltime::CTravelTime traveltime;
+
+	// setup
+	traveltime.setup(phasename, phasefile);
+
+	const traveltime::CTravelTime &constTravelTime = traveltime;
+
+	// getTravelTime(delta, depth)
+	ASSERT_NEAR(DELTATIME, constTravelTime.getTravelTime(DISTANCE, DEPTH), 0.001)
+			<< "getTravelTime(delta, depth) Check";
+
+	glass3::util::Geo originGeo;
+	originGeo.setGeographic(LATITUDE, LONGITUDE,
+							glass3::util::Geo::k_EarthRadiusKm - DEPTH);
+
+	glass3::util::Geo testGeo;
+	testGeo.setGeographic(LATITUDE, LONGITUDE + DISTANCE, DEPTH);
+
+	// getTravelTime(origin, receiver)
+	double delta = 0;
+	ASSERT_NEAR(GEOTIME,
+			constTravelTime.getTravelTime(originGeo, testGeo, &delta), 0.001)
+			<< "getTravelTime(origin, receiver) Check";
+	ASSERT_NEAR(DISTANCE, delta, 0.001)<< "Delta Check";
+
+	// member state is not modified
+	ASSERT_EQ(0, traveltime.m_dDepth)<< "Depth Check";
+	ASSERT_EQ(0, traveltime.m_dDelta)<< "Delta Check";
+
+	// out of range
+	ASSERT_EQ(traveltime::CTravelTime::k_dTravelTimeInvalid,
+			constTravelTime.getTravelTime(MAXDIST + 1.0, DEPTH))
+			<< "getTravelTime(bad delta, depth) Check";
+	ASSERT_EQ(traveltime::CTravelTime::k_dTravelTimeInvalid,
+			constTravelTime.getTravelTime(DISTANCE, MAXDEPTH + 1.0))
+			<< "getTravelTime(delta, bad depth) Check";
+
+	// publishable
+	ASSERT_TRUE(constTravelTime.isPublishable(DISTANCE))<< "isPublishable";
+}
+
+// tests to see if batch travel times match the single travel times
+TEST(TravelTimeTest, BatchOperations) {
+	glass3::util::Logger::disable();
+
+	std::string phasefile = "./" + std::string(TESTPATH) + "/"
+			+ std::string(PHASEFILENAME);
+
+	traveltime::CTravelTime traveltime;
+	traveltime.setup(PHASE, phasefile);
+
+	glass3::util::Geo originGeo;
+	originGeo.setGeographic(LATITUDE, LONGITUDE,
+							glass3::util::Geo::k_EarthRadiusKm - DEPTH);
+
+	// receivers spread over the globe
+	std::vector<glass3::util::Geo> receivers(NUMBATCHRECEIVERS);
+	std::vector<double> unitVectorX(NUMBATCHRECEIVERS);
+	std::vector<double> unitVectorY(NUMBATCHRECEIVERS);
+	std::vector<double> unitVectorZ(NUMBATCHRECEIVERS);
+	for (int i = 0; i < NUMBATCHRECEIVERS; i++) {
+		receivers[i].setGeographic(-89.0 + (178.0 * i / NUMBATCHRECEIVERS),
+									-179.0 + (0.37 * i),
+									glass3::util::Geo::k_EarthRadiusKm);
+		unitVectorX[i] = receivers[i].m_dUnitVectorX;
+		unitVectorY[i] = receivers[i].m_dUnitVectorY;
+		unitVectorZ[i] = receivers[i].m_dUnitVectorZ;
+	}
+
+	std::vector<double> travelTimes(NUMBATCHRECEIVERS);
+	std::vector<double> deltas(NUMBATCHRECEIVERS);
+	traveltime.getTravelTimes(originGeo, NUMBATCHRECEIVERS, unitVectorX.data(),
+								unitVectorY.data(), unitVectorZ.data(),
+								travelTimes.data(), deltas.data());
+
+	int numValid = 0;
+	for (int i = 0; i < NUMBATCHRECEIVERS; i++) {
+		double delta = 0;
+		double travelTime = traveltime.getTravelTime(originGeo, receivers[i],
+														&delta);
+		ASSERT_NEAR(delta, deltas[i], 1e-9)<< "batch delta Check " << i;
+		ASSERT_NEAR(travelTime, travelTimes[i], 1e-9)<< "batch time Check " << i;
+		if (travelTimes[i] > 0) {
+			numValid++;
+		}
+	}
+	ASSERT_GT(numValid, 0)<< "valid batch times";
+
+	// batch by distance, with one out of bounds distance
+	double batchDeltas[3] = { DISTANCE, -1.0, DISTANCE };
+	double batchTimes[3];
+	traveltime.getTravelTimes(3, batchDeltas, DEPTH, batchTimes);
+	ASSERT_NEAR(DELTATIME, batchTimes[0], 0.001)<< "batch delta time Check";
+	ASSERT_EQ(traveltime::CTravelTime::k_dTravelTimeInvalid, batchTimes[1])
+			<< "bad batch delta Check";
+	ASSERT_NEAR(DELTATIME, batchTimes[2], 0.001)<< "batch delta time Check";
+
+	// out of bounds depth invalidates the whole batch
+	traveltime.getTravelTimes(3, batchDeltas, MAXDEPTH + 1, batchTimes);
+	for (int i = 0; i < 3; i++) {
+		ASSERT_EQ(traveltime::CTravelTime::k_dTravelTimeInvalid, batchTimes[i])
+				<< "bad batch depth Check";
+	}
+
+	// time the batch against single travel times, timings are informational
+	double singleSum = 0;
+	auto start = std::chrono::high_resolution_clock::now();
+	for (int repeat = 0; repeat < NUMBATCHREPEATS; repeat++) {
+		for (int i = 0; i < NUMBATCHRECEIVERS; i++) {
+			singleSum += traveltime.getTravelTime(originGeo, receivers[i]);
+		}
+	}
+	auto end = std::chrono::high_resolution_clock::now();
+	double singleNs = std::chrono::duration<double, std::nano>(end - start)
+			.count() / (NUMBATCHREPEATS * NUMBATCHRECEIVERS);
+
+	double batchSum = 0;
+	start = std::chrono::high_resolution_clock::now();
+	for (int repeat = 0; repeat < NUMBATCHREPEATS; repeat++) {
+		traveltime.getTravelTimes(originGeo, NUMBATCHRECEIVERS,
+									unitVectorX.data(), unitVectorY.data(),
+									unitVectorZ.data(), travelTimes.data(),
+									deltas.data());
+		for (int i = 0; i < NUMBATCHRECEIVERS; i++) {
+			batchSum += travelTimes[i];
+		}
+	}
+	end = std::chrono::high_resolution_clock::now();
+	double batchNs = std::chrono::duration<double, std::nano>(end - start)
+			.count() / (NUMBATCHREPEATS * NUMBATCHRECEIVERS);
+
+	std::cout << "getTravelTime single: " << singleNs << " ns/receiver, batch: "
+				<< batchNs << " ns/receiver" << std::endl;
+
+	ASSERT_NEAR(singleSum, batchSum, 1e-3)<< "single and batch results match";
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <logger.h>
+
+#include "TravelTimeFile.h"
+#include "TravelTime.h"
+
+#define TESTPATH "testdata"
+#define PHASE "P"
+#define PHASEFILENAME "P.trv"
+#define BADFILENAME "badfile.trv"
+#define NOTTRVFILENAME "qa_zonestats.txt"
+
+#define NDISTANCES 720
+#define MINDIST 0.0
+#define MAXDIST 180.0
+
+#define NDEPTHS 160
+#define MINDEPTH 0.0
+#define MAXDEPTH 800.0
+
+#define DEPTH 50.0
+#define DISTANCE 50.0
+#define DELTATIME 529.2172
+
+// tests to see if a travel time file can be loaded
+TEST(TravelTimeFileTest, Load) {
+	glass3::util::Logger::disable();
+
+	std::string phasefile = "./" + std::string(TESTPATH) + "/"
+			+ std::string(PHASEFILENAME);
+
+	traveltime::CTravelTimeFile travelTimeFile;
+
+	ASSERT_TRUE(NULL == travelTimeFile.m_pTravelTimeData)<< "data null";
+
+	ASSERT_TRUE(travelTimeFile.load(phasefile))<< "load";
+
+	ASSERT_STREQ(phasefile.c_str(), travelTimeFile.m_sFileName.c_str());
+	ASSERT_EQ(NDISTANCES, travelTimeFile.m_iNumDistances)<< "NumDistances";
+	ASSERT_EQ(MINDIST, travelTimeFile.m_dMinimumDistance)<< "MinimumDistance";
+	ASSERT_EQ(MAXDIST, travelTimeFile.m_dMaximumDistance)<< "MaximumDistance";
+	ASSERT_EQ(NDEPTHS, travelTimeFile.m_iNumDepths)<< "NumDepths";
+	ASSERT_EQ(MINDEPTH, travelTimeFile.m_dMinimumDepth)<< "MinimumDepth";
+	ASSERT_EQ(MAXDEPTH, travelTimeFile.m_dMaximumDepth)<< "MaximumDepth";
+	ASSERT_TRUE(NULL != travelTimeFile.m_pTravelTimeData)<< "data not null";
+
+	travelTimeFile.clear();
+
+	ASSERT_EQ(0, travelTimeFile.m_iNumDistances)<< "cleared NumDistances";
+	ASSERT_TRUE(NULL == travelTimeFile.m_pTravelTimeData)<< "cleared data";
+}
+
+// tests to see if travel time files are shared through the registry
+TEST(TravelTimeFileTest, Registry) {
+	glass3::util::Logger::disable();
+
+	std::string phasefile = "./" + std::string(TESTPATH) + "/"
+			+ std::string(PHASEFILENAME);
+	std::string otherphasefile = std::string(TESTPATH) + "/../"
+			+ std::string(TESTPATH) + "/" + std::string(PHASEFILENAME);
+
+	int startCount = traveltime::CTravelTimeFile::getNumTravelTimeFiles();
+
+	std::shared_ptr<const traveltime::CTravelTimeFile> file1 =
+			traveltime::CTravelTimeFile::getTravelTimeFile(phasefile);
+	std::shared_ptr<const traveltime::CTravelTimeFile> file2 =
+			traveltime::CTravelTimeFile::getTravelTimeFile(otherphasefile);
+
+	ASSERT_TRUE(NULL != file1)<< "file1 not null";
+	ASSERT_EQ(file1, file2)<< "same file shared";
+	// other tests may have left static travel times using this file
+	ASSERT_LE(traveltime::CTravelTimeFile::getNumTravelTimeFiles(),
+				startCount + 1);
+
+	// CTravelTimes set up from the same file, and copies of them, share the
+	// travel time array
+	traveltime::CTravelTime traveltime1;
+	traveltime1.setup(PHASE, phasefile);
+	traveltime::CTravelTime traveltime2;
+	traveltime2.setup(PHASE, otherphasefile);
+	traveltime::CTravelTime traveltime3(traveltime1);
+
+	ASSERT_EQ(file1->m_pTravelTimeData, traveltime1.m_pTravelTimeArray);
+	ASSERT_EQ(file1->m_pTravelTimeData, traveltime2.m_pTravelTimeArray);
+	ASSERT_EQ(file1->m_pTravelTimeData, traveltime3.m_pTravelTimeArray);
+
+	ASSERT_NEAR(DELTATIME, traveltime3.getTravelTime(DISTANCE, DEPTH), 0.001)
+			<< "copy getTravelTime(delta, depth) Check";
+
+	// the mapping is released once nothing uses it
+	file1.reset();
+	file2.reset();
+	traveltime1.clear();
+	traveltime2.clear();
+	traveltime3.clear();
+
+	ASSERT_EQ(startCount, traveltime::CTravelTimeFile::getNumTravelTimeFiles());
+}
+
+// tests to see if bad travel time files are rejected
+TEST(TravelTimeFileTest, FailTests) {
+	glass3::util::Logger::disable();
+
+	std::string badfile = "./" + std::string(TESTPATH) + "/"
+			+ std::string(BADFILENAME);
+	std::string nottrvfile = "./" + std::string(TESTPATH) + "/"
+			+ std::string(NOTTRVFILENAME);
+
+	traveltime::CTravelTimeFile travelTimeFile;
+	ASSERT_FALSE(travelTimeFile.load(""))<< "empty file name";
+	ASSERT_FALSE(travelTimeFile.load(badfile))<< "missing file";
+	ASSERT_FALSE(travelTimeFile.load(nottrvfile))<< "not a trv file";
+	ASSERT_TRUE(NULL == travelTimeFile.m_pTravelTimeData)<< "data null";
+
+	ASSERT_TRUE(NULL == traveltime::CTravelTimeFile::getTravelTimeFile(badfile))
+			<< "missing file not shared";
+
+	traveltime::CTravelTime traveltime;
+	ASSERT_FALSE(traveltime.setup(PHASE, badfile))<< "setup missing file";
+	ASSERT_TRUE(NULL == traveltime.m_pTravelTimeArray)<< "array null";
+}
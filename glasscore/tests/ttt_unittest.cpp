@@ -2,6 +2,8 @@
 
 #include <logger.h>
 
+#include <chrono>
+#include <iostream>
 #include <string>
 #include "TTT.h"
 
@@ -24,6 +26,7 @@
 #define TIME3 268.36624
 #define TIME4 490.47196
 #define BADTIME -1
+#define NUMPERFORMANCECALLS 1000000
 
 // tests to see if the ttt can be constructed
 TEST(TTTTest, Construction) {
@@ -266,3 +269,243 @@ TEST(TTTTest, TFailTests) {
 	delete[] (assocRange);
 }
 
+
+// tests to see if the const (stateless) travel time functions work
+TEST(TTTTest, ConstTTests) {
+	glass3::util::Logger::disable();
+
+	std::string phase1file = "./" + std::string(TESTPATH) + "/"
+			+ std::string(PHASE1FILENAME);
+	std::string phase1name = std::string(PHASE1);
+
+	std::string phase2file = "./" + std::string(TESTPATH) + "/"
+			+ std::string(PHASE2FILENAME);
+	std::string phase2name = std::string(PHASE2);
+
+	traveltime::CTTT ttt;
+
+	double * assocRange = new double[2];
+	assocRange[0] = 10;
+	assocRange[1] = 90;
+
+	ttt.addPhase(phase1name, NULL, phase1file, true, true);
+	ttt.addPhase(phase2name, assocRange, phase2file, false, true);
+
+	const traveltime::CTTT &constTTT = ttt;
+
+	glass3::util::Geo originGeo;
+	originGeo.setGeographic(LATITUDE, LONGITUDE,
+							glass3::util::Geo::k_EarthRadiusKm - DEPTH);
+
+	glass3::util::Geo testGeo;
+	testGeo.setGeographic(LATITUDE, LONGITUDE + DISTANCE, DEPTH);
+
+	// getTravelTime(origin, receiver, phase)
+	traveltime::TTTResultStruct result = constTTT.getTravelTime(originGeo,
+																testGeo,
+																phase1name);
+	ASSERT_NEAR(TIME1, result.dTravelTime, 0.001)<< "P time Check";
+	ASSERT_STREQ(phase1name.c_str(),
+					constTTT.getPhaseName(result.iPhaseID).c_str());
+	ASSERT_TRUE(result.bUseForLocations)<< "P useForLocations Check";
+	ASSERT_TRUE(result.bPublishable)<< "P publishable Check";
+
+	result = constTTT.getTravelTime(originGeo, testGeo, phase2name);
+	ASSERT_NEAR(TIME2, result.dTravelTime, 0.001)<< "S time Check";
+	ASSERT_STREQ(phase2name.c_str(),
+					constTTT.getPhaseName(result.iPhaseID).c_str());
+	ASSERT_FALSE(result.bUseForLocations)<< "S useForLocations Check";
+
+	// getTravelTime(delta, depth, phase)
+	result = constTTT.getTravelTime(DISTANCE, DEPTH, phase1name);
+	ASSERT_NEAR(TIME3, result.dTravelTime, 0.001)<< "P delta time Check";
+	ASSERT_NEAR(DISTANCE, result.dDelta, 0.001)<< "P delta Check";
+
+	result = constTTT.getTravelTime(DISTANCE, DEPTH, phase2name);
+	ASSERT_NEAR(TIME4, result.dTravelTime, 0.001)<< "S delta time Check";
+
+	// getBestTravelTime(origin, receiver, tobs)
+	result = constTTT.getBestTravelTime(originGeo, testGeo, TIME1);
+	ASSERT_NEAR(TIME1, result.dTravelTime, 0.001)<< "best time Check";
+	ASSERT_STREQ(phase1name.c_str(),
+					constTTT.getPhaseName(result.iPhaseID).c_str());
+
+	result = constTTT.getBestTravelTime(originGeo, testGeo, TIME2);
+	ASSERT_NEAR(TIME2, result.dTravelTime, 0.001)<< "best time Check";
+	ASSERT_STREQ(phase2name.c_str(),
+					constTTT.getPhaseName(result.iPhaseID).c_str());
+
+	// unknown phase
+	result = constTTT.getTravelTime(originGeo, testGeo, "PKP");
+	ASSERT_EQ(BADTIME, result.dTravelTime)<< "unknown phase Check";
+	ASSERT_EQ(traveltime::CTTT::k_iPhaseIDInvalid, result.iPhaseID);
+	ASSERT_STREQ("?", constTTT.getPhaseName(result.iPhaseID).c_str());
+
+	// bad depth
+	result = constTTT.getTravelTime(DISTANCE, BADDEPTH, phase1name);
+	ASSERT_EQ(BADTIME, result.dTravelTime)<< "bad depth Check";
+
+	// no origin state was set by the const functions
+	ASSERT_EQ(0, ttt.m_geoTTOrigin.m_dGeocentricRadius)<<
+	"m_dGeocentricRadius Check";
+
+	delete[] (assocRange);
+}
+
+// tests the process-wide phase ids and the phase id lookups
+TEST(TTTTest, PhaseIDTests) {
+	glass3::util::Logger::disable();
+
+	std::string phase1file = "./" + std::string(TESTPATH) + "/"
+			+ std::string(PHASE1FILENAME);
+	std::string phase1name = std::string(PHASE1);
+
+	std::string phase2file = "./" + std::string(TESTPATH) + "/"
+			+ std::string(PHASE2FILENAME);
+	std::string phase2name = std::string(PHASE2);
+
+	traveltime::CTTT ttt;
+	ttt.addPhase(phase1name, NULL, phase1file);
+	ttt.addPhase(phase2name, NULL, phase2file);
+
+	traveltime::CTTT otherTTT;
+	otherTTT.addPhase(phase2name, NULL, phase2file);
+
+	// ids are stable and shared across tables
+	int pID = traveltime::CTravelTime::getPhaseID(phase1name);
+	int sID = traveltime::CTravelTime::getPhaseID(phase2name);
+	ASSERT_NE(traveltime::CTTT::k_iPhaseIDInvalid, pID)<< "P id Check";
+	ASSERT_NE(pID, sID)<< "P and S ids differ";
+	ASSERT_EQ(pID, traveltime::CTravelTime::getPhaseID(phase1name));
+	ASSERT_EQ(pID, ttt.m_pTravelTimes[0]->m_iPhaseID)<< "table P id Check";
+	ASSERT_EQ(sID, ttt.m_pTravelTimes[1]->m_iPhaseID)<< "table S id Check";
+	ASSERT_EQ(sID, otherTTT.m_pTravelTimes[0]->m_iPhaseID)<< "other S id Check";
+
+	// names round trip
+	ASSERT_STREQ(phase1name.c_str(),
+					traveltime::CTravelTime::getPhaseName(pID).c_str());
+	ASSERT_STREQ(phase2name.c_str(), ttt.getPhaseName(sID).c_str());
+
+	// invalid ids
+	ASSERT_EQ(traveltime::CTTT::k_iPhaseIDInvalid,
+				traveltime::CTravelTime::getPhaseID(""));
+	ASSERT_STREQ("", traveltime::CTravelTime::getPhaseName(
+			traveltime::CTTT::k_iPhaseIDInvalid).c_str());
+	ASSERT_STREQ("", traveltime::CTravelTime::getPhaseName(
+			traveltime::CTravelTime::k_iMaximumNumberOfPhaseIDs).c_str());
+	ASSERT_STREQ("?", ttt.getPhaseName(
+			traveltime::CTTT::k_iPhaseIDInvalid).c_str());
+
+	// id lookups match the name lookups
+	glass3::util::Geo originGeo;
+	originGeo.setGeographic(LATITUDE, LONGITUDE,
+							glass3::util::Geo::k_EarthRadiusKm - DEPTH);
+	glass3::util::Geo testGeo;
+	testGeo.setGeographic(LATITUDE, LONGITUDE + DISTANCE, DEPTH);
+
+	traveltime::TTTResultStruct result = ttt.getTravelTime(originGeo, testGeo,
+															pID);
+	ASSERT_NEAR(TIME1, result.dTravelTime, 0.001)<< "P time Check";
+	ASSERT_EQ(pID, result.iPhaseID)<< "P result id Check";
+
+	result = ttt.getTravelTime(DISTANCE, DEPTH, sID);
+	ASSERT_NEAR(TIME4, result.dTravelTime, 0.001)<< "S delta time Check";
+	ASSERT_EQ(sID, result.iPhaseID)<< "S result id Check";
+
+	// a phase not in this table
+	result = otherTTT.getTravelTime(DISTANCE, DEPTH, pID);
+	ASSERT_EQ(BADTIME, result.dTravelTime)<< "missing phase Check";
+	ASSERT_EQ(traveltime::CTTT::k_iPhaseIDInvalid, result.iPhaseID);
+
+	result = ttt.getTravelTime(DISTANCE, DEPTH,
+								traveltime::CTTT::k_iPhaseIDInvalid);
+	ASSERT_EQ(BADTIME, result.dTravelTime)<< "invalid id Check";
+}
+
+// compares the cost of name and phase id lookups
+TEST(TTTTest, PhaseIDPerformance) {
+	glass3::util::Logger::disable();
+
+	std::string phase1file = "./" + std::string(TESTPATH) + "/"
+			+ std::string(PHASE1FILENAME);
+	std::string phase1name = std::string(PHASE1);
+
+	std::string phase2file = "./" + std::string(TESTPATH) + "/"
+			+ std::string(PHASE2FILENAME);
+	std::string phase2name = std::string(PHASE2);
+
+	traveltime::CTTT ttt;
+	ttt.addPhase(phase1name, NULL, phase1file);
+	ttt.addPhase(phase2name, NULL, phase2file);
+
+	int sID = traveltime::CTravelTime::getPhaseID(phase2name);
+
+	// look up the second phase so the name search does a failed compare
+	double nameSum = 0;
+	auto start = std::chrono::high_resolution_clock::now();
+	for (int i = 0; i < NUMPERFORMANCECALLS; i++) {
+		nameSum += ttt.getTravelTime(DISTANCE, DEPTH, phase2name).dTravelTime;
+	}
+	auto end = std::chrono::high_resolution_clock::now();
+	double nameNs = std::chrono::duration<double, std::nano>(end - start)
+			.count() / NUMPERFORMANCECALLS;
+
+	double idSum = 0;
+	start = std::chrono::high_resolution_clock::now();
+	for (int i = 0; i < NUMPERFORMANCECALLS; i++) {
+		idSum += ttt.getTravelTime(DISTANCE, DEPTH, sID).dTravelTime;
+	}
+	end = std::chrono::high_resolution_clock::now();
+	double idNs = std::chrono::duration<double, std::nano>(end - start).count()
+			/ NUMPERFORMANCECALLS;
+
+	std::cout << "getTravelTime by name: " << nameNs << " ns/call, by id: "
+				<< idNs << " ns/call" << std::endl;
+
+	// timings are informational, only the results are checked
+	ASSERT_EQ(nameSum, idSum)<< "name and id results match";
+}
+
+// tests the distance based best travel time and batch travel times
+TEST(TTTTest, BatchTTests) {
+	glass3::util::Logger::disable();
+
+	std::string phase1file = "./" + std::string(TESTPATH) + "/"
+			+ std::string(PHASE1FILENAME);
+	std::string phase1name = std::string(PHASE1);
+
+	std::string phase2file = "./" + std::string(TESTPATH) + "/"
+			+ std::string(PHASE2FILENAME);
+	std::string phase2name = std::string(PHASE2);
+
+	traveltime::CTTT ttt;
+	ttt.addPhase(phase1name, NULL, phase1file);
+	ttt.addPhase(phase2name, NULL, phase2file);
+
+	int pID = traveltime::CTravelTime::getPhaseID(phase1name);
+	int sID = traveltime::CTravelTime::getPhaseID(phase2name);
+
+	// getBestTravelTime(delta, depth, tobs)
+	traveltime::TTTResultStruct result = ttt.getBestTravelTime(DISTANCE, DEPTH,
+																TIME3);
+	ASSERT_NEAR(TIME3, result.dTravelTime, 0.001)<< "best P time Check";
+	ASSERT_EQ(pID, result.iPhaseID)<< "best P id Check";
+
+	result = ttt.getBestTravelTime(DISTANCE, DEPTH, TIME4);
+	ASSERT_NEAR(TIME4, result.dTravelTime, 0.001)<< "best S time Check";
+	ASSERT_EQ(sID, result.iPhaseID)<< "best S id Check";
+
+	// getTravelTimes(n, deltas, depth, phaseID, travelTimes)
+	double deltas[2] = { DISTANCE, BADDISTANCE };
+	double travelTimes[2];
+	ASSERT_TRUE(ttt.getTravelTimes(2, deltas, DEPTH, sID, travelTimes));
+	ASSERT_NEAR(TIME4, travelTimes[0], 0.001)<< "batch S time Check";
+	ASSERT_NEAR(ttt.getTravelTime(BADDISTANCE, DEPTH, sID).dTravelTime,
+				travelTimes[1], 0.001)<< "batch S far time Check";
+
+	ASSERT_FALSE(ttt.getTravelTimes(2, deltas, DEPTH,
+									traveltime::CTTT::k_iPhaseIDInvalid,
+									travelTimes));
+	ASSERT_EQ(BADTIME, travelTimes[0])<< "invalid id batch Check";
+	ASSERT_EQ(BADTIME, travelTimes[1])<< "invalid id batch Check";
+}
@@ -5,13 +5,21 @@
 #include <sstream>
 #include <iostream>
 #include <fstream>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <functional>
 
 #include <logger.h>
+#include <threadpool.h>
 
 #include "Node.h"
 #include "Web.h"
 #include "Site.h"
 #include "SiteList.h"
+#include "Pick.h"
+#include "Trigger.h"
+#include "Glass.h"
 
 #define TESTPATH "testdata"
 
@@ -61,6 +69,10 @@
 #define GRIDNUMNUCLEATE 6
 #define GRIDRESOLUTION 25.0
 #define GRIDNUMNODES 2601
+#define GRIDCOARSERESOLUTION 100.0
+#define GRIDCOARSETHRESHOLDFACTOR 0.5
+#define NOCOARSERESOLUTION -1.0
+#define NUMNOISEPICKS 20000
 
 #define GRIDEXPLICITNAME "TestExplicitGrid"
 #define GRIDEXPLICITTHRESH 0.5
@@ -621,6 +633,265 @@ TEST(WebTest, RemoveTest) {
 	delete (testSiteList);
 }
 
+// loads the test grid, optionally with coarse nodes
+void loadCoarseTestGrid(glasscore::CSiteList *siteList, glasscore::CWeb *web,
+						bool useCoarse) {
+	std::ifstream stationFile;
+	stationFile.open(
+			"./" + std::string(TESTPATH) + "/" + std::string(STATIONFILENAME),
+			std::ios::in);
+	std::string stationLine = "";
+	std::getline(stationFile, stationLine);
+	stationFile.close();
+
+	std::ifstream gridFile;
+	gridFile.open(
+			"./" + std::string(TESTPATH) + "/" + std::string(GRIDFILENAME),
+			std::ios::in);
+	std::string gridLine = "";
+	std::getline(gridFile, gridLine);
+	gridFile.close();
+
+	siteList->receiveExternalMessage(
+			std::make_shared<json::Object>(json::Deserialize(stationLine)));
+
+	std::shared_ptr<json::Object> gridConfig = std::make_shared<json::Object>(
+			json::Deserialize(gridLine));
+	(*gridConfig)["SaveGrid"] = false;
+	if (useCoarse) {
+		(*gridConfig)["CoarseResolution"] = GRIDCOARSERESOLUTION;
+	}
+
+	web->setSiteList(siteList);
+	web->receiveExternalMessage(gridConfig);
+}
+
+// tests to see if a coarse nucleation grid can be generated
+TEST(WebTest, CoarseGridTest) {
+	glass3::util::Logger::disable();
+
+	glasscore::CSiteList * testSiteList = new glasscore::CSiteList();
+	glasscore::CWeb testGridWeb(NUMTHREADS);
+	loadCoarseTestGrid(testSiteList, &testGridWeb, true);
+
+	ASSERT_EQ(GRIDCOARSERESOLUTION, testGridWeb.getCoarseResolution())<<
+	"Web getCoarseResolution() Check";
+	ASSERT_EQ(GRIDCOARSETHRESHOLDFACTOR,
+				testGridWeb.getCoarseThresholdFactor())<<
+	"Web getCoarseThresholdFactor() Check";
+
+	// the fine nodes plus far fewer coarse nodes
+	ASSERT_GT(testGridWeb.size(), GRIDNUMNODES)<< "coarse nodes added";
+	ASSERT_LT(testGridWeb.size(), GRIDNUMNODES + (GRIDNUMNODES / 4))<<
+	"coarse nodes are coarse";
+
+	// no coarse nodes when not configured
+	glasscore::CSiteList * flatSiteList = new glasscore::CSiteList();
+	glasscore::CWeb flatGridWeb(NUMTHREADS);
+	loadCoarseTestGrid(flatSiteList, &flatGridWeb, false);
+	ASSERT_EQ(NOCOARSERESOLUTION,
+				flatGridWeb.getCoarseResolution())<< "no coarse resolution";
+	ASSERT_EQ(GRIDNUMNODES, flatGridWeb.size())<< "no coarse nodes";
+
+	// cleanup
+	delete (testSiteList);
+	delete (flatSiteList);
+}
+
+// compares nucleation with and without coarse nodes on a replayed set of
+// synthetic events
+TEST(WebTest, CoarseNucleationBenchmark) {
+	glass3::util::Logger::disable();
+
+	// set glass defaults used during nucleation
+	glasscore::CGlass testGlass;
+
+	glasscore::CSiteList * flatSiteList = new glasscore::CSiteList();
+	glasscore::CWeb flatWeb(NUMTHREADS);
+	loadCoarseTestGrid(flatSiteList, &flatWeb, false);
+
+	glasscore::CSiteList * coarseSiteList = new glasscore::CSiteList();
+	glasscore::CWeb coarseWeb(NUMTHREADS);
+	loadCoarseTestGrid(coarseSiteList, &coarseWeb, true);
+
+	// synthetic events within the grid
+	double eventLatitudes[] = { 36.0, 35.2, 37.1, 34.4, 36.6, 38.0, 33.9, 35.7 };
+	double eventLongitudes[] = { -97.5, -98.3, -96.2, -99.1, -97.9, -95.8,
+			-96.7, -100.2 };
+	int numEvents = sizeof(eventLatitudes) / sizeof(eventLatitudes[0]);
+	double eventDepth = 10.0;
+
+	// P arrivals at every station within 10 degrees of each event
+	std::vector<std::pair<double, std::string>> arrivals;
+	std::vector<int> arrivalEvents;
+	std::shared_ptr<traveltime::CTravelTime> travelTime = flatWeb
+			.getNucleationTravelTime1();
+	for (int i = 0; i < numEvents; i++) {
+		double tOrigin = 1.0e9 + (i * 3600.0);
+		glass3::util::Geo eventGeo;
+		eventGeo.setGeographic(eventLatitudes[i], eventLongitudes[i],
+								glass3::util::Geo::k_EarthRadiusKm - eventDepth);
+
+		for (auto site : flatSiteList->getListOfSites()) {
+			double delta = 0;
+			double tt = travelTime->getTravelTime(eventGeo, site->getGeo(),
+													&delta);
+			if ((tt < 0) || (delta > 10.0)) {
+				continue;
+			}
+			arrivals.push_back(
+					std::pair<double, std::string>(tOrigin + tt,
+													site->getSCNL()));
+			arrivalEvents.push_back(i);
+		}
+	}
+
+	// background noise picks at random stations, from a fixed seed so the
+	// replay is the same every run
+	std::vector<std::shared_ptr<glasscore::CSite>> noiseSites = flatSiteList
+			->getListOfSites();
+	unsigned int seed = 12345;
+	for (int i = 0; i < NUMNOISEPICKS; i++) {
+		seed = seed * 1103515245 + 12345;
+		double tPick = 1.0e9 + ((seed >> 8) % (numEvents * 3600));
+		seed = seed * 1103515245 + 12345;
+		arrivals.push_back(
+				std::pair<double, std::string>(
+						tPick, noiseSites[(seed >> 8) % noiseSites.size()]
+								->getSCNL()));
+		arrivalEvents.push_back(-1);
+	}
+
+	// replay in time order
+	std::vector<int> order(arrivals.size());
+	for (int i = 0; i < static_cast<int>(order.size()); i++) {
+		order[i] = i;
+	}
+	std::sort(order.begin(), order.end(), [&arrivals](int lhs, int rhs) {
+		return (arrivals[lhs].first < arrivals[rhs].first);
+	});
+
+	std::vector<std::shared_ptr<glasscore::CTrigger>> flatBest(numEvents);
+	std::vector<std::shared_ptr<glasscore::CTrigger>> coarseBest(numEvents);
+	int flatTriggerCount = 0;
+	int coarseTriggerCount = 0;
+	std::chrono::duration<double> flatTime(0);
+	std::chrono::duration<double> coarseTime(0);
+	for (int index : order) {
+		double tPick = arrivals[index].first;
+		int event = arrivalEvents[index];
+		std::string id = std::to_string(index);
+
+		std::shared_ptr<glasscore::CSite> flatSite = flatSiteList->getSite(
+				arrivals[index].second);
+		flatSite->addPick(
+				std::make_shared<glasscore::CPick>(flatSite, tPick, id, -1, -1));
+		std::shared_ptr<glasscore::CSite> coarseSite = coarseSiteList->getSite(
+				arrivals[index].second);
+		coarseSite->addPick(
+				std::make_shared<glasscore::CPick>(coarseSite, tPick, id, -1,
+													-1));
+
+		auto tStart = std::chrono::high_resolution_clock::now();
+		std::vector<std::shared_ptr<glasscore::CTrigger>> flatTriggers =
+				flatSite->nucleate(tPick, NULL);
+		auto tFlat = std::chrono::high_resolution_clock::now();
+		std::vector<std::shared_ptr<glasscore::CTrigger>> coarseTriggers =
+				coarseSite->nucleate(tPick, NULL);
+		auto tCoarse = std::chrono::high_resolution_clock::now();
+		flatTime += tFlat - tStart;
+		coarseTime += tCoarse - tFlat;
+
+		for (auto trigger : flatTriggers) {
+			flatTriggerCount++;
+			if (event < 0) {
+				continue;
+			}
+			if ((flatBest[event] == NULL)
+					|| (trigger->getBayesValue()
+							> flatBest[event]->getBayesValue())) {
+				flatBest[event] = trigger;
+			}
+		}
+		for (auto trigger : coarseTriggers) {
+			coarseTriggerCount++;
+			if (event < 0) {
+				continue;
+			}
+			if ((coarseBest[event] == NULL)
+					|| (trigger->getBayesValue()
+							> coarseBest[event]->getBayesValue())) {
+				coarseBest[event] = trigger;
+			}
+		}
+	}
+
+	std::cout << "[ BENCH    ] " << arrivals.size() << " picks, "
+				<< numEvents << " events, " << NUMNOISEPICKS << " noise picks"
+				<< std::endl;
+	std::cout << "[ BENCH    ] flat grid: " << flatWeb.size() << " nodes, "
+				<< flatTriggerCount << " triggers, " << flatTime.count()
+				<< " s" << std::endl;
+	std::cout << "[ BENCH    ] coarse grid: " << coarseWeb.size() << " nodes, "
+				<< coarseTriggerCount << " triggers, " << coarseTime.count()
+				<< " s" << std::endl;
+
+	// every event found by the flat grid is found at the same place by the
+	// coarse grid
+	for (int i = 0; i < numEvents; i++) {
+		ASSERT_TRUE(flatBest[i] != NULL)<< "flat grid detected event " << i;
+		ASSERT_TRUE(coarseBest[i] != NULL)<< "coarse grid detected event " << i;
+
+		glass3::util::Geo flatGeo;
+		flatGeo.setGeographic(flatBest[i]->getLatitude(),
+								flatBest[i]->getLongitude(),
+								glass3::util::Geo::k_EarthRadiusKm);
+		glass3::util::Geo coarseGeo;
+		coarseGeo.setGeographic(coarseBest[i]->getLatitude(),
+								coarseBest[i]->getLongitude(),
+								glass3::util::Geo::k_EarthRadiusKm);
+		ASSERT_LE(flatGeo.delta(&coarseGeo) * glass3::util::Geo::k_EarthRadiusKm,
+					GRIDRESOLUTION)<< "trigger location for event " << i;
+		ASSERT_NEAR(flatBest[i]->getBayesValue(),
+					coarseBest[i]->getBayesValue(), 0.5)<<
+		"trigger stack for event " << i;
+	}
+
+	// cleanup
+	delete (flatSiteList);
+	delete (coarseSiteList);
+}
+
+// tests to see if a web is released once its queued pool jobs are run
+TEST(WebTest, JobPoolRelease) {
+	glass3::util::Logger::disable();
+
+	// a pool with no threads only runs jobs when drained
+	glass3::util::ThreadPool jobPool;
+
+	std::shared_ptr<glasscore::CWeb> web(new glasscore::CWeb(0));
+	web->setJobPool(&jobPool);
+
+	// queued jobs hold references to their web
+	int jobsRun = 0;
+	web->addJob(std::bind([&jobsRun](std::shared_ptr<glasscore::CWeb>) {
+		jobsRun++;
+	}, web));
+	web->addJob(std::bind([&jobsRun](std::shared_ptr<glasscore::CWeb>) {
+		jobsRun++;
+	}, web));
+
+	std::weak_ptr<glasscore::CWeb> weakWeb = web;
+	web.reset();
+	ASSERT_FALSE(weakWeb.expired())<< "queued jobs hold the web";
+
+	// draining the pool runs the jobs, and the web is destroyed without
+	// waiting
+	jobPool.drain();
+	ASSERT_EQ(2, jobsRun)<< "jobs run";
+	ASSERT_TRUE(weakWeb.expired())<< "web released";
+}
+
 // test various failure cases for web
 TEST(WebTest, FailTests) {
 	glass3::util::Logger::disable();
@@ -7,6 +7,7 @@
 #include <fstream>
 
 #include <logger.h>
+#include <threadpool.h>
 
 #include "Web.h"
 #include "WebList.h"
@@ -218,6 +219,69 @@ TEST(WebListTest, SiteOperations) {
 	ASSERT_FALSE(testWebList->hasSite(sharedRemoveSite))<< "site removed";
 }
 
+// tests to see if web updates can run in a shared job pool
+TEST(WebListTest, SharedJobPool) {
+	glass3::util::Logger::disable();
+
+	// load files
+	std::ifstream stationFile;
+	stationFile.open(
+			"./" + std::string(TESTPATH) + "/" + std::string(STATIONFILENAME),
+			std::ios::in);
+	std::string stationLine = "";
+	std::getline(stationFile, stationLine);
+	stationFile.close();
+
+	std::ifstream gridFile;
+	gridFile.open(
+			"./" + std::string(TESTPATH) + "/" + std::string(GRIDFILENAME),
+			std::ios::in);
+	std::string gridLine = "";
+	std::getline(gridFile, gridLine);
+	gridFile.close();
+
+	std::shared_ptr<json::Object> siteList = std::make_shared<json::Object>(
+			json::Deserialize(stationLine));
+	std::shared_ptr<json::Object> gridConfig = std::make_shared<json::Object>(
+			json::Deserialize(gridLine));
+
+	glasscore::CSiteList testSiteList;
+	testSiteList.receiveExternalMessage(siteList);
+
+	// construct a WebList using a shared pool
+	glass3::util::ThreadPool jobPool("webpool", 2, 1, -1);
+	glasscore::CWebList testWebList(1);
+	testWebList.setSiteList(&testSiteList);
+	testWebList.setJobPool(&jobPool);
+	testWebList.receiveExternalMessage(gridConfig);
+	ASSERT_EQ(1, (int)testWebList.size())<< "web list added";
+
+	// add a site, then remove another in the same burst
+	std::shared_ptr<glasscore::CSite> sharedAddSite =
+			std::make_shared<glasscore::CSite>(
+					std::make_shared<json::Object>(
+							json::Object(json::Deserialize(std::string(ADDSITE)))));
+	std::shared_ptr<glasscore::CSite> sharedRemoveSite =
+			std::make_shared<glasscore::CSite>(
+					std::make_shared<json::Object>(
+							json::Object(
+									json::Deserialize(std::string(REMOVESITE)))));
+	testSiteList.addSite(sharedAddSite);
+	testSiteList.addSite(sharedRemoveSite);
+	ASSERT_TRUE(testWebList.hasSite(sharedRemoveSite))<< "site in weblist";
+
+	testWebList.updateSite(sharedAddSite);
+	testWebList.updateSite(sharedRemoveSite);
+
+	// the pool runs the updates
+	jobPool.waitForIdle();
+	ASSERT_TRUE(testWebList.hasSite(sharedAddSite))<< "site added";
+	ASSERT_FALSE(testWebList.hasSite(sharedRemoveSite))<< "site removed";
+	ASSERT_TRUE(testWebList.healthCheck())<< "healthy";
+
+	testWebList.clear();
+}
+
 // Tests various failure cases for weblist
 TEST(WebListTest, FailTests) {
 	glass3::util::Logger::disable();
@@ -14,6 +14,23 @@
 
 namespace traveltime {
 
+/**
+ * \brief CTTT travel time result structure
+ *
+ * TTTResultStruct contains the result of a stateless travel time query made
+ * through a CTTT; the travel time, the process-wide id of the phase that
+ * produced it (see CTravelTime::getPhaseID()),
+ * the source to receiver distance, and the location and publication flags
+ * for that phase at that distance.
+ */
+typedef struct _TTTResultStruct {
+	double dTravelTime;
+	int iPhaseID;
+	double dDelta;
+	bool bUseForLocations;
+	bool bPublishable;
+} TTTResultStruct;
+
 /**
  * \brief travel time interface class
  *
@@ -171,6 +188,155 @@ class CTTT {
 	 */
 	double T(glass3::util::Geo *geo, double tobs);
 
+	/**
+	 * \brief Calculate travel time for a phase
+	 *
+	 * Calculate the travel time for the given phase between the given source
+	 * and receiver locations. This function does not modify this CTTT, and is
+	 * safe to call concurrently from multiple threads on a shared CTTT.
+	 *
+	 * \param geoOrigin - A glass3::util::Geo object representing the source
+	 * location
+	 * \param geoReceiver - A glass3::util::Geo object representing the
+	 * receiver location
+	 * \param phase - A std::string containing the phase to use in calculating
+	 * the travel time
+	 * \return Returns a TTTResultStruct containing the travel time (-1.0 if
+	 * there is no valid travel time) and phase information
+	 */
+	TTTResultStruct getTravelTime(const glass3::util::Geo &geoOrigin,
+									const glass3::util::Geo &geoReceiver,
+									const std::string &phase) const;
+
+	/**
+	 * \brief Calculate travel time for a phase
+	 *
+	 * Calculate the travel time for the given phase from the given distance
+	 * and source depth. This function does not modify this CTTT, and is
+	 * safe to call concurrently from multiple threads on a shared CTTT.
+	 *
+	 * \param delta - A double value containing the distance in degrees
+	 * \param depth - A double value containing the source depth in kilometers
+	 * \param phase - A std::string containing the phase to use in calculating
+	 * the travel time
+	 * \return Returns a TTTResultStruct containing the travel time (-1.0 if
+	 * there is no valid travel time) and phase information
+	 */
+	TTTResultStruct getTravelTime(double delta, double depth,
+									const std::string &phase) const;
+
+	/**
+	 * \brief Calculate travel time for a phase id
+	 *
+	 * Calculate the travel time for the phase identified by the given
+	 * process-wide phase id (see CTravelTime::getPhaseID()) between the given
+	 * source and receiver locations, without any phase name comparisons. This
+	 * function does not modify this CTTT, and is safe to call concurrently
+	 * from multiple threads on a shared CTTT.
+	 *
+	 * \param geoOrigin - A glass3::util::Geo object representing the source
+	 * location
+	 * \param geoReceiver - A glass3::util::Geo object representing the
+	 * receiver location
+	 * \param phaseID - An integer containing the phase id of the phase to use
+	 * in calculating the travel time
+	 * \return Returns a TTTResultStruct containing the travel time (-1.0 if
+	 * there is no valid travel time) and phase information
+	 */
+	TTTResultStruct getTravelTime(const glass3::util::Geo &geoOrigin,
+									const glass3::util::Geo &geoReceiver,
+									int phaseID) const;
+
+	/**
+	 * \brief Calculate travel time for a phase id
+	 *
+	 * Calculate the travel time for the phase identified by the given
+	 * process-wide phase id (see CTravelTime::getPhaseID()) from the given
+	 * distance and source depth, without any phase name comparisons. This
+	 * function does not modify this CTTT, and is safe to call concurrently
+	 * from multiple threads on a shared CTTT.
+	 *
+	 * \param delta - A double value containing the distance in degrees
+	 * \param depth - A double value containing the source depth in kilometers
+	 * \param phaseID - An integer containing the phase id of the phase to use
+	 * in calculating the travel time
+	 * \return Returns a TTTResultStruct containing the travel time (-1.0 if
+	 * there is no valid travel time) and phase information
+	 */
+	TTTResultStruct getTravelTime(double delta, double depth,
+									int phaseID) const;
+
+	/**
+	 * \brief Calculate best travel time
+	 *
+	 * Calculate the travel time of the associable phase with the smallest
+	 * residual against the given observed travel time, between the given
+	 * source and receiver locations. This function does not modify this CTTT,
+	 * and is safe to call concurrently from multiple threads on a shared CTTT.
+	 *
+	 * \param geoOrigin - A glass3::util::Geo object representing the source
+	 * location
+	 * \param geoReceiver - A glass3::util::Geo object representing the
+	 * receiver location
+	 * \param tObserved - A double value containing the observed travel time
+	 * \return Returns a TTTResultStruct containing the best travel time (-1.0
+	 * if there is no valid travel time) and phase information
+	 */
+	TTTResultStruct getBestTravelTime(const glass3::util::Geo &geoOrigin,
+										const glass3::util::Geo &geoReceiver,
+										double tObserved) const;
+
+	/**
+	 * \brief Calculate best travel time
+	 *
+	 * Calculate the travel time of the associable phase with the smallest
+	 * residual against the given observed travel time, given the distance and
+	 * source depth. This function does not modify this CTTT, and is safe to
+	 * call concurrently from multiple threads on a shared CTTT.
+	 *
+	 * \param delta - A double value containing the distance in degrees
+	 * \param depth - A double value containing the source depth in kilometers
+	 * \param tObserved - A double value containing the observed travel time
+	 * \return Returns a TTTResultStruct containing the best travel time (-1.0
+	 * if there is no valid travel time) and phase information
+	 */
+	TTTResultStruct getBestTravelTime(double delta, double depth,
+										double tObserved) const;
+
+	/**
+	 * \brief Calculate travel times for a batch of distances
+	 *
+	 * Calculate the travel times of the phase identified by the given phase id
+	 * for an array of distances at a single source depth, see
+	 * CTravelTime::getTravelTimes(). This function does not modify this CTTT,
+	 * and is safe to call concurrently from multiple threads on a shared CTTT.
+	 *
+	 * \param numReceivers - An integer containing the number of distances
+	 * \param deltas - A pointer to an array of numReceivers double values
+	 * containing the distances in degrees
+	 * \param depth - A double value containing the source depth in kilometers
+	 * \param phaseID - An integer containing the phase id of the phase to use
+	 * in calculating the travel times
+	 * \param travelTimes - A pointer to an array of numReceivers double values
+	 * used to return the travel times in seconds, -1.0 where there is no valid
+	 * travel time
+	 * \return Returns true if the phase is in this CTTT, false otherwise
+	 */
+	bool getTravelTimes(int numReceivers, const double *deltas, double depth,
+						int phaseID, double *travelTimes) const;
+
+	/**
+	 * \brief Get phase name
+	 *
+	 * Get the name of the phase identified by the given process-wide phase id,
+	 * such as the iPhaseID returned in a TTTResultStruct
+	 *
+	 * \param phaseID - An integer containing the phase id
+	 * \return Returns a std::string containing the phase name, or "?" if the
+	 * phase id is not valid
+	 */
+	const std::string& getPhaseName(int phaseID) const;
+
 	/**
 	 * \brief Print Travel Times to File
 	 *
@@ -189,6 +355,16 @@ class CTTT {
 	 */
 	static const int k_iMaximumNumberOfTravelTimes = 40;
 
+	/**
+	 * \brief The phase id for an invalid or unknown phase
+	 */
+	static const int k_iPhaseIDInvalid = CTravelTime::k_iPhaseIDInvalid;
+
+	/**
+	 * \brief The phase name for an invalid or unknown phase
+	 */
+	static const std::string k_sPhaseUnknown;
+
 	/**
 	 * \brief A temporary std::std::string variable containing the phase
 	 * determinedduring the last call to T()
@@ -9,9 +9,12 @@
 
 #include <json.h>
 #include <geo.h>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <string>
+#include "TravelTimeFile.h"
 
 /**
  * \namespace traveltime
@@ -52,7 +55,8 @@ class CTravelTime {
 	/**
 	 * \brief CTravelTime copy constructor
 	 *
-	 * The copy constructor for the CTravelTime class.
+	 * The copy constructor for the CTravelTime class. The copy shares the
+	 * read-only travel time array of the original.
 	 */
 	CTravelTime(const CTravelTime &travelTime);
 
@@ -66,8 +70,9 @@ class CTravelTime {
 	/**
 	 * \brief Load or generate branch data
 	 *
-	 * Attempts to load branch data (using Load()) for a phase using a given
-	 * CRay and phase std::string and filename.
+	 * Attempts to load branch data for a phase using a given phase
+	 * std::string and filename. The file is memory mapped read-only and
+	 * shared with every other CTravelTime using the same file.
 	 *
 	 * \param phase - A std::std::string representing the phase to use, default
 	 * is "P"
@@ -156,7 +161,157 @@ class CTravelTime {
 	 * \return Returns the travel time in seconds, or -1.0 if there is
 	 * no valid travel time
 	 */
-	double T(int deltaIndex, int depthIndex);
+	double T(int deltaIndex, int depthIndex) const;
+
+	/**
+	 * \brief Calculate travel time in seconds
+	 *
+	 * Interpolate travel time in seconds given distance in degrees and depth
+	 * in kilometers. This function does not modify this CTravelTime, and is
+	 * safe to call concurrently from multiple threads on a shared CTravelTime.
+	 *
+	 * \param delta - A double value containing the distance in degrees
+	 * to calculate travel time from
+	 * \param depth - A double value containing the source depth in
+	 * kilometers to calculate travel time from
+	 * \return Returns the travel time in seconds, or -1.0 if there is
+	 * no valid travel time
+	 */
+	double getTravelTime(double delta, double depth) const;
+
+	/**
+	 * \brief Calculate travel time in seconds
+	 *
+	 * Calculate travel time in seconds given a source and receiver geographic
+	 * location. This function does not modify this CTravelTime, and is
+	 * safe to call concurrently from multiple threads on a shared CTravelTime.
+	 *
+	 * \param geoOrigin - A glass3::util::Geo object representing the source
+	 * location to calculate the travel time from
+	 * \param geoReceiver - A glass3::util::Geo object representing the
+	 * receiver location to calculate the travel time to
+	 * \param delta - An optional pointer to a double value used to return the
+	 * distance in degrees between the source and receiver, NULL to ignore
+	 * \return Returns the travel time in seconds, or -1.0 if there is
+	 * no valid travel time
+	 */
+	double getTravelTime(const glass3::util::Geo &geoOrigin,
+							const glass3::util::Geo &geoReceiver,
+							double *delta = NULL) const;
+
+	/**
+	 * \brief Calculate travel times in seconds for a batch of distances
+	 *
+	 * Interpolate travel times in seconds given an array of distances in
+	 * degrees and a single depth in kilometers. The depth interpolation is
+	 * computed once for the whole batch. This function does not modify this
+	 * CTravelTime, and is safe to call concurrently from multiple threads on a
+	 * shared CTravelTime.
+	 *
+	 * \param numReceivers - An integer containing the number of distances
+	 * \param deltas - A pointer to an array of numReceivers double values
+	 * containing the distances in degrees to calculate travel times from
+	 * \param depth - A double value containing the source depth in
+	 * kilometers to calculate travel times from
+	 * \param travelTimes - A pointer to an array of numReceivers double values
+	 * used to return the travel times in seconds, -1.0 where there is no valid
+	 * travel time
+	 */
+	void getTravelTimes(int numReceivers, const double *deltas, double depth,
+						double *travelTimes) const;
+
+	/**
+	 * \brief Calculate travel times in seconds for a batch of receivers
+	 *
+	 * Calculate travel times in seconds given a source geographic location
+	 * and a batch of receivers, see getDeltas(). This function does not modify
+	 * this CTravelTime, and is safe to call concurrently from multiple threads
+	 * on a shared CTravelTime.
+	 *
+	 * \param geoOrigin - A glass3::util::Geo object representing the source
+	 * location to calculate the travel times from
+	 * \param numReceivers - An integer containing the number of receivers
+	 * \param unitVectorX - A pointer to an array of numReceivers double values
+	 * containing the receiver unit vector x components
+	 * \param unitVectorY - A pointer to an array of numReceivers double values
+	 * containing the receiver unit vector y components
+	 * \param unitVectorZ - A pointer to an array of numReceivers double values
+	 * containing the receiver unit vector z components
+	 * \param travelTimes - A pointer to an array of numReceivers double values
+	 * used to return the travel times in seconds, -1.0 where there is no valid
+	 * travel time
+	 * \param deltas - A pointer to an array of numReceivers double values
+	 * used to return the distances in degrees between the source and receivers
+	 */
+	void getTravelTimes(const glass3::util::Geo &geoOrigin, int numReceivers,
+						const double *unitVectorX, const double *unitVectorY,
+						const double *unitVectorZ, double *travelTimes,
+						double *deltas) const;
+
+	/**
+	 * \brief Calculate distances in degrees for a batch of receivers
+	 *
+	 * Calculate the distances in degrees between a source geographic location
+	 * and a batch of receivers, given as contiguous arrays of the receiver
+	 * unit vectors (see glass3::util::Geo::m_dUnitVectorX). The results match
+	 * glass3::util::Geo::delta(). The dot products are computed four at a time
+	 * when built with AVX2 (SUPPORT_AVX2), otherwise with a scalar loop.
+	 *
+	 * \param geoOrigin - A glass3::util::Geo object representing the source
+	 * location
+	 * \param numReceivers - An integer containing the number of receivers
+	 * \param unitVectorX - A pointer to an array of numReceivers double values
+	 * containing the receiver unit vector x components
+	 * \param unitVectorY - A pointer to an array of numReceivers double values
+	 * containing the receiver unit vector y components
+	 * \param unitVectorZ - A pointer to an array of numReceivers double values
+	 * containing the receiver unit vector z components
+	 * \param deltas - A pointer to an array of numReceivers double values
+	 * used to return the distances in degrees
+	 */
+	static void getDeltas(const glass3::util::Geo &geoOrigin, int numReceivers,
+							const double *unitVectorX,
+							const double *unitVectorY,
+							const double *unitVectorZ, double *deltas);
+
+	/**
+	 * \brief Check if this phase is publishable at a distance
+	 *
+	 * Checks whether the given distance is within the minimum and maximum
+	 * publishable distances for this CTravelTime
+	 *
+	 * \param delta - A double value containing the distance in degrees
+	 * \return Returns true if this phase is publishable at the given distance,
+	 * false otherwise
+	 */
+	bool isPublishable(double delta) const;
+
+	/**
+	 * \brief Get phase id
+	 *
+	 * Gets the process-wide integer id for the given phase name, interning the
+	 * phase name if it has not been seen before. Phase ids are small, stable
+	 * for the life of the process, and the same for every CTravelTime and
+	 * CTTT, so that callers can look them up once and compare integers
+	 * instead of phase name strings.
+	 *
+	 * \param phase - A std::string containing the phase name
+	 * \return Returns an integer containing the phase id, or
+	 * k_iPhaseIDInvalid if the phase name is empty or the maximum number of
+	 * phase ids has been reached
+	 */
+	static int getPhaseID(const std::string &phase);
+
+	/**
+	 * \brief Get phase name
+	 *
+	 * Gets the phase name for the given process-wide phase id
+	 *
+	 * \param phaseID - An integer containing the phase id
+	 * \return Returns a std::string containing the phase name, or
+	 * k_dPhaseInvalid if the phase id is not valid
+	 */
+	static const std::string& getPhaseName(int phaseID);
 
 	/**
 	 * \brief Compute bilinear interpolation
@@ -177,7 +332,7 @@ class CTravelTime {
 	 */
 	double bilinearInterpolation(double q_x1y1, double q_x1y2, double q_x2y1,
 		double q_x2y2, double x1, double y1, double x2, double y2, double x,
-		double y);
+		double y) const;
 
 	/**
 	 * \brief Compute interpolation grid distance index
@@ -187,7 +342,7 @@ class CTravelTime {
 	 * \param distance - A double value containing the distance to use
 	 * \return Returns the distance index
 	 */
-	int getIndexFromDistance(double distance);
+	int getIndexFromDistance(double distance) const;
 
 	/**
 	 * \brief Compute distance using interpolation grid index
@@ -198,7 +353,7 @@ class CTravelTime {
 	 * 	use
 	 * \return Returns the distance
 	 */
-	double getDistanceFromIndex(int index);
+	double getDistanceFromIndex(int index) const;
 
 	/**
 	 * \brief Compute interpolation grid depth index
@@ -208,7 +363,7 @@ class CTravelTime {
 	 * \param depth - A double value containing the depth to use
 	 * \return Returns the depth index
 	 */
-	int getIndexFromDepth(double depth);
+	int getIndexFromDepth(double depth) const;
 
 	/**
 	 * \brief Compute depth using interpolation grid index
@@ -219,7 +374,7 @@ class CTravelTime {
 	 * 	use
 	 * \return Returns the depth
 	 */
-	double getDepthFromIndex(int index);
+	double getDepthFromIndex(int index) const;
 
 
 	/**
@@ -271,10 +426,18 @@ class CTravelTime {
 	double m_dDepthStep;
 
 	/**
-	 * \brief An array of double values containing the travel times indexed by
-	 * depth and distance
+	 * \brief A pointer to the raw bytes of the array of double values containing
+	 * the travel times indexed by depth and distance. This points into the
+	 * shared, read-only mapping of the travel time file held by
+	 * m_pTravelTimeFile.
+	 */
+	const char * m_pTravelTimeArray;
+
+	/**
+	 * \brief A shared_ptr to the shared, read-only travel time file that
+	 * contains the travel time array
 	 */
-	double * m_pTravelTimeArray;
+	std::shared_ptr<const CTravelTimeFile> m_pTravelTimeFile;
 
 	/**
 	 * \brief A std::string containing the name of the phase used for this
@@ -282,6 +445,12 @@ class CTravelTime {
 	 */
 	std::string m_sPhase;
 
+	/**
+	 * \brief An integer containing the process-wide phase id of the phase used
+	 * for this CTravelTime, see getPhaseID()
+	 */
+	int m_iPhaseID;
+
 	/**
 	 * \brief A boolean flag indicating whether this CTravelTime should be used in 
 	 * generating locations
@@ -328,6 +497,34 @@ class CTravelTime {
 	 * \brief the string for an invalid phase name
 	 */
 	static const std::string k_dPhaseInvalid;
+
+	/**
+	 * \brief the value for an invalid phase id
+	 */
+	static const int k_iPhaseIDInvalid = -1;
+
+	/**
+	 * \brief the maximum number of process-wide phase ids
+	 */
+	static const int k_iMaximumNumberOfPhaseIDs = 256;
+
+ private:
+	/**
+	 * \brief An array of std::strings containing the interned phase names,
+	 * indexed by phase id
+	 */
+	static std::string m_asPhaseNames[k_iMaximumNumberOfPhaseIDs];
+
+	/**
+	 * \brief An integer containing the number of interned phase names,
+	 * entries below this count are never modified
+	 */
+	static std::atomic<int> m_iNumPhaseIDs;
+
+	/**
+	 * \brief A mutex to control interning new phase names
+	 */
+	static std::mutex m_PhaseIDMutex;
 };
 }  // namespace traveltime
 #endif  // TRAVELTIME_H
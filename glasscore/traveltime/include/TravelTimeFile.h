@@ -0,0 +1,190 @@
+/*****************************************
+ * This file is documented for Doxygen.
+ * If you modify this file please update
+ * the comments so that Doxygen will still
+ * be able to work.
+ ****************************************/
+#ifndef TRAVELTIMEFILE_H
+#define TRAVELTIMEFILE_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace traveltime {
+
+/**
+ * \brief travel time file class
+ *
+ * The traveltime CTravelTimeFile class is a class that maps a binary .trv
+ * travel time file read-only into memory and exposes its header values and
+ * travel time interpolation array.
+ *
+ * CTravelTimeFile objects are obtained through getTravelTimeFile(), which
+ * keeps a process-wide registry of loaded files so that every CTravelTime
+ * using the same .trv file shares a single read-only mapping. A mapping is
+ * released when the last CTravelTime using it is cleared or destroyed.
+ */
+class CTravelTimeFile {
+ public:
+	/**
+	 * \brief CTravelTimeFile constructor
+	 *
+	 * The constructor for the CTravelTimeFile class.
+	 */
+	CTravelTimeFile();
+
+	/**
+	 * \brief CTravelTimeFile destructor
+	 *
+	 * The destructor for the CTravelTimeFile class, unmaps the file.
+	 */
+	~CTravelTimeFile();
+
+	/**
+	 * \brief CTravelTimeFile clear function
+	 *
+	 * Unmaps the file and clears the header values.
+	 */
+	void clear();
+
+	/**
+	 * \brief Map a travel time file
+	 *
+	 * Maps the given .trv file read-only into memory and validates and reads
+	 * its header.
+	 *
+	 * \param fileName - A std::string containing the file to map
+	 * \return Returns true if successful, false otherwise
+	 */
+	bool load(const std::string &fileName);
+
+	/**
+	 * \brief Get a shared travel time file
+	 *
+	 * Gets the shared, read-only CTravelTimeFile for the given .trv file,
+	 * mapping the file if it is not already mapped by this process.
+	 *
+	 * \param fileName - A std::string containing the file to get
+	 * \return Returns a shared_ptr to the CTravelTimeFile, or NULL if the file
+	 * could not be loaded
+	 */
+	static std::shared_ptr<const CTravelTimeFile> getTravelTimeFile(
+			const std::string &fileName);
+
+	/**
+	 * \brief Get the number of mapped travel time files
+	 *
+	 * Gets the number of travel time files currently mapped and shared through
+	 * getTravelTimeFile()
+	 *
+	 * \return Returns an integer containing the number of mapped files
+	 */
+	static int getNumTravelTimeFiles();
+
+	/**
+	 * \brief A std::string containing the name of the mapped file
+	 */
+	std::string m_sFileName;
+
+	/**
+	 * \brief A std::string containing the branch name read from the file
+	 */
+	std::string m_sBranch;
+
+	/**
+	 * \brief A std::string containing the phase list read from the file
+	 */
+	std::string m_sPhaseList;
+
+	/**
+	 * \brief An integer variable containing the array index size for the distance
+	 * array
+	 */
+	int m_iNumDistances;
+
+	/**
+	 * \brief A double variable containing the minimum distance of the depth
+	 * distance array
+	 */
+	double m_dMinimumDistance;
+
+	/**
+	 * \brief A double variable containing the maximum distance of the depth
+	 * distance array
+	 */
+	double m_dMaximumDistance;
+
+	/**
+	 * \brief An integer variable containing the array index size for the depth
+	 * array
+	 */
+	int m_iNumDepths;
+
+	/**
+	 * \brief A double variable containing the minimum depth of the depth
+	 * distance array
+	 */
+	double m_dMinimumDepth;
+
+	/**
+	 * \brief A double variable containing the maximum Depth of the depth
+	 * distance array
+	 */
+	double m_dMaximumDepth;
+
+	/**
+	 * \brief A pointer to the raw bytes of the travel time interpolation array
+	 * within the mapped file, indexed by depth and distance. The array follows
+	 * the 127 byte file header, so the values are not aligned and must be read
+	 * with memcpy.
+	 */
+	const char * m_pTravelTimeData;
+
+	// constants
+	/**
+	 * \brief the size in bytes of the .trv file header
+	 */
+	static const int k_iHeaderSize = 127;
+
+ private:
+	/**
+	 * \brief Disabled CTravelTimeFile copy constructor, mappings are shared
+	 * through getTravelTimeFile()
+	 */
+	CTravelTimeFile(const CTravelTimeFile &travelTimeFile) = delete;
+
+	/**
+	 * \brief Disabled CTravelTimeFile assignment operator
+	 */
+	CTravelTimeFile& operator=(const CTravelTimeFile &travelTimeFile) = delete;
+
+	/**
+	 * \brief A pointer to the start of the mapped file
+	 */
+	void * m_pMapping;
+
+	/**
+	 * \brief The size in bytes of the mapped file
+	 */
+	size_t m_iMappingSize;
+
+	/**
+	 * \brief A buffer holding the file contents on platforms without mmap
+	 */
+	std::vector<char> m_vFileBuffer;
+
+	/**
+	 * \brief The process-wide registry of mapped files, keyed by file path
+	 */
+	static std::map<std::string, std::weak_ptr<const CTravelTimeFile>> m_mTravelTimeFileRegistry;  // NOLINT
+
+	/**
+	 * \brief A mutex to control access to the registry
+	 */
+	static std::mutex m_RegistryMutex;
+};
+}  // namespace traveltime
+#endif  // TRAVELTIMEFILE_H
@@ -11,6 +11,8 @@ namespace traveltime {
 // constants
 constexpr double CTTT::k_dTTTooLargeToBeValid;
 const int CTTT::k_iMaximumNumberOfTravelTimes;
+const int CTTT::k_iPhaseIDInvalid;
+const std::string CTTT::k_sPhaseUnknown = "?"; // NOLINT
 
 // ---------------------------------------------------------CTTT
 CTTT::CTTT() {
@@ -113,109 +115,47 @@ void CTTT::setTTOrigin(const glass3::util::Geo &geoOrigin) {
 
 // ---------------------------------------------------------T
 double CTTT::T(glass3::util::Geo *geo, std::string phase) {
-	// Calculate travel time from distance in degrees
-	// for each phase
-	for (int i = 0; i < m_iNumTravelTimes; i++) {
-		// is this the phase we're looking for
-		if (m_pTravelTimes[i]->m_sPhase == phase) {
-			// set origin
-			m_pTravelTimes[i]->setTTOrigin(m_geoTTOrigin);
+	// Calculate travel time from the current origin to geo
+	TTTResultStruct result = getTravelTime(m_geoTTOrigin, *geo, phase);
 
-			// get travel time and phase
-			double traveltime = m_pTravelTimes[i]->T(geo);
-			m_sPhase = phase;
-			m_bUseForLocations = m_pTravelTimes[i]->m_bUseForLocations;
-
-			if ((m_pTravelTimes[i]->m_dDelta >=
-					m_pTravelTimes[i]->m_dMinDeltaPublishable) &&
-				(m_pTravelTimes[i]->m_dDelta <=
-					m_pTravelTimes[i]->m_dMaxDeltaPublishable)) {
-				m_bPublishable = true;
-			} else {
-				m_bPublishable = false;
-			}
+	// remember phase state for the caller
+	m_sPhase = getPhaseName(result.iPhaseID);
+	m_bUseForLocations = result.bUseForLocations;
+	m_bPublishable = result.bPublishable;
 
-			return (traveltime);
-		}
-	}
-
-	// no valid travel time
-	m_sPhase = "?";
-	m_bUseForLocations = false;
-	m_bPublishable = false;
-	return (CTravelTime::k_dTravelTimeInvalid);
+	return (result.dTravelTime);
 }
 
 // ---------------------------------------------------------T
 double CTTT::Td(double delta, std::string phase, double depth) {
 	m_geoTTOrigin.m_dGeocentricRadius = glass3::util::Geo::k_EarthRadiusKm
 			- depth;
-	// Calculate time from delta (degrees) and depth
-	// for each phase
-	for (int i = 0; i < m_iNumTravelTimes; i++) {
-		// is this the phase we're looking for
-		if (m_pTravelTimes[i]->m_sPhase == phase) {
-			// set origin and depth
-			m_pTravelTimes[i]->setTTOrigin(m_geoTTOrigin);
 
-			// get travel time and phase
-			double traveltime = m_pTravelTimes[i]->T(delta);
-			m_sPhase = phase;
-			m_bUseForLocations = m_pTravelTimes[i]->m_bUseForLocations;
-
-			if ((m_pTravelTimes[i]->m_dDelta >=
-					m_pTravelTimes[i]->m_dMinDeltaPublishable) &&
-				(m_pTravelTimes[i]->m_dDelta <=
-					m_pTravelTimes[i]->m_dMaxDeltaPublishable)) {
-				m_bPublishable = true;
-			} else {
-				m_bPublishable = false;
-			}
+	// Calculate time from delta (degrees) and depth
+	TTTResultStruct result = getTravelTime(delta, depth, phase);
 
-			return (traveltime);
-		}
-	}
+	// remember phase state for the caller
+	m_sPhase = getPhaseName(result.iPhaseID);
+	m_bUseForLocations = result.bUseForLocations;
+	m_bPublishable = result.bPublishable;
 
-	// no valid travel time
-	m_sPhase = "?";
-	m_bUseForLocations = false;
-	m_bPublishable = false;
-	return (CTravelTime::k_dTravelTimeInvalid);
+	return (result.dTravelTime);
 }
 
 // ---------------------------------------------------------T
 double CTTT::T(double delta, std::string phase) {
-	// Calculate time from delta (degrees)
-	// for each phase
-	for (int i = 0; i < m_iNumTravelTimes; i++) {
-		// is this the phase we're looking for
-		if (m_pTravelTimes[i]->m_sPhase == phase) {
-			// set origin
-			m_pTravelTimes[i]->setTTOrigin(m_geoTTOrigin);
-
-			// get travel time and phase
-			double traveltime = m_pTravelTimes[i]->T(delta);
-			m_sPhase = phase;
-			m_bUseForLocations = m_pTravelTimes[i]->m_bUseForLocations;
-
-			if ((m_pTravelTimes[i]->m_dDelta >=
-					m_pTravelTimes[i]->m_dMinDeltaPublishable) &&
-				(m_pTravelTimes[i]->m_dDelta <=
-					m_pTravelTimes[i]->m_dMaxDeltaPublishable)) {
-				m_bPublishable = true;
-			} else {
-				m_bPublishable = false;
-			}
-
-			return (traveltime);
-		}
-	}
-
-	// no valid travel time
-	m_sPhase = "?";
-	m_bUseForLocations = false;
-	m_bPublishable = false;
-	return (CTravelTime::k_dTravelTimeInvalid);
+	// Calculate time from delta (degrees) using the current origin depth
+	TTTResultStruct result = getTravelTime(
+			delta,
+			glass3::util::Geo::k_EarthRadiusKm - m_geoTTOrigin.m_dGeocentricRadius,
+			phase);
+
+	// remember phase state for the caller
+	m_sPhase = getPhaseName(result.iPhaseID);
+	m_bUseForLocations = result.bUseForLocations;
+	m_bPublishable = result.bPublishable;
+
+	return (result.dTravelTime);
 }
 
 // ---------------------------------------------------------testTravelTimes
@@ -256,33 +196,126 @@ double CTTT::T(double delta, std::string phase) {
 // ---------------------------------------------------------T
 double CTTT::T(glass3::util::Geo *geo, double tObserved) {
 	// Find Phase with least residual, returns time
+	TTTResultStruct result = getBestTravelTime(m_geoTTOrigin, *geo, tObserved);
 
-	double bestTraveltime = CTravelTime::k_dTravelTimeInvalid;
-	std::string bestPhase = "?";
-	bool useForLocations = true;
-	bool publishable = true;
-	double bestResidual = k_dTTTooLargeToBeValid;
+	// remember phase state for the caller
+	m_sPhase = getPhaseName(result.iPhaseID);
+	m_bUseForLocations = result.bUseForLocations;
+	m_bPublishable = result.bPublishable;
 
-	// for each phase
+	return (result.dTravelTime);
+}
+
+// ---------------------------------------------------------getTravelTime
+TTTResultStruct CTTT::getTravelTime(const glass3::util::Geo &geoOrigin,
+									const glass3::util::Geo &geoReceiver,
+									const std::string &phase) const {
+	// Calculate distance in degrees and depth from the origin and receiver
+	double delta = glass3::util::GlassMath::k_RadiansToDegrees
+			* geoOrigin.delta(&geoReceiver);
+	double depth = glass3::util::Geo::k_EarthRadiusKm
+			- geoOrigin.m_dGeocentricRadius;
+
+	return (getTravelTime(delta, depth, phase));
+}
+
+// ---------------------------------------------------------getTravelTime
+TTTResultStruct CTTT::getTravelTime(double delta, double depth,
+									const std::string &phase) const {
+	// find the phase id for this phase name, without interning it
+	int phaseID = k_iPhaseIDInvalid;
 	for (int i = 0; i < m_iNumTravelTimes; i++) {
-		// get current aTrv
-		CTravelTime * aTrv = m_pTravelTimes[i];
+		// is this the phase we're looking for
+		if (m_pTravelTimes[i]->m_sPhase == phase) {
+			phaseID = m_pTravelTimes[i]->m_iPhaseID;
+			break;
+		}
+	}
 
-		// set origin
-		aTrv->setTTOrigin(m_geoTTOrigin);
+	return (getTravelTime(delta, depth, phaseID));
+}
 
-		// get traveltime
-		double traveltime = aTrv->T(geo);
+// ---------------------------------------------------------getTravelTime
+TTTResultStruct CTTT::getTravelTime(const glass3::util::Geo &geoOrigin,
+									const glass3::util::Geo &geoReceiver,
+									int phaseID) const {
+	// Calculate distance in degrees and depth from the origin and receiver
+	double delta = glass3::util::GlassMath::k_RadiansToDegrees
+			* geoOrigin.delta(&geoReceiver);
+	double depth = glass3::util::Geo::k_EarthRadiusKm
+			- geoOrigin.m_dGeocentricRadius;
+
+	return (getTravelTime(delta, depth, phaseID));
+}
 
-		// check traveltime
-		if (traveltime <= CTravelTime::k_dTravelTimeInvalid) {
-			continue;
+// ---------------------------------------------------------getTravelTime
+TTTResultStruct CTTT::getTravelTime(double delta, double depth,
+									int phaseID) const {
+	TTTResultStruct result;
+	result.dTravelTime = CTravelTime::k_dTravelTimeInvalid;
+	result.iPhaseID = k_iPhaseIDInvalid;
+	result.dDelta = delta;
+	result.bUseForLocations = false;
+	result.bPublishable = false;
+
+	if (phaseID == k_iPhaseIDInvalid) {
+		return (result);
+	}
+
+	// for each phase
+	for (int i = 0; i < m_iNumTravelTimes; i++) {
+		const CTravelTime * aTrv = m_pTravelTimes[i];
+
+		// is this the phase we're looking for
+		if (aTrv->m_iPhaseID == phaseID) {
+			// get travel time and phase
+			result.dTravelTime = aTrv->getTravelTime(delta, depth);
+			result.iPhaseID = phaseID;
+			result.bUseForLocations = aTrv->m_bUseForLocations;
+			result.bPublishable = aTrv->isPublishable(delta);
+
+			return (result);
 		}
+	}
+
+	// no valid travel time
+	return (result);
+}
+
+// ---------------------------------------------------------getBestTravelTime
+TTTResultStruct CTTT::getBestTravelTime(const glass3::util::Geo &geoOrigin,
+										const glass3::util::Geo &geoReceiver,
+										double tObserved) const {
+	// Calculate distance in degrees and depth from the origin and receiver
+	double delta = glass3::util::GlassMath::k_RadiansToDegrees
+			* geoOrigin.delta(&geoReceiver);
+	double depth = glass3::util::Geo::k_EarthRadiusKm
+			- geoOrigin.m_dGeocentricRadius;
+
+	return (getBestTravelTime(delta, depth, tObserved));
+}
+
+// ---------------------------------------------------------getBestTravelTime
+TTTResultStruct CTTT::getBestTravelTime(double delta, double depth,
+										double tObserved) const {
+	TTTResultStruct result;
+	result.dTravelTime = CTravelTime::k_dTravelTimeInvalid;
+	result.iPhaseID = k_iPhaseIDInvalid;
+	result.dDelta = delta;
+	result.bUseForLocations = false;
+	result.bPublishable = false;
+
+	double bestResidual = k_dTTTooLargeToBeValid;
+
+	// for each phase
+	for (int i = 0; i < m_iNumTravelTimes; i++) {
+		// get current aTrv
+		const CTravelTime * aTrv = m_pTravelTimes[i];
 
 		// check to see if phase is associable
 		// based on minimum assoc distance, if present
 		if (m_adMinimumAssociationValues[i] >= 0) {
-			if (aTrv->m_dDelta < m_adMinimumAssociationValues[i]) {
+			if (delta < m_adMinimumAssociationValues[i]) {
 				// this phase is not associable  at this distance
 				continue;
 			}
@@ -291,12 +324,20 @@ double CTTT::T(glass3::util::Geo *geo, double tObserved) {
 		// check to see if phase is associable
 		// based on maximum assoc distance, if present
 		if (m_adMaximumAssociationValues[i] >= 0) {
-			if (aTrv->m_dDelta > m_adMaximumAssociationValues[i]) {
+			if (delta > m_adMaximumAssociationValues[i]) {
 				// this phase is not associable  at this distance
 				continue;
 			}
 		}
 
+		// get traveltime
+		double traveltime = aTrv->getTravelTime(delta, depth);
+
+		// check traveltime
+		if (traveltime <= CTravelTime::k_dTravelTimeInvalid) {
+			continue;
+		}
+
 		// compute residual
 		double residual = std::abs(tObserved - traveltime);
 
@@ -305,32 +346,63 @@ double CTTT::T(glass3::util::Geo *geo, double tObserved) {
 		if (residual < bestResidual) {
 			// this is the new best travel time
 			bestResidual = residual;
-			bestPhase = aTrv->m_sPhase;
-			bestTraveltime = traveltime;
-			useForLocations = aTrv->m_bUseForLocations;
-
-			if ((aTrv->m_dDelta >= aTrv->m_dMinDeltaPublishable) &&
-				(aTrv->m_dDelta <= aTrv->m_dMaxDeltaPublishable)) {
-				publishable = true;
-			} else {
-				publishable = false;
-			}
+			result.dTravelTime = traveltime;
+			result.iPhaseID = aTrv->m_iPhaseID;
+			result.bUseForLocations = aTrv->m_bUseForLocations;
+			result.bPublishable = aTrv->isPublishable(delta);
 		}
 	}
 
 	// check to see if minimum residual is valid
 	if (bestResidual < k_dTTTooLargeToBeValid) {
-		m_sPhase = bestPhase;
-		m_bUseForLocations = useForLocations;
-		m_bPublishable = publishable;
-
-		return (bestTraveltime);
+		return (result);
 	}
 
 	// no valid travel time
-	m_sPhase = "?";
-	m_bUseForLocations = false;
-	m_bPublishable = false;
-	return (CTravelTime::k_dTravelTimeInvalid);
+	result.dTravelTime = CTravelTime::k_dTravelTimeInvalid;
+	result.iPhaseID = k_iPhaseIDInvalid;
+	result.bUseForLocations = false;
+	result.bPublishable = false;
+	return (result);
+}
+
+// ---------------------------------------------------------getTravelTimes
+bool CTTT::getTravelTimes(int numReceivers, const double *deltas, double depth,
+							int phaseID, double *travelTimes) const {
+	if ((numReceivers <= 0) || (travelTimes == NULL)) {
+		return (false);
+	}
+
+	if (phaseID != k_iPhaseIDInvalid) {
+		// for each phase
+		for (int i = 0; i < m_iNumTravelTimes; i++) {
+			// is this the phase we're looking for
+			if (m_pTravelTimes[i]->m_iPhaseID == phaseID) {
+				m_pTravelTimes[i]->getTravelTimes(numReceivers, deltas, depth,
+													travelTimes);
+				return (true);
+			}
+		}
+	}
+
+	// no valid travel times
+	for (int i = 0; i < numReceivers; i++) {
+		travelTimes[i] = CTravelTime::k_dTravelTimeInvalid;
+	}
+	return (false);
+}
+
+// ---------------------------------------------------------getPhaseName
+const std::string& CTTT::getPhaseName(int phaseID) const {
+	if (phaseID == k_iPhaseIDInvalid) {
+		return (k_sPhaseUnknown);
+	}
+
+	const std::string &phase = CTravelTime::getPhaseName(phaseID);
+	if (phase == CTravelTime::k_dPhaseInvalid) {
+		return (k_sPhaseUnknown);
+	}
+
+	return (phase);
 }
 }  // namespace traveltime
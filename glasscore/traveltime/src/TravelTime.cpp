@@ -1,17 +1,29 @@
 #include "TravelTime.h"
 #include <geo.h>
 #include <logger.h>
+#include <atomic>
+#include <mutex>
 #include <string>
 #include <cmath>
-#include <cstdio>
 #include <cstring>
 #include <fstream>
 
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
 namespace traveltime {
 
 // constants
 constexpr double CTravelTime::k_dTravelTimeInvalid;
 const std::string CTravelTime::k_dPhaseInvalid = ""; // NOLINT
+const int CTravelTime::k_iPhaseIDInvalid;
+const int CTravelTime::k_iMaximumNumberOfPhaseIDs;
+
+// statics
+std::string CTravelTime::m_asPhaseNames[k_iMaximumNumberOfPhaseIDs];
+std::atomic<int> CTravelTime::m_iNumPhaseIDs(0);
+std::mutex CTravelTime::m_PhaseIDMutex;
 
 // ---------------------------------------------------------CTravelTime
 CTravelTime::CTravelTime(bool useForLocations, double minPublishable,
@@ -44,17 +56,15 @@ CTravelTime::CTravelTime(const CTravelTime &travelTime) {
 	m_dDepth = travelTime.m_dDepth;
 	m_dDelta = travelTime.m_dDelta;
 	m_sPhase = travelTime.m_sPhase;
+	m_iPhaseID = travelTime.m_iPhaseID;
 
 	m_bUseForLocations = travelTime.m_bUseForLocations;
 	m_dMinDeltaPublishable = travelTime.m_dMinDeltaPublishable;
 	m_dMaxDeltaPublishable = travelTime.m_dMaxDeltaPublishable;
 
-	// null check?
-	m_pTravelTimeArray = new double[m_iNumDistances * m_iNumDepths];
-
-	for (int i = 0; i < (m_iNumDistances * m_iNumDepths); i++) {
-		m_pTravelTimeArray[i] = travelTime.m_pTravelTimeArray[i];
-	}
+	// share the read-only travel time array
+	m_pTravelTimeFile = travelTime.m_pTravelTimeFile;
+	m_pTravelTimeArray = travelTime.m_pTravelTimeArray;
 }
 
 // ---------------------------------------------------------~CTravelTime
@@ -77,14 +87,14 @@ void CTravelTime::clear() {
 	m_dDepth = 0;
 	m_dDelta = 0;
 	m_sPhase = CTravelTime::k_dPhaseInvalid;
+	m_iPhaseID = CTravelTime::k_iPhaseIDInvalid;
 
 	m_bUseForLocations = true;
 	m_dMinDeltaPublishable = 0;
 	m_dMaxDeltaPublishable = 180;
 
-	if (m_pTravelTimeArray) {
-		delete (m_pTravelTimeArray);
-	}
+	// release our share of the travel time array
+	m_pTravelTimeFile.reset();
 	m_pTravelTimeArray = NULL;
 }
 
@@ -162,6 +172,7 @@ bool CTravelTime::setup(std::string phase, std::string file) {
 		return (false);
 	} else {
 		m_sPhase = phase;
+		m_iPhaseID = getPhaseID(phase);
 	}
 
 	// generate file name if not specified
@@ -172,96 +183,24 @@ bool CTravelTime::setup(std::string phase, std::string file) {
 	glass3::util::Logger::log(
 			"debug", "CTravelTime::Setup: phase:" + phase + " file:" + file);
 
-	// open file
-	FILE *inFile = fopen(file.c_str(), "rb");
-	if (!inFile) {
+	// get the shared, memory mapped travel time file
+	m_pTravelTimeFile = CTravelTimeFile::getTravelTimeFile(file);
+	if (m_pTravelTimeFile == NULL) {
 		glass3::util::Logger::log(
-				"debug", "CTravelTime::Setup: Cannot open file:" + file);
-		return (false);
-	}
-
-	// A travel time file is a binary file with a header and the travel time
-	//     interpolation array
-	// The file consists of the following:
-	// <SOF>
-	// <FileType> - 4 ascii characters plus null termination - 5 bytes
-	// <BranchName> - 16 ascii characters plus null termination - 17 bytes
-	// <PhaseList> - 64 ascii characters plus null termination - 65 bytes
-	// <numberOfDistancePoints> - 1 int value, 4 bytes
-	// <minimumDistance> - 1 double value, 8 bytes
-	// <maximumDistance> - 1 double value, 8 bytes
-	// <numberOfDepthPoints> - 1 int value, 4 bytes
-	// <minimumDepth> - 1 double value, 8 bytes
-	// <maximumDepth> - 1 double value, 8 bytes
-	// <travelTimeInterpolationArray> -
-	//    (numberOfDistancePoints * numberOfDepthPoints) double values,
-	//    (numberOfDistancePoints * numberOfDepthPoints) * 8 bytes
-	// <EOF>
-
-	// header
-	// read <FileType>
-	char fileType[5];
-	fread(fileType, sizeof(char), 5, inFile);
-
-	// check file type
-	if (strcmp(fileType, "TRAV") != 0) {
-		glass3::util::Logger::log(
-				"debug", "CTravelTime::Setup: File is not .trv file:" + file);
-
-		fclose(inFile);
-
-		return (false);
-	}
-
-	// read <BranchName>
-	char branch[17];
-	fread(branch, sizeof(char), 17, inFile);
-
-	// read <PhaseList>
-	char phaseList[65];
-	fread(phaseList, sizeof(char), 65, inFile);
-
-	// read <numberOfDistancePoints>
-	m_iNumDistances = 0;
-	fread(&m_iNumDistances, sizeof(int), 1, inFile);
-
-	// read <minimumDistance>
-	m_dMinimumDistance = 0;
-	fread(&m_dMinimumDistance, sizeof(double), 1, inFile);
-
-	// read <maximumDistance>
-	m_dMaximumDistance = 0;
-	fread(&m_dMaximumDistance, sizeof(double), 1, inFile);
-
-	// read <numberOfDepthPoints>
-	m_iNumDepths = 0;
-	fread(&m_iNumDepths, sizeof(int), 1, inFile);
-
-	// read <minimumDepth>
-	m_dMinimumDepth = 0;
-	fread(&m_dMinimumDepth, sizeof(double), 1, inFile);
-
-	// read <maximumDepth>
-	m_dMaximumDepth = 0;
-	fread(&m_dMaximumDepth, sizeof(double), 1, inFile);
-
-	// check for valid data
-	if ((m_iNumDistances <= 0) || (m_iNumDepths <= 0)) {
-		glass3::util::Logger::log("error",
-											"CTravelTime::Setup: Invalid data read from input file");
-		fclose(inFile);
+				"debug", "CTravelTime::Setup: Cannot load file:" + file);
 		return (false);
 	}
 
-	// allocate travel time interpolation array
-	m_pTravelTimeArray = new double[m_iNumDistances * m_iNumDepths];
-
-	// read <travelTimeInterpolationArray>
-	fread(m_pTravelTimeArray, 1, sizeof(double) * m_iNumDistances * m_iNumDepths,
-			inFile);
+	// copy the header values
+	m_iNumDistances = m_pTravelTimeFile->m_iNumDistances;
+	m_dMinimumDistance = m_pTravelTimeFile->m_dMinimumDistance;
+	m_dMaximumDistance = m_pTravelTimeFile->m_dMaximumDistance;
+	m_iNumDepths = m_pTravelTimeFile->m_iNumDepths;
+	m_dMinimumDepth = m_pTravelTimeFile->m_dMinimumDepth;
+	m_dMaximumDepth = m_pTravelTimeFile->m_dMaximumDepth;
 
-	// done with file
-	fclose(inFile);
+	// point at the shared travel time interpolation array
+	m_pTravelTimeArray = m_pTravelTimeFile->m_pTravelTimeData;
 
 	// compute steps
 	m_dDistanceStep = (m_dMaximumDistance - m_dMinimumDistance)
@@ -271,8 +210,9 @@ bool CTravelTime::setup(std::string phase, std::string file) {
 
 	glass3::util::Logger::log(
 		"debug",
-		"CTravelTime::Setup: Read: Branch Name |" + std::string(branch)
-			+ "| Phase List |" + std::string(phaseList)
+		"CTravelTime::Setup: Read: Branch Name |"
+			+ m_pTravelTimeFile->m_sBranch
+			+ "| Phase List |" + m_pTravelTimeFile->m_sPhaseList
 			+ "| Num Dist: " + std::to_string(m_iNumDistances)
 			+ ", Min Dist: " + std::to_string(m_dMinimumDistance)
 			+ ", Max Dist: " + std::to_string(m_dMaximumDistance)
@@ -313,60 +253,234 @@ double CTravelTime::T(glass3::util::Geo *geo) {
 double CTravelTime::T(double delta) {
 	m_dDelta = delta;
 
-	// bounds checks
-	if((m_dDelta < m_dMinimumDistance) || (m_dDelta > m_dMaximumDistance)) {
-    	return (k_dTravelTimeInvalid);
+	return (getTravelTime(m_dDelta, m_dDepth));
+}
+
+// ---------------------------------------------------------getTravelTime
+double CTravelTime::getTravelTime(const glass3::util::Geo &geoOrigin,
+									const glass3::util::Geo &geoReceiver,
+									double *delta) const {
+	// compute distance and depth from the origin and receiver, without
+	// modifying any member state
+	double inDistance = glass3::util::GlassMath::k_RadiansToDegrees
+			* geoOrigin.delta(&geoReceiver);
+	double inDepth = glass3::util::Geo::k_EarthRadiusKm
+			- geoOrigin.m_dGeocentricRadius;
+
+	if (delta != NULL) {
+		*delta = inDistance;
 	}
-	if((m_dDepth < m_dMinimumDepth) || (m_dDepth > m_dMaximumDepth)) {
-    	return (k_dTravelTimeInvalid);
+
+	return (getTravelTime(inDistance, inDepth));
+}
+
+// ---------------------------------------------------------getTravelTime
+double CTravelTime::getTravelTime(double delta, double depth) const {
+	double travelTime;
+	getTravelTimes(1, &delta, depth, &travelTime);
+
+	return (travelTime);
+}
+
+// ---------------------------------------------------------getTravelTimes
+void CTravelTime::getTravelTimes(int numReceivers, const double *deltas,
+									double depth, double *travelTimes) const {
+	if ((numReceivers <= 0) || (deltas == NULL) || (travelTimes == NULL)) {
+		return;
 	}
 
-	double inDistance = m_dDelta;
-	double inDepth = m_dDepth;
+	// nullcheck and depth bounds check, these hold for the whole batch
+	if ((m_pTravelTimeArray == NULL) || (depth < m_dMinimumDepth)
+			|| (depth > m_dMaximumDepth)) {
+		for (int i = 0; i < numReceivers; i++) {
+			travelTimes[i] = k_dTravelTimeInvalid;
+		}
+		return;
+	}
 
-	// calculate distance interpolation indexes and values
-	int distanceIndex1 = getIndexFromDistance(inDistance);
-	double distance1 = getDistanceFromIndex(distanceIndex1);
-	int distanceIndex2 = distanceIndex1 + 1;
-	double distance2 = getDistanceFromIndex(distanceIndex2);
+	double inDepth = depth;
 
-	// calculate depth interpolation indexes and values
+	// calculate depth interpolation indexes and values once, the depth is the
+	// same for every receiver
 	int depthIndex1 = getIndexFromDepth(inDepth);
 	double depth1 = getDepthFromIndex(depthIndex1);
 	int depthIndex2 = depthIndex1 + 1;
 	double depth2 = getDepthFromIndex(depthIndex2);
 
-	// lookup travel time interpolation values from using the indexes
-	double travelTime11 = T(distanceIndex1, depthIndex1);
-	double travelTime12 = T(distanceIndex1, depthIndex2);
-	double travelTime21 = T(distanceIndex2, depthIndex1);
-	double travelTime22 = T(distanceIndex2, depthIndex2);
+	for (int i = 0; i < numReceivers; i++) {
+		double inDistance = deltas[i];
+		travelTimes[i] = k_dTravelTimeInvalid;
 
-	// check travel time interpolation values
-	if ((travelTime11 < 0) || (travelTime12 < 0)
-		|| (travelTime21 < 0) || (travelTime22 < 0)) {
-		// no traveltime
-		return (k_dTravelTimeInvalid);
+		// bounds check
+		if ((inDistance < m_dMinimumDistance)
+				|| (inDistance > m_dMaximumDistance)) {
+			continue;
+		}
+
+		// calculate distance interpolation indexes and values
+		int distanceIndex1 = getIndexFromDistance(inDistance);
+		double distance1 = getDistanceFromIndex(distanceIndex1);
+		int distanceIndex2 = distanceIndex1 + 1;
+		double distance2 = getDistanceFromIndex(distanceIndex2);
+
+		// lookup travel time interpolation values from using the indexes
+		double travelTime11 = T(distanceIndex1, depthIndex1);
+		double travelTime12 = T(distanceIndex1, depthIndex2);
+		double travelTime21 = T(distanceIndex2, depthIndex1);
+		double travelTime22 = T(distanceIndex2, depthIndex2);
+
+		// check travel time interpolation values
+		if ((travelTime11 < 0) || (travelTime12 < 0)
+			|| (travelTime21 < 0) || (travelTime22 < 0)) {
+			// no traveltime
+			continue;
+		}
+
+		// get traveltime via bilinear interpolation using the values and
+		// input distance/depth
+		double outTravelTime = bilinearInterpolation(
+			travelTime11, travelTime12, travelTime21, travelTime22,
+			distance1, depth1, distance2, depth2,
+			inDistance, inDepth);
+
+		// check final travel time
+		if (outTravelTime < 0) {
+			// no traveltime
+			continue;
+		}
+
+		travelTimes[i] = outTravelTime;
 	}
+}
 
-	// get traveltime via bilinear interpolation using the values and
-	// input distance/depth
-	double outTravelTime = bilinearInterpolation(
-		travelTime11, travelTime12, travelTime21, travelTime22,
-		distance1, depth1, distance2, depth2,
-		inDistance, inDepth);
+// ---------------------------------------------------------getTravelTimes
+void CTravelTime::getTravelTimes(const glass3::util::Geo &geoOrigin,
+									int numReceivers, const double *unitVectorX,
+									const double *unitVectorY,
+									const double *unitVectorZ,
+									double *travelTimes, double *deltas) const {
+	if ((numReceivers <= 0) || (travelTimes == NULL) || (deltas == NULL)) {
+		return;
+	}
 
-	// check final travel time
-	if (outTravelTime < 0) {
-		// no traveltime
-		return (k_dTravelTimeInvalid);
+	// compute distances and depth from the origin and receivers
+	getDeltas(geoOrigin, numReceivers, unitVectorX, unitVectorY, unitVectorZ,
+				deltas);
+	double inDepth = glass3::util::Geo::k_EarthRadiusKm
+			- geoOrigin.m_dGeocentricRadius;
+
+	getTravelTimes(numReceivers, deltas, inDepth, travelTimes);
+}
+
+// ---------------------------------------------------------getDeltas
+void CTravelTime::getDeltas(const glass3::util::Geo &geoOrigin,
+							int numReceivers, const double *unitVectorX,
+							const double *unitVectorY,
+							const double *unitVectorZ, double *deltas) {
+	if ((numReceivers <= 0) || (unitVectorX == NULL) || (unitVectorY == NULL)
+			|| (unitVectorZ == NULL) || (deltas == NULL)) {
+		return;
+	}
+
+	// compute dot products, in the same order as glass3::util::Geo::delta()
+	// so that the results match
+	int i = 0;
+#ifdef __AVX2__
+	__m256d originX = _mm256_set1_pd(geoOrigin.m_dUnitVectorX);
+	__m256d originY = _mm256_set1_pd(geoOrigin.m_dUnitVectorY);
+	__m256d originZ = _mm256_set1_pd(geoOrigin.m_dUnitVectorZ);
+	for (; i + 4 <= numReceivers; i += 4) {
+		__m256d dot = _mm256_add_pd(
+				_mm256_add_pd(
+						_mm256_mul_pd(originX, _mm256_loadu_pd(unitVectorX + i)),
+						_mm256_mul_pd(originY, _mm256_loadu_pd(unitVectorY + i))),
+				_mm256_mul_pd(originZ, _mm256_loadu_pd(unitVectorZ + i)));
+		_mm256_storeu_pd(deltas + i, dot);
+	}
+#endif
+	// remaining dot products, or all of them without AVX2
+	for (; i < numReceivers; i++) {
+		deltas[i] = geoOrigin.m_dUnitVectorX * unitVectorX[i]
+				+ geoOrigin.m_dUnitVectorY * unitVectorY[i]
+				+ geoOrigin.m_dUnitVectorZ * unitVectorZ[i];
+	}
+
+	// use dot products to compute distances in degrees
+	for (i = 0; i < numReceivers; i++) {
+		double dot = deltas[i];
+		double dlt;
+		if (dot < 1.0) {
+			dlt = acos(dot);
+		} else {
+			dlt = 0.0;
+		}
+		deltas[i] = glass3::util::GlassMath::k_RadiansToDegrees * dlt;
+	}
+}
+
+// ---------------------------------------------------------isPublishable
+bool CTravelTime::isPublishable(double delta) const {
+	if ((delta >= m_dMinDeltaPublishable) && (delta <= m_dMaxDeltaPublishable)) {
+		return (true);
+	}
+
+	return (false);
+}
+
+// ---------------------------------------------------------getPhaseID
+int CTravelTime::getPhaseID(const std::string &phase) {
+	if (phase == CTravelTime::k_dPhaseInvalid) {
+		return (k_iPhaseIDInvalid);
+	}
+
+	// search the interned phases, the names below the count never change
+	// so no lock is needed
+	int numPhaseIDs = m_iNumPhaseIDs.load(std::memory_order_acquire);
+	for (int i = 0; i < numPhaseIDs; i++) {
+		if (m_asPhaseNames[i] == phase) {
+			return (i);
+		}
+	}
+
+	// not found, lock and intern it
+	std::lock_guard<std::mutex> guard(m_PhaseIDMutex);
+
+	// check again in case another thread interned it while we waited
+	numPhaseIDs = m_iNumPhaseIDs.load(std::memory_order_acquire);
+	for (int i = 0; i < numPhaseIDs; i++) {
+		if (m_asPhaseNames[i] == phase) {
+			return (i);
+		}
+	}
+
+	if (numPhaseIDs >= k_iMaximumNumberOfPhaseIDs) {
+		glass3::util::Logger::log(
+				"error",
+				"CTravelTime::getPhaseID: Maximum number of phase ids ("
+						+ std::to_string(k_iMaximumNumberOfPhaseIDs)
+						+ ") reached");
+		return (k_iPhaseIDInvalid);
+	}
+
+	// write the name before publishing the new count
+	m_asPhaseNames[numPhaseIDs] = phase;
+	m_iNumPhaseIDs.store(numPhaseIDs + 1, std::memory_order_release);
+
+	return (numPhaseIDs);
+}
+
+// ---------------------------------------------------------getPhaseName
+const std::string& CTravelTime::getPhaseName(int phaseID) {
+	if ((phaseID < 0)
+			|| (phaseID >= m_iNumPhaseIDs.load(std::memory_order_acquire))) {
+		return (k_dPhaseInvalid);
 	}
 
-	return (outTravelTime);
+	return (m_asPhaseNames[phaseID]);
 }
 
 // ------------------------------------------------------getIndexFromDistance
-int CTravelTime::getIndexFromDistance(double distance) {
+int CTravelTime::getIndexFromDistance(double distance) const {
 	if (m_dDistanceStep < 0) {
 		return (0);
 	}
@@ -392,7 +506,7 @@ int CTravelTime::getIndexFromDistance(double distance) {
 }
 
 // ------------------------------------------------------getDistanceFromIndex
-double CTravelTime::getDistanceFromIndex(int index) {
+double CTravelTime::getDistanceFromIndex(int index) const {
 	if (m_dDistanceStep < 0) {
 		return (0);
 	}
@@ -406,7 +520,7 @@ double CTravelTime::getDistanceFromIndex(int index) {
 }
 
 // ------------------------------------------------------getIndexFromDepth
-int CTravelTime::getIndexFromDepth(double depth) {
+int CTravelTime::getIndexFromDepth(double depth) const {
 	if (m_dDepthStep < 0) {
 		return (0);
 	}
@@ -432,7 +546,7 @@ int CTravelTime::getIndexFromDepth(double depth) {
 }
 
 // ------------------------------------------------------getDepthFromIndex
-double CTravelTime::getDepthFromIndex(int index) {
+double CTravelTime::getDepthFromIndex(int index) const {
 	if (m_dDepthStep < 0) {
 		return (0);
 	}
@@ -448,7 +562,7 @@ double CTravelTime::getDepthFromIndex(int index) {
 // -------------------------------------------------------bilinearInterpolation
 double CTravelTime::bilinearInterpolation(double q_x1y1, double q_x1y2,
 	double q_x2y1, double q_x2y2, double x1, double y1, double x2, double y2,
-	double x, double y) {
+	double x, double y) const {
 	// check values to avoid div by 0
 	if ((x1 == x2) || (y1 == y2)) {
 		return(-1.0);
@@ -469,7 +583,7 @@ double CTravelTime::bilinearInterpolation(double q_x1y1, double q_x1y2,
 }
 
 // ---------------------------------------------------------T
-double CTravelTime::T(int deltaIndex, int depthIndex) {
+double CTravelTime::T(int deltaIndex, int depthIndex) const {
 	// bounds checks
 	if ((deltaIndex < 0) || (deltaIndex >= m_iNumDistances)) {
 		return (k_dTravelTimeInvalid);
@@ -478,9 +592,14 @@ double CTravelTime::T(int deltaIndex, int depthIndex) {
 		return (k_dTravelTimeInvalid);
 	}
 
-	// get traveltime from travel time array
-	double travelTime = m_pTravelTimeArray[depthIndex * m_iNumDistances
-			+ deltaIndex];
+	// get traveltime from travel time array, the array is not aligned within
+	// the mapped file, so copy the value out
+	double travelTime;
+	memcpy(&travelTime,
+			m_pTravelTimeArray
+					+ (static_cast<size_t>(depthIndex) * m_iNumDistances
+							+ deltaIndex) * sizeof(double),
+			sizeof(double));
 
 	return (travelTime);
 }
@@ -0,0 +1,302 @@
+#include "TravelTimeFile.h"
+#include <logger.h>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace traveltime {
+
+// constants
+const int CTravelTimeFile::k_iHeaderSize;
+
+// statics
+std::map<std::string, std::weak_ptr<const CTravelTimeFile>> CTravelTimeFile::m_mTravelTimeFileRegistry;  // NOLINT
+std::mutex CTravelTimeFile::m_RegistryMutex;
+
+// ---------------------------------------------------------CTravelTimeFile
+CTravelTimeFile::CTravelTimeFile() {
+	m_pMapping = NULL;
+	m_iMappingSize = 0;
+
+	clear();
+}
+
+// ---------------------------------------------------------~CTravelTimeFile
+CTravelTimeFile::~CTravelTimeFile() {
+	clear();
+}
+
+// ---------------------------------------------------------clear
+void CTravelTimeFile::clear() {
+#ifndef _WIN32
+	if (m_pMapping != NULL) {
+		munmap(m_pMapping, m_iMappingSize);
+	}
+#endif
+	m_pMapping = NULL;
+	m_iMappingSize = 0;
+	m_vFileBuffer.clear();
+
+	m_sFileName = "";
+	m_sBranch = "";
+	m_sPhaseList = "";
+	m_iNumDistances = 0;
+	m_dMinimumDistance = 0;
+	m_dMaximumDistance = 0;
+	m_iNumDepths = 0;
+	m_dMinimumDepth = 0;
+	m_dMaximumDepth = 0;
+	m_pTravelTimeData = NULL;
+}
+
+// ---------------------------------------------------------load
+bool CTravelTimeFile::load(const std::string &fileName) {
+	clear();
+
+	if (fileName == "") {
+		glass3::util::Logger::log("error",
+									"CTravelTimeFile::load: empty file name");
+		return (false);
+	}
+
+	const char * fileData = NULL;
+	size_t fileSize = 0;
+
+#ifdef _WIN32
+	// no mmap, read the whole file into a buffer instead
+	FILE *inFile = fopen(fileName.c_str(), "rb");
+	if (!inFile) {
+		glass3::util::Logger::log(
+				"debug", "CTravelTimeFile::load: Cannot open file:" + fileName);
+		return (false);
+	}
+
+	fseek(inFile, 0, SEEK_END);
+	long endPosition = ftell(inFile);  // NOLINT
+	fseek(inFile, 0, SEEK_SET);
+
+	if (endPosition > 0) {
+		m_vFileBuffer.resize(endPosition);
+		fileSize = fread(m_vFileBuffer.data(), 1, endPosition, inFile);
+	}
+	fclose(inFile);
+
+	fileData = m_vFileBuffer.data();
+#else
+	// map the file read only
+	int fd = open(fileName.c_str(), O_RDONLY);
+	if (fd < 0) {
+		glass3::util::Logger::log(
+				"debug", "CTravelTimeFile::load: Cannot open file:" + fileName);
+		return (false);
+	}
+
+	struct stat fileStat;
+	if ((fstat(fd, &fileStat) != 0) || (fileStat.st_size <= 0)) {
+		glass3::util::Logger::log(
+				"error", "CTravelTimeFile::load: Cannot stat file:" + fileName);
+		close(fd);
+		return (false);
+	}
+
+	fileSize = static_cast<size_t>(fileStat.st_size);
+	void * mapping = mmap(NULL, fileSize, PROT_READ, MAP_SHARED, fd, 0);
+
+	// the mapping remains valid after the file is closed
+	close(fd);
+
+	if (mapping == MAP_FAILED) {
+		glass3::util::Logger::log(
+				"error", "CTravelTimeFile::load: Cannot map file:" + fileName);
+		return (false);
+	}
+
+	m_pMapping = mapping;
+	m_iMappingSize = fileSize;
+	fileData = static_cast<const char *>(m_pMapping);
+#endif
+
+	// A travel time file is a binary file with a header and the travel time
+	//     interpolation array
+	// The file consists of the following:
+	// <SOF>
+	// <FileType> - 4 ascii characters plus null termination - 5 bytes
+	// <BranchName> - 16 ascii characters plus null termination - 17 bytes
+	// <PhaseList> - 64 ascii characters plus null termination - 65 bytes
+	// <numberOfDistancePoints> - 1 int value, 4 bytes
+	// <minimumDistance> - 1 double value, 8 bytes
+	// <maximumDistance> - 1 double value, 8 bytes
+	// <numberOfDepthPoints> - 1 int value, 4 bytes
+	// <minimumDepth> - 1 double value, 8 bytes
+	// <maximumDepth> - 1 double value, 8 bytes
+	// <travelTimeInterpolationArray> -
+	//    (numberOfDistancePoints * numberOfDepthPoints) double values,
+	//    (numberOfDistancePoints * numberOfDepthPoints) * 8 bytes
+	// <EOF>
+
+	// check header size
+	if (fileSize < static_cast<size_t>(k_iHeaderSize)) {
+		glass3::util::Logger::log(
+				"debug", "CTravelTimeFile::load: File is not .trv file:" + fileName);
+		clear();
+		return (false);
+	}
+
+	// header
+	const char * position = fileData;
+
+	// check <FileType>
+	if (memcmp(position, "TRAV", 5) != 0) {
+		glass3::util::Logger::log(
+				"debug", "CTravelTimeFile::load: File is not .trv file:" + fileName);
+		clear();
+		return (false);
+	}
+	position += 5;
+
+	// read <BranchName>
+	char branch[17];
+	memcpy(branch, position, 17);
+	branch[16] = '\0';
+	position += 17;
+
+	// read <PhaseList>
+	char phaseList[65];
+	memcpy(phaseList, position, 65);
+	phaseList[64] = '\0';
+	position += 65;
+
+	// read <numberOfDistancePoints>, <minimumDistance>, <maximumDistance>
+	int numDistances = 0;
+	memcpy(&numDistances, position, sizeof(int));
+	position += sizeof(int);
+	double minimumDistance = 0;
+	memcpy(&minimumDistance, position, sizeof(double));
+	position += sizeof(double);
+	double maximumDistance = 0;
+	memcpy(&maximumDistance, position, sizeof(double));
+	position += sizeof(double);
+
+	// read <numberOfDepthPoints>, <minimumDepth>, <maximumDepth>
+	int numDepths = 0;
+	memcpy(&numDepths, position, sizeof(int));
+	position += sizeof(int);
+	double minimumDepth = 0;
+	memcpy(&minimumDepth, position, sizeof(double));
+	position += sizeof(double);
+	double maximumDepth = 0;
+	memcpy(&maximumDepth, position, sizeof(double));
+	position += sizeof(double);
+
+	// check for valid data
+	if ((numDistances <= 0) || (numDepths <= 0)) {
+		glass3::util::Logger::log(
+				"error", "CTravelTimeFile::load: Invalid data read from input file");
+		clear();
+		return (false);
+	}
+
+	// check that the whole travel time interpolation array is present
+	size_t arraySize = static_cast<size_t>(numDistances)
+			* static_cast<size_t>(numDepths) * sizeof(double);
+	if ((fileSize - k_iHeaderSize) < arraySize) {
+		glass3::util::Logger::log(
+				"error", "CTravelTimeFile::load: Truncated travel time array in "
+				"file:" + fileName);
+		clear();
+		return (false);
+	}
+
+	m_sFileName = fileName;
+	m_sBranch = std::string(branch);
+	m_sPhaseList = std::string(phaseList);
+	m_iNumDistances = numDistances;
+	m_dMinimumDistance = minimumDistance;
+	m_dMaximumDistance = maximumDistance;
+	m_iNumDepths = numDepths;
+	m_dMinimumDepth = minimumDepth;
+	m_dMaximumDepth = maximumDepth;
+
+	// <travelTimeInterpolationArray>
+	m_pTravelTimeData = position;
+
+	return (true);
+}
+
+// ---------------------------------------------------------getTravelTimeFile
+std::shared_ptr<const CTravelTimeFile> CTravelTimeFile::getTravelTimeFile(
+		const std::string &fileName) {
+	// key the registry on the resolved path, so that different relative
+	// paths to the same file share a mapping
+	std::string key = fileName;
+#ifndef _WIN32
+	char resolvedPath[PATH_MAX];
+	if (realpath(fileName.c_str(), resolvedPath) != NULL) {
+		key = std::string(resolvedPath);
+	}
+#endif
+
+	// lock the registry for this scope, so that concurrent callers for the
+	// same file only map it once
+	std::lock_guard<std::mutex> guard(m_RegistryMutex);
+
+	// check for an existing mapping
+	auto found = m_mTravelTimeFileRegistry.find(key);
+	if (found != m_mTravelTimeFileRegistry.end()) {
+		std::shared_ptr<const CTravelTimeFile> existingFile = found->second
+				.lock();
+		if (existingFile != NULL) {
+			return (existingFile);
+		}
+
+		// expired, the last user released it
+		m_mTravelTimeFileRegistry.erase(found);
+	}
+
+	// map the file
+	std::shared_ptr<CTravelTimeFile> newFile =
+			std::make_shared<CTravelTimeFile>();
+	if (newFile->load(fileName) == false) {
+		return (NULL);
+	}
+
+	m_mTravelTimeFileRegistry[key] = newFile;
+
+	return (newFile);
+}
+
+// ---------------------------------------------------------getNumTravelTimeFiles
+int CTravelTimeFile::getNumTravelTimeFiles() {
+	std::lock_guard<std::mutex> guard(m_RegistryMutex);
+
+	// count the mappings that are still in use
+	int count = 0;
+	for (auto it = m_mTravelTimeFileRegistry.begin();
+			it != m_mTravelTimeFileRegistry.end();) {
+		if (it->second.expired()) {
+			it = m_mTravelTimeFileRegistry.erase(it);
+		} else {
+			count++;
+			++it;
+		}
+	}
+
+	return (count);
+}
+}  // namespace traveltime
@@ -125,6 +125,21 @@ class Input : public glass3::util::iInput,
 	 */
 	std::shared_ptr<json::Object> getInputData() override;
 
+	/**
+	 * \brief Input data batch getting function
+	 *
+	 * The function (from iInput) used to get a batch of Input data from the
+	 * data queue, under a single lock of the queue.
+	 *
+	 * \param dataBatch - A pointer to the std::vector to append the data to
+	 * \param maxCount - An integer containing the maximum number of data to
+	 * get, -1 to get all of the data in the Input queue
+	 * \return Returns an integer containing the number of data appended to
+	 * dataBatch
+	 */
+	int getInputDataBatch(std::vector<std::shared_ptr<json::Object>> *dataBatch,
+							int maxCount) override;
+
 	/**
 	 * \brief Input data count function
 	 *
@@ -136,6 +151,18 @@ class Input : public glass3::util::iInput,
 	 */
 	int getInputDataCount() override;
 
+	/**
+	 * \brief Input data consumer setting function
+	 *
+	 * Sets the work thread that consumes data from the data queue, so that
+	 * it is woken as soon as new Input data is available rather than after
+	 * its sleep time.
+	 *
+	 * \param consumer - A pointer to the glass3::util::ThreadBaseClass that
+	 * consumes the Input data, NULL to disable waking
+	 */
+	void setInputDataConsumer(glass3::util::ThreadBaseClass * consumer);
+
 	/**
 	 * \brief Function to set the maximum queue size
 	 *
@@ -24,7 +24,7 @@ namespace input {
 // ---------------------------------------------------------Input
 Input::Input()
 		: glass3::util::ThreadBaseClass("input") {
-	glass3::util::Logger::log("debug", "Input::Input(): Construction.");
+	GLASS3_LOG_DEBUG("Input::Input(): Construction.");
 
 	m_GPickParser = NULL;
 	m_JSONParser = NULL;
@@ -85,24 +85,21 @@ Input::~Input() {
 // ---------------------------------------------------------setup
 bool Input::setup(std::shared_ptr<const json::Object> config) {
 	if (config == NULL) {
-		glass3::util::Logger::log("error",
-							"Input::setup(): NULL configuration passed in.");
+		GLASS3_LOG_ERROR("Input::setup(): NULL configuration passed in.");
 		return (false);
 	}
 
-	glass3::util::Logger::log("debug", "Input::setup(): Setting Up.");
+	GLASS3_LOG_DEBUG("Input::setup(): Setting Up.");
 
 	// Cmd
 	if (!(config->HasKey(CONFIG_KEY)
 			&& ((*config)[CONFIG_KEY].GetType() == json::ValueType::StringVal))) {
-		glass3::util::Logger::log("error",
-							"Input::setup(): BAD configuration passed in.");
+		GLASS3_LOG_ERROR("Input::setup(): BAD configuration passed in.");
 		return (false);
 	} else {
 		std::string configtype = (*config)[CONFIG_KEY].ToString();
 		if (configtype != "GlassInput") {
-			glass3::util::Logger::log(
-					"error",
+			GLASS3_LOG_ERROR(
 					"Input::setup(): Wrong configuration provided, configuration "
 							"is for: " + configtype + ".");
 			return (false);
@@ -113,13 +110,11 @@ bool Input::setup(std::shared_ptr<const json::Object> config) {
 	if (!(config->HasKey("DefaultAgencyID")
 			&& ((*config)["DefaultAgencyID"].GetType()
 					== json::ValueType::StringVal))) {
-		glass3::util::Logger::log(
-				"error", "Input::setup(): Missing required DefaultAgencyID.");
+		GLASS3_LOG_ERROR("Input::setup(): Missing required DefaultAgencyID.");
 		return (false);
 	} else {
 		setDefaultAgencyId((*config)["DefaultAgencyID"].ToString());
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"Input::setup(): Using AgencyID: " + getDefaultAgencyId()
 						+ " as default.");
 	}
@@ -128,13 +123,11 @@ bool Input::setup(std::shared_ptr<const json::Object> config) {
 	if (!(config->HasKey("DefaultAuthor")
 			&& ((*config)["DefaultAuthor"].GetType()
 					== json::ValueType::StringVal))) {
-		glass3::util::Logger::log("error",
-							"Input::setup(): Missing required DefaultAuthor.");
+		GLASS3_LOG_ERROR("Input::setup(): Missing required DefaultAuthor.");
 		return (false);
 	} else {
 		setDefaultAuthor((*config)["DefaultAuthor"].ToString());
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"Input::setup(): Using Author: " + getDefaultAuthor()
 						+ " as default.");
 	}
@@ -144,14 +137,12 @@ bool Input::setup(std::shared_ptr<const json::Object> config) {
 			&& ((*config)["QueueMaxSize"].GetType() == json::ValueType::IntVal))) {
 		// queue max size is optional
 		setInputDataMaxSize(-1);
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"Input::setup(): Defaulting to -1 for QueueMaxSize (no maximum "
 				"queue size).");
 	} else {
 		setInputDataMaxSize((*config)["QueueMaxSize"].ToInt());
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"Input::setup(): Using QueueMaxSize: "
 						+ std::to_string(getInputDataMaxSize()) + ".");
 	}
@@ -181,7 +172,7 @@ bool Input::setup(std::shared_ptr<const json::Object> config) {
 	m_SimplePickParser = new glass3::parse::SimplePickParser(getDefaultAgencyId(),
 																getDefaultAuthor());
 
-	glass3::util::Logger::log("debug", "Input::setup(): Done Setting Up.");
+	GLASS3_LOG_DEBUG("Input::setup(): Done Setting Up.");
 
 	// finally do baseclass setup;
 	// mostly remembering our config object
@@ -193,7 +184,7 @@ bool Input::setup(std::shared_ptr<const json::Object> config) {
 
 // ---------------------------------------------------------clear
 void Input::clear() {
-	glass3::util::Logger::log("debug", "Input::clear(): clearing configuration.");
+	GLASS3_LOG_DEBUG("Input::clear(): clearing configuration.");
 
 	setDefaultAgencyId("");
 	setDefaultAuthor("");
@@ -216,6 +207,17 @@ std::shared_ptr<json::Object> Input::getInputData() {
 	return (m_DataQueue->getDataFromQueue());
 }
 
+// ---------------------------------------------------------getInputDataBatch
+int Input::getInputDataBatch(
+		std::vector<std::shared_ptr<json::Object>> *dataBatch, int maxCount) {
+	if (m_DataQueue == NULL) {
+		return (0);
+	}
+
+	// just get the values from the queue
+	return (m_DataQueue->getDataBatchFromQueue(dataBatch, maxCount));
+}
+
 // ---------------------------------------------------------getInputDataCount
 int Input::getInputDataCount() {
 	if (m_DataQueue == NULL) {
@@ -225,6 +227,15 @@ int Input::getInputDataCount() {
 	return (m_DataQueue->size());
 }
 
+// ---------------------------------------------------------setInputDataConsumer
+void Input::setInputDataConsumer(glass3::util::ThreadBaseClass * consumer) {
+	if (m_DataQueue == NULL) {
+		return;
+	}
+
+	m_DataQueue->setWakeUpThread(consumer);
+}
+
 // ---------------------------------------------------------work
 glass3::util::WorkState Input::work() {
 	// check to see if we have room
@@ -246,8 +257,7 @@ glass3::util::WorkState Input::work() {
 	try {
 		newdata = parse(type, message);
 	} catch (const std::exception &e) {
-		glass3::util::Logger::log(
-				"debug",
+		GLASS3_LOG_DEBUG(
 				"Input::work(): Exception:" + std::string(e.what())
 						+ " processing Input: " + message);
 	}
@@ -279,8 +289,7 @@ std::shared_ptr<json::Object> Input::parse(std::string inputType,
 		// simple pick data
 		return (m_SimplePickParser->parse(inputMessage));
 	} else {
-		glass3::util::Logger::log("warning",
-							"Input::parse(): Unknown type " + inputType);
+		GLASS3_LOG_WARNING("Input::parse(): Unknown type " + inputType);
 		return (NULL);
 	}
 }
@@ -140,6 +140,12 @@ TEST(InputTest, GPickTest) {
 	// check that the right ammount of data is in the queue
 	ASSERT_EQ(TestInput.getInputDataCount(), DATACOUNT)<< "queue size check";
 
+	// check that the data can be taken as a batch
+	std::vector<std::shared_ptr<json::Object>> dataBatch;
+	ASSERT_EQ(TestInput.getInputDataBatch(&dataBatch, DATACOUNT - 1),
+				DATACOUNT - 1)<< "batch size check";
+	ASSERT_EQ(TestInput.getInputDataCount(), 1)<< "queue size after batch";
+
 	TestInput.stop();
 }
 
@@ -54,6 +54,8 @@ output::output()
 	m_TrackingCache = new glass3::util::Cache();
 	m_OutputQueue = new glass3::util::Queue();
 	m_LookupQueue = new glass3::util::Queue();
+	m_OutputQueue->setWakeUpThread(this);
+	m_LookupQueue->setWakeUpThread(this);
 
 	// setup thread pool for output
 	m_ThreadPool = new glass3::util::ThreadPool("outputpool");
@@ -97,24 +99,21 @@ output::~output() {
 // configuration
 bool output::setup(std::shared_ptr<const json::Object> config) {
 	if (config == NULL) {
-		glass3::util::Logger::log(
-				"error", "output::setup(): NULL configuration passed in.");
+		GLASS3_LOG_ERROR("output::setup(): NULL configuration passed in.");
 		return (false);
 	}
 
-	glass3::util::Logger::log("debug", "output::setup(): Setting Up.");
+	GLASS3_LOG_DEBUG("output::setup(): Setting Up.");
 
 	// Cmd
 	if (!(config->HasKey(CONFIG_KEY)
 			&& ((*config)[CONFIG_KEY].GetType() == json::ValueType::StringVal))) {
-		glass3::util::Logger::log(
-				"error", "output::setup(): BAD configuration passed in.");
+		GLASS3_LOG_ERROR("output::setup(): BAD configuration passed in.");
 		return (false);
 	} else {
 		std::string configtype = (*config)[CONFIG_KEY];
 		if (configtype != "GlassOutput") {
-			glass3::util::Logger::log(
-					"error", "output::setup(): Wrong configuration provided, "
+			GLASS3_LOG_ERROR("output::setup(): Wrong configuration provided, "
 							"configuration is for: " + configtype + ".");
 			return (false);
 		}
@@ -126,15 +125,13 @@ bool output::setup(std::shared_ptr<const json::Object> config) {
 					== json::ValueType::BoolVal))) {
 		// publish on expiration is optional, default to false
 		setPubOnExpiration(false);
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"output::setup(): PublishOnExpiration not specified, using default "
 				"of false.");
 	} else {
 		setPubOnExpiration((*config)["PublishOnExpiration"].ToBool());
 
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"output::setup(): Using PublishOnExpiration: "
 						+ std::to_string(getPubOnExpiration()) + " .");
 	}
@@ -146,8 +143,7 @@ bool output::setup(std::shared_ptr<const json::Object> config) {
 		// PublicationTimes is optional, default to minimum
 		clearPubTimes();
 		addPubTime(output::k_iMinimumPublicationTime);
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"output::setup(): PublicationTimes not specified, using default "
 				"of 0.");
 	} else {
@@ -157,8 +153,7 @@ bool output::setup(std::shared_ptr<const json::Object> config) {
 			int pubTime = dataarray[i].ToInt();
 			addPubTime(pubTime);
 
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"output::setup(): Using Publication Time #"
 							+ std::to_string(i) + ": " + std::to_string(pubTime)
 							+ " .");
@@ -169,16 +164,14 @@ bool output::setup(std::shared_ptr<const json::Object> config) {
 	if (!(config->HasKey("ImmediatePublicationThreshold")
 			&& ((*config)["ImmediatePublicationThreshold"].GetType()
 					== json::ValueType::DoubleVal))) {
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"output::setup(): ImmediatePublicationThreshold not specified.");
 		setImmediatePubThreshold(-1.0);
 	} else {
 		setImmediatePubThreshold(
 				(*config)["ImmediatePublicationThreshold"].ToDouble());
 
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"output::setup(): Using ImmediatePublicationThreshold: "
 						+ std::to_string(getImmediatePubThreshold()) + ".");
 	}
@@ -187,13 +180,11 @@ bool output::setup(std::shared_ptr<const json::Object> config) {
 	if (!(config->HasKey("OutputAgencyID")
 			&& ((*config)["OutputAgencyID"].GetType()
 					== json::ValueType::StringVal))) {
-		glass3::util::Logger::log(
-				"error", "output::setup(): Missing required OutputAgencyID.");
+		GLASS3_LOG_ERROR("output::setup(): Missing required OutputAgencyID.");
 		return (false);
 	} else {
 		setDefaultAgencyId((*config)["OutputAgencyID"].ToString());
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"output::setup(): Using AgencyID: " + getDefaultAgencyId()
 						+ " for output.");
 	}
@@ -202,13 +193,11 @@ bool output::setup(std::shared_ptr<const json::Object> config) {
 	if (!(config->HasKey("OutputAuthor")
 			&& ((*config)["OutputAuthor"].GetType()
 					== json::ValueType::StringVal))) {
-		glass3::util::Logger::log(
-				"error", "output::setup(): Missing required OutputAuthor.");
+		GLASS3_LOG_ERROR("output::setup(): Missing required OutputAuthor.");
 		return (false);
 	} else {
 		setDefaultAuthor((*config)["OutputAuthor"].ToString());
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"output::setup(): Using Author: " + getDefaultAuthor()
 						+ " for output.");
 	}
@@ -217,21 +206,19 @@ bool output::setup(std::shared_ptr<const json::Object> config) {
 	if (!(config->HasKey("SiteListRequestInterval")
 			&& ((*config)["SiteListRequestInterval"].GetType()
 					== json::ValueType::IntVal))) {
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"output::setup(): SiteListRequestInterval not specified.");
 		setSiteListRequestInterval(-1);
 	} else {
 		setSiteListRequestInterval(
 				(*config)["SiteListRequestInterval"].ToInt());
 
-		glass3::util::Logger::log(
-				"info",
+		GLASS3_LOG_INFO(
 				"output::setup(): Using SiteListRequestInterval: "
 						+ std::to_string(getSiteListRequestInterval()) + ".");
 	}
 
-	glass3::util::Logger::log("debug", "output::setup(): Done Setting Up.");
+	GLASS3_LOG_DEBUG("output::setup(): Done Setting Up.");
 
 	// finally do baseclass setup;
 	// mostly remembering our config object
@@ -243,8 +230,7 @@ bool output::setup(std::shared_ptr<const json::Object> config) {
 
 // ---------------------------------------------------------clear
 void output::clear() {
-	glass3::util::Logger::log("debug",
-								"output::clear(): clearing configuration.");
+	GLASS3_LOG_DEBUG("output::clear(): clearing configuration.");
 
 	setPubOnExpiration(false);
 	setImmediatePubThreshold(-1.0);
@@ -265,8 +251,7 @@ void output::sendToOutput(std::shared_ptr<json::Object> message) {
 	} else if (message->HasKey(TYPE_KEY)) {
 		messagetype = (*message)[TYPE_KEY].ToString();
 	} else {
-		glass3::util::Logger::log(
-				"critical",
+		GLASS3_LOG_CRITICAL(
 				"output::sendToOutput(): BAD message passed in, no Cmd/Type found.");
 		return;
 	}
@@ -325,8 +310,7 @@ bool output::healthCheck() {
 bool output::addTrackingData(std::shared_ptr<json::Object> data) {
 	std::lock_guard<std::mutex> guard(m_TrackingCacheMutex);
 	if (data == NULL) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"output::addtrackingdata(): Bad json object passed in.");
 		return (false);
 	}
@@ -338,15 +322,13 @@ bool output::addTrackingData(std::shared_ptr<json::Object> data) {
 	} else if ((*data).HasKey(PID_KEY)) {
 		id = (*data)[PID_KEY].ToString();
 	} else {
-		glass3::util::Logger::log(
-				"error", "output::addtrackingdata(): No ID found data json.");
+		GLASS3_LOG_ERROR("output::addtrackingdata(): No ID found data json.");
 		return (false);
 	}
 
 	// don't do anything if we didn't get an ID
 	if (id == "") {
-		glass3::util::Logger::log(
-				"error", "output::addtrackingdata(): Bad ID from data json.");
+		GLASS3_LOG_ERROR("output::addtrackingdata(): Bad ID from data json.");
 		return (false);
 	}
 
@@ -356,8 +338,7 @@ bool output::addTrackingData(std::shared_ptr<json::Object> data) {
 	if (existingdata != NULL) {
 		// it is, copy the pub log for an existing event
 		if (!(*existingdata).HasKey(PUBLOG_KEY)) {
-			glass3::util::Logger::log(
-					"error",
+			GLASS3_LOG_ERROR(
 					"output::addtrackingdata(): existing event missing pub log! :"
 							+ json::Serialize(*existingdata));
 
@@ -378,8 +359,7 @@ bool output::addTrackingData(std::shared_ptr<json::Object> data) {
 		(*data)[PUBLOG_KEY] = pubLog;
 	}
 
-	glass3::util::Logger::log(
-			"debug",
+	GLASS3_LOG_DEBUG(
 			"output::addTrackingData(): New tracking data: "
 					+ json::Serialize(*data));
 
@@ -391,8 +371,7 @@ bool output::addTrackingData(std::shared_ptr<json::Object> data) {
 // ---------------------------------------------------------removeTrackingData
 bool output::removeTrackingData(std::shared_ptr<const json::Object> data) {
 	if (data == NULL) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"output::removetrackingdata(): Bad json object passed in.");
 		return (false);
 	}
@@ -403,8 +382,7 @@ bool output::removeTrackingData(std::shared_ptr<const json::Object> data) {
 	} else if ((*data).HasKey(PID_KEY)) {
 		ID = (*data)[PID_KEY].ToString();
 	} else {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"output::removetrackingdata(): Bad json hypo object passed in.");
 
 		return (false);
@@ -417,8 +395,7 @@ bool output::removeTrackingData(std::shared_ptr<const json::Object> data) {
 bool output::removeTrackingData(std::string ID) {
 	std::lock_guard<std::mutex> guard(m_TrackingCacheMutex);
 	if (ID == "") {
-		glass3::util::Logger::log(
-				"error", "output::removetrackingdata(): Empty ID passed in.");
+		GLASS3_LOG_ERROR("output::removetrackingdata(): Empty ID passed in.");
 		return (false);
 	}
 
@@ -433,8 +410,7 @@ bool output::removeTrackingData(std::string ID) {
 std::shared_ptr<const json::Object> output::getTrackingData(std::string id) {
 	std::lock_guard<std::mutex> guard(m_TrackingCacheMutex);
 	if (id == "") {
-		glass3::util::Logger::log(
-				"error", "output::removetrackingdata(): Empty ID passed in.");
+		GLASS3_LOG_ERROR("output::removetrackingdata(): Empty ID passed in.");
 		return (NULL);
 	}
 
@@ -468,8 +444,7 @@ std::shared_ptr<const json::Object> output::getNextTrackingData() {
 // ---------------------------------------------------------haveTrackingData
 bool output::haveTrackingData(std::shared_ptr<json::Object> data) {
 	if (data == NULL) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"output::havetrackingdata(): Bad json object passed in.");
 		return (false);
 	}
@@ -480,8 +455,7 @@ bool output::haveTrackingData(std::shared_ptr<json::Object> data) {
 	} else if ((*data).HasKey(PID_KEY)) {
 		ID = (*data)[PID_KEY].ToString();
 	} else {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"output::havetrackingdata(): Bad json hypo object passed in.");
 		return (false);
 	}
@@ -493,8 +467,7 @@ bool output::haveTrackingData(std::shared_ptr<json::Object> data) {
 bool output::haveTrackingData(std::string ID) {
 	std::lock_guard<std::mutex> guard(m_TrackingCacheMutex);
 	if (ID == "") {
-		glass3::util::Logger::log(
-				"error", "output::haveTrackingData(): Empty ID passed in.");
+		GLASS3_LOG_ERROR("output::haveTrackingData(): Empty ID passed in.");
 		return (false);
 	}
 
@@ -509,8 +482,7 @@ void output::clearTrackingData() {
 
 // ---------------------------------------------------------checkEventsLoop
 void output::checkEventsLoop() {
-	glass3::util::Logger::log(
-			"debug",
+	GLASS3_LOG_DEBUG(
 			"output::checkEventsLoop():  Check Events Thread Startup. ("
 					+ getThreadName() + ")");
 
@@ -524,8 +496,7 @@ void output::checkEventsLoop() {
 
 		// make sure we should still be running
 		if (getWorkThreadsState() != glass3::util::ThreadState::Started) {
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"output::checkEventsLoop(): Non-Starting thread "
 							"status detected ("
 							+ std::to_string(getWorkThreadsState())
@@ -551,8 +522,7 @@ void output::checkEventsLoop() {
 		} else if ((*data).HasKey(PID_KEY)) {
 			id = (*data)[PID_KEY].ToString();
 		} else {
-			glass3::util::Logger::log(
-					"warning",
+			GLASS3_LOG_WARNING(
 					"output::checkEventsLoop(): Bad data object received from "
 					"getNextTrackingData(), no ID, skipping data.");
 
@@ -568,8 +538,7 @@ void output::checkEventsLoop() {
 		if ((*data).HasKey(CMD_KEY)) {
 			command = (*data)[CMD_KEY].ToString();
 		} else {
-			glass3::util::Logger::log(
-					"warning",
+			GLASS3_LOG_WARNING(
 					"output::checkEventsLoop(): Bad data object received from "
 					"getNextTrackingData(), no Cmd, skipping data.");
 
@@ -598,8 +567,7 @@ void output::checkEventsLoop() {
 		}
 	}
 
-	glass3::util::Logger::log("info",
-								"output::checkEventsLoop(): Stopped thread.");
+	GLASS3_LOG_INFO("output::checkEventsLoop(): Stopped thread.");
 
 	setWorkThreadsState(glass3::util::ThreadState::Stopped);
 
@@ -626,8 +594,7 @@ glass3::util::WorkState output::work() {
 						json::Object>(json::Object());
 				(*datarequest)[CMD_KEY] = "ReqSiteList";
 
-				glass3::util::Logger::log(
-						"debug", "output::work(): Requesting site list.");
+				GLASS3_LOG_DEBUG("output::work(): Requesting site list.");
 
 				// send the request to glasscore
 				getAssociator()->sendToAssociator(datarequest);
@@ -645,8 +612,7 @@ glass3::util::WorkState output::work() {
 	// null check
 	if ((m_OutputQueue == NULL) || (m_LookupQueue == NULL)) {
 		// no message queues means we've got big problems
-		glass3::util::Logger::log(
-				"critical",
+		GLASS3_LOG_CRITICAL(
 				"output::work(): No m_OutputQueue and/or m_LookupQueue.");
 		return (glass3::util::WorkState::Error);
 	}
@@ -675,8 +641,7 @@ glass3::util::WorkState output::work() {
 	} else if (message->HasKey(TYPE_KEY)) {
 		messagetype = (*message)[TYPE_KEY].ToString();
 	} else {
-		glass3::util::Logger::log(
-				"critical",
+		GLASS3_LOG_CRITICAL(
 				"output::work(): BAD message: " + json::Serialize(*message)
 						+ " passed in, no Cmd/Type found.");
 		return (glass3::util::WorkState::OK);
@@ -700,15 +665,13 @@ glass3::util::WorkState output::work() {
 		std::shared_ptr<const json::Object> trackingData = getTrackingData(
 				messageid);
 		if (trackingData == NULL) {
-			glass3::util::Logger::log(
-					"critical",
+			GLASS3_LOG_CRITICAL(
 					"output::work(): NULL tracking data for Hypo: "
 							+ json::Serialize(*message));
 			return (glass3::util::WorkState::OK);
 		}
 
-		glass3::util::Logger::log(
-				"debug",
+		GLASS3_LOG_DEBUG(
 				"output::work(): Outputting a " + messagetype + " message"
 						+ " for " + messageid + " tracking: "
 						+ json::Serialize(*trackingData));
@@ -728,8 +691,7 @@ glass3::util::WorkState output::work() {
 		m_iHypoCounter++;
 	} else if (messagetype == "SiteList") {
 		// glass has a stationlist to write to disk
-		glass3::util::Logger::log(
-				"debug",
+		GLASS3_LOG_DEBUG(
 				"output::work(): Outputting a " + messagetype + " message.");
 
 		// write out the stationlist
@@ -748,8 +710,7 @@ glass3::util::WorkState output::work() {
 		// see if we've tracked this event
 		if (trackingData != NULL) {
 			// we have
-			glass3::util::Logger::log(
-					"debug",
+			GLASS3_LOG_DEBUG(
 					"output::work(): Canceling event " + messageid
 							+ " and removing it from tracking.");
 
@@ -761,8 +722,7 @@ glass3::util::WorkState output::work() {
 				if (!((*message).HasKey(TYPE_KEY)))
 					(*message)[TYPE_KEY] = messagetype;
 
-				glass3::util::Logger::log(
-						"debug",
+				GLASS3_LOG_DEBUG(
 						"output::work(): Generating retraction message for"
 								" published event " + messageid + ".");
 
@@ -782,8 +742,7 @@ glass3::util::WorkState output::work() {
 		if (trackingData != NULL) {
 			// we have
 			// glass has expired an event we have tracked
-			glass3::util::Logger::log(
-					"debug",
+			GLASS3_LOG_DEBUG(
 					"output::work(): Expiring event " + messageid
 							+ " and removing it from tracking.");
 
@@ -810,8 +769,7 @@ glass3::util::WorkState output::work() {
 						(*hypo)["IsUpdate"] = false;
 					}
 
-					glass3::util::Logger::log(
-							"debug",
+					GLASS3_LOG_DEBUG(
 							"output::work(): Writing final hypo for expiring event "
 									+ messageid);
 
@@ -828,16 +786,14 @@ glass3::util::WorkState output::work() {
 		m_iExpireCounter++;
 	} else if (messagetype == "SiteLookup") {
 		// station info request
-		glass3::util::Logger::log(
-				"debug", "output::work(): Writing site lookup message");
+		GLASS3_LOG_DEBUG("output::work(): Writing site lookup message");
 		// output immediately
 		writeOutput(message);
 
 		m_iLookupCounter++;
 	} else {
 		// got some other message
-		glass3::util::Logger::log(
-				"warning",
+		GLASS3_LOG_WARNING(
 				"output::work(): Unknown message from glasslib: "
 						+ json::Serialize(*message) + ".");
 	}
@@ -845,16 +801,14 @@ glass3::util::WorkState output::work() {
 	// reporting
 	if ((tNow - tLastWorkReport) >= getReportInterval()) {
 		if (m_iMessageCounter == 0)
-			glass3::util::Logger::log(
-					"warning",
+			GLASS3_LOG_WARNING(
 					"output::work(): Received NO messages from associator "
 							"thread in "
 							+ std::to_string(
 									static_cast<int>(tNow) - tLastWorkReport)
 							+ " seconds.");
 		else
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"output::work(): Received "
 							+ std::to_string(m_iMessageCounter)
 							+ " messages from associator thread (events: "
@@ -890,8 +844,7 @@ glass3::util::WorkState output::work() {
 // ---------------------------------------------------------writeOutput
 void output::writeOutput(std::shared_ptr<json::Object> data) {
 	if (data == NULL) {
-		glass3::util::Logger::log(
-				"error", "output::writeoutput(): Null json object passed in.");
+		GLASS3_LOG_ERROR("output::writeoutput(): Null json object passed in.");
 		return;
 	}
 
@@ -948,23 +901,20 @@ void output::writeOutput(std::shared_ptr<json::Object> data) {
 // ---------------------------------------------------------isDataReady
 bool output::isDataReady(std::shared_ptr<const json::Object> data) {
 	if (data == NULL) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"output::isdataready(): Null tracking object passed in.");
 		return (false);
 	}
 
 	if (!(data->HasKey(CMD_KEY))) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"output::isdataready(): Bad tracking object passed in, "
 						" missing cmd: " + json::Serialize(*data));
 		return (false);
 	} else if ((!(data->HasKey(PUBLOG_KEY)))
 			|| (!(data->HasKey(VERSION_KEY)))
 			|| (!(data->HasKey(BAYES_KEY)))) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"output::isdataready(): Bad tracking object passed in, "
 						" missing PubLog, Bayes or Version:" + json::Serialize(*data));
 		return (false);
@@ -1011,8 +961,7 @@ bool output::isDataReady(std::shared_ptr<const json::Object> data) {
 			if (currentBayes >= getImmediatePubThreshold()) {
 				// it does,
 				// log what we're doing
-				glass3::util::Logger::log(
-					"debug",
+				GLASS3_LOG_DEBUG(
 					"output::isdataready(): Immediately Publishing Event: " + id
 							+ " version: " + std::to_string(currentVersion)
 							+ " tNow: " + std::to_string(static_cast<int>(tNow))
@@ -1028,8 +977,7 @@ bool output::isDataReady(std::shared_ptr<const json::Object> data) {
 				(*newData)[PUBLOG_KEY] = pubLog;
 				m_TrackingCache->addToCache(newData, id);
 
-				glass3::util::Logger::log(
-				"debug",
+				GLASS3_LOG_DEBUG(
 				"output::isDataReady(): Updated data after immediate pub: "
 						+ json::Serialize(*m_TrackingCache->getFromCache(id)));
 
@@ -1082,8 +1030,7 @@ bool output::isDataReady(std::shared_ptr<const json::Object> data) {
 
 		// depending on whether this version has already been changed
 		if (changed == true) {
-			glass3::util::Logger::log(
-					"debug",
+			GLASS3_LOG_DEBUG(
 					"output::isdataready(): Publishing Event: " + id
 							+ "; (pub #" + std::to_string(timeIndex + 1) + ")"
 							+ " version: " + std::to_string(currentVersion)
@@ -1095,23 +1042,20 @@ bool output::isDataReady(std::shared_ptr<const json::Object> data) {
 							+ " getPubTimes()[i]: "
 							+ std::to_string(pubTime) + ")");
 
-			glass3::util::Logger::log(
-				"debug",
+			GLASS3_LOG_DEBUG(
 				"output::isDataReady(): Updated data after pub: "
 						+ json::Serialize(*m_TrackingCache->getFromCache(id)));
 
 			// ready to publish
 			return (true);
 		} else {
-			glass3::util::Logger::log(
-					"debug",
+			GLASS3_LOG_DEBUG(
 					"output::isdataready(): Skipping Publishing Event: " + id
 							+ "; (pub #" + std::to_string(timeIndex + 1) + ")"
 							+ " version: " + std::to_string(currentVersion)
 							+ "; because the version has not changed since the last pub.");
 
-			glass3::util::Logger::log(
-				"debug",
+			GLASS3_LOG_DEBUG(
 				"output::isDataReady(): Updated data after skip: "
 						+ json::Serialize(*m_TrackingCache->getFromCache(id)));
 
@@ -1127,22 +1071,19 @@ bool output::isDataReady(std::shared_ptr<const json::Object> data) {
 // ---------------------------------------------------------isDataChanged
 bool output::isDataChanged(std::shared_ptr<const json::Object> data) {
 	if (data == NULL) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"output::isDataChanged(): Null tracking object passed in.");
 		return (false);
 	}
 
 	if (!(data->HasKey(CMD_KEY))) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"output::isDataChanged(): Bad tracking object passed in, "
 						" missing cmd: " + json::Serialize(*data));
 		return (false);
 	} else if ((!(data->HasKey(PUBLOG_KEY)))
 			|| (!(data->HasKey(VERSION_KEY)))) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"output::isDataChanged(): Bad tracking object passed in, "
 						" missing PubLog or Version:" + json::Serialize(*data));
 		return (false);
@@ -1174,16 +1115,14 @@ bool output::isDataChanged(std::shared_ptr<const json::Object> data) {
 bool output::isDataPublished(std::shared_ptr<const json::Object> data,
 								bool ignoreVersion) {
 	if (data == NULL) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"output::isDataPublished(): Null json data object passed in.");
 		return (false);
 	}
 
 	if ((!(data->HasKey(CMD_KEY))) || (!(data->HasKey(PUBLOG_KEY)))
 			|| (!(data->HasKey(VERSION_KEY)))) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"output::isDataPublished(): Bad json hypo object passed in "
 						" missing Cmd, PubLog or Version "
 						+ json::Serialize(*data));
@@ -1225,16 +1164,14 @@ bool output::isDataPublished(std::shared_ptr<const json::Object> data,
 // ---------------------------------------------------------isDataFinished
 bool output::isDataFinished(std::shared_ptr<const json::Object> data) {
 	if (data == NULL) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"output::isDataFinished(): Null json data object passed in.");
 		return (false);
 	}
 
 	if ((!(data->HasKey(CMD_KEY))) || (!(data->HasKey(PUBLOG_KEY)))
 			|| (!(data->HasKey(VERSION_KEY)))) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"output::isDataFinished(): Bad json hypo object passed in "
 						" missing Cmd, PubLog or Version "
 						+ json::Serialize(*data));
@@ -62,6 +62,10 @@ class JSONParser : public glass3::parse::Parser {
 	 * returned as a shared_ptr for  use in other neic-glass3 functions and
 	 * classes (such as glasscore).
 	 *
+	 * The validated message is converted directly from the detection formats
+	 * document into the SuperEasyJSON object, without serializing it to a
+	 * string and parsing it a second time.
+	 *
 	 * \param input - The json formatted std::string to parse
 	 * \return Returns a shared_ptr to the json::Object containing
 	 * the data.
@@ -6,9 +6,50 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <climits>
 
 namespace glass3 {
 namespace parse {
+
+// converts a rapidjson value into a SuperEasyJSON value, typing numbers the
+// way json::Deserialize() would have typed rapidjson's serialized output
+static json::Value convertRapidJSONValue(const rapidjson::Value &value) {
+	if (value.IsObject()) {
+		json::Object object;
+		for (rapidjson::Value::ConstMemberIterator member = value.MemberBegin();
+				member != value.MemberEnd(); ++member) {
+			object[std::string(member->name.GetString(),
+								member->name.GetStringLength())] =
+					convertRapidJSONValue(member->value);
+		}
+		return (json::Value(object));
+	} else if (value.IsArray()) {
+		json::Array array;
+		for (rapidjson::Value::ConstValueIterator element = value.Begin();
+				element != value.End(); ++element) {
+			array.push_back(convertRapidJSONValue(*element));
+		}
+		return (json::Value(array));
+	} else if (value.IsString()) {
+		return (json::Value(
+				std::string(value.GetString(), value.GetStringLength())));
+	} else if (value.IsBool()) {
+		return (json::Value(value.GetBool()));
+	} else if (value.IsDouble()) {
+		return (json::Value(value.GetDouble()));
+	} else if (value.IsNumber()) {
+		// integers that do not fit in an int are stored as doubles
+		double number = value.GetDouble();
+		if ((number >= static_cast<double>(INT_MIN))
+				&& (number <= static_cast<double>(INT_MAX))) {
+			return (json::Value(static_cast<int>(number)));
+		}
+		return (json::Value(number));
+	}
+
+	// null
+	return (json::Value());
+}
 // -------------------------------------------------------------------JSONParser
 JSONParser::JSONParser(const std::string &defaultAgencyID,
 						const std::string &defaultAuthor)
@@ -32,7 +73,6 @@ std::shared_ptr<json::Object> JSONParser::parse(const std::string &input) {
 	// Note: Detection formats does not provide generic parsing or validation
 	// functions. This makes this function more awkward than it could be.
 	rapidjson::Document detectionDocument;
-	std::string jsonString = "";
 
 	// get the message type from detection formats
 	int messageType = detectionformats::GetDetectionType(input);
@@ -50,11 +90,8 @@ std::shared_ptr<json::Object> JSONParser::parse(const std::string &input) {
 			return (NULL);
 		}
 
-		// since detection formats and glass3 use different json libraries,
-		// take the parsed and validated message back out to a string
-		jsonString = detectionformats::ToJSONString(
-				newPick.tojson(detectionDocument,
-								detectionDocument.GetAllocator()));
+		// take the parsed and validated message back out to the document
+		newPick.tojson(detectionDocument, detectionDocument.GetAllocator());
 	} else if (messageType == detectionformats::correlationtype) {
 		// convert to detectionformats::correlation
 		detectionformats::correlation newCorrelation(
@@ -67,11 +104,8 @@ std::shared_ptr<json::Object> JSONParser::parse(const std::string &input) {
 			return (NULL);
 		}
 
-		// since detection formats and glass3 use different json libraries,
-		// take the parsed and validated message back out to a string
-		jsonString = detectionformats::ToJSONString(
-				newCorrelation.tojson(detectionDocument,
-										detectionDocument.GetAllocator()));
+		// take the parsed and validated message back out to the document
+		newCorrelation.tojson(detectionDocument, detectionDocument.GetAllocator());
 	} else if (messageType == detectionformats::detectiontype) {
 		// convert to detectionformats::detection
 		detectionformats::detection newDetection(
@@ -84,11 +118,8 @@ std::shared_ptr<json::Object> JSONParser::parse(const std::string &input) {
 			return (NULL);
 		}
 
-		// since detection formats and glass3 use different json libraries,
-		// take the parsed and validated message back out to a string
-		jsonString = detectionformats::ToJSONString(
-				newDetection.tojson(detectionDocument,
-									detectionDocument.GetAllocator()));
+		// take the parsed and validated message back out to the document
+		newDetection.tojson(detectionDocument, detectionDocument.GetAllocator());
 	} else if (messageType == detectionformats::stationinfotype) {
 		// convert to detectionformats::stationInfo
 		detectionformats::stationInfo newStation(
@@ -116,44 +147,34 @@ std::shared_ptr<json::Object> JSONParser::parse(const std::string &input) {
 			}
 		}
 
-		// since detection formats and glass3 use different json libraries,
-		// take the parsed and validated message back out to a string
-		jsonString = detectionformats::ToJSONString(
-				newStation.tojson(detectionDocument,
-									detectionDocument.GetAllocator()));
+		// take the parsed and validated message back out to the document
+		newStation.tojson(detectionDocument, detectionDocument.GetAllocator());
 	} else {
 		// we don't recognize this type
 		return (NULL);
 	}
 
-	// convert the string to glass3's json library (SuperEasyJSON)
-	try {
-		// Convert into a SuperEasyJSON value object
-		json::Value deserializedValue = json::Deserialize(jsonString);
-
-		// make sure we got a valid json value object
-		if (deserializedValue.GetType() != json::ValueType::NULLVal) {
-			// create a shared pointer to the JSON object
-			std::shared_ptr<json::Object> newObject = std::make_shared<
-					json::Object>(json::Object(deserializedValue.ToObject()));
-
-			glass3::util::Logger::log(
-					"trace",
-					"JSONParser::parse: Output JSON: "
-							+ json::Serialize(*newObject) + ".");
-
-			return (newObject);
-		}
-	} catch (const std::runtime_error &e) {
-		// oopse
-		std::string exceptionstring = e.what();
+	// since detection formats and glass3 use different json libraries,
+	// convert the validated document directly to glass3's json library
+	// (SuperEasyJSON), rather than serializing it to a string and parsing
+	// that string again
+	if (detectionDocument.IsObject() == false) {
 		glass3::util::Logger::log(
-				"error",
-				"jsonparser::parse: json::Deserialize encountered error "
-						+ exceptionstring + ", returning.");
+				"error", "jsonparser::parse: validated message is not an object, "
+				"returning.");
+		return (NULL);
 	}
 
-	return (NULL);
+	// create a shared pointer to the JSON object
+	std::shared_ptr<json::Object> newObject = std::make_shared<json::Object>(
+			convertRapidJSONValue(detectionDocument).ToObject());
+
+	glass3::util::Logger::log(
+			"trace",
+			"JSONParser::parse: Output JSON: " + json::Serialize(*newObject)
+					+ ".");
+
+	return (newObject);
 }
 }  // namespace parse
 }  // namespace glass3
@@ -1,9 +1,13 @@
 #include <logger.h>
 #include <jsonparser.h>
+#include <detection-formats.h>
 #include <gtest/gtest.h>
 
 #include <string>
 #include <memory>
+#include <vector>
+#include <chrono>
+#include <iostream>
 
 // Input detection data that should work.
 #define TESTDETECTIONSTRING "{\"Type\":\"Detection\",\"ID\":\"12GFH48776857\",\"Source\":{\"AgencyID\":\"US\",\"Author\":\"TestAuthor\"},\"Hypocenter\":{\"Latitude\":40.3344,\"Longitude\":-121.44,\"Depth\":32.44,\"Time\":\"2015-12-28T21:32:24.017Z\"},\"DetectionType\":\"New\",\"EventType\":\"earthquake\",\"Bayes\":2.65,\"MinimumDistance\":2.14,\"RMS\":3.8,\"Gap\":33.67,\"Data\":[{\"Type\":\"Pick\",\"ID\":\"12GFH48776857\",\"Site\":{\"Station\":\"BMN\",\"Network\":\"LB\",\"Channel\":\"HHZ\",\"Location\":\"01\"},\"Source\":{\"AgencyID\":\"US\",\"Author\":\"TestAuthor\"},\"Time\":\"2015-12-28T21:32:24.017Z\",\"Phase\":\"P\",\"Polarity\":\"up\",\"Onset\":\"questionable\",\"Picker\":\"manual\",\"Filter\":[{\"HighPass\":1.05,\"LowPass\":2.65}],\"Amplitude\":{\"Amplitude\":21.5,\"Period\":2.65,\"SNR\":3.8},\"AssociationInfo\":{\"Phase\":\"P\",\"Distance\":0.442559,\"Azimuth\":0.418479,\"Residual\":-0.025393,\"Sigma\":0.086333}},{\"Type\":\"Correlation\",\"ID\":\"12GFH48776857\",\"Site\":{\"Station\":\"BMN\",\"Network\":\"LB\",\"Channel\":\"HHZ\",\"Location\":\"01\"},\"Source\":{\"AgencyID\":\"US\",\"Author\":\"TestAuthor\"},\"Phase\":\"P\",\"Time\":\"2015-12-28T21:32:24.017Z\",\"Correlation\":2.65,\"Hypocenter\":{\"Latitude\":40.3344,\"Longitude\":-121.44,\"Depth\":32.44,\"Time\":\"2015-12-28T21:30:44.039Z\"},\"EventType\":\"earthquake\",\"Magnitude\":2.14,\"SNR\":3.8,\"ZScore\":33.67,\"DetectionThreshold\":1.5,\"ThresholdType\":\"minimum\",\"AssociationInfo\":{\"Phase\":\"P\",\"Distance\":0.442559,\"Azimuth\":0.418479,\"Residual\":-0.025393,\"Sigma\":0.086333}}]}" // NOLINT
@@ -32,6 +36,9 @@
 // Input station data that should fail, because it was not requested by glasstest.
 #define TESTOTHERSTATIONSTRING "{\"Elevation\":151.000000,\"Enable\":true,\"InformationRequestor\":{\"AgencyID\":\"NC\",\"Author\":\"NC-Glass\"},\"Latitude\":32.888901,\"Longitude\":-117.105103,\"Quality\":1.000000,\"Site\":{\"Channel\":\"BHZ\",\"Location\":\"--\",\"Network\":\"N4\",\"Station\":\"109E\"},\"Type\":\"StationInfo\",\"UseForTeleseismic\":true}" // NOLINT
 
+// number of picks parsed by the benchmark
+#define NUMBENCHMARKPICKS 20000
+
 // agency/m_Author for testing
 #define TESTAGENCYID "US"
 #define TESTAUTHOR "glasstest"
@@ -102,6 +109,76 @@ TEST_F(JSONParser, PickParsing) {
 
 	// check the pick
 	ASSERT_FALSE(PickObject == NULL)<< "Parsed pick not null.";
+
+	// check that values kept their types
+	ASSERT_STREQ("12GFH48776857", (*PickObject)["ID"].ToString().c_str())
+	<< "ID check";
+	ASSERT_EQ(json::ValueType::ObjectVal, (*PickObject)["Site"].GetType())
+	<< "Site type check";
+	ASSERT_EQ(json::ValueType::ArrayVal, (*PickObject)["Filter"].GetType())
+	<< "Filter type check";
+	ASSERT_EQ(2, static_cast<int>((*PickObject)["Filter"].ToArray().size()))
+	<< "Filter size check";
+	json::Object amplitude = (*PickObject)["Amplitude"].ToObject();
+	ASSERT_EQ(json::ValueType::DoubleVal, amplitude["Amplitude"].GetType())
+	<< "Amplitude type check";
+	ASSERT_DOUBLE_EQ(21.5, amplitude["Amplitude"].ToDouble())
+	<< "Amplitude check";
+}
+
+// benchmark pick parsing against a serialize and reparse round trip
+TEST_F(JSONParser, PickParsingBenchmark) {
+	glass3::util::Logger::disable();
+
+	// build a set of distinct picks
+	std::string pickstring = std::string(TESTPICKSTRING);
+	std::vector<std::string> picks;
+	size_t numBytes = 0;
+	for (int i = 0; i < NUMBENCHMARKPICKS; i++) {
+		std::string pick = pickstring;
+		pick.replace(pick.find("12GFH48776857"), 13, std::to_string(i));
+		picks.push_back(pick);
+		numBytes += pick.length();
+	}
+
+	// parse them with the parser
+	std::vector<std::shared_ptr<json::Object>> parsed;
+	parsed.reserve(NUMBENCHMARKPICKS);
+	auto start = std::chrono::steady_clock::now();
+	for (const std::string &pick : picks) {
+		parsed.push_back(m_Parser->parse(pick));
+	}
+	double parseSeconds = std::chrono::duration<double>(
+			std::chrono::steady_clock::now() - start).count();
+
+	// parse them by taking the validated message back out to a string, and
+	// deserializing that string
+	std::vector<json::Value> roundTrip;
+	roundTrip.reserve(NUMBENCHMARKPICKS);
+	start = std::chrono::steady_clock::now();
+	for (const std::string &pick : picks) {
+		rapidjson::Document document;
+		detectionformats::pick newPick(
+				detectionformats::FromJSONString(pick, document));
+		std::string jsonString = detectionformats::ToJSONString(
+				newPick.tojson(document, document.GetAllocator()));
+		roundTrip.push_back(json::Deserialize(jsonString));
+	}
+	double roundTripSeconds = std::chrono::duration<double>(
+			std::chrono::steady_clock::now() - start).count();
+
+	std::cout << "[ BENCH    ] " << NUMBENCHMARKPICKS << " picks, parser "
+				<< NUMBENCHMARKPICKS / parseSeconds << " picks/s ("
+				<< numBytes / parseSeconds / 1000000.0 << " MB/s), round trip "
+				<< NUMBENCHMARKPICKS / roundTripSeconds << " picks/s"
+				<< std::endl;
+
+	// both paths should produce the same messages
+	for (int i = 0; i < NUMBENCHMARKPICKS; i++) {
+		ASSERT_FALSE(parsed[i] == NULL)<< "Parsed pick not null.";
+		ASSERT_STREQ(json::Serialize(roundTrip[i]).c_str(),
+						json::Serialize(*parsed[i]).c_str())<< "Same pick.";
+	}
 }
 
 // test station
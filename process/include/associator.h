@@ -16,6 +16,7 @@
 #include <queue.h>
 #include <ctime>
 #include <memory>
+#include <vector>
 
 namespace glass3 {
 
@@ -117,13 +118,21 @@ class Associator : public glasscore::IGlassSend,
 	 */
 	bool healthCheck() override;
 
+	/**
+	 * \brief The maximum number of input data sent into glasscore per call to
+	 * work()
+	 */
+	static const int k_iInputBatchSize = 100;
+
  protected:
 	/**
 	 * \brief associator work function
 	 *
 	 * The function (from threadclassbase) used to do work. For Associator,
 	 * this includes sending configuration, messages, and input data to the
-	 * glasscore library
+	 * glasscore library. All pending messages and up to k_iInputBatchSize
+	 * input data are retrieved under a single lock of their queues and sent
+	 * into glasscore per call
 	 *
 	 * \return returns true if work was successful, false otherwise.
 	 */
@@ -191,6 +200,18 @@ class Associator : public glasscore::IGlassSend,
 	 * output. Used to pass messages to output
 	 */
 	glass3::util::iOutput* m_Output;
+
+	/**
+	 * \brief The batch of messages retrieved from m_MessageQueue, kept between
+	 * calls to work() to reuse its storage
+	 */
+	std::vector<std::shared_ptr<json::Object>> m_vMessageBatch;
+
+	/**
+	 * \brief The batch of input data retrieved from m_Input, kept between
+	 * calls to work() to reuse its storage
+	 */
+	std::vector<std::shared_ptr<json::Object>> m_vInputDataBatch;
 };
 }  // namespace process
 }  // namespace glass3
@@ -3,6 +3,7 @@
 #include <ctime>
 #include <string>
 #include <memory>
+#include <vector>
 #include <Glass.h>
 #include <HypoList.h>
 #include <PickList.h>
@@ -10,12 +11,14 @@
 namespace glass3 {
 namespace process {
 
+// constants
+const int Associator::k_iInputBatchSize;
+
 // ---------------------------------------------------------Associator
 Associator::Associator(glass3::util::iInput* inputint,
 						glass3::util::iOutput* outputint)
 		: glass3::util::ThreadBaseClass("Associator") {
-	glass3::util::Logger::log(
-			"debug", "associator::associator(...): Advanced Construction.");
+	GLASS3_LOG_DEBUG("associator::associator(...): Advanced Construction.");
 
 	m_iInputCounter = 0;
 	m_iTotalInputCounter = 0;
@@ -28,6 +31,7 @@ Associator::Associator(glass3::util::iInput* inputint,
 	m_Input = inputint;
 	m_Output = outputint;
 	m_MessageQueue = new glass3::util::Queue();
+	m_MessageQueue->setWakeUpThread(this);
 
 	// hook up glass communication with Associator class
 	glasscore::CGlass::setExternalInterface(
@@ -56,14 +60,12 @@ Associator::~Associator() {
 // ---------------------------------------------------------setup
 bool Associator::setup(std::shared_ptr<const json::Object> config) {
 	if (m_Input == NULL) {
-		glass3::util::Logger::log(
-				"error", "associator::setup(): m_Input interface is NULL .");
+		GLASS3_LOG_ERROR("associator::setup(): m_Input interface is NULL .");
 		return (false);
 	}
 
 	if (m_Output == NULL) {
-		glass3::util::Logger::log(
-				"error", "associator::setup(): m_Output interface is NULL .");
+		GLASS3_LOG_ERROR("associator::setup(): m_Output interface is NULL .");
 		return (false);
 	}
 
@@ -72,16 +74,14 @@ bool Associator::setup(std::shared_ptr<const json::Object> config) {
 
 	// send the config to glass
 	glasscore::CGlass::receiveExternalMessage(pConfig);
-	glass3::util::Logger::log(
-			"debug", "associator::setup(): Done Passing in provided config.");
+	GLASS3_LOG_DEBUG("associator::setup(): Done Passing in provided config.");
 
 	return (true);
 }
 
 // ---------------------------------------------------------clear
 void Associator::clear() {
-	glass3::util::Logger::log("debug",
-								"associator::clear(): clearing configuration.");
+	GLASS3_LOG_DEBUG("associator::clear(): clearing configuration.");
 
 	// initialize default values in CGlass
 	glasscore::CGlass::clear();
@@ -97,8 +97,7 @@ void Associator::recieveGlassMessage(
 	ThreadBaseClass::setThreadHealth();
 
 	if (communication == NULL) {
-		glass3::util::Logger::log(
-				"critical", "associator::dispatch(): NULL message passed in.");
+		GLASS3_LOG_CRITICAL("associator::dispatch(): NULL message passed in.");
 		return;
 	}
 
@@ -106,8 +105,7 @@ void Associator::recieveGlassMessage(
 	if (m_Output != NULL) {
 		m_Output->sendToOutput(communication);
 	} else {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"associator::dispatch(): m_Output interface is NULL, nothing "
 				"to dispatch to.");
 		return;
@@ -135,32 +133,42 @@ glass3::util::WorkState Associator::work() {
 
 	// first check to see if we have any messages to send to glass
 	// is usually glass configuration or data requests (i.e. ReqHypo)
-	std::shared_ptr<json::Object> message = m_MessageQueue->getDataFromQueue();
+	m_vMessageBatch.clear();
+	m_MessageQueue->getDataBatchFromQueue(&m_vMessageBatch);
 
-	if (message != NULL) {
+	for (auto &message : m_vMessageBatch) {
 		// send the message into glass
 		glasscore::CGlass::receiveExternalMessage(message);
 	}
+	m_vMessageBatch.clear();
 
 	std::time_t tNow;
 	std::time(&tNow);
 
-	// now get the next input data from the input library,
-	// can be a pick, correlation, station, or detection
-	std::shared_ptr<json::Object> data = m_Input->getInputData();
+	// now get the next batch of input data from the input library,
+	// can be picks, correlations, stations, or detections
+	m_vInputDataBatch.clear();
+	int dataCount = m_Input->getInputDataBatch(&m_vInputDataBatch,
+												k_iInputBatchSize);
 
 	// was there anything
-	if (data != NULL) {
+	if (dataCount > 0) {
 		// glass can sort things out from here
 		// note that if this takes too long, we may need to adjust
-		// thread monitoring, or add a call to setworkcheck()
+		// thread monitoring, k_iInputBatchSize, or add a call to
+		// setworkcheck()
 		std::chrono::high_resolution_clock::time_point tGlassStartTime =
 				std::chrono::high_resolution_clock::now();
-		glasscore::CGlass::receiveExternalMessage(data);
+		for (auto &data : m_vInputDataBatch) {
+			glasscore::CGlass::receiveExternalMessage(data);
+		}
 		std::chrono::high_resolution_clock::time_point tGlassEndTime =
 				std::chrono::high_resolution_clock::now();
 
-		m_iInputCounter++;
+		// release the data now that glass has it
+		m_vInputDataBatch.clear();
+
+		m_iInputCounter += dataCount;
 
 		// keep track of the time we spent in glassland
 		tGlasscoreDuration += std::chrono::duration_cast<
@@ -176,8 +184,7 @@ glass3::util::WorkState Associator::work() {
 		double averageglasstime = tGlasscoreDuration.count() / m_iInputCounter;
 
 		if (m_iInputCounter == 0) {
-			glass3::util::Logger::log(
-					"warning",
+			GLASS3_LOG_WARNING(
 					"associator::work(): Sent NO data to glass in the last "
 							+ std::to_string(
 									static_cast<int>(tNow
@@ -211,8 +218,7 @@ glass3::util::WorkState Associator::work() {
 					/ m_iRunningAverageCounter;
 
 			// log the report
-			glass3::util::Logger::log(
-					"info",
+			GLASS3_LOG_INFO(
 					"Associator::work(): Sent "
 							+ std::to_string(m_iInputCounter)
 							+ " data to glasscore ("
@@ -237,12 +243,11 @@ glass3::util::WorkState Associator::work() {
 	}  // end if it is time to generate a performance report
 
 	// return idle if there was no data
-	if (data == NULL) {
+	if (dataCount <= 0) {
 		// no
 		return (glass3::util::WorkState::Idle);
 	}
 
-	// we only send in one item per work loop
 	// work was successful
 	return (glass3::util::WorkState::OK);
 }
@@ -252,8 +257,7 @@ bool Associator::healthCheck() {
 	// check glass
 	// check glass thread status
 	if (glasscore::CGlass::healthCheck() == false) {
-		glass3::util::Logger::log(
-				"error",
+		GLASS3_LOG_ERROR(
 				"Associator::statusCheck(): GlassLib statusCheck() returned false!.");
 		return (false);
 	}
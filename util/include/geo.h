@@ -174,7 +174,7 @@ class Geo {
 	 * \param geo - A pointer to the CGeo object to calculate distance to
 	 * \return Returns the distance in radians between the two CGeo objects.
 	 */
-	virtual double delta(Geo *geo);
+	virtual double delta(const Geo *geo) const;
 
 	/**
 	 * \brief Calculate the azimuth to a given CGeo object
@@ -185,7 +185,7 @@ class Geo {
 	 * \param geo - A pointer to the CGeo object to calculate azimuth to
 	 * \return Returns the azimuth in radians between the two CGeo objects.
 	 */
-	virtual double azimuth(Geo *geo);
+	virtual double azimuth(const Geo *geo) const;
 
 	/**
 	 * \brief the double value containing the geocentric latitude
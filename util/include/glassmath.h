@@ -7,7 +7,8 @@
 #ifndef GLASSMATH_H
 #define GLASSMATH_H
 
-#include <random>
+#include <randomengine.h>
+#include <cstdint>
 
 namespace glass3 {
 namespace util {
@@ -49,7 +50,8 @@ class GlassMath {
 	 *
 	 * Generates random number between x and y. This function is used by gauss
 	 * in determining the randomized step sizes for relocation (anneal and
-	 * localize)
+	 * localize). Draws come from the calling thread's own engine, so threads
+	 * never share generator state.
 	 *
 	 * \param x - The minimum random number
 	 * \param y - The maximum random number
@@ -57,6 +59,20 @@ class GlassMath {
 	 */
 	static double random(double x, double y);
 
+	/**
+	 * \brief Generate Random Number from a generator
+	 *
+	 * Generates random number between x and y using the provided random
+	 * engine instead of the calling thread's m_RandomGenerator, so that
+	 * callers that each own an engine can draw numbers reproducibly
+	 *
+	 * \param x - The minimum random number
+	 * \param y - The maximum random number
+	 * \param generator - A pointer to the RandomEngine to use
+	 * \return Returns the random sample
+	 */
+	static double random(double x, double y, RandomEngine *generator);
+
 	/**
 	 * \brief Calculate Gaussian random sample
 	 *
@@ -70,13 +86,38 @@ class GlassMath {
 	 */
 	static double gauss(double avg, double std);
 
+	/**
+	 * \brief Calculate Gaussian random sample from a generator
+	 *
+	 * Calculate random normal gaussian deviate value using Box-Muller method,
+	 * drawing from the provided random engine instead of the calling thread's
+	 * m_RandomGenerator
+	 *
+	 * \param avg - The mean average value to use in the Box-Muller method
+	 * \param std - The standard deviation value to use in the Box-Muller method
+	 * \param generator - A pointer to the RandomEngine to use
+	 * \return Returns the Gaussian random sample
+	 */
+	static double gauss(double avg, double std, RandomEngine *generator);
+
 	/**
 	 * \brief initialize random number generator
 	 *
-	 * Initializes the random number generator by seeding m_RandomGenerator.
+	 * Initializes the calling thread's random number generator by seeding
+	 * m_RandomGenerator nondeterministically, if it has not been seeded yet.
 	 */
 	static void initializeRandom();
 
+	/**
+	 * \brief seed random number generator
+	 *
+	 * Seeds the calling thread's random number generator, making the numbers
+	 * it draws from random() and gauss() repeatable.
+	 *
+	 * \param seed - The 64 bit seed to use
+	 */
+	static void seedRandom(uint64_t seed);
+
 	/**
 	 * \brief get angle difference between two angles
 	 *
@@ -111,14 +152,15 @@ class GlassMath {
 
  private:
 	/**
-	 * \brief A boolean flag to disable all logging
+	 * \brief A boolean flag indicating whether the calling thread's random
+	 * engine has been seeded
 	 */
-	static bool m_bInitialized;
+	static thread_local bool m_bInitialized;
 
 	/**
-	 * \brief The random engine for random()
+	 * \brief The calling thread's random engine for random()
 	 */
-	static std::default_random_engine m_RandomGenerator;
+	static thread_local RandomEngine m_RandomGenerator;
 };
 }  // namespace util
 }  // namespace glass3
@@ -0,0 +1,223 @@
+/*****************************************
+ * This file is documented for Doxygen.
+ * If you modify this file please update
+ * the comments so that Doxygen will still
+ * be able to work.
+ ****************************************/
+#ifndef INPLACEFUNCTION_H
+#define INPLACEFUNCTION_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace glass3 {
+namespace util {
+/**
+ * \brief glass3::util::InplaceFunction class
+ *
+ * The glass3::util::InplaceFunction class is a move only wrapper for a
+ * callable taking no arguments and returning nothing, used for the jobs run
+ * by glass3::util::ThreadPool.
+ *
+ * Unlike std::function, callables that fit in k_iInplaceSize bytes (function
+ * pointers, std::bind results, and lambdas with a few captures) are stored
+ * inside the InplaceFunction itself, so wrapping and moving them does not
+ * allocate. Larger callables fall back to a single heap allocation.
+ */
+class InplaceFunction {
+ public:
+	/**
+	 * \brief the size in bytes of the inline storage for callables
+	 */
+	static const int k_iInplaceSize = 64;
+
+	/**
+	 * \brief InplaceFunction constructor
+	 *
+	 * Constructs an empty InplaceFunction
+	 */
+	InplaceFunction();
+
+	/**
+	 * \brief InplaceFunction callable constructor
+	 *
+	 * Constructs an InplaceFunction wrapping a copy of, or moving from, the
+	 * provided callable, stored inline if it fits in k_iInplaceSize bytes
+	 *
+	 * \param function - The callable to wrap, callable as function()
+	 */
+	template<typename Function,
+			typename = typename std::enable_if<
+					!std::is_same<typename std::decay<Function>::type,
+							InplaceFunction>::value>::type>
+	InplaceFunction(Function &&function) {  // NOLINT(runtime/explicit)
+		typedef typename std::decay<Function>::type Callable;
+		typedef typename std::conditional<
+				(sizeof(Callable) <= static_cast<std::size_t>(k_iInplaceSize))
+						&& (alignof(Callable) <= alignof(std::max_align_t))
+						&& std::is_nothrow_move_constructible<Callable>::value,
+				InplaceOperations<Callable>, HeapOperations<Callable>>::type
+				Operations;
+
+		Operations::construct(&m_Storage, std::forward<Function>(function));
+		m_pInvoke = &Operations::invoke;
+		m_pMove = &Operations::move;
+		m_pDestroy = &Operations::destroy;
+		m_bInplace = Operations::k_bInplace;
+	}
+
+	/**
+	 * \brief InplaceFunction move constructor
+	 *
+	 * Takes the callable from other, leaving other empty
+	 *
+	 * \param other - The InplaceFunction to move from
+	 */
+	InplaceFunction(InplaceFunction &&other) noexcept;
+
+	/**
+	 * \brief InplaceFunction move assignment
+	 *
+	 * Destroys any current callable and takes the callable from other,
+	 * leaving other empty
+	 *
+	 * \param other - The InplaceFunction to move from
+	 * \return Returns a reference to this InplaceFunction
+	 */
+	InplaceFunction & operator=(InplaceFunction &&other) noexcept;
+
+	/**
+	 * \brief InplaceFunction destructor
+	 *
+	 * Destroys the wrapped callable, if any
+	 */
+	~InplaceFunction();
+
+	InplaceFunction(const InplaceFunction &) = delete;
+	InplaceFunction & operator=(const InplaceFunction &) = delete;
+
+	/**
+	 * \brief Calls the wrapped callable
+	 *
+	 * Calls the wrapped callable, does nothing if empty
+	 */
+	void operator()();
+
+	/**
+	 * \brief Checks whether a callable is wrapped
+	 *
+	 * \return Returns true if a callable is wrapped, false if empty
+	 */
+	explicit operator bool() const;
+
+	/**
+	 * \brief Checks whether the callable is stored inline
+	 *
+	 * \return Returns true if the wrapped callable is stored in the inline
+	 * storage, false if it is on the heap or there is no callable
+	 */
+	bool isInplace() const;
+
+	/**
+	 * \brief Destroys the wrapped callable
+	 *
+	 * Destroys the wrapped callable, if any, leaving this InplaceFunction
+	 * empty
+	 */
+	void clear();
+
+ private:
+	/**
+	 * \brief the storage for the callable, or for a pointer to it when it is
+	 * on the heap
+	 */
+	typedef typename std::aligned_storage<k_iInplaceSize,
+			alignof(std::max_align_t)>::type Storage;
+
+	/**
+	 * \brief the operations for a callable stored inline
+	 */
+	template<typename Callable>
+	struct InplaceOperations {
+		static const bool k_bInplace = true;
+
+		template<typename Function>
+		static void construct(Storage *storage, Function &&function) {
+			new (storage) Callable(std::forward<Function>(function));
+		}
+
+		static void invoke(Storage *storage) {
+			(*reinterpret_cast<Callable *>(storage))();
+		}
+
+		static void move(Storage *from, Storage *to) {
+			Callable *callable = reinterpret_cast<Callable *>(from);
+			new (to) Callable(std::move(*callable));
+			callable->~Callable();
+		}
+
+		static void destroy(Storage *storage) {
+			reinterpret_cast<Callable *>(storage)->~Callable();
+		}
+	};
+
+	/**
+	 * \brief the operations for a callable stored on the heap
+	 */
+	template<typename Callable>
+	struct HeapOperations {
+		static const bool k_bInplace = false;
+
+		template<typename Function>
+		static void construct(Storage *storage, Function &&function) {
+			*reinterpret_cast<Callable **>(storage) = new Callable(
+					std::forward<Function>(function));
+		}
+
+		static void invoke(Storage *storage) {
+			(**reinterpret_cast<Callable **>(storage))();
+		}
+
+		static void move(Storage *from, Storage *to) {
+			*reinterpret_cast<Callable **>(to) =
+					*reinterpret_cast<Callable **>(from);
+		}
+
+		static void destroy(Storage *storage) {
+			delete (*reinterpret_cast<Callable **>(storage));
+		}
+	};
+
+	/**
+	 * \brief the storage for the wrapped callable
+	 */
+	Storage m_Storage;
+
+	/**
+	 * \brief pointer to the function that calls the wrapped callable, NULL
+	 * if empty
+	 */
+	void (*m_pInvoke)(Storage *storage);
+
+	/**
+	 * \brief pointer to the function that moves the wrapped callable between
+	 * storages
+	 */
+	void (*m_pMove)(Storage *from, Storage *to);
+
+	/**
+	 * \brief pointer to the function that destroys the wrapped callable
+	 */
+	void (*m_pDestroy)(Storage *storage);
+
+	/**
+	 * \brief boolean flag indicating whether the wrapped callable is stored
+	 * inline
+	 */
+	bool m_bInplace;
+};
+}  // namespace util
+}  // namespace glass3
+#endif  // INPLACEFUNCTION_H
@@ -9,6 +9,7 @@
 
 #include <json.h>
 #include <memory>
+#include <vector>
 
 namespace glass3 {
 namespace util {
@@ -21,8 +22,9 @@ namespace util {
  * The iInput interface is a class interface implemented by class that
  * manages an input source for neic-glass three (such as an input file directory
  * or a HazDevBroker topic). This interface provides a method for other classes
- * in neic-glass3 to retrieve input messages via the getdata() function, and a
- * method for querying the pending data via the dataCount() function.
+ * in neic-glass3 to retrieve input messages via the getInputData() and
+ * getInputDataBatch() functions, and a method for querying the pending data via
+ * the getInputDataCount() function.
  */
 class iInput {
  public:
@@ -37,6 +39,23 @@ class iInput {
 	 */
 	virtual std::shared_ptr<json::Object> getInputData() = 0;
 
+	/**
+	 * \brief Get a batch of input data
+	 *
+	 * This pure virtual function is implemented by a class to support retrieving
+	 * several input data managed by the class at once, in order.
+	 *
+	 * \param dataBatch - A pointer to the std::vector to append the input data
+	 * to
+	 * \param maxCount - An integer containing the maximum number of input data
+	 * to retrieve, -1 to retrieve all of the pending input data
+	 * \return Returns an integer value containing the number of input data
+	 * appended to dataBatch
+	 */
+	virtual int getInputDataBatch(
+			std::vector<std::shared_ptr<json::Object>> *dataBatch,
+			int maxCount) = 0;
+
 	/**
 	 * \brief Get count of remaining input data
 	 *
@@ -0,0 +1,187 @@
+/*****************************************
+ * This file is documented for Doxygen.
+ * If you modify this file please update
+ * the comments so that Doxygen will still
+ * be able to work.
+ ****************************************/
+#ifndef INTERNEDID_H
+#define INTERNEDID_H
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace glass3 {
+namespace util {
+// forward declarations
+struct _InternEntry;
+
+/**
+ * \brief glass3::util::InternedID class
+ *
+ * The glass3::util::InternedID class holds an identifier string (a pick,
+ * hypo, or correlation id, or a site scnl) interned in a process-wide table
+ * that maps each distinct string to a dense integer handle. Every
+ * InternedID for the same string shares the single copy of the string in
+ * the table, and compares and hashes by handle, so internal containers can
+ * be keyed by the integer handle instead of the string.
+ *
+ * Table entries are reference counted by the InternedIDs holding them, and
+ * an entry is removed and its handle reused once the last InternedID for
+ * its string is gone, so the table only holds the ids in use. A handle is
+ * only unique while an InternedID holds it, so containers should not keep
+ * bare handles longer than the InternedIDs they came from.
+ *
+ * Copying, moving, and destroying an InternedID only touches the atomic
+ * reference count of its entry. The table is split into shards by string
+ * hash, and a shard is only locked to look up, add, or remove a string.
+ *
+ * The empty string is never stored, and always has the handle
+ * k_iEmptyHandle.
+ */
+class InternedID {
+ public:
+	/**
+	 * \brief the handle of the empty string
+	 */
+	static const unsigned int k_iEmptyHandle = 0;
+
+	/**
+	 * \brief InternedID constructor
+	 *
+	 * Constructs an InternedID holding the empty string
+	 */
+	InternedID();
+
+	/**
+	 * \brief InternedID string constructor
+	 *
+	 * Constructs an InternedID holding the provided string, adding it to the
+	 * table if it is not already there
+	 *
+	 * \param id - A std::string containing the identifier to hold
+	 */
+	explicit InternedID(const std::string &id);
+
+	/**
+	 * \brief InternedID copy constructor
+	 * \param other - The InternedID to copy
+	 */
+	InternedID(const InternedID &other);
+
+	/**
+	 * \brief InternedID move constructor
+	 * \param other - The InternedID to move from, left holding the empty
+	 * string
+	 */
+	InternedID(InternedID &&other) noexcept;
+
+	/**
+	 * \brief InternedID copy assignment operator
+	 * \param other - The InternedID to copy
+	 * \return Returns a reference to this InternedID
+	 */
+	InternedID & operator=(const InternedID &other);
+
+	/**
+	 * \brief InternedID move assignment operator
+	 * \param other - The InternedID to move from, left holding the empty
+	 * string
+	 * \return Returns a reference to this InternedID
+	 */
+	InternedID & operator=(InternedID &&other) noexcept;
+
+	/**
+	 * \brief InternedID destructor
+	 *
+	 * Releases the table entry, removing it if this was the last InternedID
+	 * holding its string
+	 */
+	~InternedID();
+
+	/**
+	 * \brief Get the identifier string
+	 * \return Returns a reference to the std::string held, valid as long as
+	 * this InternedID holds it
+	 */
+	const std::string & getString() const;
+
+	/**
+	 * \brief Get the handle
+	 * \return Returns an unsigned integer containing the handle of the
+	 * string held, unique among the strings currently in the table, and
+	 * reused for another string once no InternedID holds this one
+	 */
+	unsigned int getHandle() const;
+
+	/**
+	 * \brief Find the handle of a string without interning it
+	 * \param id - A std::string containing the identifier to find
+	 * \return Returns an unsigned integer containing the handle of the
+	 * string if it is held by any InternedID, k_iEmptyHandle otherwise
+	 */
+	static unsigned int findHandle(const std::string &id);
+
+	/**
+	 * \brief Get the number of strings in the table
+	 * \return Returns an integer containing the number of distinct strings
+	 * currently held by InternedIDs
+	 */
+	static int getTableSize();
+
+	/**
+	 * \brief InternedID equality operator
+	 * \param other - The InternedID to compare to
+	 * \return Returns true if both hold the same string
+	 */
+	bool operator==(const InternedID &other) const {
+		return (m_iHandle == other.m_iHandle);
+	}
+
+	/**
+	 * \brief InternedID inequality operator
+	 * \param other - The InternedID to compare to
+	 * \return Returns true if the InternedIDs hold different strings
+	 */
+	bool operator!=(const InternedID &other) const {
+		return (m_iHandle != other.m_iHandle);
+	}
+
+ private:
+	/**
+	 * \brief Release the table entry held, leaving this InternedID holding
+	 * the empty string
+	 */
+	void release();
+
+	/**
+	 * \brief A pointer to the table entry held, NULL for the empty string
+	 */
+	struct _InternEntry * m_pEntry;
+
+	/**
+	 * \brief the handle of the string held
+	 */
+	unsigned int m_iHandle;
+
+	/**
+	 * \brief A pointer to the table's copy of the string held
+	 */
+	const std::string * m_pString;
+};
+}  // namespace util
+}  // namespace glass3
+
+namespace std {
+/**
+ * \brief std::hash specialization for glass3::util::InternedID, hashing the
+ * handle
+ */
+template<>
+struct hash<glass3::util::InternedID> {
+	std::size_t operator()(const glass3::util::InternedID &id) const {
+		return (std::hash<unsigned int>()(id.getHandle()));
+	}
+};
+}  // namespace std
+#endif  // INTERNEDID_H
@@ -18,8 +18,69 @@
 #define LOGGER_H
 
 #include <spdlog.h>
+#include <atomic>
+#include <cstdio>
 #include <string>
 
+/**
+ * \brief The lowest logging level compiled into the GLASS3_LOG macros, as a
+ * spdlog::level::level_enum value (0 trace, 1 debug, 2 info, 3 warning,
+ * 4 error, 5 critical). Messages below this level are removed by the
+ * compiler, including building them. Defaults to keeping every level, so
+ * only the run time level applies.
+ */
+#ifndef GLASS3_LOG_COMPILE_LEVEL
+#define GLASS3_LOG_COMPILE_LEVEL 0
+#endif
+
+/**
+ * \brief Log a message at the given spdlog::level::level_enum level, the
+ * message expression is only evaluated if the level is compiled in and
+ * currently enabled
+ */
+#define GLASS3_LOG(level, ...) \
+	do { \
+		if (((level) >= GLASS3_LOG_COMPILE_LEVEL) \
+				&& (glass3::util::Logger::isLevelEnabled(level))) { \
+			glass3::util::Logger::log((level), (__VA_ARGS__)); \
+		} \
+	} while (0)
+
+/**
+ * \brief Log a printf style message at the given spdlog::level::level_enum
+ * level, the message is only formatted if the level is compiled in and
+ * currently enabled. The message is truncated to
+ * glass3::util::Logger::k_nMaxLogEntrySize characters.
+ */
+#define GLASS3_LOG_FORMAT(level, ...) \
+	do { \
+		if (((level) >= GLASS3_LOG_COMPILE_LEVEL) \
+				&& (glass3::util::Logger::isLevelEnabled(level))) { \
+			char glass3LogEntry[glass3::util::Logger::k_nMaxLogEntrySize]; \
+			snprintf(glass3LogEntry, sizeof(glass3LogEntry), __VA_ARGS__); \
+			glass3::util::Logger::log((level), std::string(glass3LogEntry)); \
+		} \
+	} while (0)
+
+/**
+ * \brief Level specific versions of GLASS3_LOG and GLASS3_LOG_FORMAT
+ */
+#define GLASS3_LOG_TRACE(...) GLASS3_LOG(spdlog::level::trace, __VA_ARGS__)
+#define GLASS3_LOG_DEBUG(...) GLASS3_LOG(spdlog::level::debug, __VA_ARGS__)
+#define GLASS3_LOG_INFO(...) GLASS3_LOG(spdlog::level::info, __VA_ARGS__)
+#define GLASS3_LOG_WARNING(...) GLASS3_LOG(spdlog::level::warn, __VA_ARGS__)
+#define GLASS3_LOG_ERROR(...) GLASS3_LOG(spdlog::level::err, __VA_ARGS__)
+#define GLASS3_LOG_CRITICAL(...) \
+	GLASS3_LOG(spdlog::level::critical, __VA_ARGS__)
+#define GLASS3_LOG_DEBUG_FORMAT(...) \
+	GLASS3_LOG_FORMAT(spdlog::level::debug, __VA_ARGS__)
+#define GLASS3_LOG_INFO_FORMAT(...) \
+	GLASS3_LOG_FORMAT(spdlog::level::info, __VA_ARGS__)
+#define GLASS3_LOG_WARNING_FORMAT(...) \
+	GLASS3_LOG_FORMAT(spdlog::level::warn, __VA_ARGS__)
+#define GLASS3_LOG_ERROR_FORMAT(...) \
+	GLASS3_LOG_FORMAT(spdlog::level::err, __VA_ARGS__)
+
 namespace glass3 {
 namespace util {
 
@@ -166,6 +227,34 @@ class Logger {
 	 */
 	static void log(const std::string &level, const std::string &message);
 
+	/**
+	 * \brief log a message
+	 *
+	 * Log a message with the provided level, without looking the level up
+	 * from a string. Used by the GLASS3_LOG macros.
+	 *
+	 * \param level - A spdlog::level::level_enum containing the log level
+	 * \param message - A std::string representing the message to log.
+	 */
+	static void log(spdlog::level::level_enum level,
+					const std::string &message);
+
+	/**
+	 * \brief check whether a level is being logged
+	 *
+	 * Checks the provided level against the current minimum logging level,
+	 * without locking, so callers can skip building messages nobody will
+	 * read. Nothing is logged before log_init() or while logging is
+	 * disabled.
+	 *
+	 * \param level - A spdlog::level::level_enum containing the log level
+	 * \return Returns true if messages at level are logged, false otherwise
+	 */
+	static bool isLevelEnabled(spdlog::level::level_enum level) {
+		return ((m_bDisable == false)
+				&& (level >= m_iLogLevel.load(std::memory_order_relaxed)));
+	}
+
 	/**
 	 * \brief log a message at info level
 	 *
@@ -225,6 +314,12 @@ class Logger {
 	 */
 	static bool m_bDisable;
 
+	/**
+	 * \brief The current minimum logging level, as a
+	 * spdlog::level::level_enum value, spdlog::level::off until log_init()
+	 */
+	static std::atomic<int> m_iLogLevel;
+
 	// constants
 	/**
 	 * \brief The maximum size of a constructed (via sprintf) log entry
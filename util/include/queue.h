@@ -10,13 +10,17 @@
 #include <baseclass.h>
 #include <json.h>
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <queue>
+#include <vector>
 
 namespace glass3 {
 namespace util {
+class ThreadBaseClass;
+
 /**
  * \brief glass3::util::Queue class
  *
@@ -68,6 +72,21 @@ class Queue : public util::BaseClass {
 	 */
 	std::shared_ptr<json::Object> getDataFromQueue();
 
+	/**
+	 *\brief get a batch of data from Queue
+	 *
+	 * Get up to maxCount of the next data from the Queue, in order, under a
+	 * single lock of the Queue
+	 * \param dataBatch - A pointer to the std::vector to append the data to
+	 * \param maxCount - An integer containing the maximum number of data to
+	 * get, -1 to get all of the data in the Queue
+	 * \return returns an integer containing the number of data appended to
+	 * dataBatch
+	 */
+	int getDataBatchFromQueue(
+			std::vector<std::shared_ptr<json::Object>> *dataBatch,
+			int maxCount = -1);
+
 	/**
 	 *\brief get the size of the Queue
 	 *
@@ -77,6 +96,17 @@ class Queue : public util::BaseClass {
 	 */
 	int size();
 
+	/**
+	 *\brief set the thread to wake when data is added
+	 *
+	 * Set the work thread that consumes this Queue, so that addDataToQueue()
+	 * can wake it rather than leaving it to notice the new data after its
+	 * sleep time
+	 * \param wakeUpThread - A pointer to the consuming
+	 * glass3::util::ThreadBaseClass, NULL to disable waking
+	 */
+	void setWakeUpThread(ThreadBaseClass * wakeUpThread);
+
  private:
 	/**
 	 * \brief the std::Queue used to store the Queue
@@ -93,6 +123,12 @@ class Queue : public util::BaseClass {
 	 * \brief A mutex to control access to class members
 	 */
 	std::mutex m_Mutex;
+
+	/**
+	 * \brief A pointer to the glass3::util::ThreadBaseClass to wake when
+	 * data is added, NULL if none
+	 */
+	std::atomic<ThreadBaseClass *> m_pWakeUpThread;
 };
 }  // namespace util
 }  // namespace glass3
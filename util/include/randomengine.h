@@ -0,0 +1,138 @@
+/*****************************************
+ * This file is documented for Doxygen.
+ * If you modify this file please update
+ * the comments so that Doxygen will still
+ * be able to work.
+ ****************************************/
+#ifndef RANDOMENGINE_H
+#define RANDOMENGINE_H
+
+#include <cstdint>
+
+namespace glass3 {
+namespace util {
+/**
+ * \brief glass3::util::RandomEngine class
+ *
+ * The glass3::util::RandomEngine class is a small, fast pseudo-random number
+ * generator (xoshiro256**) with a 64 bit output and 256 bits of state,
+ * seeded from a single 64 bit value using splitmix64. It satisfies the
+ * standard UniformRandomBitGenerator requirements, so it can also be used
+ * with the std::random distributions.
+ *
+ * A RandomEngine is not thread safe; it is meant to be owned by a single
+ * thread or object (such as a hypo's locator), so that draws never contend
+ * and are repeatable for a given seed regardless of how threads interleave.
+ */
+class RandomEngine {
+ public:
+	/**
+	 * \brief the type of number generated
+	 */
+	typedef uint64_t result_type;
+
+	/**
+	 * \brief the seed used by the default constructor
+	 */
+	static const uint64_t k_DefaultSeed = 0x853c49e6748fea9bULL;
+
+	/**
+	 * \brief RandomEngine constructor
+	 *
+	 * Constructs a RandomEngine seeded with k_DefaultSeed
+	 */
+	RandomEngine();
+
+	/**
+	 * \brief RandomEngine seed constructor
+	 *
+	 * Constructs a RandomEngine seeded with the provided seed
+	 *
+	 * \param seed - The 64 bit seed to use
+	 */
+	explicit RandomEngine(uint64_t seed);
+
+	/**
+	 * \brief Seed the engine
+	 *
+	 * Resets the engine state from the provided seed, after which the engine
+	 * produces the same sequence as any other engine given the same seed
+	 *
+	 * \param seed - The 64 bit seed to use
+	 */
+	void seed(uint64_t seed);
+
+	/**
+	 * \brief Generate the next random number
+	 * \return Returns a uniformly distributed 64 bit random number
+	 */
+	result_type operator()() {
+		const uint64_t result = rotateLeft(m_State[1] * 5, 7) * 9;
+		const uint64_t shifted = m_State[1] << 17;
+
+		m_State[2] ^= m_State[0];
+		m_State[3] ^= m_State[1];
+		m_State[1] ^= m_State[2];
+		m_State[0] ^= m_State[3];
+		m_State[2] ^= shifted;
+		m_State[3] = rotateLeft(m_State[3], 45);
+
+		return (result);
+	}
+
+	/**
+	 * \brief Generate a uniform random number in [0, 1)
+	 * \return Returns a double containing a uniformly distributed random
+	 * number with the full 53 bits of precision
+	 */
+	double uniform() {
+		return (static_cast<double>((*this)() >> 11) * k_dUniformScale);
+	}
+
+	/**
+	 * \brief Get the smallest number generated
+	 * \return Returns 0
+	 */
+	static constexpr result_type min() {
+		return (0);
+	}
+
+	/**
+	 * \brief Get the largest number generated
+	 * \return Returns the largest 64 bit unsigned integer
+	 */
+	static constexpr result_type max() {
+		return (UINT64_MAX);
+	}
+
+	/**
+	 * \brief Generate a nondeterministic seed
+	 * \return Returns a 64 bit seed drawn from std::random_device, for
+	 * engines that do not need to be repeatable
+	 */
+	static uint64_t randomSeed();
+
+ private:
+	/**
+	 * \brief Rotate a 64 bit value left
+	 * \param value - The value to rotate
+	 * \param bits - The number of bits to rotate by
+	 * \return Returns the rotated value
+	 */
+	static uint64_t rotateLeft(uint64_t value, int bits) {
+		return ((value << bits) | (value >> (64 - bits)));
+	}
+
+	/**
+	 * \brief the scale from a 53 bit integer to [0, 1)
+	 */
+	static constexpr double k_dUniformScale = 1.0 / 9007199254740992.0;
+
+	/**
+	 * \brief the engine state
+	 */
+	uint64_t m_State[4];
+};
+}  // namespace util
+}  // namespace glass3
+#endif  // RANDOMENGINE_H
@@ -12,6 +12,7 @@
 #include <workstate.h>
 #include <thread>
 #include <mutex>
+#include <condition_variable>
 #include <string>
 #include <vector>
 #include <map>
@@ -163,6 +164,17 @@ class ThreadBaseClass : public util::BaseClass {
 	 */
 	int getSleepTime();
 
+	/**
+	 * \brief Wakes an idle work thread
+	 *
+	 * Signals a work thread that is waiting in workLoop() after an idle
+	 * work() call so that it calls work() again immediately rather than
+	 * waiting out the rest of the sleep time. Producers call this after
+	 * handing the thread new work; the sleep time remains the upper bound
+	 * on how long an idle thread waits without being woken.
+	 */
+	void wakeUp();
+
 	/**
 	 * \brief Function to get the work threads state
 	 *
@@ -326,6 +338,23 @@ class ThreadBaseClass : public util::BaseClass {
 
 	bool m_bTerminate;
 
+	/**
+	 * \brief the mutex used with m_WakeUpCondition
+	 */
+	std::mutex m_WakeUpMutex;
+
+	/**
+	 * \brief the condition variable idle work threads wait on between
+	 * work() calls, signaled by wakeUp() and stop()
+	 */
+	std::condition_variable m_WakeUpCondition;
+
+	/**
+	 * \brief boolean flag indicating that wakeUp() was called since a work
+	 * thread last waited, protected by m_WakeUpMutex
+	 */
+	bool m_bWakeUp;
+
 	// constants
 	/**
 	 * \brief default health check interval in seconds
@@ -8,13 +8,19 @@
 #define THREADPOOL_H
 
 #include <baseclass.h>
+#include <inplacefunction.h>
 #include <threadbaseclass.h>
 #include <threadstate.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
 #include <thread>
 #include <mutex>
-#include <queue>
 #include <ctime>
 #include <string>
+#include <vector>
 
 namespace glass3 {
 namespace util {
@@ -22,8 +28,16 @@ namespace util {
  * \brief glass3::util::ThreadPool class
  *
  * This class supports creating, starting, stopping, and monitoring a pool of
- * threads that perform various jobs, managing a FIFO queue for jobs to be
- * processed, and allowing for specific pool name and sleep between jobs.
+ * threads that perform various jobs, allowing for specific pool name and
+ * sleep between jobs.
+ *
+ * Each pool thread has its own job queue, protected by its own mutex. Jobs
+ * added by a pool thread go on that thread's queue, and jobs added from
+ * outside the pool are spread across the queues. A pool thread runs the jobs
+ * on its own queue in FIFO order, and when that queue is empty steals from the
+ * back of the other queues, so that threads only contend when one runs out
+ * of work. Jobs are stored as glass3::util::InplaceFunction, so adding small
+ * jobs does not allocate.
  *
  * This class inherits from util::threadbaseclass
  *
@@ -67,25 +81,44 @@ class ThreadPool : public util::ThreadBaseClass {
 	/**
 	 * \brief add a new job for for the thread pool to process
 	 *
-	 * Adds a job, as signified by a general-purpose polymorphic function wrapper
-	 * bound to the function to run, to the queue of jobs to be run by the thread
-	 * pool.
+	 * Adds a job, as signified by a callable taking no arguments such as a
+	 * std::function<void()>, std::bind result, or lambda, to the job queues
+	 * to be run by the thread pool. If called from a pool thread, the job is
+	 * added to that thread's queue.
 	 *
-	 * \param newJob - A std::function<void()> bound to the function containing
-	 * the job to run
+	 * \param newJob - A glass3::util::InplaceFunction wrapping the callable
+	 * containing the job to run
 	 */
-	void addJob(std::function<void()> newJob);
+	void addJob(InplaceFunction newJob);
 
 	/**
 	 *\brief Retrieve the current number of jobs in the queue
 	 *
 	 * Retrieves the number of pending (queued but not started) jobs stored in
-	 * m_JobQueue
+	 * the job queues
 	 *
 	 *\return an integer containing the current number of jobs in the queue
 	 */
 	int getJobQueueSize();
 
+	/**
+	 * \brief Wait until the pool is idle
+	 *
+	 * Blocks until every added job has finished, including jobs added by
+	 * running jobs. Must not be called from a job running in this pool.
+	 */
+	void waitForIdle();
+
+	/**
+	 * \brief Drain the pool
+	 *
+	 * Runs pending jobs on the calling thread until none are left, then waits
+	 * for jobs still running on pool threads to finish, so that the pool is
+	 * drained even if it has no running threads. Must not be called from a
+	 * job running in this pool.
+	 */
+	void drain();
+
 	/**
 	 * \brief ThreadBaseClass work function
 	 *
@@ -100,21 +133,94 @@ class ThreadPool : public util::ThreadBaseClass {
 
  private:
 	/**
-	 * \brief the std::queue of std::function<void() jobs for the jobLoop()
-	 * functions to process
+	 * \brief a job queue owned by one pool thread
+	 */
+	typedef struct _JobQueue {
+		/**
+		 * \brief the mutex controlling access to Jobs
+		 */
+		std::mutex Mutex;
+
+		/**
+		 * \brief the std::deque of jobs, the owning thread takes from the
+		 * front and other threads steal from the back
+		 */
+		std::deque<InplaceFunction> Jobs;
+	} JobQueue;
+
+	/**
+	 * \brief allocates the job queues, one per pool thread
+	 */
+	void allocateJobQueues();
+
+	/**
+	 * \brief Retrieves the index of the job queue owned by the calling
+	 * thread, pool threads are assigned a queue on their first work() call
+	 *
+	 * \return Returns an integer containing the queue index, or -1 if the
+	 * calling thread is not a pool thread
+	 */
+	int getWorkerQueueIndex();
+
+	/**
+	 * \brief Gets the next job to run
+	 *
+	 * Takes the oldest job from the given queue, or failing that steals the
+	 * newest job from one of the other queues
+	 *
+	 * \param queueIndex - An integer containing the index of the calling
+	 * thread's queue, -1 to only steal
+	 * \param job - A pointer to the glass3::util::InplaceFunction to move the
+	 * job into
+	 * \return Returns true if a job was found, false if every queue is empty
+	 */
+	bool getNextJob(int queueIndex, InplaceFunction *job);
+
+	/**
+	 * \brief Runs a job, logging any exception
+	 *
+	 * \param job - A pointer to the glass3::util::InplaceFunction to run
+	 * \return Returns true if the job ran successfully, false if it threw an
+	 * exception
+	 */
+	bool runJob(InplaceFunction *job);
+
+	/**
+	 * \brief the job queues, one per pool thread
+	 */
+	std::vector<std::unique_ptr<JobQueue>> m_vJobQueues;
+
+	/**
+	 * \brief the number of jobs waiting in the job queues
+	 */
+	std::atomic<int> m_iQueuedJobs;
+
+	/**
+	 * \brief the number of jobs that have been added but not finished
+	 */
+	std::atomic<int> m_iUnfinishedJobs;
+
+	/**
+	 * \brief the index of the next job queue to add a job from outside the
+	 * pool to
+	 */
+	std::atomic<unsigned int> m_iNextQueue;
+
+	/**
+	 * \brief the index of the next job queue to assign to a pool thread
 	 */
-	std::queue<std::function<void()>> m_JobQueue;
+	std::atomic<unsigned int> m_iNextWorkerQueue;
 
 	/**
-	 * \brief Retrieves a reference to the class member containing the mutex
-	 * used to control access to class members
+	 * \brief the mutex used with m_IdleCondition
 	 */
-	std::mutex & getMutex();
+	std::mutex m_IdleMutex;
 
 	/**
-	 * \brief A mutex to control access to class members
+	 * \brief the condition variable signaled when the last unfinished job
+	 * finishes
 	 */
-	std::mutex m_Mutex;
+	std::condition_variable m_IdleCondition;
 };
 }  // namespace util
 }  // namespace glass3
@@ -200,7 +200,7 @@ void Geo::getGeocentric(double *lat, double *lon, double *r) {
 }
 
 // Calculate the distance in radians to a given geographic object
-double Geo::delta(Geo *geo) {
+double Geo::delta(const Geo *geo) const {
 	// compute dot product
 	double dot = m_dUnitVectorX * geo->m_dUnitVectorX
 			+ m_dUnitVectorY * geo->m_dUnitVectorY
@@ -217,7 +217,7 @@ double Geo::delta(Geo *geo) {
 }
 
 // Calculate the azimuth in radians to a given geographic object
-double Geo::azimuth(Geo *geo) {
+double Geo::azimuth(const Geo *geo) const {
 	// Station radial normal vector
 	double sx = cos(GlassMath::k_DegreesToRadians * geo->m_dGeocentricLatitude)
 			* cos(GlassMath::k_DegreesToRadians * geo->m_dGeocentricLongitude);
@@ -1,13 +1,14 @@
 #include <logger.h>
 #include <glassmath.h>
-#include <random>
+#include <randomengine.h>
 #include <cmath>
+#include <cstdint>
 
 namespace glass3 {
 namespace util {
 
-bool GlassMath::m_bInitialized = false;
-std::default_random_engine GlassMath::m_RandomGenerator;
+thread_local bool GlassMath::m_bInitialized = false;
+thread_local RandomEngine GlassMath::m_RandomGenerator;
 
 // constants
 constexpr double GlassMath::k_RadiansToDegrees;
@@ -40,21 +41,31 @@ double GlassMath::sig_laplace_pdf(double x, double sigma) {
 double GlassMath::random(double x, double y) {
 	initializeRandom();
 
-	std::uniform_real_distribution<double> distribution(x, y);
-	double number = distribution(m_RandomGenerator);
-	return (number);
+	return (random(x, y, &m_RandomGenerator));
+}
+
+// ---------------------------------------------------------Rand
+double GlassMath::random(double x, double y, RandomEngine *generator) {
+	return (x + (y - x) * generator->uniform());
+}
+
+// ---------------------------------------------------------gauss
+double GlassMath::gauss(double avg, double std) {
+	initializeRandom();
+
+	return (gauss(avg, std, &m_RandomGenerator));
 }
 
 // ---------------------------------------------------------gauss
 // generate Gaussian pseudo-random number using the
 // polar form of the Box-Muller method
-double GlassMath::gauss(double avg, double std) {
+double GlassMath::gauss(double avg, double std, RandomEngine *generator) {
 	double rsq = 0;
 	double v1 = 0;
 
 	do {
-		v1 = random(-1.0, 1.0);
-		double v2 = random(-1.0, 1.0);
+		v1 = random(-1.0, 1.0, generator);
+		double v2 = random(-1.0, 1.0, generator);
 		rsq = v1 * v1 + v2 * v2;
 	} while (rsq >= 1.0);
 
@@ -68,13 +79,18 @@ double GlassMath::gauss(double avg, double std) {
 // ---------------------------------------------------------initializeRandom
 void GlassMath::initializeRandom() {
 	if (m_bInitialized == false) {
-		// seed the random number generator
-		std::random_device randomDevice;
-		m_RandomGenerator.seed(randomDevice());
+		// seed this thread's random number generator
+		m_RandomGenerator.seed(RandomEngine::randomSeed());
 		m_bInitialized = true;
 	}
 }
 
+// ---------------------------------------------------------seedRandom
+void GlassMath::seedRandom(uint64_t seed) {
+	m_RandomGenerator.seed(seed);
+	m_bInitialized = true;
+}
+
 /**
  * Get the minimum angle (degrees) between two angles
  */
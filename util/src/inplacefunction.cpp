@@ -0,0 +1,86 @@
+#include <inplacefunction.h>
+
+namespace glass3 {
+namespace util {
+
+// ---------------------------------------------------------InplaceFunction
+InplaceFunction::InplaceFunction()
+		: m_pInvoke(NULL),
+		  m_pMove(NULL),
+		  m_pDestroy(NULL),
+		  m_bInplace(false) {
+}
+
+// ---------------------------------------------------------InplaceFunction
+InplaceFunction::InplaceFunction(InplaceFunction &&other) noexcept
+		: m_pInvoke(NULL),
+		  m_pMove(NULL),
+		  m_pDestroy(NULL),
+		  m_bInplace(false) {
+	*this = std::move(other);
+}
+
+// ---------------------------------------------------------operator=
+InplaceFunction & InplaceFunction::operator=(InplaceFunction &&other) noexcept {
+	if (this == &other) {
+		return (*this);
+	}
+
+	clear();
+
+	if (other.m_pInvoke == NULL) {
+		return (*this);
+	}
+
+	// take the callable, leaving other empty
+	other.m_pMove(&other.m_Storage, &m_Storage);
+	m_pInvoke = other.m_pInvoke;
+	m_pMove = other.m_pMove;
+	m_pDestroy = other.m_pDestroy;
+	m_bInplace = other.m_bInplace;
+
+	other.m_pInvoke = NULL;
+	other.m_pMove = NULL;
+	other.m_pDestroy = NULL;
+	other.m_bInplace = false;
+
+	return (*this);
+}
+
+// ---------------------------------------------------------~InplaceFunction
+InplaceFunction::~InplaceFunction() {
+	clear();
+}
+
+// ---------------------------------------------------------operator()
+void InplaceFunction::operator()() {
+	if (m_pInvoke == NULL) {
+		return;
+	}
+
+	m_pInvoke(&m_Storage);
+}
+
+// ---------------------------------------------------------operator bool
+InplaceFunction::operator bool() const {
+	return (m_pInvoke != NULL);
+}
+
+// ---------------------------------------------------------isInplace
+bool InplaceFunction::isInplace() const {
+	return (m_bInplace);
+}
+
+// ---------------------------------------------------------clear
+void InplaceFunction::clear() {
+	if (m_pDestroy != NULL) {
+		m_pDestroy(&m_Storage);
+	}
+
+	m_pInvoke = NULL;
+	m_pMove = NULL;
+	m_pDestroy = NULL;
+	m_bInplace = false;
+}
+}  // namespace util
+}  // namespace glass3
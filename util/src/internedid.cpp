@@ -0,0 +1,269 @@
+#include <internedid.h>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace glass3 {
+namespace util {
+
+// an interned string, its handle, and the number of InternedIDs holding it
+typedef struct _InternEntry {
+	std::string String;
+	unsigned int Handle;
+	std::atomic<int> References;
+} InternEntry;
+
+// one shard of the table, strings are spread across the shards by hash so
+// that threads looking up different strings rarely wait on each other
+typedef struct _InternShard {
+	std::mutex Mutex;
+	std::unordered_map<std::string, InternEntry *> Entries;
+} InternShard;
+
+// the number of shards in the table
+static const int k_iNumInternShards = 64;
+
+// the process-wide table of interned strings
+typedef struct _InternTable {
+	InternShard Shards[k_iNumInternShards];
+	std::mutex HandleMutex;
+	unsigned int NextHandle;
+	std::vector<unsigned int> FreeHandles;
+} InternTable;
+
+// the table is never destroyed, so ids held by static objects can still be
+// released at exit
+static InternTable & getInternTable() {
+	static InternTable * table = []() {
+		InternTable * newTable = new InternTable();
+		// handles start at 1
+		newTable->NextHandle = InternedID::k_iEmptyHandle + 1;
+		return (newTable);
+	}();
+	return (*table);
+}
+
+// the shard holding a string
+static InternShard & getInternShard(const std::string &id) {
+	return (getInternTable().Shards[std::hash<std::string>()(id)
+			% k_iNumInternShards]);
+}
+
+// get an unused handle, reusing a released one if we can
+static unsigned int allocateHandle() {
+	InternTable &table = getInternTable();
+	std::lock_guard<std::mutex> handleGuard(table.HandleMutex);
+
+	if (table.FreeHandles.empty() == false) {
+		unsigned int handle = table.FreeHandles.back();
+		table.FreeHandles.pop_back();
+		return (handle);
+	}
+
+	return (table.NextHandle++);
+}
+
+// return a handle to be reused
+static void freeHandle(unsigned int handle) {
+	InternTable &table = getInternTable();
+	std::lock_guard<std::mutex> handleGuard(table.HandleMutex);
+
+	table.FreeHandles.push_back(handle);
+}
+
+// the string held by empty ids
+static const std::string & getEmptyString() {
+	static const std::string * empty = new std::string();
+	return (*empty);
+}
+
+const unsigned int InternedID::k_iEmptyHandle;
+
+// ---------------------------------------------------------InternedID
+InternedID::InternedID()
+		: m_pEntry(NULL),
+		  m_iHandle(k_iEmptyHandle),
+		  m_pString(&getEmptyString()) {
+}
+
+// ---------------------------------------------------------InternedID
+InternedID::InternedID(const std::string &id)
+		: m_pEntry(NULL),
+		  m_iHandle(k_iEmptyHandle),
+		  m_pString(&getEmptyString()) {
+	if (id.empty() == true) {
+		return;
+	}
+
+	InternShard &shard = getInternShard(id);
+	std::lock_guard<std::mutex> shardGuard(shard.Mutex);
+
+	auto found = shard.Entries.find(id);
+	if (found != shard.Entries.end()) {
+		// take a reference, unless the last one has already been released
+		// and the entry is about to be removed
+		InternEntry * entry = found->second;
+		int references = entry->References.load();
+		while (references > 0) {
+			if (entry->References.compare_exchange_weak(references,
+														references + 1)) {
+				m_pEntry = entry;
+				m_iHandle = entry->Handle;
+				m_pString = &entry->String;
+				return;
+			}
+		}
+	}
+
+	// add a new entry, replacing one that is being removed, whose releaser
+	// will see it has been replaced
+	InternEntry * entry = new InternEntry();
+	entry->String = id;
+	entry->Handle = allocateHandle();
+	entry->References = 1;
+	shard.Entries[id] = entry;
+
+	m_pEntry = entry;
+	m_iHandle = entry->Handle;
+	m_pString = &entry->String;
+}
+
+// ---------------------------------------------------------InternedID
+InternedID::InternedID(const InternedID &other)
+		: m_pEntry(NULL),
+		  m_iHandle(k_iEmptyHandle),
+		  m_pString(&getEmptyString()) {
+	*this = other;
+}
+
+// ---------------------------------------------------------InternedID
+InternedID::InternedID(InternedID &&other) noexcept
+		: m_pEntry(other.m_pEntry),
+		  m_iHandle(other.m_iHandle),
+		  m_pString(other.m_pString) {
+	other.m_pEntry = NULL;
+	other.m_iHandle = k_iEmptyHandle;
+	other.m_pString = &getEmptyString();
+}
+
+// ---------------------------------------------------------operator=
+InternedID & InternedID::operator=(const InternedID &other) {
+	if (m_pEntry == other.m_pEntry) {
+		return (*this);
+	}
+
+	release();
+
+	// other holds a reference, so the entry can't be removed while we take
+	// ours
+	if (other.m_pEntry != NULL) {
+		other.m_pEntry->References.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	m_pEntry = other.m_pEntry;
+	m_iHandle = other.m_iHandle;
+	m_pString = other.m_pString;
+
+	return (*this);
+}
+
+// ---------------------------------------------------------operator=
+InternedID & InternedID::operator=(InternedID &&other) noexcept {
+	if (this == &other) {
+		return (*this);
+	}
+
+	release();
+
+	m_pEntry = other.m_pEntry;
+	m_iHandle = other.m_iHandle;
+	m_pString = other.m_pString;
+	other.m_pEntry = NULL;
+	other.m_iHandle = k_iEmptyHandle;
+	other.m_pString = &getEmptyString();
+
+	return (*this);
+}
+
+// ---------------------------------------------------------~InternedID
+InternedID::~InternedID() {
+	release();
+}
+
+// ---------------------------------------------------------getString
+const std::string & InternedID::getString() const {
+	return (*m_pString);
+}
+
+// ---------------------------------------------------------getHandle
+unsigned int InternedID::getHandle() const {
+	return (m_iHandle);
+}
+
+// ---------------------------------------------------------findHandle
+unsigned int InternedID::findHandle(const std::string &id) {
+	if (id.empty() == true) {
+		return (k_iEmptyHandle);
+	}
+
+	InternShard &shard = getInternShard(id);
+	std::lock_guard<std::mutex> shardGuard(shard.Mutex);
+
+	auto found = shard.Entries.find(id);
+	if ((found == shard.Entries.end())
+			|| (found->second->References.load() <= 0)) {
+		return (k_iEmptyHandle);
+	}
+
+	return (found->second->Handle);
+}
+
+// ---------------------------------------------------------getTableSize
+int InternedID::getTableSize() {
+	InternTable &table = getInternTable();
+
+	int size = 0;
+	for (int i = 0; i < k_iNumInternShards; i++) {
+		std::lock_guard<std::mutex> shardGuard(table.Shards[i].Mutex);
+		size += table.Shards[i].Entries.size();
+	}
+
+	return (size);
+}
+
+// ---------------------------------------------------------release
+void InternedID::release() {
+	InternEntry * entry = m_pEntry;
+
+	m_pEntry = NULL;
+	m_iHandle = k_iEmptyHandle;
+	m_pString = &getEmptyString();
+
+	if (entry == NULL) {
+		return;
+	}
+
+	if (entry->References.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+		return;
+	}
+
+	// that was the last reference, and no new ones can be taken, so remove
+	// the entry unless it has already been replaced
+	InternShard &shard = getInternShard(entry->String);
+	{
+		std::lock_guard<std::mutex> shardGuard(shard.Mutex);
+		auto found = shard.Entries.find(entry->String);
+		if ((found != shard.Entries.end()) && (found->second == entry)) {
+			shard.Entries.erase(found);
+		}
+	}
+
+	// recycle the handle
+	freeHandle(entry->Handle);
+	delete (entry);
+}
+}  // namespace util
+}  // namespace glass3
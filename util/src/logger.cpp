@@ -8,6 +8,7 @@ namespace glass3 {
 namespace util {
 
 bool Logger::m_bDisable = false;
+std::atomic<int> Logger::m_iLogLevel(spdlog::level::off);
 
 // constants
 const unsigned int Logger::k_nMaxLogEntrySize;
@@ -90,6 +91,7 @@ void Logger::log_init(const std::string &programName,
 
 		// set logging level
 		spdlog::set_level(string_to_log_level(logLevel));
+		m_iLogLevel = string_to_log_level(logLevel);
 
 		std::string startupmessage = "***** " + programName
 				+ ": Logger startup; ";
@@ -122,6 +124,7 @@ void Logger::log_update_level(spdlog::level::level_enum loglevel) {
 		spdlog::set_level(loglevel);
 		auto logger = spdlog::get("logger");
 		logger->set_level(loglevel);
+		m_iLogLevel = loglevel;
 
 		std::string levelString = spdlog::level::to_str(loglevel);
 		log("info", "logging set to level: " + levelString);
@@ -172,6 +175,24 @@ void Logger::log(const std::string &level, const std::string &message) {
 	}
 }
 
+// -------------------------------------------------------------log
+void Logger::log(spdlog::level::level_enum level, const std::string &message) {
+	// log a message
+	if (level == spdlog::level::info) {
+		logInfo(message);
+	} else if (level == spdlog::level::trace) {
+		logTrace(message);
+	} else if (level == spdlog::level::debug) {
+		logDebug(message);
+	} else if (level == spdlog::level::warn) {
+		logWarning(message);
+	} else if (level == spdlog::level::err) {
+		logError(message);
+	} else if (level == spdlog::level::critical) {
+		logCriticalError(message);
+	}
+}
+
 // -------------------------------------------------------------logInfo
 void Logger::logInfo(const std::string &message) {
 	// log an info message
@@ -1,16 +1,19 @@
 #include <queue.h>
 #include <json.h>
 #include <logger.h>
+#include <threadbaseclass.h>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <queue>
+#include <vector>
 
 namespace glass3 {
 namespace util {
 
 // ---------------------------------------------------------Queue
 Queue::Queue() {
+	m_pWakeUpThread = NULL;
 	clear();
 }
 
@@ -41,6 +44,12 @@ bool Queue::addDataToQueue(std::shared_ptr<json::Object> data) {
 	// add the new data to the Queue
 	m_DataQueue.push(data);
 
+	// let the consumer know there is new data
+	ThreadBaseClass * wakeUpThread = m_pWakeUpThread;
+	if (wakeUpThread != NULL) {
+		wakeUpThread->wakeUp();
+	}
+
 	return (true);
 }
 
@@ -63,6 +72,27 @@ std::shared_ptr<json::Object> Queue::getDataFromQueue() {
 	return (data);
 }
 
+// ---------------------------------------------------------getDataBatchFromQueue
+int Queue::getDataBatchFromQueue(
+		std::vector<std::shared_ptr<json::Object>> *dataBatch, int maxCount) {
+	if (dataBatch == NULL) {
+		return (0);
+	}
+
+	std::lock_guard < std::mutex > guard(getMutex());
+
+	// move up to maxCount elements from the front of the Queue
+	int count = 0;
+	while ((m_DataQueue.empty() == false)
+			&& ((maxCount < 0) || (count < maxCount))) {
+		dataBatch->push_back(m_DataQueue.front());
+		m_DataQueue.pop();
+		count++;
+	}
+
+	return (count);
+}
+
 // ---------------------------------------------------------size
 int Queue::size() {
 	std::lock_guard < std::mutex > guard(getMutex());
@@ -72,6 +102,11 @@ int Queue::size() {
 	return (queuesize);
 }
 
+// ---------------------------------------------------------setWakeUpThread
+void Queue::setWakeUpThread(ThreadBaseClass * wakeUpThread) {
+	m_pWakeUpThread = wakeUpThread;
+}
+
 // ---------------------------------------------------------getMutex
 std::mutex & Queue::getMutex() {
 	return (m_Mutex);
@@ -0,0 +1,42 @@
+#include <randomengine.h>
+#include <cstdint>
+#include <random>
+
+namespace glass3 {
+namespace util {
+
+// constants
+const uint64_t RandomEngine::k_DefaultSeed;
+constexpr double RandomEngine::k_dUniformScale;
+
+// ---------------------------------------------------------RandomEngine
+RandomEngine::RandomEngine() {
+	seed(k_DefaultSeed);
+}
+
+// ---------------------------------------------------------RandomEngine
+RandomEngine::RandomEngine(uint64_t seed) {
+	this->seed(seed);
+}
+
+// ---------------------------------------------------------seed
+void RandomEngine::seed(uint64_t seed) {
+	// expand the seed into the state with splitmix64, which never produces
+	// the all zero state xoshiro can't leave
+	uint64_t value = seed;
+	for (int i = 0; i < 4; i++) {
+		value += 0x9e3779b97f4a7c15ULL;
+		uint64_t mixed = value;
+		mixed = (mixed ^ (mixed >> 30)) * 0xbf58476d1ce4e5b9ULL;
+		mixed = (mixed ^ (mixed >> 27)) * 0x94d049bb133111ebULL;
+		m_State[i] = mixed ^ (mixed >> 31);
+	}
+}
+
+// ---------------------------------------------------------randomSeed
+uint64_t RandomEngine::randomSeed() {
+	std::random_device randomDevice;
+	return ((static_cast<uint64_t>(randomDevice()) << 32) ^ randomDevice());
+}
+}  // namespace util
+}  // namespace glass3
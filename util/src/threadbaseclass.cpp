@@ -24,6 +24,7 @@ ThreadBaseClass::ThreadBaseClass()
 	setNumThreads(k_iNumThreadsDefault);
 	setThreadHealth();
 	m_bTerminate = false;
+	m_bWakeUp = false;
 
 	// set to default inter-loop sleep
 	setSleepTime(k_iSleepTimeDefault);
@@ -42,6 +43,7 @@ ThreadBaseClass::ThreadBaseClass(std::string threadName, int sleepTimeMS,
 	setNumThreads(numThreads);
 	setThreadHealth();
 	m_bTerminate = false;
+	m_bWakeUp = false;
 
 	// set to provided inter-loop sleep
 	setSleepTime(sleepTimeMS);
@@ -129,6 +131,12 @@ bool ThreadBaseClass::stop() {
 		// we're stopping
 		setWorkThreadsState(glass3::util::ThreadState::Stopping);
 
+		// wake any idle threads so they see the new state
+		{
+			std::lock_guard<std::mutex> wakeUpGuard(m_WakeUpMutex);
+			m_WakeUpCondition.notify_all();
+		}
+
 		// wait for threads to finish
 		for (int i = 0; i < m_WorkThreads.size(); i++) {
 			try {
@@ -273,9 +281,17 @@ void ThreadBaseClass::workLoop() {
 							+ getThreadName() + ")");
 			break;
 		} else if (workState == glass3::util::WorkState::Idle) {
-			// give up some time if there was nothing to do
-			std::this_thread::sleep_for(
-					std::chrono::milliseconds(getSleepTime()));
+			// give up some time if there was nothing to do, waking early
+			// if a producer signals new work or we are stopped
+			std::unique_lock<std::mutex> wakeUpLock(m_WakeUpMutex);
+			m_WakeUpCondition.wait_for(
+					wakeUpLock, std::chrono::milliseconds(getSleepTime()),
+					[this]() {
+						return (m_bWakeUp
+								|| (getWorkThreadsState()
+										!= glass3::util::ThreadState::Started));
+					});
+			m_bWakeUp = false;
 		}
 
 		// make sure we should still be running
@@ -398,6 +414,13 @@ int ThreadBaseClass::getSleepTime() {
 	return (m_iSleepTimeMS);
 }
 
+// ---------------------------------------------------------wakeUp
+void ThreadBaseClass::wakeUp() {
+	std::lock_guard<std::mutex> wakeUpGuard(m_WakeUpMutex);
+	m_bWakeUp = true;
+	m_WakeUpCondition.notify_one();
+}
+
 // ---------------------------------------------------------getThreadName
 const std::string& ThreadBaseClass::getThreadName() {
 	return (m_sThreadName);
@@ -1,70 +1,95 @@
 #include <threadpool.h>
 #include <logger.h>
+#include <algorithm>
+#include <memory>
 #include <string>
+#include <utility>
 
 namespace glass3 {
 namespace util {
 
+// the pool the calling thread works for, and the index of its job queue
+static thread_local ThreadPool * t_pWorkerPool = NULL;
+static thread_local int t_iWorkerQueueIndex = -1;
+
 // ---------------------------------------------------------ThreadPool
 ThreadPool::ThreadPool()
 		: util::ThreadBaseClass() {
+	allocateJobQueues();
 }
 
 // ---------------------------------------------------------ThreadPool
 ThreadPool::ThreadPool(std::string poolName, int numThreads, int sleepTime,
 						int checkInterval)
 		: util::ThreadBaseClass(poolName, sleepTime, numThreads, checkInterval) {
+	allocateJobQueues();
 	start();
 }
 
 // ---------------------------------------------------------~ThreadPool
 ThreadPool::~ThreadPool() {
+	// make sure the pool threads are done with the job queues
+	if (getWorkThreadsState() == glass3::util::ThreadState::Started) {
+		stop();
+	}
+}
+
+// ---------------------------------------------------------allocateJobQueues
+void ThreadPool::allocateJobQueues() {
+	m_iQueuedJobs = 0;
+	m_iUnfinishedJobs = 0;
+	m_iNextQueue = 0;
+	m_iNextWorkerQueue = 0;
+
+	// one queue per thread, threads added later with setNumThreads() share
+	int numQueues = std::max(getNumThreads(), 1);
+	for (int i = 0; i < numQueues; i++) {
+		m_vJobQueues.push_back(std::unique_ptr<JobQueue>(new JobQueue()));
+	}
 }
 
 // ---------------------------------------------------------addJob
-void ThreadPool::addJob(std::function<void()> newjob) {
-	getMutex().lock();
-	m_JobQueue.push(newjob);
-	getMutex().unlock();
+void ThreadPool::addJob(InplaceFunction newjob) {
+	// pool threads add to their own queue, everyone else spreads jobs across
+	// the queues
+	int queueIndex = getWorkerQueueIndex();
+	if (queueIndex < 0) {
+		queueIndex = m_iNextQueue++ % m_vJobQueues.size();
+	}
 
-	glass3::util::Logger::log(
-			"trace",
-			"ThreadPool::addJob(): Added Job.(" + getThreadName() + ")");
+	m_iUnfinishedJobs++;
+
+	JobQueue * jobQueue = m_vJobQueues[queueIndex].get();
+	jobQueue->Mutex.lock();
+	jobQueue->Jobs.push_back(std::move(newjob));
+	m_iQueuedJobs++;
+	jobQueue->Mutex.unlock();
+
+	// wake an idle worker to run it
+	wakeUp();
 }
 
 // ---------------------------------------------------------work
 glass3::util::WorkState ThreadPool::work() {
-	// lock for queue access
-	getMutex().lock();
+	// assign pool threads a queue the first time they do work
+	if (t_pWorkerPool != this) {
+		t_pWorkerPool = this;
+		t_iWorkerQueueIndex = m_iNextWorkerQueue++ % m_vJobQueues.size();
+	}
 
 	// are there any jobs
-	if (m_JobQueue.empty() == true) {
-		// unlock and skip until next time
-		getMutex().unlock();
-
+	InplaceFunction newjob;
+	if (getNextJob(getWorkerQueueIndex(), &newjob) == false) {
 		// nothing to do
 		return (glass3::util::WorkState::Idle);
 	}
 
-	// get the next job
-	std::function<void()> newjob = m_JobQueue.front();
-	m_JobQueue.pop();
-
-	// done with queue
-	getMutex().unlock();
-
 	glass3::util::Logger::log(
 			"trace",
 			"ThreadPool::jobLoop(): Found Job.(" + getThreadName() + ")");
 
 	// run the job
-	try {
-		newjob();
-	} catch (const std::exception &e) {
-		glass3::util::Logger::log(
-				"error",
-				"ThreadPool::jobLoop: Exception during job(): "
-						+ std::string(e.what()) + " (" + getThreadName() + ")");
+	if (runJob(&newjob) == false) {
 		return (glass3::util::WorkState::Error);
 	}
 
@@ -78,14 +103,101 @@ glass3::util::WorkState ThreadPool::work() {
 
 // ---------------------------------------------------------getJobQueueSize
 int ThreadPool::getJobQueueSize() {
-	std::lock_guard<std::mutex> guard(getMutex());
-	int queuesize = static_cast<int>(m_JobQueue.size());
-	return (queuesize);
+	return (m_iQueuedJobs);
+}
+
+// ---------------------------------------------------------waitForIdle
+void ThreadPool::waitForIdle() {
+	std::unique_lock<std::mutex> idleLock(m_IdleMutex);
+	m_IdleCondition.wait(idleLock, [this]() {
+		return (m_iUnfinishedJobs <= 0);
+	});
+}
+
+// ---------------------------------------------------------drain
+void ThreadPool::drain() {
+	// help run whatever is left
+	InplaceFunction newjob;
+	while (getNextJob(-1, &newjob) == true) {
+		runJob(&newjob);
+	}
+
+	// wait for the jobs the pool threads are running
+	waitForIdle();
+}
+
+// ---------------------------------------------------------getWorkerQueueIndex
+int ThreadPool::getWorkerQueueIndex() {
+	if (t_pWorkerPool != this) {
+		return (-1);
+	}
+
+	return (t_iWorkerQueueIndex);
+}
+
+// ---------------------------------------------------------getNextJob
+bool ThreadPool::getNextJob(int queueIndex, InplaceFunction *job) {
+	// don't bother locking the queues if there's nothing in them
+	if (m_iQueuedJobs <= 0) {
+		return (false);
+	}
+
+	int numQueues = m_vJobQueues.size();
+
+	// take the oldest job from our own queue
+	if (queueIndex >= 0) {
+		JobQueue * jobQueue = m_vJobQueues[queueIndex].get();
+		std::lock_guard<std::mutex> queueGuard(jobQueue->Mutex);
+		if (jobQueue->Jobs.empty() == false) {
+			*job = std::move(jobQueue->Jobs.front());
+			jobQueue->Jobs.pop_front();
+			m_iQueuedJobs--;
+			return (true);
+		}
+	}
+
+	// steal the newest job from the next non-empty queue
+	int firstVictim = (queueIndex >= 0) ? queueIndex + 1 : 0;
+	for (int i = 0; i < numQueues; i++) {
+		int victim = (firstVictim + i) % numQueues;
+		if (victim == queueIndex) {
+			continue;
+		}
+
+		JobQueue * jobQueue = m_vJobQueues[victim].get();
+		std::lock_guard<std::mutex> queueGuard(jobQueue->Mutex);
+		if (jobQueue->Jobs.empty() == false) {
+			*job = std::move(jobQueue->Jobs.back());
+			jobQueue->Jobs.pop_back();
+			m_iQueuedJobs--;
+			return (true);
+		}
+	}
+
+	return (false);
 }
 
-// ---------------------------------------------------------getMutex
-std::mutex & ThreadPool::getMutex() {
-	return (m_Mutex);
+// ---------------------------------------------------------runJob
+bool ThreadPool::runJob(InplaceFunction *job) {
+	bool success = true;
+	try {
+		(*job)();
+	} catch (const std::exception &e) {
+		glass3::util::Logger::log(
+				"error",
+				"ThreadPool::jobLoop: Exception during job(): "
+						+ std::string(e.what()) + " (" + getThreadName() + ")");
+		success = false;
+	}
+	job->clear();
+
+	// let anyone waiting know when the last job is done
+	if (--m_iUnfinishedJobs <= 0) {
+		std::lock_guard<std::mutex> idleGuard(m_IdleMutex);
+		m_IdleCondition.notify_all();
+	}
+
+	return (success);
 }
 }  // namespace util
 }  // namespace glass3
@@ -21,3 +21,28 @@ TEST(GlassMathTest, CombinedTest) {
 				glass3::util::GlassMath::gauss(sg, 1.0));
 	}
 }
+
+// tests to see if generators with the same seed give the same numbers
+TEST(GlassMathTest, SeededGenerator) {
+	glass3::util::RandomEngine generator1(42);
+	glass3::util::RandomEngine generator2(42);
+
+	for (int i = 0; i < 100; i++) {
+		double value = glass3::util::GlassMath::random(-1.0, 1.0, &generator1);
+		ASSERT_GE(value, -1.0)<< "random lower bound";
+		ASSERT_LT(value, 1.0)<< "random upper bound";
+		ASSERT_EQ(value,
+					glass3::util::GlassMath::random(-1.0, 1.0, &generator2))<<
+		"same random sequence";
+		ASSERT_EQ(glass3::util::GlassMath::gauss(0.0, 1.0, &generator1),
+					glass3::util::GlassMath::gauss(0.0, 1.0, &generator2))<<
+		"same gauss sequence";
+	}
+
+	// seeding a thread's generator makes the plain calls repeatable too
+	glass3::util::GlassMath::seedRandom(42);
+	double first = glass3::util::GlassMath::gauss(0.0, 1.0);
+	glass3::util::GlassMath::seedRandom(42);
+	ASSERT_EQ(first, glass3::util::GlassMath::gauss(0.0, 1.0))<<
+	"same seeded gauss";
+}
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+#include <inplacefunction.h>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+int inplacefunctiondata = 0;
+void inplacefunctionjob() {
+	inplacefunctiondata++;
+}
+
+// tests to see if small callables are stored inline
+TEST(InplaceFunctionTest, Inplace) {
+	glass3::util::InplaceFunction empty;
+	ASSERT_FALSE(static_cast<bool>(empty))<< "default is empty";
+	ASSERT_FALSE(empty.isInplace())<< "empty is not inplace";
+
+	// calling empty does nothing
+	empty();
+
+	// function pointer
+	inplacefunctiondata = 0;
+	glass3::util::InplaceFunction pointerFunction(&inplacefunctionjob);
+	ASSERT_TRUE(static_cast<bool>(pointerFunction))<< "pointer not empty";
+	ASSERT_TRUE(pointerFunction.isInplace())<< "pointer is inplace";
+	pointerFunction();
+	ASSERT_EQ(1, inplacefunctiondata)<< "pointer called";
+
+	// bind
+	int value = 0;
+	glass3::util::InplaceFunction bindFunction(
+			std::bind([](int *data, int add) {*data += add;}, &value, 5));
+	ASSERT_TRUE(bindFunction.isInplace())<< "bind is inplace";
+	bindFunction();
+	ASSERT_EQ(5, value)<< "bind called";
+
+	// std::function
+	std::function<void()> stdFunction = [&value]() {value++;};
+	glass3::util::InplaceFunction wrappedFunction(stdFunction);
+	ASSERT_TRUE(wrappedFunction.isInplace())<< "std::function is inplace";
+	wrappedFunction();
+	ASSERT_EQ(6, value)<< "std::function called";
+}
+
+// tests to see if large callables fall back to the heap
+TEST(InplaceFunctionTest, Heap) {
+	std::vector<int> values;
+	double large[16] = { 0 };
+	large[15] = 3.0;
+
+	glass3::util::InplaceFunction heapFunction([&values, large]() {
+		values.push_back(static_cast<int>(large[15]));
+	});
+	ASSERT_TRUE(static_cast<bool>(heapFunction))<< "heap not empty";
+	ASSERT_FALSE(heapFunction.isInplace())<< "large is not inplace";
+	heapFunction();
+	ASSERT_EQ(1, static_cast<int>(values.size()))<< "heap called";
+	ASSERT_EQ(3, values[0])<< "heap value";
+}
+
+// tests to see if moving transfers the callable and its ownership
+TEST(InplaceFunctionTest, Move) {
+	std::shared_ptr<int> counter = std::make_shared<int>(0);
+
+	glass3::util::InplaceFunction first([counter]() {(*counter)++;});
+	ASSERT_EQ(2, counter.use_count())<< "captured";
+
+	glass3::util::InplaceFunction second(std::move(first));
+	ASSERT_FALSE(static_cast<bool>(first))<< "moved from is empty";
+	ASSERT_TRUE(static_cast<bool>(second))<< "moved to is not empty";
+	ASSERT_EQ(2, counter.use_count())<< "moved, not copied";
+	second();
+	ASSERT_EQ(1, *counter)<< "moved called";
+
+	glass3::util::InplaceFunction third;
+	third = std::move(second);
+	ASSERT_FALSE(static_cast<bool>(second))<< "assigned from is empty";
+	third();
+	ASSERT_EQ(2, *counter)<< "assigned called";
+
+	// a heap callable moves by pointer
+	double large[16] = { 0 };
+	glass3::util::InplaceFunction heapFirst([counter, large]() {
+		(*counter) += static_cast<int>(large[0]) + 1;
+	});
+	glass3::util::InplaceFunction heapSecond(std::move(heapFirst));
+	ASSERT_FALSE(heapSecond.isInplace())<< "heap moved";
+	heapSecond();
+	ASSERT_EQ(3, *counter)<< "heap moved called";
+
+	// clearing releases the captures
+	third.clear();
+	heapSecond.clear();
+	ASSERT_FALSE(static_cast<bool>(third))<< "cleared";
+	ASSERT_EQ(1, counter.use_count())<< "released";
+}
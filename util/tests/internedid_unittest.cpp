@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include <internedid.h>
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#define TESTID "F6D594930C00134FA1C00B44403F4678"
+#define TESTID2 "20682831"
+
+// tests to see if ids are interned
+TEST(InternedIDTest, Intern) {
+	int tableSize = glass3::util::InternedID::getTableSize();
+
+	glass3::util::InternedID empty;
+	ASSERT_EQ(glass3::util::InternedID::k_iEmptyHandle, empty.getHandle())<<
+	"empty handle";
+	ASSERT_STREQ("", empty.getString().c_str())<< "empty string";
+	ASSERT_EQ(empty, glass3::util::InternedID(""))<< "empty equal";
+
+	glass3::util::InternedID id(TESTID);
+	glass3::util::InternedID sameID{std::string(TESTID)};
+	glass3::util::InternedID otherID(TESTID2);
+	ASSERT_STREQ(TESTID, id.getString().c_str())<< "string";
+	ASSERT_NE(glass3::util::InternedID::k_iEmptyHandle, id.getHandle())<<
+	"handle";
+	ASSERT_EQ(id, sameID)<< "same id equal";
+	ASSERT_EQ(&id.getString(), &sameID.getString())<< "string shared";
+	ASSERT_NE(id, otherID)<< "other id not equal";
+	ASSERT_EQ(tableSize + 2, glass3::util::InternedID::getTableSize())<<
+	"table size";
+
+	ASSERT_EQ(id.getHandle(),
+			glass3::util::InternedID::findHandle(std::string(TESTID)))<<
+	"find handle";
+	ASSERT_EQ(glass3::util::InternedID::k_iEmptyHandle,
+			glass3::util::InternedID::findHandle("notanid"))<< "find missing";
+	ASSERT_EQ(tableSize + 2, glass3::util::InternedID::getTableSize())<<
+	"find does not intern";
+
+	std::unordered_set<glass3::util::InternedID> idSet;
+	idSet.insert(id);
+	ASSERT_EQ(1, static_cast<int>(idSet.count(sameID)))<< "hash";
+	ASSERT_EQ(0, static_cast<int>(idSet.count(otherID)))<< "hash other";
+}
+
+// tests to see if copies and moves keep the reference counts right
+TEST(InternedIDTest, References) {
+	int tableSize = glass3::util::InternedID::getTableSize();
+
+	{
+		glass3::util::InternedID id(TESTID);
+		unsigned int handle = id.getHandle();
+
+		glass3::util::InternedID copyID(id);
+		glass3::util::InternedID assignID;
+		assignID = id;
+		ASSERT_EQ(handle, copyID.getHandle())<< "copy";
+		ASSERT_EQ(handle, assignID.getHandle())<< "assign";
+
+		glass3::util::InternedID moveID(std::move(copyID));
+		ASSERT_EQ(handle, moveID.getHandle())<< "move";
+		ASSERT_EQ(glass3::util::InternedID::k_iEmptyHandle,
+					copyID.getHandle())<< "moved from";
+
+		// the string stays while any copy holds it
+		id = glass3::util::InternedID(TESTID2);
+		assignID = glass3::util::InternedID();
+		ASSERT_EQ(handle,
+				glass3::util::InternedID::findHandle(std::string(TESTID)))<<
+		"still held";
+		ASSERT_STREQ(TESTID, moveID.getString().c_str())<< "still valid";
+	}
+
+	ASSERT_EQ(tableSize, glass3::util::InternedID::getTableSize())<<
+	"released";
+	ASSERT_EQ(glass3::util::InternedID::k_iEmptyHandle,
+			glass3::util::InternedID::findHandle(std::string(TESTID)))<<
+	"not found after release";
+
+	// handles are reused rather than growing without bound
+	std::vector<glass3::util::InternedID> ids;
+	for (int i = 0; i < 100; i++) {
+		ids.push_back(glass3::util::InternedID(std::to_string(i)));
+	}
+	unsigned int maxHandle = 0;
+	for (const auto &id : ids) {
+		maxHandle = std::max(maxHandle, id.getHandle());
+	}
+	ids.clear();
+	for (int i = 100; i < 200; i++) {
+		ids.push_back(glass3::util::InternedID(std::to_string(i)));
+	}
+	for (const auto &id : ids) {
+		ASSERT_LE(id.getHandle(), maxHandle)<< "handle reused";
+	}
+}
+
+// tests to see if ids can be created, copied, and released from many threads
+TEST(InternedIDTest, Threads) {
+	int tableSize = glass3::util::InternedID::getTableSize();
+
+	glass3::util::InternedID sharedID(TESTID);
+	unsigned int sharedHandle = sharedID.getHandle();
+
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; t++) {
+		threads.push_back(std::thread([&sharedID, t]() {
+			for (int i = 0; i < 10000; i++) {
+				// copies of a held id
+				glass3::util::InternedID copyID(sharedID);
+				glass3::util::InternedID assignID;
+				assignID = copyID;
+
+				// ids that come and go, shared with the other threads
+				glass3::util::InternedID id(std::to_string(i % 50));
+				glass3::util::InternedID sameID(std::to_string(i % 50));
+				if ((id != sameID) || (id.getString() != sameID.getString())) {
+					ADD_FAILURE()<< "same string, different id";
+					return;
+				}
+
+				// ids only this thread uses
+				glass3::util::InternedID ownID(
+						std::to_string(t) + "-" + std::to_string(i));
+				if (glass3::util::InternedID::findHandle(ownID.getString())
+						!= ownID.getHandle()) {
+					ADD_FAILURE()<< "find own id";
+					return;
+				}
+			}
+		}));
+	}
+	for (auto &thread : threads) {
+		thread.join();
+	}
+
+	ASSERT_EQ(sharedHandle,
+			glass3::util::InternedID::findHandle(std::string(TESTID)))<<
+	"shared id kept";
+	ASSERT_EQ(tableSize + 1, glass3::util::InternedID::getTableSize())<<
+	"released";
+}
@@ -24,3 +24,51 @@ TEST(LoggerTest, Logging) {
 
 	glass3::util::Logger::log("info", "log with level test");
 }
+
+// counts how many times a log message was built
+static int nMessagesBuilt = 0;
+static std::string buildMessage(const std::string &message) {
+	nMessagesBuilt++;
+	return (message);
+}
+
+// tests to see if the logging macros only build enabled messages
+TEST(LoggerTest, LevelGating) {
+	nMessagesBuilt = 0;
+
+	// nothing is logged before the logger is initialized
+	ASSERT_FALSE(glass3::util::Logger::isLevelEnabled(spdlog::level::critical))
+	<< "off before init";
+	GLASS3_LOG_ERROR(buildMessage("error test"));
+	ASSERT_EQ(0, nMessagesBuilt)<< "not built before init";
+
+	// set the level directly, there's no logger to set it on
+	glass3::util::Logger::m_iLogLevel = spdlog::level::info;
+	ASSERT_TRUE(glass3::util::Logger::isLevelEnabled(spdlog::level::info))
+	<< "info enabled";
+	ASSERT_TRUE(glass3::util::Logger::isLevelEnabled(spdlog::level::err))
+	<< "error enabled";
+	ASSERT_FALSE(glass3::util::Logger::isLevelEnabled(spdlog::level::debug))
+	<< "debug disabled";
+
+	GLASS3_LOG_DEBUG(buildMessage("debug test"));
+	ASSERT_EQ(0, nMessagesBuilt)<< "debug not built";
+	GLASS3_LOG_INFO(buildMessage("info test"));
+	ASSERT_EQ(1, nMessagesBuilt)<< "info built";
+	GLASS3_LOG_DEBUG_FORMAT("debug format test %s",
+							buildMessage("debug").c_str());
+	ASSERT_EQ(1, nMessagesBuilt)<< "debug format not built";
+	GLASS3_LOG_WARNING_FORMAT("warning format test %s",
+								buildMessage("warning").c_str());
+	ASSERT_EQ(2, nMessagesBuilt)<< "warning format built";
+
+	// disabling the logger turns off every level
+	glass3::util::Logger::disable();
+	ASSERT_FALSE(glass3::util::Logger::isLevelEnabled(spdlog::level::err))
+	<< "error disabled";
+	GLASS3_LOG_ERROR(buildMessage("error test"));
+	ASSERT_EQ(2, nMessagesBuilt)<< "error not built";
+	glass3::util::Logger::enable();
+
+	glass3::util::Logger::m_iLogLevel = spdlog::level::off;
+}
@@ -2,6 +2,7 @@
 #include <queue.h>
 #include <string>
 #include <memory>
+#include <vector>
 
 #define TESTDATA1 "{\"HighPass\":1.000000,\"LowPass\":1.000000}"
 #define TESTDATA2 "{\"HighPass\":2.000000,\"LowPass\":2.000000}"
@@ -61,3 +62,37 @@ TEST(QueueTest, CombinedTest) {
 	// cleanup
 	delete (TestQueue);
 }
+
+// tests to see if batches of data can be taken from the queue
+TEST(QueueTest, BatchTest) {
+	glass3::util::Queue TestQueue;
+
+	std::vector<std::string> inputstrings = { std::string(TESTDATA1),
+		std::string(TESTDATA2), std::string(TESTDATA3) };
+	for (auto inputstring : inputstrings) {
+		TestQueue.addDataToQueue(
+				std::make_shared<json::Object>(json::Deserialize(inputstring)));
+	}
+
+	// a null batch gets nothing
+	ASSERT_EQ(TestQueue.getDataBatchFromQueue(NULL, 1), 0)<< "null batch";
+	ASSERT_EQ(TestQueue.size(), 3)<< "3 items in queue";
+
+	// get a limited batch
+	std::vector<std::shared_ptr<json::Object>> batch;
+	ASSERT_EQ(TestQueue.getDataBatchFromQueue(&batch, 2), 2)<< "got 2 items";
+	ASSERT_EQ(static_cast<int>(batch.size()), 2)<< "2 items in batch";
+	ASSERT_EQ(TestQueue.size(), 1)<< "1 item in queue";
+
+	// get the rest, which is appended in order
+	ASSERT_EQ(TestQueue.getDataBatchFromQueue(&batch), 1)<< "got 1 item";
+	ASSERT_EQ(static_cast<int>(batch.size()), 3)<< "3 items in batch";
+	ASSERT_EQ(TestQueue.size(), 0)<< "no items in queue";
+	for (int i = 0; i < 3; i++) {
+		ASSERT_STREQ(inputstrings[i].c_str(), json::Serialize(*batch[i]).c_str())
+		<< "batch order";
+	}
+
+	// an empty queue gets nothing
+	ASSERT_EQ(TestQueue.getDataBatchFromQueue(&batch), 0)<< "empty queue";
+}
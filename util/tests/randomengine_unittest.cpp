@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include <randomengine.h>
+#include <glassmath.h>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#define SEED 42
+#define NUMSAMPLES 100000
+#define BENCHMARK_DRAWS 1000000
+
+// tests to see if the engine is repeatable and uniform
+TEST(RandomEngineTest, Sequence) {
+	glass3::util::RandomEngine engine1(SEED);
+	glass3::util::RandomEngine engine2(SEED);
+	glass3::util::RandomEngine otherEngine(SEED + 1);
+
+	int numSame = 0;
+	for (int i = 0; i < 100; i++) {
+		uint64_t value = engine1();
+		ASSERT_EQ(value, engine2())<< "same seed same sequence";
+		if (value == otherEngine()) {
+			numSame++;
+		}
+	}
+	ASSERT_EQ(0, numSame)<< "different seed different sequence";
+
+	// reseeding restarts the sequence
+	glass3::util::RandomEngine reseeded;
+	reseeded.seed(SEED);
+	engine1.seed(SEED);
+	ASSERT_EQ(engine1(), reseeded())<< "reseed";
+
+	// uniform values are in [0, 1) with the right mean
+	double sum = 0;
+	for (int i = 0; i < NUMSAMPLES; i++) {
+		double value = engine1.uniform();
+		ASSERT_GE(value, 0.0)<< "uniform lower bound";
+		ASSERT_LT(value, 1.0)<< "uniform upper bound";
+		sum += value;
+	}
+	ASSERT_NEAR(0.5, sum / NUMSAMPLES, 0.01)<< "uniform mean";
+
+	// and it works with the standard distributions
+	std::uniform_int_distribution<int> distribution(1, 6);
+	for (int i = 0; i < 100; i++) {
+		int value = distribution(engine1);
+		ASSERT_GE(value, 1)<< "distribution lower bound";
+		ASSERT_LE(value, 6)<< "distribution upper bound";
+	}
+}
+
+// benchmarks gaussian draws across threads from a single shared engine, as
+// the locator used to, against each thread's own engine
+TEST(RandomEngineTest, ThreadBenchmark) {
+	std::vector<int> threadCounts = { 1, 2, 4 };
+	for (int numThreads : threadCounts) {
+		// one std engine shared by every thread, guarded so draws are safe
+		std::default_random_engine sharedGenerator(SEED);
+		std::mutex sharedMutex;
+		std::vector<double> sharedSums(numThreads, 0.0);
+		std::vector<std::thread> threads;
+		auto start = std::chrono::steady_clock::now();
+		for (int t = 0; t < numThreads; t++) {
+			threads.push_back(std::thread([&, t]() {
+				std::normal_distribution<double> distribution(0.0, 1.0);
+				double sum = 0;
+				for (int i = 0; i < BENCHMARK_DRAWS; i++) {
+					std::lock_guard<std::mutex> guard(sharedMutex);
+					sum += distribution(sharedGenerator);
+				}
+				sharedSums[t] = sum;
+			}));
+		}
+		for (auto &thread : threads) {
+			thread.join();
+		}
+		double sharedSeconds = std::chrono::duration<double>(
+				std::chrono::steady_clock::now() - start).count();
+
+		// one engine per thread, seeded per thread so the draws are repeatable
+		std::vector<double> ownSums(numThreads, 0.0);
+		threads.clear();
+		start = std::chrono::steady_clock::now();
+		for (int t = 0; t < numThreads; t++) {
+			threads.push_back(std::thread([&, t]() {
+				glass3::util::RandomEngine engine(SEED + t);
+				double sum = 0;
+				for (int i = 0; i < BENCHMARK_DRAWS; i++) {
+					sum += glass3::util::GlassMath::gauss(0.0, 1.0, &engine);
+				}
+				ownSums[t] = sum;
+			}));
+		}
+		for (auto &thread : threads) {
+			thread.join();
+		}
+		double ownSeconds = std::chrono::duration<double>(
+				std::chrono::steady_clock::now() - start).count();
+
+		// the same thread engines again, which must give the same draws
+		for (int t = 0; t < numThreads; t++) {
+			glass3::util::RandomEngine engine(SEED + t);
+			double sum = 0;
+			for (int i = 0; i < BENCHMARK_DRAWS; i++) {
+				sum += glass3::util::GlassMath::gauss(0.0, 1.0, &engine);
+			}
+			ASSERT_EQ(ownSums[t], sum)<< "repeatable thread draws";
+			ASSERT_LT(std::abs(sum / BENCHMARK_DRAWS), 0.01)<< "gauss mean";
+		}
+
+		double totalDraws = static_cast<double>(numThreads) * BENCHMARK_DRAWS;
+		std::cout << "[ BENCH    ] " << numThreads << " threads: shared engine "
+					<< totalDraws / sharedSeconds / 1.0e6
+					<< " M draws/s, per thread engine "
+					<< totalDraws / ownSeconds / 1.0e6 << " M draws/s"
+					<< std::endl;
+	}
+}
@@ -1,13 +1,23 @@
 #include <gtest/gtest.h>
 #include <threadbaseclass.h>
 #include <logger.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <queue>
 #include <string>
+#include <utility>
+#include <vector>
 
 #define TESTTHREADNAME "threadbasestub"
 #define TESTSLEEPTIME 50
 #define TESTSLEEPTIMECHANGE 100
 #define TESTSTOPCOUNT 10
 #define WAITTIME 2
+#define LATENCYSLEEPTIME 50
+#define LATENCYNUMITEMS 40
+#define LATENCYSPACING 13
 
 // stub class based on ThreadBaseClass for unit tests
 class threadbasestub : public glass3::util::ThreadBaseClass {
@@ -73,6 +83,89 @@ class threadbasestub : public glass3::util::ThreadBaseClass {
 	}
 };
 
+// stub class based on ThreadBaseClass that measures how long produced items
+// wait before work() consumes them
+class latencystub : public glass3::util::ThreadBaseClass {
+ public:
+	latencystub()
+			: glass3::util::ThreadBaseClass("latencystub", LATENCYSLEEPTIME) {
+		setHealthCheckInterval(-1);
+	}
+
+	~latencystub() {
+	}
+
+	// add a timestamped item, optionally waking the work thread
+	void produce(bool wake) {
+		m_Mutex.lock();
+		m_qItems.push(std::chrono::steady_clock::now());
+		m_Mutex.unlock();
+
+		if (wake) {
+			wakeUp();
+		}
+	}
+
+	// the number of consumed items
+	int consumedCount() {
+		std::lock_guard<std::mutex> guard(m_Mutex);
+		return (m_vLatencies.size());
+	}
+
+	// the requested percentile of the consumed item latencies in microseconds
+	double percentile(double fraction) {
+		std::lock_guard<std::mutex> guard(m_Mutex);
+		std::vector<double> sorted = m_vLatencies;
+		std::sort(sorted.begin(), sorted.end());
+		int index = static_cast<int>(fraction * (sorted.size() - 1));
+		return (sorted[index]);
+	}
+
+ protected:
+	// work function, consumes an item and records its latency
+	glass3::util::WorkState work() override {
+		std::lock_guard<std::mutex> guard(m_Mutex);
+		setThreadHealth();
+		if (m_qItems.empty()) {
+			return (glass3::util::WorkState::Idle);
+		}
+
+		m_vLatencies.push_back(
+				std::chrono::duration<double, std::micro>(
+						std::chrono::steady_clock::now() - m_qItems.front())
+						.count());
+		m_qItems.pop();
+
+		return (glass3::util::WorkState::OK);
+	}
+
+ private:
+	std::mutex m_Mutex;
+	std::queue<std::chrono::steady_clock::time_point> m_qItems;
+	std::vector<double> m_vLatencies;
+};
+
+// produces items at intervals that leave the consumer idle, returns the
+// p50 and p99 latencies in microseconds
+std::pair<double, double> measureLatency(bool wake) {
+	latencystub consumer;
+	consumer.start();
+
+	for (int i = 0; i < LATENCYNUMITEMS; i++) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(LATENCYSPACING));
+		consumer.produce(wake);
+	}
+
+	// wait for the last item
+	while (consumer.consumedCount() < LATENCYNUMITEMS) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	consumer.stop();
+
+	return (std::pair<double, double>(consumer.percentile(0.5),
+										consumer.percentile(0.99)));
+}
+
 // tests to see if the threadbaseclass is functional
 TEST(ThreadBaseClassTest, CombinedTest) {
 	std::string name = std::string(TESTTHREADNAME);
@@ -214,3 +307,21 @@ TEST(ThreadBaseClassTest, FailTests) {
 	ASSERT_FALSE(TestThreadBaseStub->healthCheck())<<
 	"TestThreadBaseStub healthCheck is false";
 }
+
+// compares the latency of producer wakeups against sleep polling
+TEST(ThreadBaseClassTest, WakeUpLatency) {
+	glass3::util::Logger::disable();
+
+	std::pair<double, double> sleepLatency = measureLatency(false);
+	std::pair<double, double> wakeLatency = measureLatency(true);
+
+	std::cout << "[ BENCH    ] sleep polling latency p50: "
+				<< sleepLatency.first << "us p99: " << sleepLatency.second
+				<< "us" << std::endl;
+	std::cout << "[ BENCH    ] wakeup latency p50: " << wakeLatency.first
+				<< "us p99: " << wakeLatency.second << "us" << std::endl;
+
+	// woken consumers don't wait out the sleep time
+	ASSERT_LT(wakeLatency.first, sleepLatency.first)<< "p50 latency";
+	ASSERT_LT(wakeLatency.first, LATENCYSLEEPTIME * 1000.0)<< "p50 bound";
+}
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include <threadpool.h>
+#include <atomic>
+#include <chrono>
 #include <thread>
 #include <mutex>
 #include <future>
@@ -13,6 +15,12 @@
 #define NUMTHREADS 5
 #define SLEEPTIME 100
 #define CHECKTIME 1
+#define NUMSTEALTHREADS 4
+#define NUMOUTERJOBS 8
+#define NUMINNERJOBS 100
+#define NUMBENCHTHREADS 16
+#define NUMBENCHPRODUCERS 4
+#define NUMBENCHJOBS 50000
 
 #define TESTJOB1RESULT 25
 int testjob1data = 0;
@@ -146,3 +154,74 @@ TEST(ThreadPoolTest, FailTests) {
 	ASSERT_TRUE(aThreadPool->healthCheck())<< "ThreadPool check is true";
 }
 
+
+// tests to see if jobs added by pool threads are run, stolen, and waited for
+TEST(ThreadPoolTest, WorkStealingTest) {
+	glass3::util::ThreadPool aThreadPool("stealpool", NUMSTEALTHREADS,
+											SLEEPTIME, -1);
+	std::atomic<int> count(0);
+
+	// each outer job adds its inner jobs to its own thread's queue, leaving
+	// the other threads to steal them
+	for (int i = 0; i < NUMOUTERJOBS; i++) {
+		aThreadPool.addJob([&aThreadPool, &count]() {
+			for (int j = 0; j < NUMINNERJOBS; j++) {
+				aThreadPool.addJob([&count]() {count++;});
+			}
+			count++;
+		});
+	}
+
+	aThreadPool.waitForIdle();
+	ASSERT_EQ(NUMOUTERJOBS * (NUMINNERJOBS + 1), count.load())<<
+	"all jobs run";
+	ASSERT_EQ(0, aThreadPool.getJobQueueSize())<< "queues empty";
+}
+
+// tests to see if a pool without running threads can be drained
+TEST(ThreadPoolTest, DrainTest) {
+	glass3::util::ThreadPool aThreadPool;
+	int count = 0;
+
+	for (int i = 0; i < NUMINNERJOBS; i++) {
+		aThreadPool.addJob([&count]() {count++;});
+	}
+	ASSERT_EQ(NUMINNERJOBS, aThreadPool.getJobQueueSize())<< "jobs queued";
+
+	aThreadPool.drain();
+	ASSERT_EQ(NUMINNERJOBS, count)<< "all jobs run by drain";
+	ASSERT_EQ(0, aThreadPool.getJobQueueSize())<< "queues empty";
+}
+
+// measures job throughput with several producers and many pool threads
+TEST(ThreadPoolTest, ThroughputBenchmark) {
+	glass3::util::ThreadPool aThreadPool("benchpool", NUMBENCHTHREADS, 1, -1);
+	std::atomic<int> count(0);
+
+	std::chrono::high_resolution_clock::time_point tStart =
+			std::chrono::high_resolution_clock::now();
+
+	std::vector<std::thread> producers;
+	for (int i = 0; i < NUMBENCHPRODUCERS; i++) {
+		producers.push_back(std::thread([&aThreadPool, &count]() {
+			for (int j = 0; j < NUMBENCHJOBS; j++) {
+				aThreadPool.addJob([&count]() {count++;});
+			}
+		}));
+	}
+	for (auto &producer : producers) {
+		producer.join();
+	}
+	aThreadPool.waitForIdle();
+
+	double seconds = std::chrono::duration<double>(
+			std::chrono::high_resolution_clock::now() - tStart).count();
+
+	std::cout << "[ BENCH    ] " << NUMBENCHPRODUCERS * NUMBENCHJOBS
+				<< " jobs, " << NUMBENCHTHREADS << " threads: "
+				<< (NUMBENCHPRODUCERS * NUMBENCHJOBS) / seconds << " jobs/s"
+				<< std::endl;
+
+	ASSERT_EQ(NUMBENCHPRODUCERS * NUMBENCHJOBS, count.load())<<
+	"all jobs run";
+}